@@ -0,0 +1,178 @@
+/**
+ * @file Bench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the measure and JSON report shared by the host benchmarks
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "Trace.h"
+#include "Det.h"
+#include <stdio.h>
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define BENCH_QUICK_DIVISOR (100U)  /* Iterations of a full run for one of a quick run */
+#define BENCH_PATH_MAX      (256U)  /* Longest path of the report */
+#define BENCH_NAME_MAX      (64U)   /* Longest name of a result */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    char name[BENCH_NAME_MAX];  /* Name of the result, copied so the caller can build the next one in place */
+    double value;               /* Value */
+    const char *unit;           /* Unit of the value */
+} Bench_Result_Types;           /* One result of the report */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static const char *benchSuite;                              /* Name of the benchmark */
+static char benchPath[BENCH_PATH_MAX];                      /* Path of the report */
+static uint8_t benchIsQuick;                                /* 1 for a quick run */
+static Bench_Result_Types benchResult[BENCH_RESULTS_MAX];   /* Results recorded */
+static uint32_t benchResultCount;                           /* Number of results recorded */
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to start a report from the arguments of the benchmark, "--quick" divides
+ *        the iterations by 100 for the tests and the other argument is the path of the report. The
+ *        simulator is reset, its cycle counter follows the host clock only with TRACE_ENABLE
+ *
+ * @param argc[in]: number of arguments
+ * @param argv[in]: arguments
+ * @param suite[in]: name of the benchmark, the report is suite.json by default
+ *
+ * @return void
+ */
+void benchInit(int argc, char **argv, const char *suite)
+{
+    benchSuite = suite;
+    benchIsQuick = 0;
+    benchResultCount = 0;
+    (void)snprintf(benchPath, sizeof(benchPath), "%s.json", suite);
+
+    for(int i = 1; i < argc; i++)
+    {
+        if(0 == strcmp(argv[i], "--quick"))
+        {
+            benchIsQuick = 1;
+        }
+        else
+        {
+            (void)snprintf(benchPath, sizeof(benchPath), "%s", argv[i]);
+        }
+    }
+
+    /* Reading the host clock costs more than most of the paths measured, it is only worth it for the
+       cycle counts of the trace points */
+    simReset();
+    simCycleModeSet((1 == TRACE_ENABLE) ? SIM_CYCLE_HOST : SIM_CYCLE_VIRTUAL);
+    traceInit();
+}
+
+/**
+ * @brief This function is used to scale a number of iterations to the mode of the run
+ *
+ * @param iterations[in]: iterations of a full run
+ *
+ * @return uint32_t: iterations to run, at least 1
+ */
+uint32_t benchIterations(uint32_t iterations)
+{
+    uint32_t count = (0 != benchIsQuick) ? (iterations / BENCH_QUICK_DIVISOR) : iterations;
+
+    return (0 != count) ? count : 1U;
+}
+
+/**
+ * @brief This function is used to add a result to the report and print it
+ *
+ * @param name[in]: name of the result, kept from release to release
+ * @param value[in]: value
+ * @param unit[in]: unit of the value
+ *
+ * @return void
+ */
+void benchRecord(const char *name, double value, const char *unit)
+{
+    if(benchResultCount < BENCH_RESULTS_MAX)
+    {
+        (void)snprintf(benchResult[benchResultCount].name, BENCH_NAME_MAX, "%s", name);
+        benchResult[benchResultCount].value = value;
+        benchResult[benchResultCount].unit = unit;
+        benchResultCount++;
+    }
+
+    (void)printf("%-40s %12.2f %s\n", name, value, unit);
+}
+
+/**
+ * @brief This function is used to write the report as JSON, with the trace points measured when the
+ *        drivers are built with TRACE_ENABLE
+ *
+ * @return int: exit status of the benchmark, 0 if the report is written
+ */
+int benchFinish(void)
+{
+    int status = 1;
+    FILE *pFile = fopen(benchPath, "w");
+
+    if(0 != pFile)
+    {
+        const char *separator = "";
+
+        (void)fprintf(pFile, "{\"suite\":\"%s\",\"config\":{\"trace\":%d,\"det\":%d,\"lto\":%d,\"quick\":%u},",
+                      benchSuite, TRACE_ENABLE, DET_ENABLE, BENCH_LTO, benchIsQuick);
+        (void)fprintf(pFile, "\"results\":[");
+
+        for(uint32_t i = 0; i < benchResultCount; i++)
+        {
+            (void)fprintf(pFile, "%s\n{\"name\":\"%s\",\"value\":%.3f,\"unit\":\"%s\"}",
+                          (0 != i) ? "," : "", benchResult[i].name, benchResult[i].value, benchResult[i].unit);
+        }
+
+        (void)fprintf(pFile, "],\n\"trace\":[");
+
+        for(uint32_t id = 0; id < TRACE_ID_COUNT; id++)
+        {
+            Trace_Stats_Types stats;
+            char line[TRACE_JSON_MAX];
+            uint32_t length;
+
+            if((TRACE_E_OK == traceRead((Trace_Id_Types)id, &stats)) && (0 != stats.count))
+            {
+                length = traceFormatJson((Trace_Id_Types)id, line, sizeof(line));
+
+                if(0 != length)
+                {
+                    line[length - 1U] = '\0';   /* Line feed */
+                    (void)fprintf(pFile, "%s\n%s", separator, line);
+                    separator = ",";
+                }
+            }
+        }
+
+        (void)fprintf(pFile, "]}\n");
+        status = (0 == fclose(pFile)) ? 0 : 1;
+        (void)printf("report written to %s\n", benchPath);
+    }
+    else
+    {
+        (void)printf("cannot write %s\n", benchPath);
+    }
+
+    return status;
+}
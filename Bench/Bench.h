@@ -0,0 +1,102 @@
+/**
+ * @file Bench.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the measure and JSON report shared by the host benchmarks
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef BENCH_H_
+#define BENCH_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Sim.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define BENCH_RESULTS_MAX   (128U)  /* Results of one report */
+
+#ifndef BENCH_REPEATS
+#define BENCH_REPEATS       (5U)    /* Runs of each measure, the fastest is reported */
+#endif
+
+#ifndef BENCH_LTO
+#define BENCH_LTO           (0)     /* 1 when the drivers are linked with link time optimization */
+#endif
+
+/* Time in ns of one operation, the fastest of BENCH_REPEATS runs of iterations executions of statement
+   doing ops operations each, the statement can use benchIteration */
+#define BENCH_MEASURE_OPS(name, iterations, ops, statement) do { \
+    uint32_t benchCount = benchIterations(iterations); \
+    uint64_t benchBest = UINT64_MAX; \
+    for(uint32_t benchRun = 0; benchRun < BENCH_REPEATS; benchRun++) \
+    { \
+        uint64_t benchStart = simHostNs(); \
+        for(uint32_t benchIteration = 0; benchIteration < benchCount; benchIteration++) \
+        { \
+            statement; \
+        } \
+        benchStart = simHostNs() - benchStart; \
+        benchBest = (benchStart < benchBest) ? benchStart : benchBest; \
+    } \
+    benchRecord((name), (double)benchBest / ((double)benchCount * (ops)), "ns"); } while(0)
+
+#define BENCH_MEASURE(name, iterations, statement)  BENCH_MEASURE_OPS(name, iterations, 1U, statement)
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name benchInit
+ *
+ * @brief This function is used to start a report from the arguments of the benchmark, "--quick" divides
+ *        the iterations by 100 for the tests and the other argument is the path of the report. The
+ *        simulator is reset, its cycle counter follows the host clock only with TRACE_ENABLE
+ *
+ * @param argc[in]: number of arguments
+ * @param argv[in]: arguments
+ * @param suite[in]: name of the benchmark, the report is suite.json by default
+ *
+ * @return void
+ */
+void benchInit(int argc, char **argv, const char *suite);
+
+/**
+ * @name benchIterations
+ *
+ * @brief This function is used to scale a number of iterations to the mode of the run
+ *
+ * @param iterations[in]: iterations of a full run
+ *
+ * @return uint32_t: iterations to run, at least 1
+ */
+uint32_t benchIterations(uint32_t iterations);
+
+/**
+ * @name benchRecord
+ *
+ * @brief This function is used to add a result to the report and print it
+ *
+ * @param name[in]: name of the result, kept from release to release
+ * @param value[in]: value
+ * @param unit[in]: unit of the value
+ *
+ * @return void
+ */
+void benchRecord(const char *name, double value, const char *unit);
+
+/**
+ * @name benchFinish
+ *
+ * @brief This function is used to write the report as JSON, with the trace points measured when the
+ *        drivers are built with TRACE_ENABLE
+ *
+ * @return int: exit status of the benchmark, 0 if the report is written
+ */
+int benchFinish(void);
+
+#endif /* BENCH_H_ */
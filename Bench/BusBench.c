@@ -0,0 +1,166 @@
+/**
+ * @file BusBench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host benchmark of the fan-out cost of the message bus against a copy to each subscriber
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * A message is taken from the pool, its payload written, published and delivered to 1 to 16 subscribers
+ * of BUS_TOPIC_LPUART_RX, each one reads its last byte. The copy measure gives each subscriber its own
+ * copy of the payload and calls it directly, as the single-slot callbacks would need.
+ * Usage:
+ *     BusBench [--quick] [report.json]
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "Bus.h"
+#include <stdio.h>
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define BUS_BENCH_ITERATIONS    (200000U)   /* Messages of each measure in a full run */
+#define BUS_BENCH_PAYLOAD_MAX   (256U)      /* Largest payload */
+#define BUS_BENCH_BLOCKS        (8U)        /* Blocks of the message pool */
+#define BUS_BENCH_BLOCK_SIZE    (sizeof(Std_Bus_Message_Types) + BUS_BENCH_PAYLOAD_MAX)    /* Bytes of a block */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Std_Pool_Types busBenchPool;                                             /* Pool of the messages */
+static uint32_t busBenchMemory[POOL_MEMORY_WORDS(BUS_BENCH_BLOCK_SIZE, BUS_BENCH_BLOCKS)];
+static uint8_t busBenchPayload[BUS_BENCH_PAYLOAD_MAX];                          /* Payload published */
+static uint8_t busBenchCopy[BUS_SUBSCRIBERS_MAX][BUS_BENCH_PAYLOAD_MAX];        /* Copy of each subscriber */
+static volatile uint32_t busBenchSum[BUS_SUBSCRIBERS_MAX];                      /* Bytes read by each subscriber */
+static void (*volatile busBenchCopyHandler)(const uint8_t *pData, uint32_t len, uint32_t index);   /* Called
+                                                                                   through a pointer as a callback */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to read the last byte of a message, as a subscriber of the bus
+ *
+ * @param pMessage[in]: message delivered
+ * @param arg[in]: number of the subscriber
+ *
+ * @return void
+ */
+static void busBenchHandler(Std_Bus_Message_Types *pMessage, void *arg)
+{
+    busBenchSum[(uintptr_t)arg] += BUS_PAYLOAD(pMessage)[pMessage->len - 1U];
+}
+
+/**
+ * @brief This function is used to read the last byte of a copy, as a subscriber given its own buffer
+ *
+ * @param pData[in]: copy of the payload
+ * @param len[in]: bytes of the copy
+ * @param index[in]: number of the subscriber
+ *
+ * @return void
+ */
+static void busBenchCopyRead(const uint8_t *pData, uint32_t len, uint32_t index)
+{
+    busBenchSum[index] += pData[len - 1U];
+}
+
+/**
+ * @brief This function is used to publish and deliver one message
+ *
+ * @param len[in]: bytes of payload
+ *
+ * @return void
+ */
+static void busBenchPublish(uint32_t len)
+{
+    Std_Bus_Message_Types *pMessage = busAlloc(BUS_TOPIC_LPUART_RX, 0U, len);
+
+    if(0 != pMessage)
+    {
+        (void)memcpy(BUS_PAYLOAD(pMessage), busBenchPayload, len);
+        (void)busPublish(pMessage);
+    }
+
+    (void)busDispatch();
+}
+
+/**
+ * @brief This function is used to measure the delivery of one payload size to a number of subscribers,
+ *        through the bus and by copy
+ *
+ * @param len[in]: bytes of payload
+ * @param nOfSubscribers[in]: subscribers of the topic
+ *
+ * @return uint8_t: 1 if every message reached every subscriber and the pool is whole afterwards
+ */
+static uint8_t busBenchFanout(uint32_t len, uint32_t nOfSubscribers)
+{
+    static char name[64];
+    Bus_Statistics_Types statistics;
+    Pool_Statistics_Types poolStatistics;
+
+    (void)busInit(&busBenchPool);
+
+    for(uint32_t i = 0; i < nOfSubscribers; i++)
+    {
+        (void)busSubscribe(BUS_TOPIC_LPUART_RX, busBenchHandler, (void *)(uintptr_t)i);
+    }
+
+    (void)snprintf(name, sizeof(name), "fanout_%u_%u", len, nOfSubscribers);
+    BENCH_MEASURE(name, BUS_BENCH_ITERATIONS, busBenchPublish(len));
+
+    (void)snprintf(name, sizeof(name), "copy_%u_%u", len, nOfSubscribers);
+    BENCH_MEASURE(name, BUS_BENCH_ITERATIONS,
+                  for(uint32_t i = 0; i < nOfSubscribers; i++)
+                  {
+                      (void)memcpy(busBenchCopy[i], busBenchPayload, len);
+                      busBenchCopyHandler(busBenchCopy[i], len, i);
+                  });
+
+    busGetStatistics(&statistics);
+    poolGetStatistics(&busBenchPool, &poolStatistics);
+
+    return ((0U == statistics.dropped) && (statistics.published == statistics.dispatched) &&
+            (statistics.handlerCalls == (statistics.dispatched * nOfSubscribers)) && (0U == poolStatistics.inUse)) ?
+           1U : 0U;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    static const uint32_t lens[3] = { 4U, 64U, 256U };
+    uint32_t nOfFailed = 0;
+
+    benchInit(argc, argv, "BusBench");
+    (void)poolInit(&busBenchPool, busBenchMemory, BUS_BENCH_BLOCK_SIZE, BUS_BENCH_BLOCKS);
+    busBenchCopyHandler = busBenchCopyRead;
+
+    for(uint32_t i = 0; i < BUS_BENCH_PAYLOAD_MAX; i++)
+    {
+        busBenchPayload[i] = (uint8_t)i;
+    }
+
+    for(uint32_t i = 0; i < 3U; i++)
+    {
+        for(uint32_t nOfSubscribers = 1U; nOfSubscribers <= BUS_SUBSCRIBERS_MAX; nOfSubscribers *= 2U)
+        {
+            nOfFailed += (0U != busBenchFanout(lens[i], nOfSubscribers)) ? 0U : 1U;
+        }
+    }
+
+    if(0U != nOfFailed)
+    {
+        (void)printf("%u fan-out measures lost messages or blocks\n", nOfFailed);
+        return 1;
+    }
+
+    return benchFinish();
+}
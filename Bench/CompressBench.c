@@ -0,0 +1,333 @@
+/**
+ * @file CompressBench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host benchmark of the compression ratio and time per byte of the streaming LZ compressor
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Two telemetry traces are generated: binary log frames as the Logger sends them and sensor text lines
+ * as NMEA. Each one is compressed in packets of 64 and 4096 bytes ended by compressFlush, through the Tx
+ * ring of LPUART0 drained by its interrupt handler. Only compressWrite and compressFlush are timed, next to
+ * LPUART_Send of the raw trace. The traces and the compressed streams are written as
+ * CompressBench_<trace>.bin and CompressBench_<trace>_<packet>.lz for Tools/Decompress.
+ * Usage:
+ *     CompressBench [--quick] [report.json]
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "Compress.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define COMPRESS_BENCH_PASSES       (20U)       /* Passes over each trace in a full run */
+#define COMPRESS_BENCH_TRACE_LEN    (32768U)    /* Bytes of a trace */
+#define COMPRESS_BENCH_CAPTURE_LEN  (COMPRESS_BENCH_TRACE_LEN * 2U)    /* Room for the compressed stream */
+#define COMPRESS_BENCH_LINE_MAX     (96U)       /* Longest frame or line of a trace */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef uint32_t (*CompressBench_Record_Types)(uint8_t *pRecord, uint32_t index);   /* Writes the record of
+                                                                                       a trace at an index */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t compressBenchRxArr[8];                           /* Rx ring of LPUART0 */
+static uint8_t compressBenchTxArr[255];                         /* Tx ring of LPUART0 */
+static uint8_t compressBenchTrace[COMPRESS_BENCH_TRACE_LEN];    /* Trace being compressed */
+static uint8_t compressBenchCapture[COMPRESS_BENCH_CAPTURE_LEN];   /* Bytes sent by LPUART0 */
+static uint32_t compressBenchCaptureLen;                        /* Number of bytes in the capture */
+static uint32_t compressBenchSeed;                              /* State of the noise generator */
+static Std_Compress_Types compressBenchComp;                    /* Compressor of LPUART0 */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to draw the noise of the sensor values
+ *
+ * @param span[in]: number of values
+ *
+ * @return uint32_t: value from 0 to span - 1
+ */
+static uint32_t compressBenchNoise(uint32_t span)
+{
+    compressBenchSeed = (compressBenchSeed * 1103515245U) + 12345U;
+
+    return (compressBenchSeed >> 16) % span;
+}
+
+/**
+ * @brief This function is used to write a binary log frame: sync, id, length, timestamp, arguments and
+ *        checksum
+ *
+ * @param pRecord[out]: frame
+ * @param index[in]: number of the frame in the trace
+ *
+ * @return uint32_t: bytes of the frame
+ */
+static uint32_t compressBenchLogFrame(uint8_t *pRecord, uint32_t index)
+{
+    uint32_t timestamp = (index * 1000U) + compressBenchNoise(16U);
+    uint32_t nOfArgs = 1U + (index % 3U);
+    uint32_t len = 0;
+    uint8_t sum = 0;
+
+    pRecord[len++] = 0xA5U;
+    pRecord[len++] = (uint8_t)(0x10U + (index % 5U));
+    pRecord[len++] = (uint8_t)(nOfArgs * 2U);
+
+    for(uint32_t i = 0; i < 4U; i++)
+    {
+        pRecord[len++] = (uint8_t)(timestamp >> (8U * i));
+    }
+
+    for(uint32_t i = 0; i < nOfArgs; i++)
+    {
+        uint32_t value = 2048U + (i * 300U) + compressBenchNoise(8U);
+
+        pRecord[len++] = (uint8_t)value;
+        pRecord[len++] = (uint8_t)(value >> 8);
+    }
+
+    for(uint32_t i = 0; i < len; i++)
+    {
+        sum = (uint8_t)(sum + pRecord[i]);
+    }
+
+    pRecord[len++] = sum;
+
+    return len;
+}
+
+/**
+ * @brief This function is used to write a sensor line, a position or an attitude sentence in turn
+ *
+ * @param pRecord[out]: line
+ * @param index[in]: number of the line in the trace
+ *
+ * @return uint32_t: bytes of the line
+ */
+static uint32_t compressBenchSensorLine(uint8_t *pRecord, uint32_t index)
+{
+    int len;
+
+    if(0U == (index & 1U))
+    {
+        len = snprintf((char *)pRecord, COMPRESS_BENCH_LINE_MAX,
+                       "$GPGGA,%02u%02u%02u.00,4807.%03u,N,01131.%03u,E,1,08,0.9,545.%u,M,46.9,M,,*%02X\r\n",
+                       12U, (index / 120U) % 60U, (index / 2U) % 60U, 38U + compressBenchNoise(4U),
+                       compressBenchNoise(4U), compressBenchNoise(10U), index & 0xFFU);
+    }
+    else
+    {
+        len = snprintf((char *)pRecord, COMPRESS_BENCH_LINE_MAX, "$IMU,%d,%d,%u,%u.%u\r\n",
+                       (int)compressBenchNoise(21U) - 10, (int)compressBenchNoise(21U) - 10,
+                       9800U + compressBenchNoise(8U), 24U, compressBenchNoise(10U));
+    }
+
+    return (uint32_t)len;
+}
+
+/**
+ * @brief This function is used to fill the trace with records, the last one is cut at the end of the trace
+ *
+ * @param record[in]: function writing the records
+ *
+ * @return void
+ */
+static void compressBenchTraceFill(CompressBench_Record_Types record)
+{
+    uint8_t line[COMPRESS_BENCH_LINE_MAX];
+    uint32_t len = 0;
+
+    compressBenchSeed = 12345U;
+
+    for(uint32_t index = 0; len < COMPRESS_BENCH_TRACE_LEN; index++)
+    {
+        uint32_t nOfBytes = record(line, index);
+
+        for(uint32_t i = 0; (i < nOfBytes) && (len < COMPRESS_BENCH_TRACE_LEN); i++)
+        {
+            compressBenchTrace[len++] = line[i];
+        }
+    }
+}
+
+/**
+ * @brief This function is used to let LPUART0 send what its Tx ring holds into the capture
+ *
+ * @return void
+ */
+static void compressBenchDrain(void)
+{
+    uint8_t data;
+
+    while(0 != simLpuartTransmit(LPUART0, &data))
+    {
+        if(compressBenchCaptureLen < COMPRESS_BENCH_CAPTURE_LEN)
+        {
+            compressBenchCapture[compressBenchCaptureLen++] = data;
+        }
+    }
+}
+
+/**
+ * @brief This function is used to send the trace in packets, compressed or raw, only the calls taking the
+ *        data are timed
+ *
+ * @param packet[in]: bytes of a packet, 0 to send the trace raw with LPUART_Send
+ *
+ * @return uint64_t: time in ns of the calls
+ */
+static uint64_t compressBenchSend(uint32_t packet)
+{
+    uint32_t step = (0U != packet) ? packet : sizeof(compressBenchTxArr);  /* Raw in pieces of the Tx ring */
+    uint64_t total = 0;
+
+    compressBenchCaptureLen = 0;
+    (void)compressInit(&compressBenchComp, LPUART0);
+
+    for(uint32_t offset = 0; offset < COMPRESS_BENCH_TRACE_LEN; offset += step)
+    {
+        uint32_t len = COMPRESS_BENCH_TRACE_LEN - offset;
+        uint32_t nOfTaken = 0;
+
+        len = (len > step) ? step : len;
+
+        while(nOfTaken < len)
+        {
+            uint64_t start = simHostNs();
+
+            nOfTaken += (0U != packet) ? compressWrite(&compressBenchComp, &compressBenchTrace[offset + nOfTaken],
+                                                       len - nOfTaken) :
+                                         LPUART_Send(LPUART0, &compressBenchTrace[offset + nOfTaken], len - nOfTaken);
+            total += simHostNs() - start;
+            compressBenchDrain();
+        }
+
+        if(0U != packet)
+        {
+            Std_Compress_Status status = COMPRESS_E_BUSY;
+
+            while(COMPRESS_E_BUSY == status)
+            {
+                uint64_t start = simHostNs();
+
+                status = compressFlush(&compressBenchComp);
+                total += simHostNs() - start;
+                compressBenchDrain();
+            }
+        }
+    }
+
+    return total;
+}
+
+/**
+ * @brief This function is used to write a buffer to a file
+ *
+ * @param pPath[in]: path of the file
+ * @param pData[in]: data
+ * @param len[in]: bytes of the data
+ *
+ * @return uint8_t: 1 if the file is written
+ */
+static uint8_t compressBenchWrite(const char *pPath, const uint8_t *pData, uint32_t len)
+{
+    FILE *pFile = fopen(pPath, "wb");
+    uint8_t isWritten = 0;
+
+    if(0 != pFile)
+    {
+        isWritten = (len == fwrite(pData, 1U, len, pFile)) ? 1U : 0U;
+        isWritten = (0 == fclose(pFile)) ? isWritten : 0U;
+    }
+
+    return isWritten;
+}
+
+/**
+ * @brief This function is used to measure one trace raw and compressed in each packet size, and to write
+ *        the trace and its compressed streams
+ *
+ * @param trace[in]: name of the trace
+ * @param record[in]: function writing its records
+ *
+ * @return uint8_t: 1 if the files are written
+ */
+static uint8_t compressBenchMeasure(const char *trace, CompressBench_Record_Types record)
+{
+    static const uint32_t packets[3] = { 0U, 64U, 4096U };
+    static char name[64];
+    uint8_t isWritten;
+
+    compressBenchTraceFill(record);
+    (void)snprintf(name, sizeof(name), "CompressBench_%s.bin", trace);
+    isWritten = compressBenchWrite(name, compressBenchTrace, COMPRESS_BENCH_TRACE_LEN);
+
+    for(uint32_t i = 0; i < 3U; i++)
+    {
+        uint32_t count = benchIterations(COMPRESS_BENCH_PASSES);
+        uint64_t best = UINT64_MAX;
+
+        for(uint32_t run = 0; run < BENCH_REPEATS; run++)
+        {
+            uint64_t total = 0;
+
+            for(uint32_t pass = 0; pass < count; pass++)
+            {
+                total += compressBenchSend(packets[i]);
+            }
+
+            best = (total < best) ? total : best;
+        }
+
+        if(0U == packets[i])
+        {
+            (void)snprintf(name, sizeof(name), "send_raw_%s", trace);
+            benchRecord(name, (double)best / ((double)count * COMPRESS_BENCH_TRACE_LEN), "ns");
+        }
+        else
+        {
+            (void)snprintf(name, sizeof(name), "compress_%s_%u", trace, packets[i]);
+            benchRecord(name, (double)best / ((double)count * COMPRESS_BENCH_TRACE_LEN), "ns");
+            (void)snprintf(name, sizeof(name), "ratio_%s_%u", trace, packets[i]);
+            benchRecord(name, (double)COMPRESS_BENCH_TRACE_LEN / compressBenchCaptureLen, "x");
+            (void)snprintf(name, sizeof(name), "CompressBench_%s_%u.lz", trace, packets[i]);
+            isWritten = compressBenchWrite(name, compressBenchCapture, compressBenchCaptureLen) ? isWritten : 0U;
+        }
+    }
+
+    return isWritten;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    uint8_t isWritten;
+
+    benchInit(argc, argv, "CompressBench");
+    (void)LPUART_BufferInit(LPUART0, compressBenchRxArr, sizeof(compressBenchRxArr), compressBenchTxArr,
+                            sizeof(compressBenchTxArr));
+
+    isWritten = compressBenchMeasure("logger", compressBenchLogFrame);
+    isWritten = compressBenchMeasure("sensor", compressBenchSensorLine) ? isWritten : 0U;
+
+    if(0U == isWritten)
+    {
+        (void)printf("The traces could not be written\n");
+        return 1;
+    }
+
+    return benchFinish();
+}
@@ -0,0 +1,119 @@
+/**
+ * @file CrcBench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host benchmark of the CRC engine variants against a bit by bit computation
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Built once for each value of CRC_SLICE_BY as CrcBench1, CrcBench4 and CrcBench8.
+ * Usage:
+ *     CrcBench<N> [--quick] [report.json]
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "s32k144_crc_driver.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define CRC_BENCH_ITERATIONS    (20000U)    /* Buffers processed by each measure in a full run */
+#define CRC_BENCH_LEN           (1024U)     /* Bytes of the buffer */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static volatile uint32_t crcBenchSink;      /* Keeps the results the measures do not use */
+static uint8_t crcBenchData[CRC_BENCH_LEN]; /* Data of the measures */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to compute CRC-16-CCITT bit by bit, as the packets were before the engine
+ *
+ * @param crc[in]: CRC of the previous data
+ * @param pData[in]: data
+ * @param len[in]: length of the data
+ *
+ * @return uint16_t: CRC
+ */
+static uint16_t crcBenchBitwise16(uint16_t crc, const uint8_t *pData, uint32_t len)
+{
+    for(uint32_t i = 0; i < len; i++)
+    {
+        crc ^= (uint16_t)(pData[i] << 8);
+
+        for(uint32_t bit = 0; bit < 8U; bit++)
+        {
+            crc = (0 != (crc & 0x8000U)) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief This function is used to compute the reflected CRC-32 bit by bit
+ *
+ * @param crc[in]: CRC of the previous data
+ * @param pData[in]: data
+ * @param len[in]: length of the data
+ *
+ * @return uint32_t: CRC
+ */
+static uint32_t crcBenchBitwise32(uint32_t crc, const uint8_t *pData, uint32_t len)
+{
+    for(uint32_t i = 0; i < len; i++)
+    {
+        crc ^= pData[i];
+
+        for(uint32_t bit = 0; bit < 8U; bit++)
+        {
+            crc = (0 != (crc & 1U)) ? ((crc >> 1) ^ 0xEDB88320U) : (crc >> 1);
+        }
+    }
+
+    return crc;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    static char suite[16];
+
+    (void)snprintf(suite, sizeof(suite), "CrcBench%d", CRC_SLICE_BY);
+    benchInit(argc, argv, suite);
+
+    for(uint32_t i = 0; i < CRC_BENCH_LEN; i++)
+    {
+        crcBenchData[i] = (uint8_t)((i * 131U) + (i >> 3));
+    }
+
+    /* The reference vectors and the bit by bit results must match before any figure is kept */
+    if((CRC_E_OK != CRC_SelfTest()) ||
+       (crcBenchBitwise16(0xFFFFU, crcBenchData, CRC_BENCH_LEN) != CRC16_Update(0xFFFFU, crcBenchData, CRC_BENCH_LEN)) ||
+       (crcBenchBitwise32(0xFFFFFFFFU, crcBenchData, CRC_BENCH_LEN) !=
+        CRC32_Update(0xFFFFFFFFU, crcBenchData, CRC_BENCH_LEN)))
+    {
+        (void)printf("CRC results do not match the reference\n");
+        return 1;
+    }
+
+    BENCH_MEASURE_OPS("crc16_bitwise", CRC_BENCH_ITERATIONS / 10U, CRC_BENCH_LEN,
+                      crcBenchSink = crcBenchBitwise16(0xFFFFU, crcBenchData, CRC_BENCH_LEN));
+    BENCH_MEASURE_OPS("crc16_update", CRC_BENCH_ITERATIONS, CRC_BENCH_LEN,
+                      crcBenchSink = CRC16_Update(0xFFFFU, crcBenchData, CRC_BENCH_LEN));
+    BENCH_MEASURE_OPS("crc32_bitwise", CRC_BENCH_ITERATIONS / 10U, CRC_BENCH_LEN,
+                      crcBenchSink = crcBenchBitwise32(0xFFFFFFFFU, crcBenchData, CRC_BENCH_LEN));
+    BENCH_MEASURE_OPS("crc32_update", CRC_BENCH_ITERATIONS, CRC_BENCH_LEN,
+                      crcBenchSink = CRC32_Update(0xFFFFFFFFU, crcBenchData, CRC_BENCH_LEN));
+
+    return benchFinish();
+}
@@ -0,0 +1,60 @@
+/**
+ * @file DetBench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host benchmark of the parameter checks compiled out by DET_ENABLE
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Built as DetBench against the development library and as DetBenchRelease against the one built with
+ * DET_ENABLE=0, the difference of the two reports is the time the checks cost per call.
+ * Usage:
+ *     DetBench [--quick] [report.json]
+ *     DetBenchRelease [--quick] [report.json]
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "s32k144_lpuart_driver.h"
+#include "s32k144_gpio_driver.h"
+#include "Det.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define DET_BENCH_ITERATIONS    (1000000U)  /* Executions of each call in a full run */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static volatile uint32_t detBenchSink;  /* Keeps the results the measures do not use */
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    LPUART_Handle_Type handle =
+    {
+        .pLPUARTx = LPUART1,
+        .LPUART_Config =
+        {
+            .frameLenth = LPUART_FRAME_8BITS,
+            .parityMode = LPUART_PARITY_DISABLE,
+            .nOfStopBits = LPUART_STOP_BITS_1,
+            .msbFirst = LPUART_LSB_FIRST,
+            .baudRate = 115200U,
+        },
+    };
+
+    benchInit(argc, argv, (1 == DET_ENABLE) ? "DetBench" : "DetBenchRelease");
+
+    /* TDRE stays set in the simulator, the wait of each frame ends at the first read */
+    BENCH_MEASURE("lpuart_tx_frame_7_8", DET_BENCH_ITERATIONS, detBenchSink = LPUART_TxFrame7_8(LPUART1, 0x55U));
+    BENCH_MEASURE("gpio_set_pin", DET_BENCH_ITERATIONS, detBenchSink = GPIO_SetPin(PTD, 0U));
+    BENCH_MEASURE("lpuart_init", DET_BENCH_ITERATIONS / 10U, detBenchSink = LPUART_Init(&handle));
+
+    return benchFinish();
+}
@@ -0,0 +1,168 @@
+/**
+ * @file DriverBench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host benchmark of the driver hot paths on the simulator
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Usage:
+ *     DriverBench [--quick] [report.json]
+ * The times are host nanoseconds, only their changes from release to release are meaningful.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "RingBuffer.h"
+#include "s32k144_lpuart_driver.h"
+#include "s32k144_gpio_driver.h"
+#include "s32k144_port_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define DRIVER_BENCH_ITERATIONS (1000000U)  /* Executions of the short paths in a full run */
+#define DRIVER_BENCH_PORT_PINS  (32U)       /* Pins configured by one PORT_Init measure */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static volatile uint32_t driverBenchSink;   /* Keeps the results the measures do not use */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used as the application handler of the port interrupts
+ *
+ * @return void
+ */
+static void driverBenchPortHandler(void)
+{
+    driverBenchSink++;
+}
+
+/**
+ * @brief This function is used to measure the push and pop of a ring
+ *
+ * @return void
+ */
+static void driverBenchQueue(void)
+{
+    static uint8_t arr[255];
+    Std_Queue_Types queue;
+
+    queueInit(&queue, arr, sizeof(arr));
+
+    BENCH_MEASURE("queue_push_pop", DRIVER_BENCH_ITERATIONS,
+                  queuePush(&queue, (uint8_t)benchIteration); driverBenchSink = queuePop(&queue));
+
+    /* Half full, so the indexes wrap during the measure */
+    for(uint32_t i = 0; i < (sizeof(arr) / 2U); i++)
+    {
+        queuePush(&queue, (uint8_t)i);
+    }
+
+    BENCH_MEASURE("queue_push_pop_half_full", DRIVER_BENCH_ITERATIONS,
+                  queuePush(&queue, (uint8_t)benchIteration); driverBenchSink = queuePop(&queue));
+}
+
+/**
+ * @brief This function is used to measure the search of the baudrate divisors
+ *
+ * @return void
+ */
+static void driverBenchBaudRate(void)
+{
+    BENCH_MEASURE("lpuart_baudrate_config_9600", DRIVER_BENCH_ITERATIONS / 10U,
+                  (void)LPUART_BaudRateConfig(LPUART0, 9600U));
+    BENCH_MEASURE("lpuart_baudrate_config_115200", DRIVER_BENCH_ITERATIONS / 10U,
+                  (void)LPUART_BaudRateConfig(LPUART0, 115200U));
+    BENCH_MEASURE("lpuart_baudrate_config_1000000", DRIVER_BENCH_ITERATIONS / 10U,
+                  (void)LPUART_BaudRateConfig(LPUART0, 1000000U));
+}
+
+/**
+ * @brief This function is used to measure the pin accesses, each one is a single write of PSOR, PCOR or
+ *        PTOR so the time is the call and the checks around the store
+ *
+ * @return void
+ */
+static void driverBenchGpio(void)
+{
+    BENCH_MEASURE("gpio_toggle_pin", DRIVER_BENCH_ITERATIONS, (void)GPIO_TogglePin(PTD, 15U));
+    BENCH_MEASURE("gpio_set_pin", DRIVER_BENCH_ITERATIONS, (void)GPIO_SetPin(PTD, 15U));
+    BENCH_MEASURE("gpio_clear_pin", DRIVER_BENCH_ITERATIONS, (void)GPIO_ClearPin(PTD, 15U));
+    BENCH_MEASURE("gpio_read_pin", DRIVER_BENCH_ITERATIONS, driverBenchSink = GPIO_ReadPin(PTD, 15U));
+}
+
+/**
+ * @brief This function is used to measure the configuration of the pins of a port, the result is the time
+ *        of one pin
+ *
+ * @return void
+ */
+static void driverBenchPort(void)
+{
+    PORT_Config_t config = {0, PORT_MUX_GPIO, PORT_PIN_PULL_DISABLE, PORT_PIN_PULLDOWN, PORT_IRQ_MODE_DISABLED};
+    uint32_t count = DRIVER_BENCH_ITERATIONS / DRIVER_BENCH_PORT_PINS;
+
+    BENCH_MEASURE_OPS("port_init_per_pin", count, DRIVER_BENCH_PORT_PINS,
+                      for(config.pin = 0; config.pin < DRIVER_BENCH_PORT_PINS; config.pin++)
+                      {
+                          (void)PORT_Init(PORTC, &config);
+                      });
+
+    config.pull_enable = PORT_PIN_PULL_ENABLE;
+    config.pull_select = PORT_PIN_PULLUP;
+    config.irq_mode = PORT_IRQ_MODE_FALLING_EDGE_INT;
+
+    BENCH_MEASURE_OPS("port_init_per_pin_pull_irq", count, DRIVER_BENCH_PORT_PINS,
+                      for(config.pin = 0; config.pin < DRIVER_BENCH_PORT_PINS; config.pin++)
+                      {
+                          (void)PORT_Init(PORTC, &config);
+                      });
+}
+
+/**
+ * @brief This function is used to measure the interrupt handlers called through the vector table
+ *
+ * @return void
+ */
+static void driverBenchIsr(void)
+{
+    static uint8_t rxArr[255];
+    static uint8_t txArr[255];
+    uint8_t data = 0x55U;
+
+    (void)Register_InterruptHandler(PORTA, driverBenchPortHandler);
+    BENCH_MEASURE("isr_port_dispatch", DRIVER_BENCH_ITERATIONS, simIrq(PORTA_IRQn));
+
+    (void)LPUART_BufferInit(LPUART0, rxArr, sizeof(rxArr), txArr, sizeof(txArr));
+    BENCH_MEASURE("isr_lpuart_rx_byte", DRIVER_BENCH_ITERATIONS,
+                  simLpuartReceive(LPUART0, data); driverBenchSink = LPUART_RxConsume(LPUART0, 1U));
+
+    /* One interrupt writes the byte, the next one finds the ring empty and stops the Tx interrupt */
+    BENCH_MEASURE("isr_lpuart_tx_byte", DRIVER_BENCH_ITERATIONS,
+                  driverBenchSink = LPUART_Send(LPUART0, &data, 1U);
+                  driverBenchSink = simLpuartTransmit(LPUART0, &data);
+                  driverBenchSink = simLpuartTransmit(LPUART0, &data));
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    benchInit(argc, argv, "DriverBench");
+
+    driverBenchQueue();
+    driverBenchBaudRate();
+    driverBenchGpio();
+    driverBenchPort();
+    driverBenchIsr();
+
+    return benchFinish();
+}
@@ -0,0 +1,119 @@
+/**
+ * @file LoggerBench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host benchmark of the deferred log calls
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Only the log calls are timed, the ring is drained over LPUART0 between the batches. On the target the
+ * cycles of logRecord are the TRACE_ID_LOG_RECORD point of a TRACE_ENABLE build.
+ * Usage:
+ *     LoggerBench [--quick] [report.json]
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "Logger.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LOGGER_BENCH_ITERATIONS (1000000U)  /* Log calls of each measure in a full run */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t loggerBenchRxArr[8];     /* Rx ring of LPUART0, not used */
+static uint8_t loggerBenchTxArr[255];   /* Tx ring of LPUART0 */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to send every recorded message and empty the transmitter
+ *
+ * @return void
+ */
+static void loggerBenchDrain(void)
+{
+    uint32_t nOfMessages;
+    uint8_t data;
+
+    do
+    {
+        nOfMessages = logDrain();
+
+        while(0 != simLpuartTransmit(LPUART0, &data))
+        {
+            /* Next character */
+        }
+    } while(0 != nOfMessages);
+}
+
+/**
+ * @brief This function is used to measure the log calls with a number of arguments, a batch fills the
+ *        ring and is drained before the next one
+ *
+ * @param name[in]: name of the result
+ * @param nOfArgs[in]: number of arguments of the message
+ *
+ * @return void
+ */
+static void loggerBenchRecord(const char *name, uint8_t nOfArgs)
+{
+    uint32_t nOfBatches = (benchIterations(LOGGER_BENCH_ITERATIONS) / LOG_RING_SIZE) + 1U;
+    uint64_t best = UINT64_MAX;
+
+    for(uint32_t run = 0; run < BENCH_REPEATS; run++)
+    {
+        uint64_t total = 0;
+
+        for(uint32_t batch = 0; batch < nOfBatches; batch++)
+        {
+            uint64_t start = simHostNs();
+
+            for(uint32_t i = 0; i < LOG_RING_SIZE; i++)
+            {
+                logRecord(LOG_ID_GPIO_EDGE, nOfArgs, i, batch, run, 0U);
+            }
+
+            total += simHostNs() - start;
+            loggerBenchDrain();
+        }
+
+        best = (total < best) ? total : best;
+    }
+
+    benchRecord(name, (double)best / ((double)nOfBatches * LOG_RING_SIZE), "ns");
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    benchInit(argc, argv, "LoggerBench");
+
+    (void)LPUART_BufferInit(LPUART0, loggerBenchRxArr, sizeof(loggerBenchRxArr),
+                            loggerBenchTxArr, sizeof(loggerBenchTxArr));
+    logInit(LPUART0);
+
+    loggerBenchRecord("log_record_0_args", 0U);
+    loggerBenchRecord("log_record_2_args", 2U);
+    loggerBenchRecord("log_record_4_args", 4U);
+
+    /* A full ring only counts the loss */
+    for(uint32_t i = 0; i < LOG_RING_SIZE; i++)
+    {
+        LOG_0(LOG_ID_BOOT);
+    }
+
+    BENCH_MEASURE("log_record_ring_full", LOGGER_BENCH_ITERATIONS, LOG_2(LOG_ID_GPIO_EDGE, benchIteration, 0U));
+    benchRecord("log_dropped", (double)logGetDropped(), "messages");
+    loggerBenchDrain();
+
+    return benchFinish();
+}
@@ -0,0 +1,345 @@
+/**
+ * @file PoolBench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host stress benchmark of the fixed-block pools against malloc and against a copy-based hand-off
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The stress part runs POOL_BENCH_THREADS threads on one small pool, each one takes a few blocks, stamps
+ * every word, checks them and gives them back, the pool runs empty often. The hand-off part sends
+ * messages from the main thread to a consumer thread through a ring: pool blocks or malloc buffers passed by
+ * pointer, or the bytes copied into the ring and out again. The threads only yield, as the tasks and the
+ * interrupts of the target would share one core.
+ * Usage:
+ *     PoolBench [--quick] [report.json]
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "Pool.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define POOL_BENCH_ITERATIONS       (200000U)   /* Operations of each measure in a full run */
+#define POOL_BENCH_THREADS          (4U)        /* Threads of the stress part */
+#define POOL_BENCH_STRESS_BLOCKS    (24U)       /* Blocks of the stress pool, fewer than the threads can hold */
+#define POOL_BENCH_STRESS_HOLD      (8U)        /* Blocks a stress thread takes at once */
+#define POOL_BENCH_STRESS_WORDS     (16U)       /* Words of a stress block */
+#define POOL_BENCH_RING_SIZE        (64U)       /* Messages in flight between the threads */
+#define POOL_BENCH_SIZE_MAX         (1024U)     /* Largest message */
+#define POOL_BENCH_BLOCKS           (POOL_BENCH_RING_SIZE + 4U)     /* Blocks of the hand-off pool */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    POOL_BENCH_POOL,        /* Pool blocks passed by pointer */
+    POOL_BENCH_MALLOC,      /* malloc buffers passed by pointer */
+    POOL_BENCH_COPY,        /* Bytes copied into the ring and out of it */
+} PoolBench_Mode_Types;     /* Way the messages are handed off */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static void *volatile poolBenchSink;                    /* Keeps the blocks the measures do not use */
+static Std_Pool_Types poolBenchStressPool;              /* Pool shared by the stress threads */
+static uint32_t poolBenchStressMemory[POOL_MEMORY_WORDS(POOL_BENCH_STRESS_WORDS * 4U, POOL_BENCH_STRESS_BLOCKS)];
+static atomic_uint_fast32_t poolBenchStressAllocs;      /* Blocks the stress threads got */
+static atomic_uint_fast32_t poolBenchStressErrors;      /* Stamps overwritten by another thread */
+static Std_Pool_Types poolBenchPool;                    /* Pool of the hand-off */
+static uint32_t poolBenchMemory[POOL_MEMORY_WORDS(POOL_BENCH_SIZE_MAX, POOL_BENCH_BLOCKS)];
+static uint8_t *poolBenchRing[POOL_BENCH_RING_SIZE];    /* Messages passed by pointer */
+static uint8_t poolBenchSlot[POOL_BENCH_RING_SIZE][POOL_BENCH_SIZE_MAX];   /* Messages passed by copy */
+static atomic_uint_fast32_t poolBenchHead;              /* Messages sent, written by the producer */
+static atomic_uint_fast32_t poolBenchTail;              /* Messages received, written by the consumer */
+static PoolBench_Mode_Types poolBenchMode;              /* Way the messages are handed off */
+static uint32_t poolBenchSize;                          /* Bytes of a message */
+static uint32_t poolBenchCount;                         /* Messages of a run */
+static uint32_t poolBenchErrors;                        /* Messages received wrong */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to run one stress thread: take blocks, stamp them, check them and give
+ *        them back
+ *
+ * @param pArg[in]: number of the thread
+ *
+ * @return void*: 0
+ */
+static void *poolBenchStressThread(void *pArg)
+{
+    uint32_t id = (uint32_t)(uintptr_t)pArg;
+    uint32_t *pBlocks[POOL_BENCH_STRESS_HOLD];
+
+    for(uint32_t i = 0; i < benchIterations(POOL_BENCH_ITERATIONS / 10U); i++)
+    {
+        uint32_t nOfHeld = 0;
+        uint32_t stamp = (id << 24) | (i & 0xFFFFFFU);
+
+        for(uint32_t j = 0; j < POOL_BENCH_STRESS_HOLD; j++)
+        {
+            uint32_t *pBlock = poolAlloc(&poolBenchStressPool);
+
+            if(0 != pBlock)
+            {
+                for(uint32_t k = 0; k < POOL_BENCH_STRESS_WORDS; k++)
+                {
+                    pBlock[k] = stamp;
+                }
+
+                pBlocks[nOfHeld++] = pBlock;
+            }
+        }
+
+        (void)atomic_fetch_add(&poolBenchStressAllocs, nOfHeld);
+
+        /* Let the other threads run while the blocks are held */
+        (void)sched_yield();
+
+        for(uint32_t j = 0; j < nOfHeld; j++)
+        {
+            for(uint32_t k = 0; k < POOL_BENCH_STRESS_WORDS; k++)
+            {
+                if(stamp != pBlocks[j][k])
+                {
+                    (void)atomic_fetch_add(&poolBenchStressErrors, 1U);
+                }
+            }
+
+            (void)poolFree(&poolBenchStressPool, pBlocks[j]);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief This function is used to run the stress threads and check the pool is whole afterwards
+ *
+ * @return uint8_t: 1 if no block was shared or lost
+ */
+static uint8_t poolBenchStress(void)
+{
+    pthread_t threads[POOL_BENCH_THREADS];
+    Pool_Statistics_Types statistics;
+
+    (void)poolInit(&poolBenchStressPool, poolBenchStressMemory, POOL_BENCH_STRESS_WORDS * 4U,
+                   POOL_BENCH_STRESS_BLOCKS);
+
+    for(uint32_t i = 0; i < POOL_BENCH_THREADS; i++)
+    {
+        (void)pthread_create(&threads[i], 0, poolBenchStressThread, (void *)(uintptr_t)i);
+    }
+
+    for(uint32_t i = 0; i < POOL_BENCH_THREADS; i++)
+    {
+        (void)pthread_join(threads[i], 0);
+    }
+
+    poolGetStatistics(&poolBenchStressPool, &statistics);
+    (void)printf("stress: %u threads, %u blocks taken, %u refused, %u overwritten, %u in use, high water %u\n",
+                 POOL_BENCH_THREADS, (uint32_t)atomic_load(&poolBenchStressAllocs), statistics.failures,
+                 (uint32_t)atomic_load(&poolBenchStressErrors), statistics.inUse, statistics.highWater);
+
+    return ((0U == atomic_load(&poolBenchStressErrors)) && (0U == statistics.inUse) &&
+            (atomic_load(&poolBenchStressAllocs) == statistics.allocs) &&
+            (POOL_BENCH_STRESS_BLOCKS >= statistics.highWater)) ? 1U : 0U;
+}
+
+/**
+ * @brief This function is used to receive the messages of a run and check each one
+ *
+ * @param pArg[in]: not used
+ *
+ * @return void*: 0
+ */
+static void *poolBenchConsumer(void *pArg)
+{
+    static uint8_t message[POOL_BENCH_SIZE_MAX];
+    uint32_t tail = 0;
+
+    (void)pArg;
+
+    while(tail < poolBenchCount)
+    {
+        uint8_t *pMessage;
+
+        while(tail == atomic_load_explicit(&poolBenchHead, memory_order_acquire))
+        {
+            (void)sched_yield();
+        }
+
+        if(POOL_BENCH_COPY == poolBenchMode)
+        {
+            (void)memcpy(message, poolBenchSlot[tail % POOL_BENCH_RING_SIZE], poolBenchSize);
+            pMessage = message;
+        }
+        else
+        {
+            pMessage = poolBenchRing[tail % POOL_BENCH_RING_SIZE];
+        }
+
+        if((pMessage[0] != (uint8_t)tail) || (pMessage[poolBenchSize - 1U] != (uint8_t)tail))
+        {
+            poolBenchErrors++;
+        }
+
+        if(POOL_BENCH_POOL == poolBenchMode)
+        {
+            (void)poolFree(&poolBenchPool, pMessage);
+        }
+        else if(POOL_BENCH_MALLOC == poolBenchMode)
+        {
+            free(pMessage);
+        }
+        else
+        {
+            /* The slot is free once it is copied */
+        }
+
+        tail++;
+        atomic_store_explicit(&poolBenchTail, tail, memory_order_release);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief This function is used to send the messages of a run to the consumer thread
+ *
+ * @return uint64_t: time in ns from the first message sent to the last one received
+ */
+static uint64_t poolBenchHandOff(void)
+{
+    static uint8_t message[POOL_BENCH_SIZE_MAX];
+    pthread_t consumer;
+    uint64_t start;
+
+    atomic_store(&poolBenchHead, 0U);
+    atomic_store(&poolBenchTail, 0U);
+    (void)pthread_create(&consumer, 0, poolBenchConsumer, 0);
+    start = simHostNs();
+
+    for(uint32_t head = 0; head < poolBenchCount; head++)
+    {
+        uint8_t *pMessage = 0;
+
+        while((head - atomic_load_explicit(&poolBenchTail, memory_order_acquire)) >= POOL_BENCH_RING_SIZE)
+        {
+            (void)sched_yield();
+        }
+
+        if(POOL_BENCH_POOL == poolBenchMode)
+        {
+            while(0 == (pMessage = poolAlloc(&poolBenchPool)))
+            {
+                (void)sched_yield();
+            }
+        }
+        else if(POOL_BENCH_MALLOC == poolBenchMode)
+        {
+            pMessage = malloc(poolBenchSize);
+        }
+        else
+        {
+            pMessage = message;
+        }
+
+        /* The message is built where it is, then passed by pointer or copied */
+        (void)memset(pMessage, (int)(uint8_t)head, poolBenchSize);
+
+        if(POOL_BENCH_COPY == poolBenchMode)
+        {
+            (void)memcpy(poolBenchSlot[head % POOL_BENCH_RING_SIZE], pMessage, poolBenchSize);
+        }
+        else
+        {
+            poolBenchRing[head % POOL_BENCH_RING_SIZE] = pMessage;
+        }
+
+        atomic_store_explicit(&poolBenchHead, head + 1U, memory_order_release);
+    }
+
+    (void)pthread_join(consumer, 0);
+
+    return simHostNs() - start;
+}
+
+/**
+ * @brief This function is used to measure the hand-off of messages of one size in each mode
+ *
+ * @param size[in]: bytes of a message
+ *
+ * @return void
+ */
+static void poolBenchMeasure(uint32_t size)
+{
+    static const char *const modes[3] = { "pool", "malloc", "copy" };
+    static char name[64];
+
+    poolBenchSize = size;
+    poolBenchCount = benchIterations(POOL_BENCH_ITERATIONS);
+
+    for(uint32_t mode = POOL_BENCH_POOL; mode <= POOL_BENCH_COPY; mode++)
+    {
+        uint64_t best = UINT64_MAX;
+
+        poolBenchMode = (PoolBench_Mode_Types)mode;
+
+        for(uint32_t run = 0; run < BENCH_REPEATS; run++)
+        {
+            uint64_t time = poolBenchHandOff();
+
+            best = (time < best) ? time : best;
+        }
+
+        (void)snprintf(name, sizeof(name), "handoff_%s_%u", modes[mode], size);
+        benchRecord(name, (double)best / poolBenchCount, "ns");
+    }
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    Pool_Statistics_Types statistics;
+    uint8_t isWhole;
+
+    benchInit(argc, argv, "PoolBench");
+    isWhole = poolBenchStress();
+
+    (void)poolInit(&poolBenchPool, poolBenchMemory, POOL_BENCH_SIZE_MAX, POOL_BENCH_BLOCKS);
+    poolBenchMeasure(64U);
+    poolBenchMeasure(256U);
+    poolBenchMeasure(1024U);
+
+    BENCH_MEASURE("alloc_free_pool", POOL_BENCH_ITERATIONS,
+                  poolBenchSink = poolAlloc(&poolBenchPool);
+                  (void)poolFree(&poolBenchPool, poolBenchSink));
+    BENCH_MEASURE("alloc_free_malloc", POOL_BENCH_ITERATIONS,
+                  poolBenchSink = malloc(POOL_BENCH_SIZE_MAX);
+                  free(poolBenchSink));
+
+    poolGetStatistics(&poolBenchPool, &statistics);
+
+    if((0U == isWhole) || (0U != poolBenchErrors) || (0U != statistics.inUse))
+    {
+        (void)printf("The pools lost or shared blocks, %u messages were received wrong\n", poolBenchErrors);
+        return 1;
+    }
+
+    return benchFinish();
+}
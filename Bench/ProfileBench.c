@@ -0,0 +1,113 @@
+/**
+ * @file ProfileBench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host benchmark of a switch between two LPUART profiles, with LPUART_ProfileApply and with
+ *        LPUART_DeInit followed by LPUART_Init
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * LPUART1 alternates between 9600 8E1 and 115200 8N1. The write of STAT by LPUART_ProfileApply clears
+ * TDRE and TC in the plain memory of the simulator, the hardware keeps these read only flags, so they are
+ * set again after each switch as the idle transmitter would show them.
+ * Usage:
+ *     ProfileBench [--quick] [report.json]
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "s32k144_lpuart_driver.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define PROFILE_BENCH_ITERATIONS    (200000U)   /* Switches of each measure in a full run */
+#define PROFILE_BENCH_TX_IDLE       (LPUART_STAT_TDRE_MASK | LPUART_STAT_TC_MASK)   /* Flags of the idle
+                                                                                       transmitter */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static volatile uint32_t profileBenchSink;  /* Keeps the results the measures do not use */
+static uint32_t profileBenchRefused;        /* Switches LPUART_ProfileApply refused */
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    LPUART_Handle_Type handles[2] =
+    {
+        {
+            .pLPUARTx = LPUART1,
+            .LPUART_Config =
+            {
+                .frameLenth = LPUART_FRAME_8BITS,
+                .parityMode = LPUART_PARITY_EVEN,
+                .nOfStopBits = LPUART_STOP_BITS_1,
+                .msbFirst = LPUART_LSB_FIRST,
+                .baudRate = 9600U,
+            },
+        },
+        {
+            .pLPUARTx = LPUART1,
+            .LPUART_Config =
+            {
+                .frameLenth = LPUART_FRAME_8BITS,
+                .parityMode = LPUART_PARITY_DISABLE,
+                .nOfStopBits = LPUART_STOP_BITS_1,
+                .msbFirst = LPUART_LSB_FIRST,
+                .baudRate = 115200U,
+            },
+        },
+    };
+    LPUART_Profile_Type profiles[2];
+
+    benchInit(argc, argv, "ProfileBench");
+    LPUART1->STAT = PROFILE_BENCH_TX_IDLE;
+
+    /* The registers a profile gives must be the ones LPUART_Init gives before any figure is kept */
+    for(uint32_t i = 0; i < 2U; i++)
+    {
+        uint32_t baud;
+        uint32_t ctrl;
+
+        (void)LPUART_Init(&handles[i]);
+        baud = LPUART1->BAUD;
+        ctrl = LPUART1->CTRL;
+        (void)LPUART_Init(&handles[1U - i]);
+        LPUART1->STAT |= PROFILE_BENCH_TX_IDLE;
+
+        if((LPUART_E_OK != LPUART_ProfileCompile(&handles[i], &profiles[i])) ||
+           (LPUART_E_OK != LPUART_ProfileApply(LPUART1, &profiles[i])) || (baud != LPUART1->BAUD) ||
+           (ctrl != LPUART1->CTRL))
+        {
+            (void)printf("Profile %u does not match LPUART_Init\n", i);
+            return 1;
+        }
+    }
+
+    BENCH_MEASURE("switch_deinit_init", PROFILE_BENCH_ITERATIONS / 10U,
+                  profileBenchSink = LPUART_DeInit(LPUART1);
+                  profileBenchSink = LPUART_Init(&handles[benchIteration & 1U]));
+
+    LPUART1->STAT |= PROFILE_BENCH_TX_IDLE;
+    BENCH_MEASURE("switch_profile_apply", PROFILE_BENCH_ITERATIONS,
+                  profileBenchRefused += (LPUART_E_OK != LPUART_ProfileApply(LPUART1, &profiles[benchIteration & 1U])) ?
+                                         1U : 0U;
+                  LPUART1->STAT |= PROFILE_BENCH_TX_IDLE);
+
+    if(0U != profileBenchRefused)
+    {
+        (void)printf("%u profile switches were refused\n", profileBenchRefused);
+        return 1;
+    }
+
+    BENCH_MEASURE("profile_compile", PROFILE_BENCH_ITERATIONS / 10U,
+                  profileBenchSink = LPUART_ProfileCompile(&handles[benchIteration & 1U], &profiles[0]));
+
+    return benchFinish();
+}
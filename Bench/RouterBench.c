@@ -0,0 +1,242 @@
+/**
+ * @file RouterBench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host benchmark of the forwarding throughput, latency and fairness of the router
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * LPUART0 and LPUART1 are routed to LPUART2, as the bridge product does. The bytes are received and sent
+ * by the interrupt handlers of the drivers, called through the simulator.
+ * Usage:
+ *     RouterBench [--quick] [report.json]
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "Router.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define ROUTER_BENCH_ITERATIONS (200000U)   /* Turns of each measure in a full run */
+#define ROUTER_BENCH_FRAME_LEN  (16U)       /* Bytes of a frame, delimiter included */
+#define ROUTER_BENCH_DRAIN_LEN  (8U)        /* Bytes LPUART2 sends per turn in the fairness measure */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static volatile uint32_t routerBenchSink;   /* Keeps the results the measures do not use */
+static uint8_t routerBenchRxArr[3][255];    /* Rx ring of each instance */
+static uint8_t routerBenchTxArr[3][255];    /* Tx ring of each instance */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to receive data on an instance, its last byte is the delimiter '\n'
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param len[in]: number of bytes
+ *
+ * @return void
+ */
+static void routerBenchReceive(LPUART_Type *pLPUARTx, uint32_t len)
+{
+    for(uint32_t i = 1; i < len; i++)
+    {
+        simLpuartReceive(pLPUARTx, (uint8_t)('a' + i));
+    }
+
+    simLpuartReceive(pLPUARTx, (uint8_t)'\n');
+}
+
+/**
+ * @brief This function is used to let the transmitter of an instance send up to a number of bytes
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param maxLen[in]: maximum number of bytes
+ *
+ * @return uint32_t: number of bytes sent
+ */
+static uint32_t routerBenchDrain(LPUART_Type *pLPUARTx, uint32_t maxLen)
+{
+    uint32_t len = 0;
+    uint8_t data;
+
+    while((len < maxLen) && (0 != simLpuartTransmit(pLPUARTx, &data)))
+    {
+        len++;
+    }
+
+    return len;
+}
+
+/**
+ * @brief This function is used to measure the turns of the router forwarding the data received on an
+ *        instance, only routerPoll is timed
+ *
+ * @param name[in]: name of the result
+ * @param router[in/out]: pointer to the router
+ * @param pSource[in/out]: instance receiving the data
+ * @param len[in]: number of bytes received before each turn
+ * @param ops[in]: operations done by each turn
+ *
+ * @return void
+ */
+static void routerBenchPoll(const char *name, Std_Router_Types *router, LPUART_Type *pSource, uint32_t len,
+                            uint32_t ops)
+{
+    uint32_t count = benchIterations(ROUTER_BENCH_ITERATIONS);
+    uint64_t best = UINT64_MAX;
+
+    for(uint32_t run = 0; run < BENCH_REPEATS; run++)
+    {
+        uint64_t total = 0;
+
+        for(uint32_t i = 0; i < count; i++)
+        {
+            uint64_t start;
+
+            routerBenchReceive(pSource, len);
+            start = simHostNs();
+            routerBenchSink = routerPoll(router);
+            total += simHostNs() - start;
+            routerBenchSink = routerBenchDrain(LPUART2, UINT32_MAX);
+        }
+
+        best = (total < best) ? total : best;
+    }
+
+    benchRecord(name, (double)best / ((double)count * ops), "ns");
+}
+
+/**
+ * @brief This function is used to measure the share of LPUART2 each of two routes gets, both sources
+ *        always have data waiting and LPUART2 sends fewer bytes per turn than they receive. The share of a
+ *        frame route is counted in frames, the one of a stream route in bytes
+ *
+ * @param name[in]: name of the results, followed by the number of the source instance
+ * @param routes[in/out]: two routes from LPUART0 and LPUART1 to LPUART2
+ *
+ * @return void
+ */
+static void routerBenchShare(const char *name, Std_Router_Route_Types *routes)
+{
+    static char names[2][64];
+    Std_Router_Types router;
+    uint32_t count[2];
+
+    (void)routerInit(&router, routes, 2U);
+
+    for(uint32_t i = 0; i < benchIterations(ROUTER_BENCH_ITERATIONS); i++)
+    {
+        if(LPUART_GetRxFree(LPUART0) >= ROUTER_BENCH_FRAME_LEN)
+        {
+            routerBenchReceive(LPUART0, ROUTER_BENCH_FRAME_LEN);
+        }
+
+        if(LPUART_GetRxFree(LPUART1) >= (ROUTER_BENCH_FRAME_LEN / 2U))
+        {
+            routerBenchReceive(LPUART1, ROUTER_BENCH_FRAME_LEN / 2U);
+        }
+
+        routerBenchSink = routerPoll(&router);
+        routerBenchSink = routerBenchDrain(LPUART2, ROUTER_BENCH_DRAIN_LEN);
+    }
+
+    for(uint32_t i = 0; i < 2U; i++)
+    {
+        count[i] = (ROUTER_NO_DELIMITER == routes[i].delimiter) ? routes[i].stats.bytes : routes[i].stats.frames;
+    }
+
+    for(uint32_t i = 0; i < 2U; i++)
+    {
+        (void)snprintf(names[i], sizeof(names[i]), "%s%u", name, i);
+        benchRecord(names[i], (100.0 * count[i]) / (((count[0] + count[1]) != 0U) ? (count[0] + count[1]) : 1U),
+                    "%");
+    }
+
+    /* Empty the rings for the next measure */
+    while(0 != routerPoll(&router))
+    {
+        routerBenchSink = routerBenchDrain(LPUART2, UINT32_MAX);
+    }
+
+    routerBenchSink = routerBenchDrain(LPUART2, UINT32_MAX);
+}
+
+/**
+ * @brief This function is used to measure the bridge written before the router, one byte at a time with
+ *        the blocking receive and send of the driver
+ *
+ * @return void
+ */
+static void routerBenchByteLoop(void)
+{
+    uint8_t data = 0;
+
+    BENCH_MEASURE("byte_loop_per_byte", ROUTER_BENCH_ITERATIONS * 10U,
+                  LPUART0->DATA = (uint8_t)benchIteration;
+                  LPUART0->STAT |= LPUART_STAT_RDRF_MASK;
+                  routerBenchSink = LPUART_RxFrame(LPUART0, &data);
+                  routerBenchSink = LPUART_TxFrame7_8(LPUART2, data));
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    Std_Router_Types router;
+    Std_Router_Route_Types stream[2] =
+    {
+        { .pSource = LPUART0, .pDestination = LPUART2, .delimiter = ROUTER_NO_DELIMITER, .filter = 0 },
+        { .pSource = LPUART1, .pDestination = LPUART2, .delimiter = ROUTER_NO_DELIMITER, .filter = 0 },
+    };
+    Std_Router_Route_Types frames[2] =
+    {
+        { .pSource = LPUART0, .pDestination = LPUART2, .delimiter = '\n', .filter = 0 },
+        { .pSource = LPUART1, .pDestination = LPUART2, .delimiter = '\n', .filter = 0 },
+    };
+
+    benchInit(argc, argv, "RouterBench");
+
+    routerBenchByteLoop();
+
+    for(uint32_t i = 0; i < LPUART_INSTANCE_COUNT; i++)
+    {
+        LPUART_Type *const instances[LPUART_INSTANCE_COUNT] = { LPUART0, LPUART1, LPUART2 };
+
+        (void)LPUART_BufferInit(instances[i], routerBenchRxArr[i], sizeof(routerBenchRxArr[i]),
+                                routerBenchTxArr[i], sizeof(routerBenchTxArr[i]));
+    }
+
+    /* Throughput of a stream route, with and without the interrupts receiving and sending the bytes */
+    (void)routerInit(&router, stream, 1U);
+    BENCH_MEASURE_OPS("router_stream_path_per_byte", ROUTER_BENCH_ITERATIONS, ROUTER_QUANTUM,
+                      for(uint32_t i = 0; i < ROUTER_QUANTUM; i++)
+                      {
+                          simLpuartReceive(LPUART0, (uint8_t)i);
+                      }
+                      routerBenchSink = routerPoll(&router);
+                      routerBenchSink = routerBenchDrain(LPUART2, ROUTER_QUANTUM + 1U));
+
+    routerBenchPoll("router_stream_poll_per_byte", &router, LPUART0, ROUTER_QUANTUM, ROUTER_QUANTUM);
+
+    /* Latency the router adds to a frame: the turn of the poll that finds its delimiter, until the frame is
+       queued and the Tx interrupt armed. With nothing received a turn is the polling period */
+    (void)routerInit(&router, frames, 2U);
+    BENCH_MEASURE("router_poll_idle_2_routes", ROUTER_BENCH_ITERATIONS, routerBenchSink = routerPoll(&router));
+
+    routerBenchPoll("router_frame_forward_16B", &router, LPUART0, ROUTER_BENCH_FRAME_LEN, 1U);
+
+    routerBenchShare("fair_share_frames_lpuart", frames);
+
+    routerBenchShare("fair_share_stream_bytes_lpuart", stream);
+
+    return benchFinish();
+}
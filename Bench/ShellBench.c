@@ -0,0 +1,146 @@
+/**
+ * @file ShellBench.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host benchmark of the command dispatch of the shell
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * A table of 16 commands is searched for its first and its last entry, with 1 and SHELL_ARGC_MAX tokens
+ * on the line. The dispatch cost is the dispatchCycles the shell measures around the tokenizer and the
+ * lookup, read with the cycle counter following the host clock. A few cycles are below the resolution of
+ * one line, so the mean over the lines is reported. The time of a whole line, received, echoed and
+ * dispatched, is measured next to it.
+ * Usage:
+ *     ShellBench [--quick] [report.json]
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bench.h"
+#include "Shell.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define SHELL_BENCH_ITERATIONS  (100000U)   /* Lines of each measure in a full run */
+#define SHELL_BENCH_COMMANDS    (16U)       /* Entries of the command table */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+static Std_Shell_Status shellBenchHandler(Std_Shell_Types *shell, uint8_t argc, char *argv[]);
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t shellBenchRxArr[128];            /* Rx ring of LPUART0 */
+static uint8_t shellBenchTxArr[255];            /* Tx ring of LPUART0 */
+static Std_Shell_Types shellBenchShell;         /* Shell measured */
+static volatile uint32_t shellBenchArgc;        /* Tokens seen by the handler */
+
+static const Std_Shell_Command_Types shellBenchTable[SHELL_BENCH_COMMANDS] =
+{
+    { "baud", shellBenchHandler, "" }, { "crc", shellBenchHandler, "" }, { "det", shellBenchHandler, "" },
+    { "echo", shellBenchHandler, "" }, { "gpio", shellBenchHandler, "" }, { "help", shellBenchHandler, "" },
+    { "lin", shellBenchHandler, "" }, { "log", shellBenchHandler, "" }, { "modbus", shellBenchHandler, "" },
+    { "pool", shellBenchHandler, "" }, { "reset", shellBenchHandler, "" }, { "route", shellBenchHandler, "" },
+    { "stats", shellBenchHandler, "" }, { "timer", shellBenchHandler, "" }, { "trace", shellBenchHandler, "" },
+    { "version", shellBenchHandler, "" },
+};  /* Commands of the shell, sorted by name */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to do nothing but count the tokens, as the cheapest command
+ *
+ * @param shell[in]: pointer to the shell
+ * @param argc[in]: number of tokens
+ * @param argv[in]: tokens
+ *
+ * @return Std_Shell_Status: SHELL_E_OK
+ */
+static Std_Shell_Status shellBenchHandler(Std_Shell_Types *shell, uint8_t argc, char *argv[])
+{
+    (void)shell;
+    (void)argv;
+
+    shellBenchArgc += argc;
+
+    return SHELL_E_OK;
+}
+
+/**
+ * @brief This function is used to receive a line, run the shell on it and empty the transmitter
+ *
+ * @param pLine[in]: null terminated line with its ending
+ *
+ * @return void
+ */
+static void shellBenchLine(const char *pLine)
+{
+    uint8_t data;
+
+    for(const char *pChar = pLine; '\0' != *pChar; pChar++)
+    {
+        simLpuartReceive(LPUART0, (uint8_t)*pChar);
+    }
+
+    shellPoll(&shellBenchShell);
+
+    while(0 != simLpuartTransmit(LPUART0, &data))
+    {
+        /* Next character */
+    }
+}
+
+/**
+ * @brief This function is used to measure one line: its dispatch cycles and the time of the whole line
+ *
+ * @param name[in]: name of the result
+ * @param pLine[in]: null terminated line with its ending
+ *
+ * @return void
+ */
+static void shellBenchMeasure(const char *name, const char *pLine)
+{
+    static char result[64];
+    uint32_t count = benchIterations(SHELL_BENCH_ITERATIONS);
+    uint64_t total = 0;
+
+    /* The counter follows the host clock only for the dispatch, the whole line is timed without it */
+    simCycleModeSet(SIM_CYCLE_HOST);
+
+    for(uint32_t i = 0; i < count; i++)
+    {
+        shellBenchLine(pLine);
+        total += shellBenchShell.dispatchCycles;
+    }
+
+    simCycleModeSet(SIM_CYCLE_VIRTUAL);
+    (void)snprintf(result, sizeof(result), "dispatch_%s", name);
+    benchRecord(result, (double)total / count, "cycles");
+    (void)snprintf(result, sizeof(result), "line_%s", name);
+    BENCH_MEASURE(result, SHELL_BENCH_ITERATIONS, shellBenchLine(pLine));
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    benchInit(argc, argv, "ShellBench");
+    (void)LPUART_BufferInit(LPUART0, shellBenchRxArr, sizeof(shellBenchRxArr), shellBenchTxArr,
+                            sizeof(shellBenchTxArr));
+    (void)shellInit(&shellBenchShell, LPUART0, shellBenchTable, SHELL_BENCH_COMMANDS);
+
+    shellBenchMeasure("first_1_token", "baud\r");
+    shellBenchMeasure("last_1_token", "version\r");
+    shellBenchMeasure("first_8_tokens", "baud 0 115200 8 n 1 lsb rx\r");
+    shellBenchMeasure("last_8_tokens", "version 0 115200 8 n 1 lsb rx\r");
+
+    return benchFinish();
+}
@@ -0,0 +1,597 @@
+/**
+ * @file Bus.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the publish and subscribe message bus between the drivers and the
+ *        application
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Bus.h"
+#include "MpscQueue.h"
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define BUS_QUEUE_MASK      (BUS_QUEUE_SIZE - 1U)   /* Index mask of the message queue */
+
+#if (0U != (BUS_QUEUE_SIZE & BUS_QUEUE_MASK))
+#error "BUS_QUEUE_SIZE must be a power of 2"
+#endif
+
+#define BUS_LPUART_NUM      (3U)    /* Number of LPUART instances */
+#define BUS_PORT_NUM        (5U)    /* Number of ports */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    atomic_uint_fast32_t seq;           /* Head value + 1 once the message is published */
+    Std_Bus_Message_Types *pMessage;    /* Message waiting for busDispatch */
+} Bus_Slot_Types;                       /* Slot of the message queue */
+
+typedef struct
+{
+    Bus_Handler_Types handler;  /* Function called for each message */
+    void *arg;                  /* Argument of the handler */
+} Bus_Subscriber_Types;         /* Subscriber of a topic */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+/**
+ * @name busLpuartIrq
+ *
+ * @brief This function is used to publish the content of the Rx ring of an LPUART instance
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return void
+ */
+static void busLpuartIrq(uint8_t index);
+
+static void busLpuartIrq0(void);
+static void busLpuartIrq1(void);
+static void busLpuartIrq2(void);
+
+/**
+ * @name busPortIrq
+ *
+ * @brief This function is used to clear the pin interrupt flags of a port and publish them
+ *
+ * @param index[in]: index of the port
+ *
+ * @return void
+ */
+static void busPortIrq(uint8_t index);
+
+static void busPortIrq0(void);
+static void busPortIrq1(void);
+static void busPortIrq2(void);
+static void busPortIrq3(void);
+static void busPortIrq4(void);
+
+/**
+ * @name busClockChange
+ *
+ * @brief This function is used to publish the new frequency of the system clock
+ *
+ * @param frequency[in]: system clock in Hz
+ *
+ * @return void
+ */
+static void busClockChange(uint32_t frequency);
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Std_Pool_Types *busPool;                                 /* Pool of the messages */
+static Bus_Slot_Types busSlots[BUS_QUEUE_SIZE];                 /* Slots of the message queue */
+static Std_MpscQueue_Types busQueue = MPSC_QUEUE_INIT(busSlots);  /* Messages published and not delivered yet */
+
+static Bus_Subscriber_Types busSubscribers[BUS_TOPIC_COUNT][BUS_SUBSCRIBERS_MAX];  /* Subscribers of each topic */
+static uint8_t busNofSubscribers[BUS_TOPIC_COUNT];                                  /* Number of subscribers of each topic */
+
+static atomic_uint_fast32_t busPublished;   /* Messages queued by busPublish */
+static atomic_uint_fast32_t busDropped;     /* Messages lost */
+static uint32_t busDispatched;              /* Messages delivered by busDispatch */
+static uint32_t busHandlerCalls;            /* Subscribers called */
+static uint32_t busFanoutCyclesMax;         /* Longest time spent delivering one message */
+
+static LPUART_Type * const busLpuartInstance[BUS_LPUART_NUM] =
+{
+    LPUART0, LPUART1, LPUART2
+};  /* Base address of each LPUART instance */
+
+static const LPUART_CallbackPtr busLpuartIrqs[BUS_LPUART_NUM] =
+{
+    busLpuartIrq0, busLpuartIrq1, busLpuartIrq2
+};  /* Callback registered for each LPUART instance */
+
+static PORT_Type * const busPortInstance[BUS_PORT_NUM] =
+{
+    PORTA, PORTB, PORTC, PORTD, PORTE
+};  /* Base address of each port */
+
+static const func_ptr busPortIrqs[BUS_PORT_NUM] =
+{
+    busPortIrq0, busPortIrq1, busPortIrq2, busPortIrq3, busPortIrq4
+};  /* Callback registered for each port */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to publish the content of the Rx ring of an LPUART instance
+ *
+ * The spans of the ring are copied once into a message, which then goes to every subscriber without
+ * another copy. When no block is free the data stays in the ring for the next interrupt.
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return void
+ */
+static void busLpuartIrq(uint8_t index)
+{
+    LPUART_Type *pLPUARTx = busLpuartInstance[index];
+    const uint8_t *pSpan = 0;
+
+    if(0 != LPUART_RxPeek(pLPUARTx, 0, &pSpan))
+    {
+        Std_Bus_Message_Types *pMessage = busAlloc(BUS_TOPIC_LPUART_RX, index, 0);
+
+        if(0 != pMessage)
+        {
+            uint32_t room = poolGetBlockSize(busPool) - (uint32_t)sizeof(Std_Bus_Message_Types);
+            uint32_t len = 0;
+            uint32_t spanLen;
+
+            while((len < room) && (0 != (spanLen = LPUART_RxPeek(pLPUARTx, len, &pSpan))))
+            {
+                if(spanLen > (room - len))
+                {
+                    spanLen = room - len;
+                }
+
+                memcpy(BUS_PAYLOAD(pMessage) + len, pSpan, spanLen);
+                len += spanLen;
+            }
+
+            LPUART_RxConsume(pLPUARTx, len);
+            pMessage->len = len;
+            busPublish(pMessage);
+        }
+    }
+}
+
+static void busLpuartIrq0(void)
+{
+    busLpuartIrq(0);
+}
+
+static void busLpuartIrq1(void)
+{
+    busLpuartIrq(1);
+}
+
+static void busLpuartIrq2(void)
+{
+    busLpuartIrq(2);
+}
+
+/**
+ * @brief This function is used to clear the pin interrupt flags of a port and publish them
+ *
+ * @param index[in]: index of the port
+ *
+ * @return void
+ */
+static void busPortIrq(uint8_t index)
+{
+    PORT_Type *PORTx = busPortInstance[index];
+    uint32_t flags = PORTx->ISFR;
+
+    /* Write 1 to clear the flags being published only, a pin firing now stays pending */
+    PORTx->ISFR = flags;
+
+    if(0 != flags)
+    {
+        Std_Bus_Message_Types *pMessage = busAlloc(BUS_TOPIC_PIN_EDGE, index, sizeof(flags));
+
+        if(0 != pMessage)
+        {
+            memcpy(BUS_PAYLOAD(pMessage), &flags, sizeof(flags));
+            busPublish(pMessage);
+        }
+    }
+}
+
+static void busPortIrq0(void)
+{
+    busPortIrq(0);
+}
+
+static void busPortIrq1(void)
+{
+    busPortIrq(1);
+}
+
+static void busPortIrq2(void)
+{
+    busPortIrq(2);
+}
+
+static void busPortIrq3(void)
+{
+    busPortIrq(3);
+}
+
+static void busPortIrq4(void)
+{
+    busPortIrq(4);
+}
+
+/**
+ * @brief This function is used to publish the new frequency of the system clock
+ *
+ * @param frequency[in]: system clock in Hz
+ *
+ * @return void
+ */
+static void busClockChange(uint32_t frequency)
+{
+    Std_Bus_Message_Types *pMessage = busAlloc(BUS_TOPIC_CLOCK_CHANGE, 0, sizeof(frequency));
+
+    if(0 != pMessage)
+    {
+        memcpy(BUS_PAYLOAD(pMessage), &frequency, sizeof(frequency));
+        busPublish(pMessage);
+    }
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to empty the bus and give it the pool of the messages
+ *
+ * @param pool[in/out]: pool of the messages, a block holds the header and the payload
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the blocks are too small for a header
+ */
+Std_Bus_Status busInit(Std_Pool_Types *pool)
+{
+    Std_Bus_Status status = BUS_E_NOT_OK;
+
+    if((0 != pool) && (sizeof(Std_Bus_Message_Types) <= poolGetBlockSize(pool)))
+    {
+        busPool = pool;
+        mpscQueueInit(&busQueue, busSlots, (uint32_t)sizeof(Bus_Slot_Types), BUS_QUEUE_SIZE);
+
+        for(uint32_t i = 0; i < BUS_QUEUE_SIZE; i++)
+        {
+            busSlots[i].pMessage = 0;
+        }
+
+        for(uint32_t i = 0; i < BUS_TOPIC_COUNT; i++)
+        {
+            busNofSubscribers[i] = 0;
+        }
+
+        atomic_store_explicit(&busPublished, 0U, memory_order_relaxed);
+        atomic_store_explicit(&busDropped, 0U, memory_order_relaxed);
+        busDispatched = 0;
+        busHandlerCalls = 0;
+        busFanoutCyclesMax = 0;
+        atomic_thread_fence(memory_order_release);
+        status = BUS_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to add a subscriber to a topic, from task context and not from a handler
+ *
+ * @param topic[in]: topic
+ * @param handler[in]: function called for each message of the topic
+ * @param arg[in]: argument of the handler
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the topic is not valid or has BUS_SUBSCRIBERS_MAX subscribers
+ */
+Std_Bus_Status busSubscribe(Bus_Topic_Types topic, Bus_Handler_Types handler, void *arg)
+{
+    Std_Bus_Status status = BUS_E_NOT_OK;
+
+    if((BUS_TOPIC_COUNT > (uint32_t)topic) && (0 != handler) && (BUS_SUBSCRIBERS_MAX > busNofSubscribers[topic]))
+    {
+        Bus_Subscriber_Types *pSubscriber = &busSubscribers[topic][busNofSubscribers[topic]];
+
+        pSubscriber->handler = handler;
+        pSubscriber->arg = arg;
+        busNofSubscribers[topic]++;
+        status = BUS_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to remove a subscriber from a topic, from task context and not from a
+ *        handler
+ *
+ * @param topic[in]: topic
+ * @param handler[in]: function given to busSubscribe
+ * @param arg[in]: argument given to busSubscribe
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the subscriber is not found
+ */
+Std_Bus_Status busUnsubscribe(Bus_Topic_Types topic, Bus_Handler_Types handler, void *arg)
+{
+    Std_Bus_Status status = BUS_E_NOT_OK;
+
+    if(BUS_TOPIC_COUNT > (uint32_t)topic)
+    {
+        Bus_Subscriber_Types *pList = busSubscribers[topic];
+
+        for(uint8_t i = 0; (BUS_E_NOT_OK == status) && (i < busNofSubscribers[topic]); i++)
+        {
+            if((pList[i].handler == handler) && (pList[i].arg == arg))
+            {
+                /* Keep the order of the others, they are called in the order they subscribed */
+                for(uint8_t j = i + 1U; j < busNofSubscribers[topic]; j++)
+                {
+                    pList[j - 1U] = pList[j];
+                }
+
+                busNofSubscribers[topic]--;
+                status = BUS_E_OK;
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to take a message from the pool, it can be called from any context
+ *        including ISR
+ *
+ * @param topic[in]: topic of the message
+ * @param source[in]: instance publishing the message
+ * @param len[in]: bytes of payload, written at BUS_PAYLOAD(pMessage) by the caller
+ *
+ * @return Std_Bus_Message_Types*: message holding one reference, 0 if no block is free or too small
+ */
+Std_Bus_Message_Types *busAlloc(Bus_Topic_Types topic, uint16_t source, uint32_t len)
+{
+    Std_Bus_Message_Types *pMessage = 0;
+
+    if((0 != busPool) && (BUS_TOPIC_COUNT > (uint32_t)topic) &&
+       (len <= (poolGetBlockSize(busPool) - (uint32_t)sizeof(Std_Bus_Message_Types))))
+    {
+        pMessage = (Std_Bus_Message_Types *)poolAlloc(busPool);
+
+        if(0 != pMessage)
+        {
+            atomic_init(&pMessage->refs, 1U);
+            pMessage->pPool = busPool;
+            pMessage->topic = (uint16_t)topic;
+            pMessage->source = source;
+            pMessage->len = len;
+        }
+        else
+        {
+            atomic_fetch_add_explicit(&busDropped, 1U, memory_order_relaxed);
+        }
+    }
+
+    return pMessage;
+}
+
+/**
+ * @brief This function is used to queue a message for its subscribers, it can be called from any context
+ *        including ISR, the message is delivered later by busDispatch
+ *
+ * Only the pointer is queued. A slot is reserved with a compare and swap on the head so producers
+ * preempting each other never share a slot, the message is published by writing its sequence number.
+ *
+ * @param pMessage[in]: message of busAlloc, its reference is given to the bus in any case
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the queue is full, the message is released then
+ */
+Std_Bus_Status busPublish(Std_Bus_Message_Types *pMessage)
+{
+    Std_Bus_Status status = BUS_E_NOT_OK;
+
+    if(0 != pMessage)
+    {
+        uint_fast32_t index;
+        Bus_Slot_Types *pSlot = (Bus_Slot_Types *)mpscQueueReserve(&busQueue, &index);
+
+        if(0 != pSlot)
+        {
+            pSlot->pMessage = pMessage;
+            mpscQueuePublish(&busQueue, index);
+            atomic_fetch_add_explicit(&busPublished, 1U, memory_order_relaxed);
+            status = BUS_E_OK;
+        }
+        else
+        {
+            atomic_fetch_add_explicit(&busDropped, 1U, memory_order_relaxed);
+            busRelease(pMessage);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to take one more reference to a message, it can be called from any context
+ *        including ISR
+ *
+ * @param pMessage[in/out]: message
+ *
+ * @return void
+ */
+void busRetain(Std_Bus_Message_Types *pMessage)
+{
+    if(0 != pMessage)
+    {
+        atomic_fetch_add_explicit(&pMessage->refs, 1U, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief This function is used to give back a reference to a message, the last one returns the block to
+ *        its pool, it can be called from any context including ISR
+ *
+ * @param pMessage[in/out]: message, not used by the caller any more
+ *
+ * @return void
+ */
+void busRelease(Std_Bus_Message_Types *pMessage)
+{
+    /* Release so the reads of the payload are done before another context can free the block */
+    if((0 != pMessage) && (1U == atomic_fetch_sub_explicit(&pMessage->refs, 1U, memory_order_acq_rel)))
+    {
+        poolFree(pMessage->pPool, pMessage);
+    }
+}
+
+/**
+ * @brief This function is used to deliver the queued messages to their subscribers, it should be called
+ *        from the background loop or from a task
+ *
+ * The bus holds the reference of the publisher during the calls, so every subscriber reads the same block
+ * and a subscriber calling busRetain keeps it after the others returned.
+ *
+ * @return uint32_t: number of messages delivered
+ */
+uint32_t busDispatch(void)
+{
+    uint32_t nOfMessages = 0;
+    uint8_t isEmpty = 0;
+
+    while(0 == isEmpty)
+    {
+        const Bus_Slot_Types *pSlot = (const Bus_Slot_Types *)mpscQueuePeek(&busQueue, 0);
+
+        if(0 != pSlot)
+        {
+            Std_Bus_Message_Types *pMessage = pSlot->pMessage;
+            const Bus_Subscriber_Types *pList = busSubscribers[pMessage->topic];
+            uint8_t nOfSubscribers = busNofSubscribers[pMessage->topic];
+            uint32_t start = BUS_CYCLE_COUNTER();
+            uint32_t cycles;
+
+            /* Free the slot before the handlers run, they may publish */
+            mpscQueueRelease(&busQueue, 1U);
+
+            for(uint8_t i = 0; i < nOfSubscribers; i++)
+            {
+                pList[i].handler(pMessage, pList[i].arg);
+            }
+
+            busRelease(pMessage);
+            cycles = BUS_CYCLE_COUNTER() - start;
+
+            busHandlerCalls += nOfSubscribers;
+            busDispatched++;
+            nOfMessages++;
+
+            if(cycles > busFanoutCyclesMax)
+            {
+                busFanoutCyclesMax = cycles;
+            }
+        }
+        else
+        {
+            /* Empty, or the next message is still being published */
+            isEmpty = 1;
+        }
+    }
+
+    return nOfMessages;
+}
+
+/**
+ * @brief This function is used to read the statistics of the bus
+ *
+ * @param pStatistics[out]: statistics of the bus
+ *
+ * @return void
+ */
+void busGetStatistics(Bus_Statistics_Types *pStatistics)
+{
+    if(0 != pStatistics)
+    {
+        pStatistics->published = (uint32_t)atomic_load_explicit(&busPublished, memory_order_relaxed);
+        pStatistics->dropped = (uint32_t)atomic_load_explicit(&busDropped, memory_order_relaxed);
+        pStatistics->dispatched = busDispatched;
+        pStatistics->handlerCalls = busHandlerCalls;
+        pStatistics->fanoutCyclesMax = busFanoutCyclesMax;
+    }
+}
+
+/**
+ * @brief This function is used to publish the pin interrupts of a port on BUS_TOPIC_PIN_EDGE
+ *
+ * @param PORTx[in]: pointer to the port
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the port is not valid
+ */
+Std_Bus_Status busBindPort(PORT_Type *PORTx)
+{
+    Std_Bus_Status status = BUS_E_NOT_OK;
+
+    for(uint8_t i = 0; i < BUS_PORT_NUM; i++)
+    {
+        if((busPortInstance[i] == PORTx) && (PORT_E_OK == Register_InterruptHandler(PORTx, busPortIrqs[i])))
+        {
+            status = BUS_E_OK;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to publish the data received by an LPUART instance on BUS_TOPIC_LPUART_RX,
+ *        the instance must be set up with LPUART_BufferInit
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the instance is not valid
+ */
+Std_Bus_Status busBindLpuart(LPUART_Type *pLPUARTx)
+{
+    Std_Bus_Status status = BUS_E_NOT_OK;
+
+    for(uint8_t i = 0; i < BUS_LPUART_NUM; i++)
+    {
+        if((busLpuartInstance[i] == pLPUARTx) && (LPUART_E_OK == LPUART_CallbackRegister(pLPUARTx, busLpuartIrqs[i])))
+        {
+            status = BUS_E_OK;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to publish the changes of the system clock on BUS_TOPIC_CLOCK_CHANGE
+ *
+ * @return Std_Bus_Status: status of the operation
+ */
+Std_Bus_Status busBindClock(void)
+{
+    return (SCG_E_OK == SCG_ClockChangeCallbackRegister(busClockChange)) ? BUS_E_OK : BUS_E_NOT_OK;
+}
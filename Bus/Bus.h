@@ -0,0 +1,226 @@
+/**
+ * @file Bus.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the publish and subscribe message bus between the drivers and the
+ *        application
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef BUS_H_
+#define BUS_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpuart_driver.h"
+#include "s32k144_port_driver.h"
+#include "s32k144_pcc_driver.h"
+#include "Pool.h"
+#include <stdatomic.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#ifndef BUS_SUBSCRIBERS_MAX
+#define BUS_SUBSCRIBERS_MAX (16U)   /* Subscribers of each topic */
+#endif
+
+#ifndef BUS_QUEUE_SIZE
+#define BUS_QUEUE_SIZE      (32U)   /* Messages published and not delivered yet, must be a power of 2 */
+#endif
+
+#ifndef BUS_CYCLE_COUNTER
+#define BUS_CYCLE_COUNTER() CYCLE_COUNTER()     /* Cycle counter used to time the deliveries */
+#endif
+
+#define BUS_PAYLOAD(pMessage)   ((uint8_t *)(pMessage) + sizeof(Std_Bus_Message_Types))    /* First byte of the payload */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    BUS_E_OK,           /* Operation completed without error */
+    BUS_E_NOT_OK,       /* Operation not completed */
+} Std_Bus_Status;       /* Standard status type */
+
+#define BUS_TOPIC(id) id,
+typedef enum
+{
+#include "BusTopics.def"
+    BUS_TOPIC_COUNT     /* Number of topics */
+} Bus_Topic_Types;      /* Topic identifiers generated from BusTopics.def */
+#undef BUS_TOPIC
+
+typedef struct
+{
+    atomic_uint_fast32_t refs;  /* References held, the block goes back to its pool at 0 */
+    Std_Pool_Types *pPool;      /* Pool of the block */
+    uint16_t topic;             /* Bus_Topic_Types */
+    uint16_t source;            /* Instance that published the message */
+    uint32_t len;               /* Bytes of payload, stored after the header */
+} Std_Bus_Message_Types;        /* Header of a message, at the start of a pool block */
+
+/* Subscriber of a topic, called from busDispatch. The payload is shared by all the subscribers and must
+   not be changed, busRetain keeps the message after the return */
+typedef void (*Bus_Handler_Types)(Std_Bus_Message_Types *pMessage, void *arg);
+
+typedef struct
+{
+    uint32_t published;         /* Messages queued by busPublish */
+    uint32_t dropped;           /* Messages lost because the queue was full or no block was free */
+    uint32_t dispatched;        /* Messages delivered by busDispatch */
+    uint32_t handlerCalls;      /* Subscribers called */
+    uint32_t fanoutCyclesMax;   /* Longest time in cycles spent delivering one message */
+} Bus_Statistics_Types;         /* Statistics of the bus */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name busInit
+ *
+ * @brief This function is used to empty the bus and give it the pool of the messages
+ *
+ * @param pool[in/out]: pool of the messages, a block holds the header and the payload
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the blocks are too small for a header
+ */
+Std_Bus_Status busInit(Std_Pool_Types *pool);
+
+/**
+ * @name busSubscribe
+ *
+ * @brief This function is used to add a subscriber to a topic, from task context and not from a handler
+ *
+ * @param topic[in]: topic
+ * @param handler[in]: function called for each message of the topic
+ * @param arg[in]: argument of the handler
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the topic is not valid or has BUS_SUBSCRIBERS_MAX subscribers
+ */
+Std_Bus_Status busSubscribe(Bus_Topic_Types topic, Bus_Handler_Types handler, void *arg);
+
+/**
+ * @name busUnsubscribe
+ *
+ * @brief This function is used to remove a subscriber from a topic, from task context and not from a
+ *        handler
+ *
+ * @param topic[in]: topic
+ * @param handler[in]: function given to busSubscribe
+ * @param arg[in]: argument given to busSubscribe
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the subscriber is not found
+ */
+Std_Bus_Status busUnsubscribe(Bus_Topic_Types topic, Bus_Handler_Types handler, void *arg);
+
+/**
+ * @name busAlloc
+ *
+ * @brief This function is used to take a message from the pool, it can be called from any context
+ *        including ISR
+ *
+ * @param topic[in]: topic of the message
+ * @param source[in]: instance publishing the message
+ * @param len[in]: bytes of payload, written at BUS_PAYLOAD(pMessage) by the caller
+ *
+ * @return Std_Bus_Message_Types*: message holding one reference, 0 if no block is free or too small
+ */
+Std_Bus_Message_Types *busAlloc(Bus_Topic_Types topic, uint16_t source, uint32_t len);
+
+/**
+ * @name busPublish
+ *
+ * @brief This function is used to queue a message for its subscribers, it can be called from any context
+ *        including ISR, the message is delivered later by busDispatch
+ *
+ * @param pMessage[in]: message of busAlloc, its reference is given to the bus in any case
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the queue is full, the message is released then
+ */
+Std_Bus_Status busPublish(Std_Bus_Message_Types *pMessage);
+
+/**
+ * @name busRetain
+ *
+ * @brief This function is used to take one more reference to a message, it can be called from any context
+ *        including ISR
+ *
+ * @param pMessage[in/out]: message
+ *
+ * @return void
+ */
+void busRetain(Std_Bus_Message_Types *pMessage);
+
+/**
+ * @name busRelease
+ *
+ * @brief This function is used to give back a reference to a message, the last one returns the block to
+ *        its pool, it can be called from any context including ISR
+ *
+ * @param pMessage[in/out]: message, not used by the caller any more
+ *
+ * @return void
+ */
+void busRelease(Std_Bus_Message_Types *pMessage);
+
+/**
+ * @name busDispatch
+ *
+ * @brief This function is used to deliver the queued messages to their subscribers, it should be called
+ *        from the background loop or from a task
+ *
+ * @return uint32_t: number of messages delivered
+ */
+uint32_t busDispatch(void);
+
+/**
+ * @name busGetStatistics
+ *
+ * @brief This function is used to read the statistics of the bus
+ *
+ * @param pStatistics[out]: statistics of the bus
+ *
+ * @return void
+ */
+void busGetStatistics(Bus_Statistics_Types *pStatistics);
+
+/**
+ * @name busBindPort
+ *
+ * @brief This function is used to publish the pin interrupts of a port on BUS_TOPIC_PIN_EDGE
+ *
+ * @param PORTx[in]: pointer to the port
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the port is not valid
+ */
+Std_Bus_Status busBindPort(PORT_Type *PORTx);
+
+/**
+ * @name busBindLpuart
+ *
+ * @brief This function is used to publish the data received by an LPUART instance on BUS_TOPIC_LPUART_RX,
+ *        the instance must be set up with LPUART_BufferInit
+ *
+ * Each interrupt publishes the Rx ring as one message, up to the payload a block holds. With
+ * LPUART_RxMatchConfig the interrupt, so the message, comes on a terminator instead of every character.
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return Std_Bus_Status: BUS_E_NOT_OK if the instance is not valid
+ */
+Std_Bus_Status busBindLpuart(LPUART_Type *pLPUARTx);
+
+/**
+ * @name busBindClock
+ *
+ * @brief This function is used to publish the changes of the system clock on BUS_TOPIC_CLOCK_CHANGE
+ *
+ * @return Std_Bus_Status: status of the operation
+ */
+Std_Bus_Status busBindClock(void);
+
+#endif /* BUS_H_ */
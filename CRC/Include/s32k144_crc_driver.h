@@ -0,0 +1,161 @@
+/**
+ * @file s32k144_crc_driver.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This is the header file of the CRC engine used for serial framing on S32K144 MCU.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef S32K144_CRC_DRIVER_H
+#define S32K144_CRC_DRIVER_H
+
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_crc_hal.h"
+#include "RingBuffer.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#ifndef CRC_SLICE_BY
+#define CRC_SLICE_BY (4)    /* Bytes consumed per table step of the software engine, value is 1, 4 or 8 */
+#endif
+
+#define CRC16_CCITT_POLY    (0x1021U)       /* CRC-16-CCITT polynomial, MSB first */
+#define CRC16_CCITT_INIT    (0xFFFFU)       /* CRC-16-CCITT (FALSE) initial value */
+#define CRC16_CCITT_CHECK   (0x29B1U)       /* CRC-16-CCITT (FALSE) of "123456789" */
+
+#define CRC32_POLY          (0x04C11DB7U)   /* CRC-32 (IEEE 802.3) polynomial */
+#define CRC32_INIT          (0xFFFFFFFFU)   /* CRC-32 initial value */
+#define CRC32_XOROUT        (0xFFFFFFFFU)   /* CRC-32 final XOR value */
+#define CRC32_CHECK         (0xCBF43926U)   /* CRC-32 of "123456789" */
+
+#define CRC32_FINAL(crc)    ((crc) ^ CRC32_XOROUT)  /* Finalize a running CRC-32 */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    CRC_E_OK,       /* Operation completed without error */
+    CRC_E_NOT_OK,   /* Operation not completed */
+} Std_CRC_Status;   /* Standard status type */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name CRC16_Update
+ *
+ * @brief This function is used to feed data into a running CRC-16-CCITT
+ *
+ * @param crc[in]: running CRC, CRC16_CCITT_INIT for a new computation
+ * @param pData[in]: pointer to the data
+ * @param len[in]: length of the data
+ *
+ * @return uint16_t: updated CRC
+ */
+uint16_t CRC16_Update(uint16_t crc, const uint8_t *pData, uint32_t len);
+
+/**
+ * @name CRC16_UpdateQueue
+ *
+ * @brief This function is used to feed the content of a queue into a running CRC-16-CCITT without popping it
+ *
+ * @param crc[in]: running CRC
+ * @param queue[in]: pointer to the queue
+ *
+ * @return uint16_t: updated CRC
+ */
+uint16_t CRC16_UpdateQueue(uint16_t crc, const Std_Queue_Types *queue);
+
+/**
+ * @name CRC32_Update
+ *
+ * @brief This function is used to feed data into a running CRC-32, the result is finalized with CRC32_FINAL
+ *
+ * @param crc[in]: running CRC, CRC32_INIT for a new computation
+ * @param pData[in]: pointer to the data
+ * @param len[in]: length of the data
+ *
+ * @return uint32_t: updated CRC
+ */
+uint32_t CRC32_Update(uint32_t crc, const uint8_t *pData, uint32_t len);
+
+/**
+ * @name CRC32_UpdateQueue
+ *
+ * @brief This function is used to feed the content of a queue into a running CRC-32 without popping it
+ *
+ * @param crc[in]: running CRC
+ * @param queue[in]: pointer to the queue
+ *
+ * @return uint32_t: updated CRC
+ */
+uint32_t CRC32_UpdateQueue(uint32_t crc, const Std_Queue_Types *queue);
+
+/**
+ * @name CRC_SelfTest
+ *
+ * @brief This function is used to check the software engine against the reference vectors
+ *
+ * @return Std_CRC_Status: status of the operation
+ */
+Std_CRC_Status CRC_SelfTest(void);
+
+/**
+ * @name CRC_HwInit
+ *
+ * @brief This function is used to enable the clock of the CRC peripheral
+ *
+ * @return Std_CRC_Status: status of the operation
+ */
+Std_CRC_Status CRC_HwInit(void);
+
+/**
+ * @name CRC_HwStart
+ *
+ * @brief This function is used to start a new computation on the CRC peripheral
+ *
+ * @param width[in]: CRC_WIDTH_16BITS for CRC-16-CCITT, CRC_WIDTH_32BITS for CRC-32
+ *
+ * @return Std_CRC_Status: status of the operation
+ */
+Std_CRC_Status CRC_HwStart(CRC_Width_Type width);
+
+/**
+ * @name CRC_HwUpdate
+ *
+ * @brief This function is used to feed data into the CRC peripheral
+ *
+ * @param pData[in]: pointer to the data
+ * @param len[in]: length of the data
+ *
+ * @return Std_CRC_Status: status of the operation
+ */
+Std_CRC_Status CRC_HwUpdate(const uint8_t *pData, uint32_t len);
+
+/**
+ * @name CRC_HwUpdateQueue
+ *
+ * @brief This function is used to feed the content of a queue into the CRC peripheral without popping it
+ *
+ * @param queue[in]: pointer to the queue
+ *
+ * @return Std_CRC_Status: status of the operation
+ */
+Std_CRC_Status CRC_HwUpdateQueue(const Std_Queue_Types *queue);
+
+/**
+ * @name CRC_HwGetResult
+ *
+ * @brief This function is used to read the final CRC from the CRC peripheral
+ *
+ * @return uint32_t: final CRC, already complemented for CRC-32
+ */
+uint32_t CRC_HwGetResult(void);
+
+#endif /* S32K144_CRC_DRIVER_H */
@@ -0,0 +1,102 @@
+/**
+ * @file s32k144_crc_hal.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This is the header file of the Hardware Abstraction Layer for CRC module of S32K144 MCU.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef S32K144_CRC_HAL_H
+#define S32K144_CRC_HAL_H
+
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "S32K144.h"
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    CRC_WIDTH_16BITS,   /* 16-bit CRC protocol */
+    CRC_WIDTH_32BITS,   /* 32-bit CRC protocol */
+} CRC_Width_Type;       /* CRC protocol width */
+
+typedef enum
+{
+    CRC_TRANSPOSE_NONE,             /* No transposition */
+    CRC_TRANSPOSE_BITS,             /* Bits in bytes are transposed, bytes are not */
+    CRC_TRANSPOSE_BITS_AND_BYTES,   /* Both bits in bytes and bytes are transposed */
+    CRC_TRANSPOSE_BYTES,            /* Only bytes are transposed */
+} CRC_Transpose_Type;               /* CRC transpose type for read and write */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name HAL_CRC_SetConfig
+ *
+ * @brief This function is used to configure width, transposition and final XOR of the CRC
+ *
+ * @param pCRCx[in/out]: pointer to the CRC instance
+ * @param width[in]: protocol width
+ * @param writeTranspose[in]: transposition applied to written data
+ * @param readTranspose[in]: transposition applied to the read result
+ * @param finalXor[in]: 1 to complement the read result, 0 otherwise
+ *
+ * @return void
+ */
+void HAL_CRC_SetConfig(CRC_Type *pCRCx, CRC_Width_Type width, CRC_Transpose_Type writeTranspose,
+                       CRC_Transpose_Type readTranspose, uint8_t finalXor);
+
+/**
+ * @name HAL_CRC_SetPolynomial
+ *
+ * @brief This function is used to set the generator polynomial of the CRC
+ *
+ * @param pCRCx[in/out]: pointer to the CRC instance
+ * @param polynomial[in]: polynomial, the low 16 bits are used in 16-bit mode
+ *
+ * @return void
+ */
+void HAL_CRC_SetPolynomial(CRC_Type *pCRCx, uint32_t polynomial);
+
+/**
+ * @name HAL_CRC_SetSeed
+ *
+ * @brief This function is used to load the seed value of the CRC
+ *
+ * @param pCRCx[in/out]: pointer to the CRC instance
+ * @param seed[in]: seed value
+ *
+ * @return void
+ */
+void HAL_CRC_SetSeed(CRC_Type *pCRCx, uint32_t seed);
+
+/**
+ * @name HAL_CRC_WriteData8
+ *
+ * @brief This function is used to feed one byte into the CRC
+ *
+ * @param pCRCx[in/out]: pointer to the CRC instance
+ * @param data[in]: data to feed
+ *
+ * @return void
+ */
+void HAL_CRC_WriteData8(CRC_Type *pCRCx, uint8_t data);
+
+/**
+ * @name HAL_CRC_GetResult
+ *
+ * @brief This function is used to read the CRC result
+ *
+ * @param pCRCx[in/out]: pointer to the CRC instance
+ *
+ * @return uint32_t: CRC result, only the low 16 bits are valid in 16-bit mode
+ */
+uint32_t HAL_CRC_GetResult(CRC_Type *pCRCx);
+
+#endif /* S32K144_CRC_HAL_H */
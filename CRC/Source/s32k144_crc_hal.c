@@ -0,0 +1,91 @@
+/**
+ * @file s32k144_crc_hal.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This is the definition file of the Hardware Abstraction Layer for CRC module of S32K144 MCU.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_crc_hal.h"
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to configure width, transposition and final XOR of the CRC
+ *
+ * @param pCRCx[in/out]: pointer to the CRC instance
+ * @param width[in]: protocol width
+ * @param writeTranspose[in]: transposition applied to written data
+ * @param readTranspose[in]: transposition applied to the read result
+ * @param finalXor[in]: 1 to complement the read result, 0 otherwise
+ *
+ * @return void
+ */
+void HAL_CRC_SetConfig(CRC_Type *pCRCx, CRC_Width_Type width, CRC_Transpose_Type writeTranspose,
+                       CRC_Transpose_Type readTranspose, uint8_t finalXor)
+{
+    pCRCx->CTRL = CRC_CTRL_TCRC((CRC_WIDTH_32BITS == width) ? 1U : 0U) |
+                  CRC_CTRL_TOT(writeTranspose) |
+                  CRC_CTRL_TOTR(readTranspose) |
+                  CRC_CTRL_FXOR(finalXor);
+}
+
+/**
+ * @brief This function is used to set the generator polynomial of the CRC
+ *
+ * @param pCRCx[in/out]: pointer to the CRC instance
+ * @param polynomial[in]: polynomial, the low 16 bits are used in 16-bit mode
+ *
+ * @return void
+ */
+void HAL_CRC_SetPolynomial(CRC_Type *pCRCx, uint32_t polynomial)
+{
+    pCRCx->GPOLY = polynomial;
+}
+
+/**
+ * @brief This function is used to load the seed value of the CRC
+ *
+ * @param pCRCx[in/out]: pointer to the CRC instance
+ * @param seed[in]: seed value
+ *
+ * @return void
+ */
+void HAL_CRC_SetSeed(CRC_Type *pCRCx, uint32_t seed)
+{
+    /* Data written while WAS is set is loaded as the seed */
+    pCRCx->CTRL |= CRC_CTRL_WAS_MASK;
+    pCRCx->DATAu.DATA = seed;
+    pCRCx->CTRL &= ~CRC_CTRL_WAS_MASK;
+}
+
+/**
+ * @brief This function is used to feed one byte into the CRC
+ *
+ * @param pCRCx[in/out]: pointer to the CRC instance
+ * @param data[in]: data to feed
+ *
+ * @return void
+ */
+void HAL_CRC_WriteData8(CRC_Type *pCRCx, uint8_t data)
+{
+    pCRCx->DATAu.DATA_8.LL = data;
+}
+
+/**
+ * @brief This function is used to read the CRC result
+ *
+ * @param pCRCx[in/out]: pointer to the CRC instance
+ *
+ * @return uint32_t: CRC result, only the low 16 bits are valid in 16-bit mode
+ */
+uint32_t HAL_CRC_GetResult(CRC_Type *pCRCx)
+{
+    return pCRCx->DATAu.DATA;
+}
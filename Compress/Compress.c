@@ -0,0 +1,411 @@
+/**
+ * @file Compress.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the streaming LZ compressor feeding the LPUART Tx ring
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Compress.h"
+#include "Trace.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define COMPRESS_WINDOW_MASK    (COMPRESS_WINDOW_SIZE - 1U)     /* Mask to wrap a position in the window */
+#define COMPRESS_HASH_MASK      (COMPRESS_HASH_SIZE - 1U)       /* Mask of a chain index */
+#define COMPRESS_LOOKAHEAD_MASK (COMPRESS_LOOKAHEAD_SIZE - 1U)  /* Mask to wrap an index in the lookahead */
+#define COMPRESS_TOKEN_BYTES    (3U)    /* Room in out for one token or the flush marker and its padding */
+
+#if ((COMPRESS_WINDOW_BITS < COMPRESS_HASH_BITS) || (COMPRESS_WINDOW_BITS > 15U))
+#error "COMPRESS_WINDOW_BITS must be between COMPRESS_HASH_BITS and 15"
+#endif
+
+#if (COMPRESS_MATCH_MAX >= COMPRESS_LOOKAHEAD_SIZE)
+#error "COMPRESS_LENGTH_BITS is too large for the lookahead ring"
+#endif
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+/**
+ * @name compressByte
+ *
+ * @brief This function is used to read a byte of the stream at a position, from the window or from the
+ *        lookahead
+ *
+ * @param comp[in]: pointer to the compressor
+ * @param position[in]: position of the byte, before pos + nOfPending
+ *
+ * @return uint8_t: byte at the position
+ */
+static uint8_t compressByte(const Std_Compress_Types *comp, uint16_t position);
+
+/**
+ * @name compressHash
+ *
+ * @brief This function is used to get the chain of the two bytes starting a match
+ *
+ * @param b0[in]: first byte
+ * @param b1[in]: second byte
+ *
+ * @return uint32_t: index of the chain
+ */
+static uint32_t compressHash(uint8_t b0, uint8_t b1);
+
+/**
+ * @name compressPutBits
+ *
+ * @brief This function is used to add bits to the output, most significant first
+ *
+ * @param comp[in/out]: pointer to the compressor
+ * @param value[in]: bits to add, right aligned
+ * @param nOfBits[in]: number of bits, at most 16
+ *
+ * @return void
+ */
+static void compressPutBits(Std_Compress_Types *comp, uint32_t value, uint8_t nOfBits);
+
+/**
+ * @name compressDrain
+ *
+ * @brief This function is used to move the output bytes to the Tx ring
+ *
+ * @param comp[in/out]: pointer to the compressor
+ *
+ * @return void
+ */
+static void compressDrain(Std_Compress_Types *comp);
+
+/**
+ * @name compressHasRoom
+ *
+ * @brief This function is used to make room in the output for one token
+ *
+ * @param comp[in/out]: pointer to the compressor
+ *
+ * @return uint8_t: 1 if a token fits, 0 while the Tx ring is full
+ */
+static uint8_t compressHasRoom(Std_Compress_Types *comp);
+
+/**
+ * @name compressEncode
+ *
+ * @brief This function is used to encode the start of the lookahead as the longest match found in the
+ *        window, or as a literal
+ *
+ * @param comp[in/out]: pointer to the compressor, with at least one pending byte and room for a token
+ *
+ * @return void
+ */
+static void compressEncode(Std_Compress_Types *comp);
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to read a byte of the stream at a position, from the window or from the
+ *        lookahead
+ *
+ * @param comp[in]: pointer to the compressor
+ * @param position[in]: position of the byte, before pos + nOfPending
+ *
+ * @return uint8_t: byte at the position
+ */
+static uint8_t compressByte(const Std_Compress_Types *comp, uint16_t position)
+{
+    uint16_t offset = (uint16_t)(position - comp->pos);
+    uint8_t data;
+
+    /* Positions before pos wrap to large offsets */
+    if(offset < comp->nOfPending)
+    {
+        data = comp->lookahead[(comp->lookaheadStart + offset) & COMPRESS_LOOKAHEAD_MASK];
+    }
+    else
+    {
+        data = comp->window[position & COMPRESS_WINDOW_MASK];
+    }
+
+    return data;
+}
+
+/**
+ * @brief This function is used to get the chain of the two bytes starting a match
+ *
+ * @param b0[in]: first byte
+ * @param b1[in]: second byte
+ *
+ * @return uint32_t: index of the chain
+ */
+static uint32_t compressHash(uint8_t b0, uint8_t b1)
+{
+    /* Multiplicative hash, the upper bits of the 16-bit product mix both bytes */
+    return ((((((uint32_t)b0 << 8U) | b1) * 40503U) & 0xFFFFU) >> (16U - COMPRESS_HASH_BITS)) & COMPRESS_HASH_MASK;
+}
+
+/**
+ * @brief This function is used to add bits to the output, most significant first
+ *
+ * @param comp[in/out]: pointer to the compressor
+ * @param value[in]: bits to add, right aligned
+ * @param nOfBits[in]: number of bits, at most 16
+ *
+ * @return void
+ */
+static void compressPutBits(Std_Compress_Types *comp, uint32_t value, uint8_t nOfBits)
+{
+    comp->bits = (comp->bits << nOfBits) | (value & ((1UL << nOfBits) - 1U));
+    comp->nOfBits += nOfBits;
+
+    while(comp->nOfBits >= 8U)
+    {
+        comp->nOfBits -= 8U;
+        comp->out[comp->outLen] = (uint8_t)(comp->bits >> comp->nOfBits);
+        comp->outLen++;
+    }
+}
+
+/**
+ * @brief This function is used to move the output bytes to the Tx ring
+ *
+ * @param comp[in/out]: pointer to the compressor
+ *
+ * @return void
+ */
+static void compressDrain(Std_Compress_Types *comp)
+{
+    if(0 != comp->outLen)
+    {
+        uint32_t nOfSent = LPUART_Send(comp->pLPUARTx, comp->out, comp->outLen);
+
+        for(uint32_t i = nOfSent; i < comp->outLen; i++)
+        {
+            comp->out[i - nOfSent] = comp->out[i];
+        }
+
+        comp->outLen -= (uint8_t)nOfSent;
+        comp->stats.bytesOut += nOfSent;
+    }
+}
+
+/**
+ * @brief This function is used to make room in the output for one token
+ *
+ * @param comp[in/out]: pointer to the compressor
+ *
+ * @return uint8_t: 1 if a token fits, 0 while the Tx ring is full
+ */
+static uint8_t compressHasRoom(Std_Compress_Types *comp)
+{
+    if((COMPRESS_OUT_SIZE - comp->outLen) < COMPRESS_TOKEN_BYTES)
+    {
+        compressDrain(comp);
+    }
+
+    return ((COMPRESS_OUT_SIZE - comp->outLen) >= COMPRESS_TOKEN_BYTES) ? 1U : 0U;
+}
+
+/**
+ * @brief This function is used to encode the start of the lookahead as the longest match found in the
+ *        window, or as a literal
+ *
+ * The chains are completed first up to the byte before the lookahead, so a run of one byte is found at
+ * distance 1. A match may run into the lookahead, the receiver copies it byte by byte.
+ *
+ * @param comp[in/out]: pointer to the compressor, with at least one pending byte and room for a token
+ *
+ * @return void
+ */
+static void compressEncode(Std_Compress_Types *comp)
+{
+    uint32_t bestLen = 0;
+    uint16_t bestDist = 0;
+    uint32_t nOfEncoded;
+
+    while(comp->hashed != comp->pos)
+    {
+        uint32_t chain = compressHash(compressByte(comp, comp->hashed), compressByte(comp, comp->hashed + 1U));
+
+        comp->prev[comp->hashed & COMPRESS_WINDOW_MASK] = comp->head[chain];
+        comp->head[chain] = comp->hashed;
+        comp->hashed++;
+    }
+
+    if(comp->nOfPending >= COMPRESS_MATCH_MIN)
+    {
+        uint16_t candidate = comp->head[compressHash(compressByte(comp, comp->pos), compressByte(comp, comp->pos + 1U))];
+        uint16_t lastDist = 0;
+
+        for(uint32_t i = 0; (i < COMPRESS_CHAIN_MAX) && (bestLen < comp->nOfPending); i++)
+        {
+            uint16_t dist = (uint16_t)(comp->pos - candidate);
+            uint32_t len = 0;
+
+            /* A chain only goes back in time, a shorter distance is an entry overwritten since */
+            if((dist <= lastDist) || (dist >= COMPRESS_WINDOW_SIZE))
+            {
+                break;
+            }
+
+            while((len < comp->nOfPending) && (compressByte(comp, candidate + len) == compressByte(comp, comp->pos + len)))
+            {
+                len++;
+            }
+
+            if(len > bestLen)
+            {
+                bestLen = len;
+                bestDist = dist;
+            }
+
+            lastDist = dist;
+            candidate = comp->prev[candidate & COMPRESS_WINDOW_MASK];
+        }
+    }
+
+    if(bestLen >= COMPRESS_MATCH_MIN)
+    {
+        /* Flag 0 then the distance, below 2^COMPRESS_WINDOW_BITS */
+        compressPutBits(comp, bestDist, (uint8_t)(COMPRESS_WINDOW_BITS + 1U));
+        compressPutBits(comp, bestLen - COMPRESS_MATCH_MIN, (uint8_t)COMPRESS_LENGTH_BITS);
+        comp->stats.matches++;
+        nOfEncoded = bestLen;
+    }
+    else
+    {
+        compressPutBits(comp, 0x100U | compressByte(comp, comp->pos), 9U);
+        comp->stats.literals++;
+        nOfEncoded = 1U;
+    }
+
+    for(uint32_t i = 0; i < nOfEncoded; i++)
+    {
+        comp->window[comp->pos & COMPRESS_WINDOW_MASK] = comp->lookahead[comp->lookaheadStart];
+        comp->lookaheadStart = (uint8_t)((comp->lookaheadStart + 1U) & COMPRESS_LOOKAHEAD_MASK);
+        comp->nOfPending--;
+        comp->pos++;
+    }
+
+    comp->isDirty = 1;
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to start a new stream with an empty window
+ *
+ * @param comp[out]: pointer to the compressor
+ * @param pLPUARTx[in]: LPUART instance, set up with LPUART_BufferInit
+ *
+ * @return Std_Compress_Status: COMPRESS_E_NOT_OK if a parameter is not valid
+ */
+Std_Compress_Status compressInit(Std_Compress_Types *comp, LPUART_Type *pLPUARTx)
+{
+    Std_Compress_Status status = COMPRESS_E_NOT_OK;
+
+    if((0 != comp) && (0 != pLPUARTx))
+    {
+        /* The receiver starts with the same zero window */
+        *comp = (Std_Compress_Types){0};
+        comp->pLPUARTx = pLPUARTx;
+        status = COMPRESS_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to compress data into the Tx ring without waiting, the last bytes stay in
+ *        the lookahead until more data comes or compressFlush is called
+ *
+ * A token is encoded each time the lookahead is full, so the time per byte is bounded by
+ * COMPRESS_CHAIN_MAX comparisons of at most COMPRESS_MATCH_MAX bytes.
+ *
+ * @param comp[in/out]: pointer to the compressor
+ * @param pData[in]: pointer to the data
+ * @param len[in]: length of the data
+ *
+ * @return uint32_t: number of bytes taken, less than len when the Tx ring is full
+ */
+uint32_t compressWrite(Std_Compress_Types *comp, const uint8_t *pData, uint32_t len)
+{
+    uint32_t nOfTaken = 0;
+    uint8_t isFull = 0;
+
+    TRACE_ENTER(TRACE_ID_COMPRESS_WRITE);
+
+    if((0 != comp) && (0 != pData))
+    {
+        while((nOfTaken < len) && (0 == isFull))
+        {
+            if(comp->nOfPending < COMPRESS_MATCH_MAX)
+            {
+                comp->lookahead[(comp->lookaheadStart + comp->nOfPending) & COMPRESS_LOOKAHEAD_MASK] = pData[nOfTaken];
+                comp->nOfPending++;
+                nOfTaken++;
+            }
+            else if(0 != compressHasRoom(comp))
+            {
+                compressEncode(comp);
+            }
+            else
+            {
+                isFull = 1;
+            }
+        }
+
+        comp->stats.bytesIn += nOfTaken;
+    }
+
+    TRACE_EXIT(TRACE_ID_COMPRESS_WRITE);
+
+    return nOfTaken;
+}
+
+/**
+ * @brief This function is used to send all the data taken so far, ended by a flush marker so the
+ *        receiver can decode it at once, it should be called at the end of each packet
+ *
+ * @param comp[in/out]: pointer to the compressor
+ *
+ * @return Std_Compress_Status: COMPRESS_E_BUSY while the Tx ring is full, call again until COMPRESS_E_OK
+ */
+Std_Compress_Status compressFlush(Std_Compress_Types *comp)
+{
+    Std_Compress_Status status = COMPRESS_E_NOT_OK;
+
+    if(0 != comp)
+    {
+        while((0 != comp->nOfPending) && (0 != compressHasRoom(comp)))
+        {
+            compressEncode(comp);
+        }
+
+        if((0 == comp->nOfPending) && (0 != comp->isDirty) && (0 != compressHasRoom(comp)))
+        {
+            /* Distance 0 then padding, the receiver drops the rest of the byte */
+            compressPutBits(comp, 0U, (uint8_t)(COMPRESS_WINDOW_BITS + 1U));
+
+            if(0 != comp->nOfBits)
+            {
+                compressPutBits(comp, 0U, (uint8_t)(8U - comp->nOfBits));
+            }
+
+            comp->isDirty = 0;
+            comp->stats.flushes++;
+        }
+
+        compressDrain(comp);
+
+        status = ((0 == comp->nOfPending) && (0 == comp->isDirty) && (0 == comp->outLen)) ? COMPRESS_E_OK : COMPRESS_E_BUSY;
+    }
+
+    return status;
+}
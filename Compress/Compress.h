@@ -0,0 +1,133 @@
+/**
+ * @file Compress.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the streaming LZ compressor feeding the LPUART Tx ring
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Stream on the wire, bits sent most significant first:
+ *     literal:  1, byte (8 bits)
+ *     match:    0, distance back in the window (COMPRESS_WINDOW_BITS, 1 and up),
+ *               length minus COMPRESS_MATCH_MIN (COMPRESS_LENGTH_BITS)
+ *     flush:    0, distance 0, then zero bits up to the next byte boundary
+ * The window starts filled with zeros and is kept across flushes, so the stream must arrive complete and
+ * in order from compressInit on. Tools/Decompress rebuilds the data on the host.
+ */
+#ifndef COMPRESS_H_
+#define COMPRESS_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpuart_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#ifndef COMPRESS_WINDOW_BITS
+#define COMPRESS_WINDOW_BITS    (8U)    /* The window holds 2^COMPRESS_WINDOW_BITS bytes, at most 15 */
+#endif
+
+#ifndef COMPRESS_LENGTH_BITS
+#define COMPRESS_LENGTH_BITS    (4U)    /* Bits of the length of a match */
+#endif
+
+#ifndef COMPRESS_HASH_BITS
+#define COMPRESS_HASH_BITS      (8U)    /* The match index has 2^COMPRESS_HASH_BITS chains */
+#endif
+
+#ifndef COMPRESS_CHAIN_MAX
+#define COMPRESS_CHAIN_MAX      (8U)    /* Candidates compared for each match, bounds the time per byte */
+#endif
+
+#ifndef COMPRESS_OUT_SIZE
+#define COMPRESS_OUT_SIZE       (32U)   /* Compressed bytes waiting for room in the Tx ring */
+#endif
+
+#define COMPRESS_WINDOW_SIZE    (1U << COMPRESS_WINDOW_BITS)    /* Bytes of the window */
+#define COMPRESS_HASH_SIZE      (1U << COMPRESS_HASH_BITS)      /* Chains of the match index */
+#define COMPRESS_MATCH_MIN      (2U)    /* Shortest match, 13 bits instead of 18 for two literals */
+#define COMPRESS_MATCH_MAX      (COMPRESS_MATCH_MIN + (1U << COMPRESS_LENGTH_BITS) - 1U)   /* Longest match */
+#define COMPRESS_LOOKAHEAD_SIZE (32U)   /* Ring of the bytes not encoded yet, a power of 2 above COMPRESS_MATCH_MAX */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    COMPRESS_E_OK,          /* Operation completed without error */
+    COMPRESS_E_NOT_OK,      /* Operation not completed */
+    COMPRESS_E_BUSY,        /* The Tx ring is full, call again later */
+} Std_Compress_Status;      /* Standard status type */
+
+typedef struct
+{
+    uint32_t bytesIn;           /* Bytes given to compressWrite */
+    uint32_t bytesOut;          /* Compressed bytes queued to the Tx ring */
+    uint32_t literals;          /* Bytes sent as literals */
+    uint32_t matches;           /* Matches sent */
+    uint32_t flushes;           /* Flush markers sent */
+} Compress_Statistics_Types;    /* Statistics of the compressor */
+
+typedef struct
+{
+    LPUART_Type *pLPUARTx;                          /* LPUART instance, set up with LPUART_BufferInit */
+    uint8_t window[COMPRESS_WINDOW_SIZE];           /* Last bytes encoded */
+    uint16_t head[COMPRESS_HASH_SIZE];              /* Latest position of each chain */
+    uint16_t prev[COMPRESS_WINDOW_SIZE];            /* Previous position in the chain of each window byte */
+    uint8_t lookahead[COMPRESS_LOOKAHEAD_SIZE];     /* Bytes received and not encoded yet */
+    uint8_t lookaheadStart;                         /* First byte of the lookahead ring */
+    uint8_t nOfPending;                             /* Bytes in the lookahead ring */
+    uint16_t pos;                                   /* Position of the first byte of the lookahead ring */
+    uint16_t hashed;                                /* First position not in the match index yet */
+    uint32_t bits;                                  /* Bits not written to out yet, right aligned */
+    uint8_t nOfBits;                                /* Number of bits in bits */
+    uint8_t isDirty;                                /* 1 when data was encoded since the last flush marker */
+    uint8_t out[COMPRESS_OUT_SIZE];                 /* Compressed bytes waiting for the Tx ring */
+    uint8_t outLen;                                 /* Number of bytes in out */
+    Compress_Statistics_Types stats;                /* Statistics of the compressor */
+} Std_Compress_Types;                               /* Compressor of one stream, all its memory is here */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name compressInit
+ *
+ * @brief This function is used to start a new stream with an empty window
+ *
+ * @param comp[out]: pointer to the compressor
+ * @param pLPUARTx[in]: LPUART instance, set up with LPUART_BufferInit
+ *
+ * @return Std_Compress_Status: COMPRESS_E_NOT_OK if a parameter is not valid
+ */
+Std_Compress_Status compressInit(Std_Compress_Types *comp, LPUART_Type *pLPUARTx);
+
+/**
+ * @name compressWrite
+ *
+ * @brief This function is used to compress data into the Tx ring without waiting, the last bytes stay in
+ *        the lookahead until more data comes or compressFlush is called
+ *
+ * @param comp[in/out]: pointer to the compressor
+ * @param pData[in]: pointer to the data
+ * @param len[in]: length of the data
+ *
+ * @return uint32_t: number of bytes taken, less than len when the Tx ring is full
+ */
+uint32_t compressWrite(Std_Compress_Types *comp, const uint8_t *pData, uint32_t len);
+
+/**
+ * @name compressFlush
+ *
+ * @brief This function is used to send all the data taken so far, ended by a flush marker so the
+ *        receiver can decode it at once, it should be called at the end of each packet
+ *
+ * @param comp[in/out]: pointer to the compressor
+ *
+ * @return Std_Compress_Status: COMPRESS_E_BUSY while the Tx ring is full, call again until COMPRESS_E_OK
+ */
+Std_Compress_Status compressFlush(Std_Compress_Types *comp);
+
+#endif /* COMPRESS_H_ */
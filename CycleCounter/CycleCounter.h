@@ -0,0 +1,63 @@
+/**
+ * @file CycleCounter.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the cycle counter shared by the drivers and the middleware
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef CYCLECOUNTER_H_
+#define CYCLECOUNTER_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include <stdint.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#if defined(__arm__)
+#define CYCLE_COUNTER_DEMCR         (*(volatile uint32_t *)0xE000EDFCUL)    /* Debug exception and monitor control */
+#define CYCLE_COUNTER_DEMCR_TRCENA  (1UL << 24U)                            /* Enable the DWT */
+#define CYCLE_COUNTER_DWT_CTRL      (*(volatile uint32_t *)0xE0001000UL)    /* DWT control */
+#define CYCLE_COUNTER_DWT_CYCCNTENA (1UL << 0U)                             /* Enable the cycle counter */
+#define CYCLE_COUNTER_DWT_CYCCNT    (*(volatile uint32_t *)0xE0001004UL)    /* DWT cycle counter */
+#endif
+
+#ifndef CYCLE_COUNTER
+#if defined(__arm__)
+#define CYCLE_COUNTER()     (CYCLE_COUNTER_DWT_CYCCNT)  /* DWT CYCCNT, started by CYCLE_COUNTER_ENABLE */
+#else
+#define CYCLE_COUNTER()     cycleCounterSim()           /* Cycle counter of the host simulator */
+#endif
+#endif
+
+#ifndef CYCLE_COUNTER_ENABLE
+#if defined(__arm__)
+/* Set DEMCR TRCENA and DWT CYCCNTENA, can be called again when the counter already runs */
+#define CYCLE_COUNTER_ENABLE() do { \
+    CYCLE_COUNTER_DEMCR |= CYCLE_COUNTER_DEMCR_TRCENA; \
+    CYCLE_COUNTER_DWT_CTRL |= CYCLE_COUNTER_DWT_CYCCNTENA; } while(0)
+#else
+#define CYCLE_COUNTER_ENABLE() do { } while(0)          /* The counter of the host simulator always runs */
+#endif
+#endif
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+#if !defined(__arm__)
+/**
+ * @name cycleCounterSim
+ *
+ * @brief This function is used to read the cycle counter of the host simulator, it is defined by the
+ *        simulator and only used in the host builds
+ *
+ * @return uint32_t: cycles counted since the start, wrapping like DWT CYCCNT
+ */
+uint32_t cycleCounterSim(void);
+#endif
+
+#endif /* CYCLECOUNTER_H_ */
@@ -0,0 +1,57 @@
+/**
+ * @file Det.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the development error detection shared by the drivers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Det.h"
+#include <stdatomic.h>
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static atomic_uint_fast32_t detCount;       /* Number of failed checks */
+
+static const char * volatile detLastApi;    /* Function of the last failed check */
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to report a failed parameter check, it can be called from any context
+ *        including ISR
+ *
+ * @param api[in]: name of the function whose parameter is not valid
+ *
+ * @return uint8_t: always 0, the value of the failed check
+ */
+uint8_t detReportError(const char *api)
+{
+    detLastApi = api;
+    atomic_fetch_add_explicit(&detCount, 1U, memory_order_relaxed);
+
+    return 0U;
+}
+
+/**
+ * @brief This function is used to read the development errors reported
+ *
+ * @param pError[out]: errors reported
+ *
+ * @return void
+ */
+void detGetError(Det_Error_Types *pError)
+{
+    if(0 != pError)
+    {
+        pError->count = (uint32_t)atomic_load_explicit(&detCount, memory_order_relaxed);
+        pError->api = detLastApi;
+    }
+}
@@ -0,0 +1,68 @@
+/**
+ * @file Det.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the development error detection shared by the drivers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef DET_H_
+#define DET_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include <stdint.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#ifndef DET_ENABLE
+#define DET_ENABLE          (1)     /* 1 for development builds, 0 for validated release images */
+#endif
+
+#if (1 == DET_ENABLE)
+/* The parameter is checked and a failed check is reported with the name of the calling function */
+#define DET_CHECK(cond)     ((cond) ? 1U : detReportError(__func__))
+#else
+/* The caller guarantees the parameter, the check compiles to a constant and its branch is removed */
+#define DET_CHECK(cond)     (1U)
+#endif
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    uint32_t count;     /* Number of failed checks since reset */
+    const char *api;    /* Function of the last failed check, 0 if none */
+} Det_Error_Types;      /* Development errors reported */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name detReportError
+ *
+ * @brief This function is used to report a failed parameter check, it can be called from any context
+ *        including ISR
+ *
+ * @param api[in]: name of the function whose parameter is not valid
+ *
+ * @return uint8_t: always 0, the value of the failed check
+ */
+uint8_t detReportError(const char *api);
+
+/**
+ * @name detGetError
+ *
+ * @brief This function is used to read the development errors reported
+ *
+ * @param pError[out]: errors reported
+ *
+ * @return void
+ */
+void detGetError(Det_Error_Types *pError);
+
+#endif /* DET_H_ */
@@ -15,7 +15,7 @@
 /**
  * INCLUSION
  */
-#include "../include/S32K144.h"
+#include "S32K144.h"
 /**
  * TYPE DEFINITIONS
  */
@@ -15,7 +15,7 @@
 /**
  * INCLUSIONS
  */
-#include "../include/S32K144.h"
+#include "S32K144.h"
 
 /**
  * MACROS
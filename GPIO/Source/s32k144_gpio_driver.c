@@ -12,21 +12,25 @@
 /**
  * INCLUSION
  */
-#include "../src/Driver/GPIO/Include/s32k144_gpio_driver.h"
+#include "s32k144_gpio_driver.h"
 
-#include "../src/Driver/GPIO/Include/s32k144_gpio_hal.h"
+#include "s32k144_gpio_hal.h"
+
+#include "Trace.h"
+#include "Det.h"
 
 /**
  * MACROS
  */
 /**
- * @brief   Check if the pin is available
+ * @brief   Check if the pin is available, the check is reported in development builds and compiled out
+ *          in release builds
  *
  * @param pin   [in]    GPIO pin
  * @param port  [in]    GPIO port
  * @return Std_GPIO_Status    1 if available, 0 if not available
  */
-#define PIN_IS_AVAILABLE(pin, port)     ((pin) < ((port == PTE) ? 17U : 18U))
+#define PIN_IS_AVAILABLE(pin, port)     DET_CHECK((pin) < ((port == PTE) ? 17U : 18U))
 
 /**
  * FUNCTION DEFINITIONS
@@ -168,6 +172,8 @@ uint32_t GPIO_TogglePin(GPIO_Type *pGPIOx, ARM_GPIO_Pin_Type pin)
 {
     Std_GPIO_Status result = GPIO_E_OK;
 
+    TRACE_ENTER(TRACE_ID_GPIO_TOGGLE);
+
     /* Check if the pin is available and toggle the value for the pin */
     if (PIN_IS_AVAILABLE(pin, pGPIOx)) {
         HAL_GPIO_TogglePin(pGPIOx, pin);
@@ -177,5 +183,7 @@ uint32_t GPIO_TogglePin(GPIO_Type *pGPIOx, ARM_GPIO_Pin_Type pin)
         result = GPIO_E_NOT_OK;
     }
 
+    TRACE_EXIT(TRACE_ID_GPIO_TOGGLE);
+
     return result;
 }
@@ -12,7 +12,7 @@
 /**
  * INCLUSIONS
  */
-#include "../src/Driver/GPIO/Include/s32k144_gpio_hal.h"
+#include "s32k144_gpio_hal.h"
 
 /**
  * FUNCTIONS DEFINITIONS
@@ -0,0 +1,542 @@
+/**
+ * @file Lin.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the LIN 2.x master and slave stack running over LPUART
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Lin.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LIN_INSTANCE_NUM    (3U)    /* Number of LPUART instances */
+#define LIN_ID_MASK         (0x3FU) /* Identifier bits of a protected identifier */
+#define LIN_ID_DIAG_MASTER  (0x3CU) /* Master request diagnostic frame */
+#define LIN_ID_DIAG_SLAVE   (0x3DU) /* Slave response diagnostic frame */
+
+#define LIN_LINE_ERROR_FLAGS    (LPUART_STAT_OR_MASK | LPUART_STAT_NF_MASK | LPUART_STAT_FE_MASK | LPUART_STAT_PF_MASK)    /* Line error flags */
+
+#define LIN_BIT(value, n)   (((value) >> (n)) & 1U)     /* Get one bit of a value */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+/**
+ * @name linGetIndex
+ *
+ * @brief This function is used to get the index of an LPUART instance
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint8_t: index of the instance
+ */
+static uint8_t linGetIndex(LPUART_Type *pLPUARTx);
+
+/**
+ * @name linStartResponse
+ *
+ * @brief This function is used to start the response of the frame whose header was received
+ *
+ * @param lin[in/out]: pointer to the node
+ *
+ * @return void
+ */
+static void linStartResponse(Std_Lin_Types *lin);
+
+/**
+ * @name linReceive
+ *
+ * @brief This function is used to move the state machine with a received byte
+ *
+ * @param lin[in/out]: pointer to the node
+ * @param data[in]: byte received
+ *
+ * @return void
+ */
+static void linReceive(Std_Lin_Types *lin, uint8_t data);
+
+/**
+ * @name linIrqHandler
+ *
+ * @brief This function is used to serve the LPUART interrupt of a node
+ *
+ * @param lin[in/out]: pointer to the node
+ *
+ * @return void
+ */
+static void linIrqHandler(Std_Lin_Types *lin);
+
+static void linIrqHandler0(void);
+static void linIrqHandler1(void);
+static void linIrqHandler2(void);
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Std_Lin_Types *linNodes[LIN_INSTANCE_NUM];   /* Node attached to each LPUART instance */
+
+static const LPUART_CallbackPtr linIrqHandlers[LIN_INSTANCE_NUM] =
+{
+    linIrqHandler0, linIrqHandler1, linIrqHandler2
+};  /* Callback registered for each LPUART instance */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to get the index of an LPUART instance
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint8_t: index of the instance
+ */
+static uint8_t linGetIndex(LPUART_Type *pLPUARTx)
+{
+    uint8_t index = 0;
+
+    if(LPUART1 == pLPUARTx)
+    {
+        index = 1;
+    }
+    else if(LPUART2 == pLPUARTx)
+    {
+        index = 2;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return index;
+}
+
+/**
+ * @brief This function is used to start the response of the frame whose header was received
+ *
+ * @param lin[in/out]: pointer to the node
+ *
+ * @return void
+ */
+static void linStartResponse(Std_Lin_Types *lin)
+{
+    Std_Lin_Frame_Types *pFrame = lin->pFrame;
+
+    lin->index = 0;
+    lin->state = LIN_STATE_RESPONSE;
+
+    if(LIN_FRAME_PUBLISH == pFrame->direction)
+    {
+        for(uint8_t i = 0; i < pFrame->length; i++)
+        {
+            lin->buffer[i] = pFrame->data[i];
+        }
+        lin->buffer[pFrame->length] = linChecksum(pFrame->seed, lin->buffer, pFrame->length);
+
+        HAL_LPUART_WriteData(lin->pLPUARTx, lin->buffer[0]);
+    }
+}
+
+/**
+ * @brief This function is used to move the state machine with a received byte
+ *
+ * Every byte sent by the node is read back, the next one is written only once the previous one has
+ * been seen on the bus.
+ *
+ * @param lin[in/out]: pointer to the node
+ * @param data[in]: byte received
+ *
+ * @return void
+ */
+static void linReceive(Std_Lin_Types *lin, uint8_t data)
+{
+    Std_Lin_Frame_Types *pFrame = lin->pFrame;
+
+    switch(lin->state)
+    {
+        case LIN_STATE_SYNC:
+            if(LIN_SYNC_BYTE != data)
+            {
+                lin->errors.syncErrors++;
+                lin->state = LIN_STATE_IDLE;
+            }
+            else
+            {
+                if(LIN_ROLE_MASTER == lin->role)
+                {
+                    HAL_LPUART_WriteData(lin->pLPUARTx, pFrame->pid);
+                }
+                lin->state = LIN_STATE_PID;
+            }
+            break;
+
+        case LIN_STATE_PID:
+            if(LIN_ROLE_MASTER == lin->role)
+            {
+                if(pFrame->pid != data)
+                {
+                    lin->errors.readbackErrors++;
+                    lin->state = LIN_STATE_IDLE;
+                }
+                else
+                {
+                    linStartResponse(lin);
+                }
+            }
+            else
+            {
+                uint8_t frameIndex = lin->frameById[data & LIN_ID_MASK];
+
+                if(LIN_FRAME_NONE == frameIndex)
+                {
+                    /* Frame of another node */
+                    lin->state = LIN_STATE_IDLE;
+                }
+                else if(lin->frames[frameIndex].pid != data)
+                {
+                    lin->errors.parityErrors++;
+                    lin->state = LIN_STATE_IDLE;
+                }
+                else
+                {
+                    lin->pFrame = &lin->frames[frameIndex];
+                    linStartResponse(lin);
+                }
+            }
+            break;
+
+        case LIN_STATE_RESPONSE:
+            if(LIN_FRAME_PUBLISH == pFrame->direction)
+            {
+                if(lin->buffer[lin->index] != data)
+                {
+                    lin->errors.readbackErrors++;
+                    lin->state = LIN_STATE_IDLE;
+                }
+                else if(lin->index < pFrame->length)
+                {
+                    lin->index++;
+                    HAL_LPUART_WriteData(lin->pLPUARTx, lin->buffer[lin->index]);
+                }
+                else
+                {
+                    pFrame->isUpdated = 1;
+                    lin->state = LIN_STATE_IDLE;
+                }
+            }
+            else
+            {
+                lin->buffer[lin->index] = data;
+
+                if(lin->index < pFrame->length)
+                {
+                    lin->index++;
+                }
+                else if(linChecksum(pFrame->seed, lin->buffer, pFrame->length) != data)
+                {
+                    lin->errors.checksumErrors++;
+                    lin->state = LIN_STATE_IDLE;
+                }
+                else
+                {
+                    for(uint8_t i = 0; i < pFrame->length; i++)
+                    {
+                        pFrame->data[i] = lin->buffer[i];
+                    }
+                    pFrame->isUpdated = 1;
+                    lin->state = LIN_STATE_IDLE;
+                }
+            }
+            break;
+
+        default:
+            /* Byte outside of a frame */
+            break;
+    }
+}
+
+/**
+ * @brief This function is used to serve the LPUART interrupt of a node
+ *
+ * @param lin[in/out]: pointer to the node
+ *
+ * @return void
+ */
+static void linIrqHandler(Std_Lin_Types *lin)
+{
+    uint32_t stat = HAL_LPUART_GetStatus(lin->pLPUARTx);
+
+    /* A break starts a new frame whatever the state, the master reads back its own break */
+    if(0 != (stat & LPUART_STAT_LBKDIF_MASK))
+    {
+        HAL_LPUART_ClearStatusFlags(lin->pLPUARTx, LPUART_STAT_LBKDIF_MASK);
+
+        if((LIN_ROLE_MASTER == lin->role) && (LIN_STATE_BREAK == lin->state))
+        {
+            HAL_LPUART_WriteData(lin->pLPUARTx, LIN_SYNC_BYTE);
+            lin->state = LIN_STATE_SYNC;
+        }
+        else if(LIN_ROLE_SLAVE == lin->role)
+        {
+            lin->state = LIN_STATE_SYNC;
+        }
+        else
+        {
+            /* Break from another master, or outside of a slot */
+            lin->state = LIN_STATE_IDLE;
+        }
+    }
+
+    if(0 != (stat & LIN_LINE_ERROR_FLAGS))
+    {
+        HAL_LPUART_ClearStatusFlags(lin->pLPUARTx, stat & LIN_LINE_ERROR_FLAGS);
+        lin->errors.lineErrors++;
+        lin->state = LIN_STATE_IDLE;
+    }
+
+    if(0 != (stat & LPUART_STAT_RDRF_MASK))
+    {
+        linReceive(lin, (uint8_t)HAL_LPUART_ReadData(lin->pLPUARTx));
+    }
+}
+
+/**
+ * @brief These functions are the LPUART callbacks of each instance
+ *
+ * @return void
+ */
+static void linIrqHandler0(void)
+{
+    linIrqHandler(linNodes[0]);
+}
+
+static void linIrqHandler1(void)
+{
+    linIrqHandler(linNodes[1]);
+}
+
+static void linIrqHandler2(void)
+{
+    linIrqHandler(linNodes[2]);
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to initialize a LIN node, the LPUART is set up from the handle and its
+ *        interrupt is taken over by the stack
+ *
+ * The protected identifiers, checksum seeds and the identifier lookup are computed here so the
+ * interrupt only indexes tables.
+ *
+ * @param lin[in/out]: pointer to the node
+ * @param pLPUARTHandle[in]: LPUART handle, 8 bit frames without parity at the bus baudrate
+ * @param role[in]: role of the node
+ * @param frames[in/out]: frame table
+ * @param nOfFrames[in]: number of entries in the frame table
+ *
+ * @return Std_Lin_Status: LIN_E_NOT_OK if the handle or the frame table is not valid
+ */
+Std_Lin_Status linInit(Std_Lin_Types *lin, LPUART_Handle_Type *pLPUARTHandle, Lin_Role_Types role,
+                       Std_Lin_Frame_Types *frames, uint8_t nOfFrames)
+{
+    Std_Lin_Status status = LIN_E_NOT_OK;
+
+    if((0 != lin) && (0 != pLPUARTHandle) && (0 != frames) && (0 != nOfFrames) && (LIN_FRAME_NONE > nOfFrames) &&
+       (LIN_ROLE_MASTER >= role) &&
+       (LPUART_FRAME_8BITS == pLPUARTHandle->LPUART_Config.frameLenth) &&
+       (LPUART_PARITY_DISABLE == pLPUARTHandle->LPUART_Config.parityMode))
+    {
+        status = LIN_E_OK;
+
+        for(uint8_t i = 0; i < LIN_ID_NUM; i++)
+        {
+            lin->frameById[i] = LIN_FRAME_NONE;
+        }
+
+        for(uint8_t i = 0; (i < nOfFrames) && (LIN_E_OK == status); i++)
+        {
+            Std_Lin_Frame_Types *pFrame = &frames[i];
+
+            if((LIN_ID_NUM <= pFrame->id) || (0 == pFrame->length) || (LIN_DATA_MAX < pFrame->length) ||
+               (0 == pFrame->data) || (LIN_FRAME_SUBSCRIBE < pFrame->direction) ||
+               (LIN_FRAME_NONE != lin->frameById[pFrame->id]))
+            {
+                status = LIN_E_NOT_OK;
+            }
+            else
+            {
+                pFrame->pid = linComputePid(pFrame->id);
+
+                if((LIN_CHECKSUM_ENHANCED == pFrame->checksum) &&
+                   (LIN_ID_DIAG_MASTER != pFrame->id) && (LIN_ID_DIAG_SLAVE != pFrame->id))
+                {
+                    pFrame->seed = pFrame->pid;
+                }
+                else
+                {
+                    pFrame->seed = 0;
+                }
+
+                pFrame->isUpdated = 0;
+                lin->frameById[pFrame->id] = i;
+            }
+        }
+    }
+
+    if((LIN_E_OK == status) && (LPUART_E_OK == LPUART_Init(pLPUARTHandle)))
+    {
+        uint8_t index = linGetIndex(pLPUARTHandle->pLPUARTx);
+
+        lin->pLPUARTx = pLPUARTHandle->pLPUARTx;
+        lin->role = role;
+        lin->frames = frames;
+        lin->nOfFrames = nOfFrames;
+        lin->schedule = 0;
+        lin->nOfSlots = 0;
+        lin->slotIndex = 0;
+        lin->ticksLeft = 0;
+        lin->state = LIN_STATE_IDLE;
+        lin->pFrame = 0;
+        lin->index = 0;
+        lin->errors = (Lin_Errors_Types){0};
+
+        linNodes[index] = lin;
+
+        HAL_LPUART_TxInterruptConfig(lin->pLPUARTx, LPUART_TX_INTERRUPT_DISABLE);
+        HAL_LPUART_RxInterruptConfig(lin->pLPUARTx, LPUART_RX_INTERRUPT_ENABLE);
+        LPUART_CallbackRegister(lin->pLPUARTx, linIrqHandlers[index]);
+        LPUART_LinModeConfig(lin->pLPUARTx, 1);
+    }
+    else
+    {
+        status = LIN_E_NOT_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to select the schedule table run by the master, it starts at the next tick
+ *
+ * @param lin[in/out]: pointer to the node
+ * @param schedule[in]: schedule table, 0 to stop sending headers
+ * @param nOfSlots[in]: number of entries in the schedule table
+ *
+ * @return Std_Lin_Status: LIN_E_NOT_OK if the node is not a master or a slot refers to an unknown frame
+ */
+Std_Lin_Status linSetSchedule(Std_Lin_Types *lin, const Std_Lin_Slot_Types *schedule, uint8_t nOfSlots)
+{
+    Std_Lin_Status status = LIN_E_NOT_OK;
+
+    if(LIN_ROLE_MASTER == lin->role)
+    {
+        status = LIN_E_OK;
+
+        for(uint8_t i = 0; (0 != schedule) && (i < nOfSlots); i++)
+        {
+            if((lin->nOfFrames <= schedule[i].frameIndex) || (0 == schedule[i].ticks))
+            {
+                status = LIN_E_NOT_OK;
+            }
+        }
+
+        if((0 != schedule) && (0 == nOfSlots))
+        {
+            status = LIN_E_NOT_OK;
+        }
+    }
+
+    if(LIN_E_OK == status)
+    {
+        /* The tick interrupt ignores the node while the schedule pointer is cleared */
+        lin->schedule = 0;
+        lin->nOfSlots = nOfSlots;
+        lin->slotIndex = 0;
+        lin->ticksLeft = 1;
+        lin->schedule = schedule;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to run the schedule, it must be called from a periodic timer interrupt
+ *
+ * @param lin[in/out]: pointer to the node
+ *
+ * @return void
+ */
+void linTick(Std_Lin_Types *lin)
+{
+    if((LIN_ROLE_MASTER == lin->role) && (0 != lin->schedule))
+    {
+        lin->ticksLeft--;
+
+        if(0 == lin->ticksLeft)
+        {
+            const Std_Lin_Slot_Types *pSlot = &lin->schedule[lin->slotIndex];
+
+            if(LIN_STATE_IDLE != lin->state)
+            {
+                lin->errors.noResponses++;
+            }
+
+            lin->pFrame = &lin->frames[pSlot->frameIndex];
+            lin->ticksLeft = pSlot->ticks;
+            lin->slotIndex = ((lin->slotIndex + 1U) < lin->nOfSlots) ? (uint8_t)(lin->slotIndex + 1U) : 0U;
+            lin->state = LIN_STATE_BREAK;
+
+            HAL_LPUART_SendBreak(lin->pLPUARTx);
+        }
+    }
+}
+
+/**
+ * @brief This function is used to add the parity bits to a frame identifier
+ *
+ * @param id[in]: frame identifier, from 0 to 63
+ *
+ * @return uint8_t: protected identifier
+ */
+uint8_t linComputePid(uint8_t id)
+{
+    uint8_t p0 = LIN_BIT(id, 0) ^ LIN_BIT(id, 1) ^ LIN_BIT(id, 2) ^ LIN_BIT(id, 4);
+    uint8_t p1 = (uint8_t)(~(LIN_BIT(id, 1) ^ LIN_BIT(id, 3) ^ LIN_BIT(id, 4) ^ LIN_BIT(id, 5)) & 1U);
+
+    return (uint8_t)((id & LIN_ID_MASK) | (p0 << 6) | (p1 << 7));
+}
+
+/**
+ * @brief This function is used to compute the checksum of a response
+ *
+ * @param seed[in]: 0 for the classic checksum, protected identifier for the enhanced one
+ * @param data[in]: data bytes
+ * @param length[in]: number of data bytes
+ *
+ * @return uint8_t: checksum
+ */
+uint8_t linChecksum(uint8_t seed, const uint8_t *data, uint8_t length)
+{
+    uint16_t sum = seed;
+
+    /* Sum with the carry added back */
+    for(uint8_t i = 0; i < length; i++)
+    {
+        sum += data[i];
+
+        if(sum > 0xFFU)
+        {
+            sum -= 0xFFU;
+        }
+    }
+
+    return (uint8_t)~sum;
+}
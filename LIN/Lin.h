@@ -0,0 +1,179 @@
+/**
+ * @file Lin.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the LIN 2.x master and slave stack running over LPUART
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef LIN_H_
+#define LIN_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpuart_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LIN_DATA_MAX        (8U)        /* Maximum number of data bytes of a frame */
+#define LIN_ID_NUM          (64U)       /* Number of frame identifiers */
+#define LIN_SYNC_BYTE       (0x55U)     /* Sync field sent after the break */
+#define LIN_FRAME_NONE      (0xFFU)     /* Identifier not handled by the node */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    LIN_E_OK,           /* Operation completed without error */
+    LIN_E_NOT_OK,       /* Operation not completed */
+} Std_Lin_Status;       /* Standard status type */
+
+typedef enum
+{
+    LIN_ROLE_SLAVE,     /* Responds to the headers seen on the bus */
+    LIN_ROLE_MASTER,    /* Sends the headers of the schedule, and responds to them like a slave */
+} Lin_Role_Types;       /* Role of the node */
+
+typedef enum
+{
+    LIN_CHECKSUM_CLASSIC,   /* Checksum over the data bytes, LIN 1.x and diagnostic frames */
+    LIN_CHECKSUM_ENHANCED,  /* Checksum over the protected identifier and the data bytes, LIN 2.x */
+} Lin_Checksum_Types;       /* Checksum model of a frame */
+
+typedef enum
+{
+    LIN_FRAME_PUBLISH,      /* The node sends the response */
+    LIN_FRAME_SUBSCRIBE,    /* The node receives the response */
+} Lin_Direction_Types;      /* Direction of a frame seen from the node */
+
+typedef enum
+{
+    LIN_STATE_IDLE,         /* Waiting for a break */
+    LIN_STATE_BREAK,        /* Master sent a break, waiting to read it back */
+    LIN_STATE_SYNC,         /* Waiting for the sync field */
+    LIN_STATE_PID,          /* Waiting for the protected identifier */
+    LIN_STATE_RESPONSE,     /* Sending or receiving the response */
+} Lin_State_Types;          /* State of the frame being processed */
+
+typedef struct
+{
+    uint8_t id;                     /* Frame identifier, from 0 to 63 */
+    uint8_t length;                 /* Number of data bytes, from 1 to LIN_DATA_MAX */
+    Lin_Checksum_Types checksum;    /* Checksum model, diagnostic frames 0x3C and 0x3D are always classic */
+    Lin_Direction_Types direction;  /* Direction seen from the node */
+    uint8_t *data;                  /* Data of the frame, written by the stack for a subscribed frame */
+    volatile uint8_t isUpdated;     /* Set by the stack after each transfer without error, cleared by the user */
+    uint8_t pid;                    /* Computed by linInit: protected identifier */
+    uint8_t seed;                   /* Computed by linInit: initial value of the checksum */
+} Std_Lin_Frame_Types;              /* Entry of the frame table */
+
+typedef struct
+{
+    uint8_t frameIndex;     /* Index of the frame in the frame table */
+    uint16_t ticks;         /* Duration of the slot in calls of linTick, must cover the whole frame */
+} Std_Lin_Slot_Types;       /* Entry of a schedule table */
+
+typedef struct
+{
+    uint32_t syncErrors;        /* Sync field different from 0x55 */
+    uint32_t parityErrors;      /* Protected identifier with a wrong parity */
+    uint32_t checksumErrors;    /* Response with a wrong checksum */
+    uint32_t readbackErrors;    /* Byte sent different from the byte read back */
+    uint32_t noResponses;       /* Slot ended before the frame was complete */
+    uint32_t lineErrors;        /* Framing, noise, parity or overrun flag of the LPUART */
+} Lin_Errors_Types;             /* Error counters of the node */
+
+typedef struct
+{
+    LPUART_Type *pLPUARTx;                      /* LPUART instance */
+    Lin_Role_Types role;                        /* Role of the node */
+    Std_Lin_Frame_Types *frames;                /* Frame table */
+    uint8_t nOfFrames;                          /* Number of entries in the frame table */
+    uint8_t frameById[LIN_ID_NUM];              /* Computed by linInit: frame index of each identifier */
+    const Std_Lin_Slot_Types *schedule;         /* Schedule table run by the master */
+    uint8_t nOfSlots;                           /* Number of entries in the schedule table */
+    uint8_t slotIndex;                          /* Slot being run */
+    uint16_t ticksLeft;                         /* Ticks before the next slot */
+    volatile Lin_State_Types state;             /* State of the frame being processed */
+    Std_Lin_Frame_Types *pFrame;                /* Frame being processed */
+    uint8_t buffer[LIN_DATA_MAX + 1U];          /* Response being sent or received, with its checksum */
+    uint8_t index;                              /* Number of response bytes read */
+    Lin_Errors_Types errors;                    /* Error counters */
+} Std_Lin_Types;                                /* LIN node */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name linInit
+ *
+ * @brief This function is used to initialize a LIN node, the LPUART is set up from the handle and its
+ *        interrupt is taken over by the stack
+ *
+ * The protected identifiers, checksum seeds and the identifier lookup are computed here so the
+ * interrupt only indexes tables.
+ *
+ * @param lin[in/out]: pointer to the node
+ * @param pLPUARTHandle[in]: LPUART handle, 8 bit frames without parity at the bus baudrate
+ * @param role[in]: role of the node
+ * @param frames[in/out]: frame table
+ * @param nOfFrames[in]: number of entries in the frame table
+ *
+ * @return Std_Lin_Status: LIN_E_NOT_OK if the handle or the frame table is not valid
+ */
+Std_Lin_Status linInit(Std_Lin_Types *lin, LPUART_Handle_Type *pLPUARTHandle, Lin_Role_Types role,
+                       Std_Lin_Frame_Types *frames, uint8_t nOfFrames);
+
+/**
+ * @name linSetSchedule
+ *
+ * @brief This function is used to select the schedule table run by the master, it starts at the next tick
+ *
+ * @param lin[in/out]: pointer to the node
+ * @param schedule[in]: schedule table, 0 to stop sending headers
+ * @param nOfSlots[in]: number of entries in the schedule table
+ *
+ * @return Std_Lin_Status: LIN_E_NOT_OK if the node is not a master or a slot refers to an unknown frame
+ */
+Std_Lin_Status linSetSchedule(Std_Lin_Types *lin, const Std_Lin_Slot_Types *schedule, uint8_t nOfSlots);
+
+/**
+ * @name linTick
+ *
+ * @brief This function is used to run the schedule, it must be called from a periodic timer interrupt
+ *
+ * @param lin[in/out]: pointer to the node
+ *
+ * @return void
+ */
+void linTick(Std_Lin_Types *lin);
+
+/**
+ * @name linComputePid
+ *
+ * @brief This function is used to add the parity bits to a frame identifier
+ *
+ * @param id[in]: frame identifier, from 0 to 63
+ *
+ * @return uint8_t: protected identifier
+ */
+uint8_t linComputePid(uint8_t id);
+
+/**
+ * @name linChecksum
+ *
+ * @brief This function is used to compute the checksum of a response
+ *
+ * @param seed[in]: 0 for the classic checksum, protected identifier for the enhanced one
+ * @param data[in]: data bytes
+ * @param length[in]: number of data bytes
+ *
+ * @return uint8_t: checksum
+ */
+uint8_t linChecksum(uint8_t seed, const uint8_t *data, uint8_t length);
+
+#endif /* LIN_H_ */
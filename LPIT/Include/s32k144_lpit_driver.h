@@ -0,0 +1,127 @@
+/**
+ * @file s32k144_lpit_driver.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This is the header file of the monotonic timebase built on LPIT module of S32K144 MCU.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef S32K144_LPIT_DRIVER_H
+#define S32K144_LPIT_DRIVER_H
+
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpit_hal.h"
+#include "s32k144_pcc_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LPIT_DEADLINE_NEVER (0xFFFFFFFFFFFFFFFFULL)     /* Deadline of a wait that cannot time out */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    LPIT_E_OK,         /* Operation completed without error */
+    LPIT_E_NOT_OK,     /* Operation not completed */
+} Std_LPIT_Status;     /* Standard status type */
+
+typedef struct
+{
+    PeripheralClockSource source;   /* Functional clock selected in PCC, as CLOCK_OPTION_3 for FIRCDIV2 */
+    uint32_t frequency;             /* Frequency of the functional clock in Hz                          */
+    uint32_t tickRate;              /* Rate of the periodic tick interrupt in Hz, 0 for no tick         */
+} LPIT_Timebase_Config_Type;
+
+typedef void (*LPIT_CallbackPtr) (void);    /* LPIT callback type for the pointer to callback function */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name LPIT_TimebaseInit
+ *
+ * @brief This function is used to start the timebase: channels 0 and 1 are chained into a 64-bit counter
+ *        of the functional clock, channel 2 gives the periodic tick
+ *
+ * @param pConfig[in]: timebase settings
+ *
+ * @return Std_LPIT_Status: LPIT_E_NOT_OK if the settings are not valid
+ */
+Std_LPIT_Status LPIT_TimebaseInit(const LPIT_Timebase_Config_Type *pConfig);
+
+/**
+ * @name LPIT_GetTimestamp
+ *
+ * @brief This function is used to read the 64-bit counter, it can be called from any context
+ *
+ * @return uint64_t: functional clock cycles since LPIT_TimebaseInit, 0 if the timebase is stopped
+ */
+uint64_t LPIT_GetTimestamp(void);
+
+/**
+ * @name LPIT_GetFrequency
+ *
+ * @brief This function is used to get the frequency of the 64-bit counter
+ *
+ * @return uint32_t: frequency in Hz, 0 if the timebase is stopped
+ */
+uint32_t LPIT_GetFrequency(void);
+
+/**
+ * @name LPIT_GetTickCount
+ *
+ * @brief This function is used to get the number of periodic ticks
+ *
+ * @return uint64_t: ticks since LPIT_TimebaseInit
+ */
+uint64_t LPIT_GetTickCount(void);
+
+/**
+ * @name LPIT_Deadline
+ *
+ * @brief This function is used to compute the deadline of a wait
+ *
+ * @param timeoutUs[in]: time allowed from now, in microseconds
+ *
+ * @return uint64_t: deadline for LPIT_IsExpired, LPIT_DEADLINE_NEVER if the timebase is stopped
+ */
+uint64_t LPIT_Deadline(uint32_t timeoutUs);
+
+/**
+ * @name LPIT_IsExpired
+ *
+ * @brief This function is used to check whether a deadline has passed
+ *
+ * @param deadline[in]: deadline given by LPIT_Deadline
+ *
+ * @return uint8_t: 1 if the deadline has passed, 0 otherwise
+ */
+uint8_t LPIT_IsExpired(uint64_t deadline);
+
+/**
+ * @name LPIT_TickCallbackRegister
+ *
+ * @brief This function is used to register the function called on each periodic tick, from the interrupt
+ *
+ * @param IRQHandler[in]: function to call
+ *
+ * @return Std_LPIT_Status: status of the operation
+ */
+Std_LPIT_Status LPIT_TickCallbackRegister(LPIT_CallbackPtr IRQHandler);
+
+/**
+ * @name LPIT_DeInit
+ *
+ * @brief This function is used to stop the timebase
+ *
+ * @return Std_LPIT_Status: status of the operation
+ */
+Std_LPIT_Status LPIT_DeInit(void);
+
+#endif /* S32K144_LPIT_DRIVER_H */
@@ -0,0 +1,176 @@
+/**
+ * @file s32k144_lpit_hal.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This is the header file of the Hardware Abstraction Layer for LPIT module of S32K144 MCU.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef S32K144_LPIT_HAL_H
+#define S32K144_LPIT_HAL_H
+
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "S32K144.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+/* Register accesses whose effect goes beyond the memory, the device header of the host simulator gives its
+   models of them instead */
+#ifndef LPIT_CVAL_READ
+#define LPIT_CVAL_READ(pLPITx, channel)     ((pLPITx)->TMR[(channel)].CVAL)     /* Read a down counter */
+#endif
+
+#ifndef LPIT_SETTEN_WRITE
+#define LPIT_SETTEN_WRITE(pLPITx, mask)     ((pLPITx)->SETTEN = (mask))         /* Start and load channels */
+#endif
+
+#ifndef LPIT_CLRTEN_WRITE
+#define LPIT_CLRTEN_WRITE(pLPITx, mask)     ((pLPITx)->CLRTEN = (mask))         /* Stop channels */
+#endif
+
+#ifndef LPIT_MSR_WRITE
+#define LPIT_MSR_WRITE(pLPITx, mask)        ((pLPITx)->MSR = (mask))            /* Write 1 to clear the flags */
+#endif
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    LPIT_MODE_PERIODIC_32BITS,      /* 32-bit periodic counter */
+    LPIT_MODE_PERIODIC_DUAL_16BITS, /* Dual 16-bit periodic counter */
+    LPIT_MODE_TRIGGER_ACCUMULATOR,  /* 32-bit trigger accumulator */
+    LPIT_MODE_INPUT_CAPTURE,        /* 32-bit trigger input capture */
+} LPIT_Mode_Type;                   /* Operation mode of a timer channel */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name HAL_LPIT_ModuleEnable
+ *
+ * @brief This function is used to enable the LPIT, the timers keep running in debug and low power modes
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ *
+ * @return void
+ */
+void HAL_LPIT_ModuleEnable(LPIT_Type *pLPITx);
+
+/**
+ * @name HAL_LPIT_ModuleDisable
+ *
+ * @brief This function is used to disable the LPIT
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ *
+ * @return void
+ */
+void HAL_LPIT_ModuleDisable(LPIT_Type *pLPITx);
+
+/**
+ * @name HAL_LPIT_TimerConfig
+ *
+ * @brief This function is used to configure the mode and the chaining of a timer channel, the channel
+ *        must be stopped
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param channel[in]: timer channel, from 0 to 3
+ * @param mode[in]: operation mode
+ * @param chain[in]: 1 to decrement on the expiry of the previous channel, 0 on the functional clock
+ *
+ * @return void
+ */
+void HAL_LPIT_TimerConfig(LPIT_Type *pLPITx, uint8_t channel, LPIT_Mode_Type mode, uint8_t chain);
+
+/**
+ * @name HAL_LPIT_SetTimerValue
+ *
+ * @brief This function is used to set the value a timer channel reloads on expiry
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param channel[in]: timer channel, from 0 to 3
+ * @param value[in]: reload value, the period is value + 1 counts
+ *
+ * @return void
+ */
+void HAL_LPIT_SetTimerValue(LPIT_Type *pLPITx, uint8_t channel, uint32_t value);
+
+/**
+ * @name HAL_LPIT_GetCurrentValue
+ *
+ * @brief This function is used to read the down counter of a timer channel
+ *
+ * @param pLPITx[in]: pointer to the LPIT instance
+ * @param channel[in]: timer channel, from 0 to 3
+ *
+ * @return uint32_t: current value
+ */
+uint32_t HAL_LPIT_GetCurrentValue(LPIT_Type *pLPITx, uint8_t channel);
+
+/**
+ * @name HAL_LPIT_StartTimers
+ *
+ * @brief This function is used to start several timer channels at the same time
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param mask[in]: bit n starts channel n
+ *
+ * @return void
+ */
+void HAL_LPIT_StartTimers(LPIT_Type *pLPITx, uint32_t mask);
+
+/**
+ * @name HAL_LPIT_StopTimers
+ *
+ * @brief This function is used to stop several timer channels at the same time
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param mask[in]: bit n stops channel n
+ *
+ * @return void
+ */
+void HAL_LPIT_StopTimers(LPIT_Type *pLPITx, uint32_t mask);
+
+/**
+ * @name HAL_LPIT_InterruptConfig
+ *
+ * @brief This function is used to configure the interrupt of a timer channel
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param channel[in]: timer channel, from 0 to 3
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPIT_InterruptConfig(LPIT_Type *pLPITx, uint8_t channel, uint8_t enable);
+
+/**
+ * @name HAL_LPIT_GetStatus
+ *
+ * @brief This function is used to read the interrupt flags of the timer channels
+ *
+ * @param pLPITx[in]: pointer to the LPIT instance
+ *
+ * @return uint32_t: value of the MSR register, bit n is the flag of channel n
+ */
+uint32_t HAL_LPIT_GetStatus(LPIT_Type *pLPITx);
+
+/**
+ * @name HAL_LPIT_ClearStatusFlags
+ *
+ * @brief This function is used to clear interrupt flags of the timer channels
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param mask[in]: bit n clears the flag of channel n
+ *
+ * @return void
+ */
+void HAL_LPIT_ClearStatusFlags(LPIT_Type *pLPITx, uint32_t mask);
+
+#endif /* S32K144_LPIT_HAL_H */
@@ -0,0 +1,241 @@
+/**
+ * @file s32k144_lpit_driver.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This is the definition file of the monotonic timebase built on LPIT module of S32K144 MCU.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpit_driver.h"
+#include "Trace.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LPIT_LOW_CHANNEL    (0U)    /* Lower 32 bits of the 64-bit counter */
+#define LPIT_HIGH_CHANNEL   (1U)    /* Upper 32 bits, chained to the lower channel */
+#define LPIT_TICK_CHANNEL   (2U)    /* Periodic tick */
+#define LPIT_ALL_CHANNELS   (0xFU)  /* Mask of the 4 channels */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static LPIT_CallbackPtr LPIT_TickCallback;  /* Function called on each tick */
+
+static volatile uint64_t LPIT_TickCount;    /* Ticks since the timebase started */
+
+static uint32_t LPIT_Frequency;             /* Frequency of the 64-bit counter, 0 while stopped */
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to start the timebase: channels 0 and 1 are chained into a 64-bit counter
+ *        of the functional clock, channel 2 gives the periodic tick
+ *
+ * @param pConfig[in]: timebase settings
+ *
+ * @return Std_LPIT_Status: LPIT_E_NOT_OK if the settings are not valid
+ */
+Std_LPIT_Status LPIT_TimebaseInit(const LPIT_Timebase_Config_Type *pConfig)
+{
+    Std_LPIT_Status status = LPIT_E_NOT_OK;
+
+    if((0 != pConfig) && (0 != pConfig->frequency) && (pConfig->tickRate <= pConfig->frequency))
+    {
+        uint32_t mask = (1UL << LPIT_LOW_CHANNEL) | (1UL << LPIT_HIGH_CHANNEL);
+
+        PCC_De_Init(PCC_LPIT_INDEX);
+        PCC_Clock_Source_Select(PCC_LPIT_INDEX, pConfig->source);
+        PCC_Init(PCC_LPIT_INDEX);
+
+        HAL_LPIT_ModuleEnable(LPIT0);
+        HAL_LPIT_StopTimers(LPIT0, LPIT_ALL_CHANNELS);
+
+        /* Both channels count 2^32, the high channel decrements each time the low channel wraps */
+        HAL_LPIT_TimerConfig(LPIT0, LPIT_LOW_CHANNEL, LPIT_MODE_PERIODIC_32BITS, 0);
+        HAL_LPIT_SetTimerValue(LPIT0, LPIT_LOW_CHANNEL, 0xFFFFFFFFU);
+        HAL_LPIT_TimerConfig(LPIT0, LPIT_HIGH_CHANNEL, LPIT_MODE_PERIODIC_32BITS, 1);
+        HAL_LPIT_SetTimerValue(LPIT0, LPIT_HIGH_CHANNEL, 0xFFFFFFFFU);
+
+        LPIT_TickCount = 0;
+
+        if(0 != pConfig->tickRate)
+        {
+            uint32_t irqn = (uint32_t)LPIT0_Ch2_IRQn;
+
+            HAL_LPIT_TimerConfig(LPIT0, LPIT_TICK_CHANNEL, LPIT_MODE_PERIODIC_32BITS, 0);
+            HAL_LPIT_SetTimerValue(LPIT0, LPIT_TICK_CHANNEL, (pConfig->frequency / pConfig->tickRate) - 1U);
+            HAL_LPIT_ClearStatusFlags(LPIT0, 1UL << LPIT_TICK_CHANNEL);
+            HAL_LPIT_InterruptConfig(LPIT0, LPIT_TICK_CHANNEL, 1);
+            S32_NVIC->ISER[irqn >> 5U] = (1UL << (irqn & 0x1FU));
+
+            mask |= (1UL << LPIT_TICK_CHANNEL);
+        }
+
+        HAL_LPIT_StartTimers(LPIT0, mask);
+
+        LPIT_Frequency = pConfig->frequency;
+        status = LPIT_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to read the 64-bit counter, it can be called from any context
+ *
+ * The high channel is read before and after the low channel, a different value means the low channel
+ * wrapped in between and the read is done again.
+ *
+ * @return uint64_t: functional clock cycles since LPIT_TimebaseInit, 0 if the timebase is stopped
+ */
+uint64_t LPIT_GetTimestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if(0 != LPIT_Frequency)
+    {
+        uint32_t high;
+        uint32_t low;
+
+        do
+        {
+            high = HAL_LPIT_GetCurrentValue(LPIT0, LPIT_HIGH_CHANNEL);
+            low = HAL_LPIT_GetCurrentValue(LPIT0, LPIT_LOW_CHANNEL);
+        } while(high != HAL_LPIT_GetCurrentValue(LPIT0, LPIT_HIGH_CHANNEL));
+
+        /* The channels count down from 0xFFFFFFFF */
+        timestamp = ~(((uint64_t)high << 32U) | low);
+    }
+
+    return timestamp;
+}
+
+/**
+ * @brief This function is used to get the frequency of the 64-bit counter
+ *
+ * @return uint32_t: frequency in Hz, 0 if the timebase is stopped
+ */
+uint32_t LPIT_GetFrequency(void)
+{
+    return LPIT_Frequency;
+}
+
+/**
+ * @brief This function is used to get the number of periodic ticks
+ *
+ * @return uint64_t: ticks since LPIT_TimebaseInit
+ */
+uint64_t LPIT_GetTickCount(void)
+{
+    uint64_t ticks;
+
+    /* The count is two words, read again if the tick interrupt came in between */
+    do
+    {
+        ticks = LPIT_TickCount;
+    } while(ticks != LPIT_TickCount);
+
+    return ticks;
+}
+
+/**
+ * @brief This function is used to compute the deadline of a wait
+ *
+ * @param timeoutUs[in]: time allowed from now, in microseconds
+ *
+ * @return uint64_t: deadline for LPIT_IsExpired, LPIT_DEADLINE_NEVER if the timebase is stopped
+ */
+uint64_t LPIT_Deadline(uint32_t timeoutUs)
+{
+    uint64_t deadline = LPIT_DEADLINE_NEVER;
+
+    if(0 != LPIT_Frequency)
+    {
+        deadline = LPIT_GetTimestamp() + (((uint64_t)timeoutUs * LPIT_Frequency) / 1000000U);
+    }
+
+    return deadline;
+}
+
+/**
+ * @brief This function is used to check whether a deadline has passed
+ *
+ * @param deadline[in]: deadline given by LPIT_Deadline
+ *
+ * @return uint8_t: 1 if the deadline has passed, 0 otherwise
+ */
+uint8_t LPIT_IsExpired(uint64_t deadline)
+{
+    return ((LPIT_DEADLINE_NEVER != deadline) && (LPIT_GetTimestamp() >= deadline)) ? 1U : 0U;
+}
+
+/**
+ * @brief This function is used to register the function called on each periodic tick, from the interrupt
+ *
+ * @param IRQHandler[in]: function to call
+ *
+ * @return Std_LPIT_Status: status of the operation
+ */
+Std_LPIT_Status LPIT_TickCallbackRegister(LPIT_CallbackPtr IRQHandler)
+{
+    Std_LPIT_Status status = LPIT_E_NOT_OK;
+
+    if(0 != IRQHandler)
+    {
+        LPIT_TickCallback = IRQHandler;
+        status = LPIT_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to stop the timebase
+ *
+ * @return Std_LPIT_Status: status of the operation
+ */
+Std_LPIT_Status LPIT_DeInit(void)
+{
+    uint32_t irqn = (uint32_t)LPIT0_Ch2_IRQn;
+
+    S32_NVIC->ICER[irqn >> 5U] = (1UL << (irqn & 0x1FU));
+    HAL_LPIT_StopTimers(LPIT0, LPIT_ALL_CHANNELS);
+    HAL_LPIT_InterruptConfig(LPIT0, LPIT_TICK_CHANNEL, 0);
+    HAL_LPIT_ModuleDisable(LPIT0);
+    PCC_De_Init(PCC_LPIT_INDEX);
+
+    LPIT_Frequency = 0;
+
+    return LPIT_E_OK;
+}
+
+/**
+ * @brief This function is used to handle the periodic tick
+ *
+ * @return void
+ */
+void LPIT0_Ch2_IRQHandler(void)
+{
+    TRACE_ENTER(TRACE_ID_LPIT_TICK_IRQ);
+
+    HAL_LPIT_ClearStatusFlags(LPIT0, 1UL << LPIT_TICK_CHANNEL);
+    LPIT_TickCount++;
+
+    if(0 != LPIT_TickCallback)
+    {
+        LPIT_TickCallback();
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    TRACE_EXIT(TRACE_ID_LPIT_TICK_IRQ);
+}
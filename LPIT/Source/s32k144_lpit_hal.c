@@ -0,0 +1,150 @@
+/**
+ * @file s32k144_lpit_hal.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This is the definition file of the Hardware Abstraction Layer for LPIT module of S32K144 MCU.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpit_hal.h"
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to enable the LPIT, the timers keep running in debug and low power modes
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ *
+ * @return void
+ */
+void HAL_LPIT_ModuleEnable(LPIT_Type *pLPITx)
+{
+    pLPITx->MCR = LPIT_MCR_M_CEN_MASK | LPIT_MCR_DBG_EN_MASK | LPIT_MCR_DOZE_EN_MASK;
+}
+
+/**
+ * @brief This function is used to disable the LPIT
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ *
+ * @return void
+ */
+void HAL_LPIT_ModuleDisable(LPIT_Type *pLPITx)
+{
+    pLPITx->MCR &= ~LPIT_MCR_M_CEN_MASK;
+}
+
+/**
+ * @brief This function is used to configure the mode and the chaining of a timer channel, the channel
+ *        must be stopped
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param channel[in]: timer channel, from 0 to 3
+ * @param mode[in]: operation mode
+ * @param chain[in]: 1 to decrement on the expiry of the previous channel, 0 on the functional clock
+ *
+ * @return void
+ */
+void HAL_LPIT_TimerConfig(LPIT_Type *pLPITx, uint8_t channel, LPIT_Mode_Type mode, uint8_t chain)
+{
+    pLPITx->TMR[channel].TCTRL = LPIT_TMR_TCTRL_MODE(mode) | LPIT_TMR_TCTRL_CHAIN(chain);
+}
+
+/**
+ * @brief This function is used to set the value a timer channel reloads on expiry
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param channel[in]: timer channel, from 0 to 3
+ * @param value[in]: reload value, the period is value + 1 counts
+ *
+ * @return void
+ */
+void HAL_LPIT_SetTimerValue(LPIT_Type *pLPITx, uint8_t channel, uint32_t value)
+{
+    pLPITx->TMR[channel].TVAL = value;
+}
+
+/**
+ * @brief This function is used to read the down counter of a timer channel
+ *
+ * @param pLPITx[in]: pointer to the LPIT instance
+ * @param channel[in]: timer channel, from 0 to 3
+ *
+ * @return uint32_t: current value
+ */
+uint32_t HAL_LPIT_GetCurrentValue(LPIT_Type *pLPITx, uint8_t channel)
+{
+    return LPIT_CVAL_READ(pLPITx, channel);
+}
+
+/**
+ * @brief This function is used to start several timer channels at the same time
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param mask[in]: bit n starts channel n
+ *
+ * @return void
+ */
+void HAL_LPIT_StartTimers(LPIT_Type *pLPITx, uint32_t mask)
+{
+    LPIT_SETTEN_WRITE(pLPITx, mask);
+}
+
+/**
+ * @brief This function is used to stop several timer channels at the same time
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param mask[in]: bit n stops channel n
+ *
+ * @return void
+ */
+void HAL_LPIT_StopTimers(LPIT_Type *pLPITx, uint32_t mask)
+{
+    LPIT_CLRTEN_WRITE(pLPITx, mask);
+}
+
+/**
+ * @brief This function is used to configure the interrupt of a timer channel
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param channel[in]: timer channel, from 0 to 3
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPIT_InterruptConfig(LPIT_Type *pLPITx, uint8_t channel, uint8_t enable)
+{
+    pLPITx->MIER = (pLPITx->MIER & ~(1UL << channel)) | ((uint32_t)enable << channel);
+}
+
+/**
+ * @brief This function is used to read the interrupt flags of the timer channels
+ *
+ * @param pLPITx[in]: pointer to the LPIT instance
+ *
+ * @return uint32_t: value of the MSR register, bit n is the flag of channel n
+ */
+uint32_t HAL_LPIT_GetStatus(LPIT_Type *pLPITx)
+{
+    return pLPITx->MSR;
+}
+
+/**
+ * @brief This function is used to clear interrupt flags of the timer channels
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param mask[in]: bit n clears the flag of channel n
+ *
+ * @return void
+ */
+void HAL_LPIT_ClearStatusFlags(LPIT_Type *pLPITx, uint32_t mask)
+{
+    /* Write 1 to clear */
+    LPIT_MSR_WRITE(pLPITx, mask);
+}
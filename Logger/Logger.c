@@ -0,0 +1,254 @@
+/**
+ * @file Logger.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the deferred binary logger drained over LPUART
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Logger.h"
+#include "Trace.h"
+#include "MpscQueue.h"
+#include <stdatomic.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LOG_RING_MASK   (LOG_RING_SIZE - 1U)    /* Mask to wrap an index in the ring */
+
+#if ((LOG_RING_SIZE & LOG_RING_MASK) != 0U)
+#error "LOG_RING_SIZE must be a power of 2"
+#endif
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    atomic_uint_fast32_t seq;       /* Index of the record plus 1 once it is completely written */
+    uint16_t id;                    /* Message identifier */
+    uint8_t nOfArgs;                /* Number of valid arguments */
+    uint32_t args[LOG_ARGS_MAX];    /* Raw arguments */
+} Log_Record_Types;                 /* Record of the ring */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Log_Record_Types logRing[LOG_RING_SIZE];    /* Ring of records */
+static Std_MpscQueue_Types logQueue = MPSC_QUEUE_INIT(logRing);    /* Records recorded and not drained yet */
+static atomic_uint_fast32_t logDropped;            /* Number of messages lost because the ring was full */
+static LPUART_Type *logLPUARTx;                    /* LPUART instance used to drain the log */
+static Std_Pool_Types *logPool;                    /* Pool of the blocks the frames are built in, 0 to use the Tx ring */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+/**
+ * @name logFrame
+ *
+ * @brief This function is used to build the frame of a record
+ *
+ * @param pRecord[in]: record completely written
+ * @param pFrame[out]: frame of at least LOG_FRAME_MAX bytes
+ *
+ * @return uint32_t: length of the frame
+ */
+static uint32_t logFrame(const Log_Record_Types *pRecord, uint8_t *pFrame);
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to build the frame of a record
+ *
+ * Frame on the wire: sync, id (little endian), number of arguments, arguments (little endian),
+ * checksum (sum of all previous bytes).
+ *
+ * @param pRecord[in]: record completely written
+ * @param pFrame[out]: frame of at least LOG_FRAME_MAX bytes
+ *
+ * @return uint32_t: length of the frame
+ */
+static uint32_t logFrame(const Log_Record_Types *pRecord, uint8_t *pFrame)
+{
+    uint32_t len = 0;
+    uint8_t checksum = 0;
+
+    pFrame[len++] = LOG_FRAME_SYNC;
+    pFrame[len++] = (uint8_t)(pRecord->id & 0xFFU);
+    pFrame[len++] = (uint8_t)(pRecord->id >> 8);
+    pFrame[len++] = pRecord->nOfArgs;
+
+    for(uint8_t i = 0; (i < pRecord->nOfArgs) && (i < LOG_ARGS_MAX); i++)
+    {
+        pFrame[len++] = (uint8_t)(pRecord->args[i]);
+        pFrame[len++] = (uint8_t)(pRecord->args[i] >> 8);
+        pFrame[len++] = (uint8_t)(pRecord->args[i] >> 16);
+        pFrame[len++] = (uint8_t)(pRecord->args[i] >> 24);
+    }
+
+    for(uint32_t i = 0; i < len; i++)
+    {
+        checksum += pFrame[i];
+    }
+    pFrame[len++] = checksum;
+
+    return len;
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to initialize the logger
+ *
+ * @param pLPUARTx[in]: LPUART instance used to drain the log, must be set up with LPUART_BufferInit
+ *
+ * @return void
+ */
+void logInit(LPUART_Type *pLPUARTx)
+{
+    logLPUARTx = pLPUARTx;
+}
+
+/**
+ * @brief This function is used to build the frames in pool blocks handed over to LPUART_SendBlock instead
+ *        of copying them to the Tx ring
+ *
+ * The Tx ring is still used while the pool is empty.
+ *
+ * @param pool[in/out]: pool of blocks of at least LOG_FRAME_MAX bytes, 0 to use the Tx ring again
+ *
+ * @return void
+ */
+void logSetPool(Std_Pool_Types *pool)
+{
+    logPool = ((0 == pool) || (LOG_FRAME_MAX <= poolGetBlockSize(pool))) ? pool : 0;
+}
+
+/**
+ * @brief This function is used to record a message, it can be called from any context including ISR
+ *
+ * A slot is reserved with a compare and swap on the head, so producers preempting each other never
+ * share a slot, then the record is published by writing its sequence number last.
+ *
+ * @param id[in]: message identifier
+ * @param nOfArgs[in]: number of valid arguments
+ * @param a0..a3[in]: raw arguments
+ *
+ * @return void
+ */
+void logRecord(Log_Id_Types id, uint8_t nOfArgs, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    Log_Record_Types *pRecord;
+    uint_fast32_t index;
+
+    TRACE_ENTER(TRACE_ID_LOG_RECORD);
+
+    pRecord = (Log_Record_Types *)mpscQueueReserve(&logQueue, &index);
+
+    if(0 != pRecord)
+    {
+        pRecord->id = (uint16_t)id;
+        pRecord->nOfArgs = (nOfArgs > LOG_ARGS_MAX) ? (uint8_t)LOG_ARGS_MAX : nOfArgs;
+        pRecord->args[0] = a0;
+        pRecord->args[1] = a1;
+        pRecord->args[2] = a2;
+        pRecord->args[3] = a3;
+
+        mpscQueuePublish(&logQueue, index);
+    }
+    else
+    {
+        atomic_fetch_add_explicit(&logDropped, 1U, memory_order_relaxed);
+    }
+
+    TRACE_EXIT(TRACE_ID_LOG_RECORD);
+}
+
+/**
+ * @brief This function is used to move the recorded messages to the LPUART Tx ring, it should be called
+ *        from the background loop and returns when the ring is empty or the Tx ring is full
+ *
+ * With a pool the frames are built straight in a block, as many as it holds, and the block is handed over
+ * to the Tx interrupt. The records are released only once the driver accepted the block.
+ *
+ * @return uint32_t: number of messages moved
+ */
+uint32_t logDrain(void)
+{
+    uint32_t nOfMessages = 0;
+    uint8_t isDone = 0;
+
+    while(0 == isDone)
+    {
+        const Log_Record_Types *pRecord = (const Log_Record_Types *)mpscQueuePeek(&logQueue, 0);
+        uint8_t *pBlock = ((0 != pRecord) && (0 != logPool)) ? (uint8_t *)poolAlloc(logPool) : 0;
+        uint8_t frame[LOG_FRAME_MAX];
+        uint8_t *pFrame = (0 != pBlock) ? pBlock : frame;
+        uint32_t size = (0 != pBlock) ? poolGetBlockSize(logPool) : LOG_FRAME_MAX;
+        uint32_t len = 0;
+        uint32_t nOfFrames = 0;
+
+        /* Up to the first record not completely written, as many frames as the buffer holds */
+        while((0 != pRecord) && ((len + LOG_FRAME_MAX) <= size))
+        {
+            len += logFrame(pRecord, &pFrame[len]);
+            nOfFrames++;
+            pRecord = (const Log_Record_Types *)mpscQueuePeek(&logQueue, nOfFrames);
+        }
+
+        if(0 == nOfFrames)
+        {
+            /* Empty, or the next record is still being written */
+        }
+        else if(0 != pBlock)
+        {
+            /* The driver owns the block once it accepts it */
+            nOfFrames = (LPUART_E_OK == LPUART_SendBlock(logLPUARTx, logPool, pBlock, len)) ? nOfFrames : 0U;
+            pBlock = (0 != nOfFrames) ? 0 : pBlock;
+        }
+        else if(LPUART_GetTxFree(logLPUARTx) >= len)
+        {
+            /* Frames are never split, otherwise wait for the Tx ring to make room */
+            LPUART_Send(logLPUARTx, frame, len);
+        }
+        else
+        {
+            nOfFrames = 0;
+        }
+
+        if(0 != nOfFrames)
+        {
+            mpscQueueRelease(&logQueue, nOfFrames);
+            nOfMessages += nOfFrames;
+        }
+        else
+        {
+            /* The records stay for the next call */
+            isDone = 1;
+        }
+
+        if(0 != pBlock)
+        {
+            (void)poolFree(logPool, pBlock);
+        }
+    }
+
+    return nOfMessages;
+}
+
+/**
+ * @brief This function is used to get the number of messages lost because the ring was full
+ *
+ * @return uint32_t: number of dropped messages
+ */
+uint32_t logGetDropped(void)
+{
+    return (uint32_t)atomic_load_explicit(&logDropped, memory_order_relaxed);
+}
@@ -0,0 +1,105 @@
+/**
+ * @file Logger.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the deferred binary logger drained over LPUART
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef LOGGER_H_
+#define LOGGER_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpuart_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LOG_ARGS_MAX        (4U)    /* Maximum number of arguments of a message */
+#define LOG_RING_SIZE       (32U)   /* Number of records in the ring, must be a power of 2 */
+
+#define LOG_FRAME_SYNC      (0xA5U) /* First byte of a frame on the wire */
+#define LOG_FRAME_HEADER    (4U)    /* Sync, id low, id high, number of arguments */
+#define LOG_FRAME_MAX       (LOG_FRAME_HEADER + (4U * LOG_ARGS_MAX) + 1U)   /* Header, arguments and checksum */
+
+#define LOG_0(id)               logRecord((id), 0U, 0U, 0U, 0U, 0U)     /* Record a message without argument */
+#define LOG_1(id, a)            logRecord((id), 1U, (uint32_t)(a), 0U, 0U, 0U)
+#define LOG_2(id, a, b)         logRecord((id), 2U, (uint32_t)(a), (uint32_t)(b), 0U, 0U)
+#define LOG_3(id, a, b, c)      logRecord((id), 3U, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), 0U)
+#define LOG_4(id, a, b, c, d)   logRecord((id), 4U, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d))
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+#define LOG_MESSAGE(id, format) id,
+typedef enum
+{
+#include "LogMessages.def"
+    LOG_ID_COUNT        /* Number of messages */
+} Log_Id_Types;         /* Message identifiers generated from LogMessages.def */
+#undef LOG_MESSAGE
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name logInit
+ *
+ * @brief This function is used to initialize the logger
+ *
+ * @param pLPUARTx[in]: LPUART instance used to drain the log, must be set up with LPUART_BufferInit
+ *
+ * @return void
+ */
+void logInit(LPUART_Type *pLPUARTx);
+
+/**
+ * @name logSetPool
+ *
+ * @brief This function is used to build the frames in pool blocks handed over to LPUART_SendBlock instead
+ *        of copying them to the Tx ring
+ *
+ * The Tx ring is still used while the pool is empty.
+ *
+ * @param pool[in/out]: pool of blocks of at least LOG_FRAME_MAX bytes, 0 to use the Tx ring again
+ *
+ * @return void
+ */
+void logSetPool(Std_Pool_Types *pool);
+
+/**
+ * @name logRecord
+ *
+ * @brief This function is used to record a message, it can be called from any context including ISR
+ *
+ * @param id[in]: message identifier
+ * @param nOfArgs[in]: number of valid arguments
+ * @param a0..a3[in]: raw arguments
+ *
+ * @return void
+ */
+void logRecord(Log_Id_Types id, uint8_t nOfArgs, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+
+/**
+ * @name logDrain
+ *
+ * @brief This function is used to move the recorded messages to the LPUART Tx ring, it should be called
+ *        from the background loop and returns when the ring is empty or the Tx ring is full
+ *
+ * @return uint32_t: number of messages moved
+ */
+uint32_t logDrain(void);
+
+/**
+ * @name logGetDropped
+ *
+ * @brief This function is used to get the number of messages lost because the ring was full
+ *
+ * @return uint32_t: number of dropped messages
+ */
+uint32_t logGetDropped(void);
+
+#endif /* LOGGER_H_ */
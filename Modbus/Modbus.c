@@ -0,0 +1,971 @@
+/**
+ * @file Modbus.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the Modbus RTU master and slave stack running over LPUART
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Modbus.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define MODBUS_INSTANCE_NUM     (3U)            /* Number of LPUART instances */
+#define MODBUS_ADDRESS_MAX      (247U)          /* Highest slave address */
+#define MODBUS_FRAME_MIN        (4U)            /* Address, function code and CRC */
+#define MODBUS_FC_EXCEPTION     (0x80U)         /* Bit set in the function code of an exception */
+#define MODBUS_CHAR_BITS        (11U)           /* Start, 8 data, parity or second stop, stop bits */
+#define MODBUS_FIXED_BAUDRATE   (19200U)        /* Above it the silences have fixed durations */
+#define MODBUS_T15_FIXED_NS     (750000U)       /* 1.5 characters above MODBUS_FIXED_BAUDRATE */
+#define MODBUS_T35_FIXED_NS     (1750000U)      /* 3.5 characters above MODBUS_FIXED_BAUDRATE */
+#define MODBUS_NS_PER_S         (1000000000ULL) /* Nanoseconds in a second */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    const uint8_t *pHead;   /* First span of the frame in the Rx ring */
+    uint32_t headLen;       /* Length of the first span */
+    const uint8_t *pTail;   /* Second span, when the frame wraps in the Rx ring */
+    uint32_t len;           /* Length of the frame */
+} Modbus_Frame_Types;       /* Frame read in place from the Rx ring */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+/**
+ * @name modbusGetIndex
+ *
+ * @brief This function is used to get the index of an LPUART instance
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint8_t: index of the instance, MODBUS_INSTANCE_NUM if the instance is not valid
+ */
+static uint8_t modbusGetIndex(LPUART_Type *pLPUARTx);
+
+/**
+ * @name modbusFind
+ *
+ * @brief This function is used to look up a register in a sorted map
+ *
+ * @param map[in]: register map
+ * @param nOfRegisters[in]: number of entries in the map
+ * @param address[in]: register address
+ *
+ * @return Std_Modbus_Register_Types *: entry of the register, 0 if it is not in the map
+ */
+static Std_Modbus_Register_Types *modbusFind(Std_Modbus_Register_Types *map, uint16_t nOfRegisters, uint16_t address);
+
+/**
+ * @name modbusIsSorted
+ *
+ * @brief This function is used to check that a map is sorted by strictly increasing address
+ *
+ * @param map[in]: register map
+ * @param nOfRegisters[in]: number of entries in the map
+ *
+ * @return uint8_t: 1 if the map is sorted, 0 otherwise
+ */
+static uint8_t modbusIsSorted(const Std_Modbus_Register_Types *map, uint16_t nOfRegisters);
+
+/**
+ * @name modbusByte
+ *
+ * @brief This function is used to read a byte of a frame in the Rx ring
+ *
+ * @param pFrame[in]: frame
+ * @param offset[in]: offset of the byte
+ *
+ * @return uint8_t: byte, 0 when offset is not less than the length of the frame
+ */
+static uint8_t modbusByte(const Modbus_Frame_Types *pFrame, uint32_t offset);
+
+/**
+ * @name modbusWord
+ *
+ * @brief This function is used to read a big endian 16-bit field of a frame in the Rx ring
+ *
+ * @param pFrame[in]: frame
+ * @param offset[in]: offset of the high byte
+ *
+ * @return uint16_t: field
+ */
+static uint16_t modbusWord(const Modbus_Frame_Types *pFrame, uint32_t offset);
+
+/**
+ * @name modbusFinish
+ *
+ * @brief This function is used to append the CRC to the frame built in the Tx buffer and queue it
+ *
+ * @param modbus[in/out]: pointer to the node
+ * @param len[in]: length of the frame without its CRC
+ *
+ * @return void
+ */
+static void modbusFinish(Std_Modbus_Types *modbus, uint32_t len);
+
+/**
+ * @name modbusServeRequest
+ *
+ * @brief This function is used to execute a request received by the slave and build its response
+ *
+ * @param modbus[in/out]: pointer to the slave
+ * @param pFrame[in]: request with a valid CRC
+ *
+ * @return void
+ */
+static void modbusServeRequest(Std_Modbus_Types *modbus, const Modbus_Frame_Types *pFrame);
+
+/**
+ * @name modbusServeResponse
+ *
+ * @brief This function is used to check a frame received by the master against the pending request
+ *
+ * @param modbus[in/out]: pointer to the master
+ * @param pFrame[in]: frame with a valid CRC
+ *
+ * @return void
+ */
+static void modbusServeResponse(Std_Modbus_Types *modbus, const Modbus_Frame_Types *pFrame);
+
+/**
+ * @name modbusIrqHandler
+ *
+ * @brief This function is used to record the end of a frame on the idle line interrupt
+ *
+ * @param modbus[in/out]: pointer to the node
+ *
+ * @return void
+ */
+static void modbusIrqHandler(Std_Modbus_Types *modbus);
+
+static void modbusIrqHandler0(void);
+static void modbusIrqHandler1(void);
+static void modbusIrqHandler2(void);
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Std_Modbus_Types *modbusNodes[MODBUS_INSTANCE_NUM];     /* Node attached to each LPUART instance */
+
+static const LPUART_CallbackPtr modbusIrqHandlers[MODBUS_INSTANCE_NUM] =
+{
+    modbusIrqHandler0, modbusIrqHandler1, modbusIrqHandler2
+};  /* Callback registered for each LPUART instance */
+
+static const uint16_t modbusCrcTable[256] =
+{
+    0x0000U, 0xC0C1U, 0xC181U, 0x0140U, 0xC301U, 0x03C0U, 0x0280U, 0xC241U,
+    0xC601U, 0x06C0U, 0x0780U, 0xC741U, 0x0500U, 0xC5C1U, 0xC481U, 0x0440U,
+    0xCC01U, 0x0CC0U, 0x0D80U, 0xCD41U, 0x0F00U, 0xCFC1U, 0xCE81U, 0x0E40U,
+    0x0A00U, 0xCAC1U, 0xCB81U, 0x0B40U, 0xC901U, 0x09C0U, 0x0880U, 0xC841U,
+    0xD801U, 0x18C0U, 0x1980U, 0xD941U, 0x1B00U, 0xDBC1U, 0xDA81U, 0x1A40U,
+    0x1E00U, 0xDEC1U, 0xDF81U, 0x1F40U, 0xDD01U, 0x1DC0U, 0x1C80U, 0xDC41U,
+    0x1400U, 0xD4C1U, 0xD581U, 0x1540U, 0xD701U, 0x17C0U, 0x1680U, 0xD641U,
+    0xD201U, 0x12C0U, 0x1380U, 0xD341U, 0x1100U, 0xD1C1U, 0xD081U, 0x1040U,
+    0xF001U, 0x30C0U, 0x3180U, 0xF141U, 0x3300U, 0xF3C1U, 0xF281U, 0x3240U,
+    0x3600U, 0xF6C1U, 0xF781U, 0x3740U, 0xF501U, 0x35C0U, 0x3480U, 0xF441U,
+    0x3C00U, 0xFCC1U, 0xFD81U, 0x3D40U, 0xFF01U, 0x3FC0U, 0x3E80U, 0xFE41U,
+    0xFA01U, 0x3AC0U, 0x3B80U, 0xFB41U, 0x3900U, 0xF9C1U, 0xF881U, 0x3840U,
+    0x2800U, 0xE8C1U, 0xE981U, 0x2940U, 0xEB01U, 0x2BC0U, 0x2A80U, 0xEA41U,
+    0xEE01U, 0x2EC0U, 0x2F80U, 0xEF41U, 0x2D00U, 0xEDC1U, 0xEC81U, 0x2C40U,
+    0xE401U, 0x24C0U, 0x2580U, 0xE541U, 0x2700U, 0xE7C1U, 0xE681U, 0x2640U,
+    0x2200U, 0xE2C1U, 0xE381U, 0x2340U, 0xE101U, 0x21C0U, 0x2080U, 0xE041U,
+    0xA001U, 0x60C0U, 0x6180U, 0xA141U, 0x6300U, 0xA3C1U, 0xA281U, 0x6240U,
+    0x6600U, 0xA6C1U, 0xA781U, 0x6740U, 0xA501U, 0x65C0U, 0x6480U, 0xA441U,
+    0x6C00U, 0xACC1U, 0xAD81U, 0x6D40U, 0xAF01U, 0x6FC0U, 0x6E80U, 0xAE41U,
+    0xAA01U, 0x6AC0U, 0x6B80U, 0xAB41U, 0x6900U, 0xA9C1U, 0xA881U, 0x6840U,
+    0x7800U, 0xB8C1U, 0xB981U, 0x7940U, 0xBB01U, 0x7BC0U, 0x7A80U, 0xBA41U,
+    0xBE01U, 0x7EC0U, 0x7F80U, 0xBF41U, 0x7D00U, 0xBDC1U, 0xBC81U, 0x7C40U,
+    0xB401U, 0x74C0U, 0x7580U, 0xB541U, 0x7700U, 0xB7C1U, 0xB681U, 0x7640U,
+    0x7200U, 0xB2C1U, 0xB381U, 0x7340U, 0xB101U, 0x71C0U, 0x7080U, 0xB041U,
+    0x5000U, 0x90C1U, 0x9181U, 0x5140U, 0x9301U, 0x53C0U, 0x5280U, 0x9241U,
+    0x9601U, 0x56C0U, 0x5780U, 0x9741U, 0x5500U, 0x95C1U, 0x9481U, 0x5440U,
+    0x9C01U, 0x5CC0U, 0x5D80U, 0x9D41U, 0x5F00U, 0x9FC1U, 0x9E81U, 0x5E40U,
+    0x5A00U, 0x9AC1U, 0x9B81U, 0x5B40U, 0x9901U, 0x59C0U, 0x5880U, 0x9841U,
+    0x8801U, 0x48C0U, 0x4980U, 0x8941U, 0x4B00U, 0x8BC1U, 0x8A81U, 0x4A40U,
+    0x4E00U, 0x8EC1U, 0x8F81U, 0x4F40U, 0x8D01U, 0x4DC0U, 0x4C80U, 0x8C41U,
+    0x4400U, 0x84C1U, 0x8581U, 0x4540U, 0x8701U, 0x47C0U, 0x4680U, 0x8641U,
+    0x8201U, 0x42C0U, 0x4380U, 0x8341U, 0x4100U, 0x81C1U, 0x8081U, 0x4040U,
+};  /* CRC-16/MODBUS of each byte value, reflected polynomial 0xA001 */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to get the index of an LPUART instance
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint8_t: index of the instance, MODBUS_INSTANCE_NUM if the instance is not valid
+ */
+static uint8_t modbusGetIndex(LPUART_Type *pLPUARTx)
+{
+    uint8_t index = MODBUS_INSTANCE_NUM;
+
+    if(LPUART0 == pLPUARTx)
+    {
+        index = 0;
+    }
+    else if(LPUART1 == pLPUARTx)
+    {
+        index = 1;
+    }
+    else if(LPUART2 == pLPUARTx)
+    {
+        index = 2;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return index;
+}
+
+/**
+ * @brief This function is used to look up a register in a sorted map
+ *
+ * @param map[in]: register map
+ * @param nOfRegisters[in]: number of entries in the map
+ * @param address[in]: register address
+ *
+ * @return Std_Modbus_Register_Types *: entry of the register, 0 if it is not in the map
+ */
+static Std_Modbus_Register_Types *modbusFind(Std_Modbus_Register_Types *map, uint16_t nOfRegisters, uint16_t address)
+{
+    Std_Modbus_Register_Types *pRegister = 0;
+    uint32_t low = 0;
+    uint32_t high = nOfRegisters;
+
+    while((low < high) && (0 == pRegister))
+    {
+        uint32_t middle = (low + high) / 2U;
+
+        if(map[middle].address < address)
+        {
+            low = middle + 1U;
+        }
+        else if(map[middle].address > address)
+        {
+            high = middle;
+        }
+        else
+        {
+            pRegister = &map[middle];
+        }
+    }
+
+    return pRegister;
+}
+
+/**
+ * @brief This function is used to check that a map is sorted by strictly increasing address
+ *
+ * @param map[in]: register map
+ * @param nOfRegisters[in]: number of entries in the map
+ *
+ * @return uint8_t: 1 if the map is sorted, 0 otherwise
+ */
+static uint8_t modbusIsSorted(const Std_Modbus_Register_Types *map, uint16_t nOfRegisters)
+{
+    uint8_t isSorted = ((0 != map) || (0 == nOfRegisters)) ? 1U : 0U;
+
+    for(uint32_t i = 1; (i < nOfRegisters) && (0 != isSorted); i++)
+    {
+        isSorted = (map[i - 1U].address < map[i].address) ? 1U : 0U;
+    }
+
+    for(uint32_t i = 0; (i < nOfRegisters) && (0 != isSorted); i++)
+    {
+        isSorted = (0 != map[i].pValue) ? 1U : 0U;
+    }
+
+    return isSorted;
+}
+
+/**
+ * @brief This function is used to read a byte of a frame in the Rx ring
+ *
+ * @param pFrame[in]: frame
+ * @param offset[in]: offset of the byte
+ *
+ * @return uint8_t: byte, 0 when offset is not less than the length of the frame
+ */
+static uint8_t modbusByte(const Modbus_Frame_Types *pFrame, uint32_t offset)
+{
+    uint8_t data = 0;
+
+    if(offset < pFrame->len)
+    {
+        data = (offset < pFrame->headLen) ? pFrame->pHead[offset] : pFrame->pTail[offset - pFrame->headLen];
+    }
+
+    return data;
+}
+
+/**
+ * @brief This function is used to read a big endian 16-bit field of a frame in the Rx ring
+ *
+ * @param pFrame[in]: frame
+ * @param offset[in]: offset of the high byte
+ *
+ * @return uint16_t: field
+ */
+static uint16_t modbusWord(const Modbus_Frame_Types *pFrame, uint32_t offset)
+{
+    return (uint16_t)(((uint16_t)modbusByte(pFrame, offset) << 8U) | modbusByte(pFrame, offset + 1U));
+}
+
+/**
+ * @brief This function is used to append the CRC to the frame built in the Tx buffer and queue it
+ *
+ * @param modbus[in/out]: pointer to the node
+ * @param len[in]: length of the frame without its CRC
+ *
+ * @return void
+ */
+static void modbusFinish(Std_Modbus_Types *modbus, uint32_t len)
+{
+    uint16_t crc = modbusCrc(0xFFFFU, modbus->txBuffer, len);
+
+    modbus->txBuffer[len] = (uint8_t)crc;
+    modbus->txBuffer[len + 1U] = (uint8_t)(crc >> 8U);
+    modbus->txVec.pData = modbus->txBuffer;
+    modbus->txVec.len = len + 2U;
+    modbus->state = MODBUS_STATE_TURNAROUND;
+}
+
+/**
+ * @brief This function is used to execute a request received by the slave and build its response
+ *
+ * The request is parsed where it lies in the Rx ring. A request touching several registers is checked
+ * completely before any register is written, so a failed write leaves the map unchanged.
+ *
+ * @param modbus[in/out]: pointer to the slave
+ * @param pFrame[in]: request with a valid CRC
+ *
+ * @return void
+ */
+static void modbusServeRequest(Std_Modbus_Types *modbus, const Modbus_Frame_Types *pFrame)
+{
+    uint8_t slave = modbusByte(pFrame, 0);
+    uint8_t function = modbusByte(pFrame, 1);
+    uint8_t *pTx = modbus->txBuffer;
+    uint8_t code = 0;
+    uint32_t len = 0;
+
+    if((slave == modbus->address) || (MODBUS_BROADCAST == slave))
+    {
+        pTx[0] = slave;
+        pTx[1] = function;
+
+        if((MODBUS_FC_READ_HOLDING == function) || (MODBUS_FC_READ_INPUT == function))
+        {
+            Std_Modbus_Register_Types *map = (MODBUS_FC_READ_HOLDING == function) ? modbus->holding : modbus->input;
+            uint16_t nOfRegisters = (MODBUS_FC_READ_HOLDING == function) ? modbus->nOfHolding : modbus->nOfInput;
+            uint16_t start = 0;
+            uint16_t count = 0;
+
+            /* The fields are read only once the length is known to hold them */
+            if(8U == pFrame->len)
+            {
+                start = modbusWord(pFrame, 2);
+                count = modbusWord(pFrame, 4);
+            }
+
+            if((0 == count) || (MODBUS_READ_MAX < count))
+            {
+                code = MODBUS_EX_ILLEGAL_VALUE;
+            }
+            else
+            {
+                Std_Modbus_Register_Types *pRegister = modbusFind(map, nOfRegisters, start);
+
+                /* The map is sorted, the next registers follow the first one */
+                for(uint32_t i = 0; (i < count) && (0 == code); i++)
+                {
+                    if((0 == pRegister) || (pRegister >= &map[nOfRegisters]) || (pRegister->address != (uint16_t)(start + i)))
+                    {
+                        code = MODBUS_EX_ILLEGAL_ADDRESS;
+                    }
+                    else
+                    {
+                        uint16_t value = *pRegister->pValue;
+
+                        pTx[3U + (2U * i)] = (uint8_t)(value >> 8U);
+                        pTx[4U + (2U * i)] = (uint8_t)value;
+                        pRegister++;
+                    }
+                }
+
+                pTx[2] = (uint8_t)(2U * count);
+                len = 3U + (2U * count);
+            }
+        }
+        else if(MODBUS_FC_WRITE_SINGLE == function)
+        {
+            Std_Modbus_Register_Types *pRegister = 0;
+
+            if(8U == pFrame->len)
+            {
+                pRegister = modbusFind(modbus->holding, modbus->nOfHolding, modbusWord(pFrame, 2));
+            }
+
+            if(8U != pFrame->len)
+            {
+                code = MODBUS_EX_ILLEGAL_VALUE;
+            }
+            else if((0 == pRegister) || (0 == pRegister->isWritable))
+            {
+                code = MODBUS_EX_ILLEGAL_ADDRESS;
+            }
+            else
+            {
+                *pRegister->pValue = modbusWord(pFrame, 4);
+                pRegister->isUpdated = 1;
+
+                /* The response echoes the request */
+                for(uint32_t i = 2; i < 6U; i++)
+                {
+                    pTx[i] = modbusByte(pFrame, i);
+                }
+
+                len = 6;
+            }
+        }
+        else if(MODBUS_FC_WRITE_MULTIPLE == function)
+        {
+            uint16_t start = 0;
+            uint16_t count = 0;
+
+            /* The fields are read only once the length is known to hold them */
+            if(9U <= pFrame->len)
+            {
+                start = modbusWord(pFrame, 2);
+                count = modbusWord(pFrame, 4);
+            }
+
+            if((0 == count) || (MODBUS_WRITE_MAX < count) ||
+               (modbusByte(pFrame, 6) != (2U * count)) || (pFrame->len != (9U + (2U * count))))
+            {
+                code = MODBUS_EX_ILLEGAL_VALUE;
+            }
+            else
+            {
+                Std_Modbus_Register_Types *pFirst = modbusFind(modbus->holding, modbus->nOfHolding, start);
+                Std_Modbus_Register_Types *pRegister = pFirst;
+
+                for(uint32_t i = 0; (i < count) && (0 == code); i++)
+                {
+                    if((0 == pRegister) || (pRegister >= &modbus->holding[modbus->nOfHolding]) ||
+                       (pRegister->address != (uint16_t)(start + i)) || (0 == pRegister->isWritable))
+                    {
+                        code = MODBUS_EX_ILLEGAL_ADDRESS;
+                    }
+                    else
+                    {
+                        pRegister++;
+                    }
+                }
+
+                for(uint32_t i = 0; (i < count) && (0 == code); i++)
+                {
+                    *pFirst[i].pValue = modbusWord(pFrame, 7U + (2U * i));
+                    pFirst[i].isUpdated = 1;
+                }
+
+                for(uint32_t i = 2; i < 6U; i++)
+                {
+                    pTx[i] = modbusByte(pFrame, i);
+                }
+
+                len = 6;
+            }
+        }
+        else
+        {
+            code = MODBUS_EX_ILLEGAL_FUNCTION;
+        }
+
+        if(0 != code)
+        {
+            pTx[1] = function | MODBUS_FC_EXCEPTION;
+            pTx[2] = code;
+            len = 3;
+            modbus->stats.exceptions++;
+        }
+
+        /* A broadcast is never answered */
+        if(MODBUS_BROADCAST != slave)
+        {
+            modbusFinish(modbus, len);
+        }
+    }
+}
+
+/**
+ * @brief This function is used to check a frame received by the master against the pending request
+ *
+ * Frames of another slave or function are ignored, the request then keeps waiting for its response.
+ *
+ * @param modbus[in/out]: pointer to the master
+ * @param pFrame[in]: frame with a valid CRC
+ *
+ * @return void
+ */
+static void modbusServeResponse(Std_Modbus_Types *modbus, const Modbus_Frame_Types *pFrame)
+{
+    uint8_t function = modbusByte(pFrame, 1);
+    uint8_t isDone = 0;
+
+    if((MODBUS_STATE_WAIT_REPLY != modbus->state) || (modbusByte(pFrame, 0) != modbus->slave))
+    {
+        /* Not the response of the pending request */
+    }
+    else if((function == (modbus->function | MODBUS_FC_EXCEPTION)) && (5U == pFrame->len))
+    {
+        modbus->exception = modbusByte(pFrame, 2);
+        modbus->result = MODBUS_E_EXCEPTION;
+        modbus->stats.exceptions++;
+        isDone = 1;
+    }
+    else if(function != modbus->function)
+    {
+        /* Not the response of the pending request */
+    }
+    else if((MODBUS_FC_READ_HOLDING == function) || (MODBUS_FC_READ_INPUT == function))
+    {
+        if((pFrame->len == (5U + (2U * modbus->count))) && (modbusByte(pFrame, 2) == (2U * modbus->count)))
+        {
+            for(uint32_t i = 0; i < modbus->count; i++)
+            {
+                modbus->pValues[i] = modbusWord(pFrame, 3U + (2U * i));
+            }
+
+            modbus->result = MODBUS_E_OK;
+            isDone = 1;
+        }
+    }
+    else if(8U == pFrame->len)
+    {
+        modbus->result = MODBUS_E_OK;
+        isDone = 1;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    if(0 != isDone)
+    {
+        modbus->state = MODBUS_STATE_IDLE;
+    }
+}
+
+/**
+ * @brief This function is used to record the end of a frame on the idle line interrupt
+ *
+ * The end is the count of data pushed to the Rx ring, the frame is the data between two ends. When
+ * the queue is full the end is lost, the frame then merges with the next one and fails its CRC.
+ *
+ * @param modbus[in/out]: pointer to the node
+ *
+ * @return void
+ */
+static void modbusIrqHandler(Std_Modbus_Types *modbus)
+{
+    if((0 != modbus) && (0 != (HAL_LPUART_GetStatus(modbus->pLPUARTx) & LPUART_STAT_IDLE_MASK)))
+    {
+        HAL_LPUART_ClearStatusFlags(modbus->pLPUARTx, LPUART_STAT_IDLE_MASK);
+
+        if(MODBUS_FRAME_QUEUE > (uint8_t)(modbus->frameIn - modbus->frameOut))
+        {
+            uint8_t slot = modbus->frameIn & (MODBUS_FRAME_QUEUE - 1U);
+
+            /* The flag is set after the idle time, the frame ended that long ago */
+            modbus->frameEnd[slot] = LPUART_GetRxCount(modbus->pLPUARTx);
+            modbus->frameStamp[slot] = LPIT_GetTimestamp() - modbus->idleCycles;
+            modbus->frameIn++;
+        }
+        else
+        {
+            modbus->stats.overruns++;
+        }
+    }
+}
+
+/**
+ * @brief These functions are the LPUART callbacks of each instance
+ *
+ * @return void
+ */
+static void modbusIrqHandler0(void)
+{
+    modbusIrqHandler(modbusNodes[0]);
+}
+
+static void modbusIrqHandler1(void)
+{
+    modbusIrqHandler(modbusNodes[1]);
+}
+
+static void modbusIrqHandler2(void)
+{
+    modbusIrqHandler(modbusNodes[2]);
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to initialize a Modbus node, the idle line interrupt of the LPUART ends
+ *        the frames and its callback is taken over by the stack
+ *
+ * The character time is derived from the oversampling ratio and the divisor of the instance, so the
+ * baudrate must be set before. The LPIT timebase must be running to time the silences.
+ *
+ * A gap of 1.5 characters inside a frame is an error, so the idle time is the shortest setting of at
+ * least 1.5 characters: a longer gap splits the frame and both parts fail their CRC. The frame is then
+ * complete, the rest of the 3.5 characters of silence is timed with the LPIT before the next frame is
+ * sent. Data received before is dropped.
+ *
+ * @param modbus[in/out]: pointer to the node
+ * @param pLPUARTx[in]: LPUART instance, set up with LPUART_Init and LPUART_BufferInit
+ * @param role[in]: role of the node
+ * @param address[in]: address of the slave, from 1 to 247, not used by the master
+ *
+ * @return Std_Modbus_Status: MODBUS_E_NOT_OK if the instance or the address is not valid, or if the LPIT
+ *                            timebase is stopped
+ */
+Std_Modbus_Status modbusInit(Std_Modbus_Types *modbus, LPUART_Type *pLPUARTx, Modbus_Role_Types role, uint8_t address)
+{
+    Std_Modbus_Status status = MODBUS_E_NOT_OK;
+    uint8_t index = modbusGetIndex(pLPUARTx);
+    uint32_t baudRate = LPUART_GetBaudRate(pLPUARTx);
+    uint64_t frequency = LPIT_GetFrequency();
+
+    if((0 != modbus) && (MODBUS_INSTANCE_NUM > index) && (0 != baudRate) && (0U != frequency) &&
+       (MODBUS_ROLE_MASTER >= role) &&
+       ((MODBUS_ROLE_MASTER == role) || ((MODBUS_BROADCAST != address) && (MODBUS_ADDRESS_MAX >= address))))
+    {
+        uint64_t charNs = ((uint64_t)MODBUS_CHAR_BITS * MODBUS_NS_PER_S) / baudRate;
+        uint64_t t15Ns = (MODBUS_FIXED_BAUDRATE < baudRate) ? MODBUS_T15_FIXED_NS : ((3U * charNs) / 2U);
+        uint64_t t35Ns = (MODBUS_FIXED_BAUDRATE < baudRate) ? MODBUS_T35_FIXED_NS : ((7U * charNs) / 2U);
+        LPUART_IdleChars_Type idleChars = LPUART_IDLE_1_CHAR;
+
+        while((LPUART_IDLE_128_CHARS > idleChars) && ((charNs << idleChars) < t15Ns))
+        {
+            idleChars++;
+        }
+
+        modbus->pLPUARTx = pLPUARTx;
+        modbus->role = role;
+        modbus->address = address;
+        modbus->holding = 0;
+        modbus->nOfHolding = 0;
+        modbus->input = 0;
+        modbus->nOfInput = 0;
+        modbus->charCycles = (charNs * frequency) / MODBUS_NS_PER_S;
+        modbus->idleCycles = ((charNs << idleChars) * frequency) / MODBUS_NS_PER_S;
+        modbus->silenceCycles = (t35Ns * frequency) / MODBUS_NS_PER_S;
+        modbus->frameIn = 0;
+        modbus->frameOut = 0;
+        modbus->readyStamp = 0;
+        modbus->state = MODBUS_STATE_IDLE;
+        modbus->result = MODBUS_E_OK;
+        modbus->exception = 0;
+        modbus->stats = (Modbus_Statistics_Types){0};
+
+        /* With the receiver off the Rx count matches the empty ring */
+        LPUART_SetRxState(pLPUARTx, 0);
+        LPUART_RxConsume(pLPUARTx, 0xFFFFFFFFU);
+        modbus->rxServed = LPUART_GetRxCount(pLPUARTx);
+
+        modbusNodes[index] = modbus;
+
+        HAL_LPUART_RxInterruptConfig(pLPUARTx, LPUART_RX_INTERRUPT_ENABLE);
+        LPUART_CallbackRegister(pLPUARTx, modbusIrqHandlers[index]);
+        LPUART_IdleLineConfig(pLPUARTx, idleChars, 1);
+        LPUART_SetRxState(pLPUARTx, 1);
+
+        status = MODBUS_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to give the register maps served by a slave
+ *
+ * @param modbus[in/out]: pointer to the node
+ * @param holding[in/out]: holding register map, sorted by increasing address, 0 for none
+ * @param nOfHolding[in]: number of entries in the holding register map
+ * @param input[in/out]: input register map, sorted by increasing address, 0 for none
+ * @param nOfInput[in]: number of entries in the input register map
+ *
+ * @return Std_Modbus_Status: MODBUS_E_NOT_OK if a map is not sorted
+ */
+Std_Modbus_Status modbusSetRegisters(Std_Modbus_Types *modbus, Std_Modbus_Register_Types *holding, uint16_t nOfHolding,
+                                     Std_Modbus_Register_Types *input, uint16_t nOfInput)
+{
+    Std_Modbus_Status status = MODBUS_E_NOT_OK;
+
+    if((0 != modbus) && (0 != modbusIsSorted(holding, nOfHolding)) && (0 != modbusIsSorted(input, nOfInput)))
+    {
+        modbus->holding = holding;
+        modbus->nOfHolding = (0 != holding) ? nOfHolding : 0U;
+        modbus->input = input;
+        modbus->nOfInput = (0 != input) ? nOfInput : 0U;
+        status = MODBUS_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to serve the received frames and to send the pending frame, it should be
+ *        called from the background loop
+ *
+ * Frames wait in the Rx ring while the node has a frame of its own to send. The response of a slave
+ * starts at the first call after the 3.5 characters of silence that follow the request.
+ *
+ * @param modbus[in/out]: pointer to the node
+ *
+ * @return void
+ */
+void modbusPoll(Std_Modbus_Types *modbus)
+{
+    if(0 != modbus)
+    {
+        while((modbus->frameOut != modbus->frameIn) &&
+              ((MODBUS_STATE_IDLE == modbus->state) || (MODBUS_STATE_WAIT_REPLY == modbus->state)))
+        {
+            uint8_t slot = modbus->frameOut & (MODBUS_FRAME_QUEUE - 1U);
+            Modbus_Frame_Types frame = {0};
+            uint32_t tailLen = 0;
+
+            frame.len = modbus->frameEnd[slot] - modbus->rxServed;
+            frame.headLen = LPUART_RxPeek(modbus->pLPUARTx, 0, &frame.pHead);
+
+            if(frame.headLen < frame.len)
+            {
+                tailLen = LPUART_RxPeek(modbus->pLPUARTx, frame.headLen, &frame.pTail);
+            }
+
+            if((MODBUS_FRAME_MIN <= frame.len) && (frame.len <= (frame.headLen + tailLen)))
+            {
+                uint32_t headLen = (frame.len < frame.headLen) ? frame.len : frame.headLen;
+                uint16_t crc = modbusCrc(0xFFFFU, frame.pHead, headLen);
+
+                /* The CRC over the frame and its own CRC is 0 */
+                crc = modbusCrc(crc, frame.pTail, frame.len - headLen);
+
+                if(0 == crc)
+                {
+                    modbus->stats.frames++;
+                    modbus->requestEnd = modbus->frameStamp[slot];
+
+                    if(MODBUS_ROLE_SLAVE == modbus->role)
+                    {
+                        modbusServeRequest(modbus, &frame);
+                    }
+                    else
+                    {
+                        modbusServeResponse(modbus, &frame);
+                    }
+                }
+                else
+                {
+                    modbus->stats.crcErrors++;
+                }
+            }
+            else
+            {
+                modbus->stats.crcErrors++;
+            }
+
+            LPUART_RxConsume(modbus->pLPUARTx, frame.len);
+            modbus->rxServed += frame.len;
+            modbus->readyStamp = modbus->frameStamp[slot] + modbus->silenceCycles;
+            modbus->frameOut++;
+        }
+
+        if(MODBUS_STATE_TURNAROUND == modbus->state)
+        {
+            uint64_t now = LPIT_GetTimestamp();
+
+            if((now >= modbus->readyStamp) && (LPUART_E_OK == LPUART_TransmitV(modbus->pLPUARTx, &modbus->txVec, 1)))
+            {
+                if((MODBUS_ROLE_SLAVE == modbus->role) && ((now - modbus->requestEnd) > modbus->stats.latencyMax))
+                {
+                    modbus->stats.latencyMax = (uint32_t)(now - modbus->requestEnd);
+                }
+
+                modbus->state = MODBUS_STATE_SENDING;
+            }
+        }
+        else if(MODBUS_STATE_SENDING == modbus->state)
+        {
+            if(0 == LPUART_IsTransmitVBusy(modbus->pLPUARTx))
+            {
+                /* The last 2 characters are still shifted out of the transmitter */
+                modbus->readyStamp = LPIT_GetTimestamp() + (2U * modbus->charCycles) + modbus->silenceCycles;
+
+                if((MODBUS_ROLE_MASTER == modbus->role) && (MODBUS_BROADCAST != modbus->slave))
+                {
+                    modbus->deadline = LPIT_Deadline(MODBUS_RESPONSE_TIMEOUT_US);
+                    modbus->state = MODBUS_STATE_WAIT_REPLY;
+                }
+                else
+                {
+                    modbus->result = MODBUS_E_OK;
+                    modbus->state = MODBUS_STATE_IDLE;
+                }
+            }
+        }
+        else if(MODBUS_STATE_WAIT_REPLY == modbus->state)
+        {
+            if(0 != LPIT_IsExpired(modbus->deadline))
+            {
+                modbus->result = MODBUS_E_TIMEOUT;
+                modbus->stats.timeouts++;
+                modbus->state = MODBUS_STATE_IDLE;
+            }
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+}
+
+/**
+ * @brief This function is used to start a request of the master, modbusPoll sends it and waits for the
+ *        response
+ *
+ * @param modbus[in/out]: pointer to the master
+ * @param slave[in]: address of the slave, MODBUS_BROADCAST for a write to every slave
+ * @param function[in]: MODBUS_FC_READ_HOLDING, MODBUS_FC_READ_INPUT, MODBUS_FC_WRITE_SINGLE or
+ *                      MODBUS_FC_WRITE_MULTIPLE
+ * @param address[in]: address of the first register
+ * @param count[in]: number of registers, 1 for MODBUS_FC_WRITE_SINGLE
+ * @param pValues[in/out]: values written, or receiving the values read, must stay valid until the end
+ *
+ * @return Std_Modbus_Status: MODBUS_E_NOT_OK if the request is not valid or the master is busy
+ */
+Std_Modbus_Status modbusRequest(Std_Modbus_Types *modbus, uint8_t slave, uint8_t function, uint16_t address,
+                                uint16_t count, uint16_t *pValues)
+{
+    Std_Modbus_Status status = MODBUS_E_NOT_OK;
+
+    if((0 != modbus) && (MODBUS_ROLE_MASTER == modbus->role) && (MODBUS_STATE_IDLE == modbus->state) &&
+       (0 != pValues) && (MODBUS_ADDRESS_MAX >= slave) && (0 != count))
+    {
+        uint8_t *pTx = modbus->txBuffer;
+        uint32_t len = 0;
+
+        pTx[0] = slave;
+        pTx[1] = function;
+        pTx[2] = (uint8_t)(address >> 8U);
+        pTx[3] = (uint8_t)address;
+
+        if(((MODBUS_FC_READ_HOLDING == function) || (MODBUS_FC_READ_INPUT == function)) &&
+           (MODBUS_BROADCAST != slave) && (MODBUS_READ_MAX >= count))
+        {
+            pTx[4] = (uint8_t)(count >> 8U);
+            pTx[5] = (uint8_t)count;
+            len = 6;
+        }
+        else if((MODBUS_FC_WRITE_SINGLE == function) && (1U == count))
+        {
+            pTx[4] = (uint8_t)(pValues[0] >> 8U);
+            pTx[5] = (uint8_t)pValues[0];
+            len = 6;
+        }
+        else if((MODBUS_FC_WRITE_MULTIPLE == function) && (MODBUS_WRITE_MAX >= count))
+        {
+            pTx[4] = (uint8_t)(count >> 8U);
+            pTx[5] = (uint8_t)count;
+            pTx[6] = (uint8_t)(2U * count);
+
+            for(uint32_t i = 0; i < count; i++)
+            {
+                pTx[7U + (2U * i)] = (uint8_t)(pValues[i] >> 8U);
+                pTx[8U + (2U * i)] = (uint8_t)pValues[i];
+            }
+
+            len = 7U + (2U * count);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        if(0 != len)
+        {
+            modbus->slave = slave;
+            modbus->function = function;
+            modbus->count = count;
+            modbus->pValues = pValues;
+            modbus->exception = 0;
+            modbus->result = MODBUS_E_BUSY;
+            modbusFinish(modbus, len);
+            status = MODBUS_E_OK;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to get the result of the last request of the master
+ *
+ * @param modbus[in]: pointer to the master
+ * @param pException[out]: exception code when the result is MODBUS_E_EXCEPTION, can be 0
+ *
+ * @return Std_Modbus_Status: MODBUS_E_BUSY until the response is received or times out
+ */
+Std_Modbus_Status modbusGetResult(const Std_Modbus_Types *modbus, uint8_t *pException)
+{
+    Std_Modbus_Status status = MODBUS_E_NOT_OK;
+
+    if(0 != modbus)
+    {
+        status = modbus->result;
+
+        if(0 != pException)
+        {
+            *pException = modbus->exception;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to feed data into a running Modbus CRC
+ *
+ * @param crc[in]: running CRC, 0xFFFF for a new computation
+ * @param data[in]: pointer to the data
+ * @param length[in]: length of the data
+ *
+ * @return uint16_t: updated CRC, sent low byte first
+ */
+uint16_t modbusCrc(uint16_t crc, const uint8_t *data, uint32_t length)
+{
+    for(uint32_t i = 0; i < length; i++)
+    {
+        crc = (uint16_t)((crc >> 8U) ^ modbusCrcTable[(crc ^ data[i]) & 0xFFU]);
+    }
+
+    return crc;
+}
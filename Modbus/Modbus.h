@@ -0,0 +1,211 @@
+/**
+ * @file Modbus.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the Modbus RTU master and slave stack running over LPUART
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef MODBUS_H_
+#define MODBUS_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpuart_driver.h"
+#include "s32k144_lpit_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define MODBUS_ADU_MAX          (256U)      /* Maximum length of a frame */
+#define MODBUS_BROADCAST        (0U)        /* Address of a request executed by every slave, without response */
+#define MODBUS_FRAME_QUEUE      (4U)        /* Frames received and not served yet, must be a power of 2 */
+#define MODBUS_READ_MAX         (125U)      /* Maximum number of registers read by a request */
+#define MODBUS_WRITE_MAX        (123U)      /* Maximum number of registers written by a request */
+
+#define MODBUS_FC_READ_HOLDING  (0x03U)     /* Read holding registers */
+#define MODBUS_FC_READ_INPUT    (0x04U)     /* Read input registers */
+#define MODBUS_FC_WRITE_SINGLE  (0x06U)     /* Write single register */
+#define MODBUS_FC_WRITE_MULTIPLE (0x10U)    /* Write multiple registers */
+
+#define MODBUS_EX_ILLEGAL_FUNCTION  (0x01U) /* Function code not supported */
+#define MODBUS_EX_ILLEGAL_ADDRESS   (0x02U) /* Register not in the map or not writable */
+#define MODBUS_EX_ILLEGAL_VALUE     (0x03U) /* Register count or byte count not valid */
+
+#ifndef MODBUS_RESPONSE_TIMEOUT_US
+#define MODBUS_RESPONSE_TIMEOUT_US  (100000U)   /* Time the master waits for a response */
+#endif
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    MODBUS_E_OK,            /* Operation completed without error */
+    MODBUS_E_NOT_OK,        /* Operation not completed */
+    MODBUS_E_BUSY,          /* Request of the master still running */
+    MODBUS_E_TIMEOUT,       /* No response before MODBUS_RESPONSE_TIMEOUT_US */
+    MODBUS_E_EXCEPTION,     /* The slave answered with an exception */
+} Std_Modbus_Status;        /* Standard status type */
+
+typedef enum
+{
+    MODBUS_ROLE_SLAVE,      /* Answers the requests sent to its address */
+    MODBUS_ROLE_MASTER,     /* Sends requests with modbusRequest */
+} Modbus_Role_Types;        /* Role of the node */
+
+typedef enum
+{
+    MODBUS_STATE_IDLE,          /* Waiting for a frame, or for a request of the application */
+    MODBUS_STATE_TURNAROUND,    /* Frame built, waiting for the silence of 3.5 characters on the bus */
+    MODBUS_STATE_SENDING,       /* Frame being written to the transmitter */
+    MODBUS_STATE_WAIT_REPLY,    /* Master waiting for the response */
+} Modbus_State_Types;           /* State of the node */
+
+typedef struct
+{
+    uint16_t address;           /* Register address, the map is sorted by increasing address */
+    uint16_t *pValue;           /* Value of the register */
+    uint8_t isWritable;         /* 1 if the master may write the register */
+    volatile uint8_t isUpdated; /* Set by the stack after each write, cleared by the user */
+} Std_Modbus_Register_Types;    /* Entry of a register map */
+
+typedef struct
+{
+    uint32_t frames;            /* Frames with a valid CRC */
+    uint32_t crcErrors;         /* Frames too short or with a wrong CRC */
+    uint32_t exceptions;        /* Exceptions answered by the slave or received by the master */
+    uint32_t timeouts;          /* Requests of the master without response */
+    uint32_t overruns;          /* Frame ends lost because MODBUS_FRAME_QUEUE frames were waiting */
+    uint32_t latencyMax;        /* Longest time from the end of a request to the start of the response, in LPIT counts */
+} Modbus_Statistics_Types;      /* Statistics of the node */
+
+typedef struct
+{
+    LPUART_Type *pLPUARTx;                      /* LPUART instance, set up with LPUART_BufferInit */
+    Modbus_Role_Types role;                     /* Role of the node */
+    uint8_t address;                            /* Address of the slave, from 1 to 247 */
+    Std_Modbus_Register_Types *holding;         /* Holding register map of the slave */
+    uint16_t nOfHolding;                        /* Number of entries in the holding register map */
+    Std_Modbus_Register_Types *input;           /* Input register map of the slave */
+    uint16_t nOfInput;                          /* Number of entries in the input register map */
+    uint64_t charCycles;                        /* Computed by modbusInit: one character, in LPIT counts */
+    uint64_t idleCycles;                        /* Computed by modbusInit: idle time ending a frame */
+    uint64_t silenceCycles;                     /* Computed by modbusInit: 3.5 characters between frames */
+    volatile uint32_t frameEnd[MODBUS_FRAME_QUEUE];     /* Rx count at the end of each frame received */
+    volatile uint64_t frameStamp[MODBUS_FRAME_QUEUE];   /* LPIT timestamp of the end of each frame */
+    volatile uint8_t frameIn;                   /* Frames queued by the idle interrupt */
+    uint8_t frameOut;                           /* Frames served */
+    uint32_t rxServed;                          /* Rx count of the data already served */
+    uint64_t readyStamp;                        /* Timestamp the bus has been silent for 3.5 characters */
+    uint64_t requestEnd;                        /* Timestamp of the end of the request being answered */
+    volatile Modbus_State_Types state;          /* State of the node */
+    uint8_t txBuffer[MODBUS_ADU_MAX];           /* Frame being sent */
+    LPUART_IoVec_Type txVec;                    /* Segment of the frame being sent */
+    uint8_t slave;                              /* Master: address of the request */
+    uint8_t function;                           /* Master: function code of the request */
+    uint16_t count;                             /* Master: number of registers of the request */
+    uint16_t *pValues;                          /* Master: values read by the request */
+    uint64_t deadline;                          /* Master: end of the response timeout */
+    volatile Std_Modbus_Status result;          /* Master: result of the last request */
+    uint8_t exception;                          /* Master: exception code of the last response */
+    Modbus_Statistics_Types stats;              /* Statistics of the node */
+} Std_Modbus_Types;                             /* Modbus RTU node */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name modbusInit
+ *
+ * @brief This function is used to initialize a Modbus node, the idle line interrupt of the LPUART ends
+ *        the frames and its callback is taken over by the stack
+ *
+ * The character time is derived from the oversampling ratio and the divisor of the instance, so the
+ * baudrate must be set before. The LPIT timebase must be running to time the silences.
+ *
+ * @param modbus[in/out]: pointer to the node
+ * @param pLPUARTx[in]: LPUART instance, set up with LPUART_Init and LPUART_BufferInit
+ * @param role[in]: role of the node
+ * @param address[in]: address of the slave, from 1 to 247, not used by the master
+ *
+ * @return Std_Modbus_Status: MODBUS_E_NOT_OK if the instance or the address is not valid, or if the LPIT
+ *                            timebase is stopped
+ */
+Std_Modbus_Status modbusInit(Std_Modbus_Types *modbus, LPUART_Type *pLPUARTx, Modbus_Role_Types role, uint8_t address);
+
+/**
+ * @name modbusSetRegisters
+ *
+ * @brief This function is used to give the register maps served by a slave
+ *
+ * @param modbus[in/out]: pointer to the node
+ * @param holding[in/out]: holding register map, sorted by increasing address, 0 for none
+ * @param nOfHolding[in]: number of entries in the holding register map
+ * @param input[in/out]: input register map, sorted by increasing address, 0 for none
+ * @param nOfInput[in]: number of entries in the input register map
+ *
+ * @return Std_Modbus_Status: MODBUS_E_NOT_OK if a map is not sorted
+ */
+Std_Modbus_Status modbusSetRegisters(Std_Modbus_Types *modbus, Std_Modbus_Register_Types *holding, uint16_t nOfHolding,
+                                     Std_Modbus_Register_Types *input, uint16_t nOfInput);
+
+/**
+ * @name modbusPoll
+ *
+ * @brief This function is used to serve the received frames and to send the pending frame, it should be
+ *        called from the background loop
+ *
+ * @param modbus[in/out]: pointer to the node
+ *
+ * @return void
+ */
+void modbusPoll(Std_Modbus_Types *modbus);
+
+/**
+ * @name modbusRequest
+ *
+ * @brief This function is used to start a request of the master, modbusPoll sends it and waits for the
+ *        response
+ *
+ * @param modbus[in/out]: pointer to the master
+ * @param slave[in]: address of the slave, MODBUS_BROADCAST for a write to every slave
+ * @param function[in]: MODBUS_FC_READ_HOLDING, MODBUS_FC_READ_INPUT, MODBUS_FC_WRITE_SINGLE or
+ *                      MODBUS_FC_WRITE_MULTIPLE
+ * @param address[in]: address of the first register
+ * @param count[in]: number of registers, 1 for MODBUS_FC_WRITE_SINGLE
+ * @param pValues[in/out]: values written, or receiving the values read, must stay valid until the end
+ *
+ * @return Std_Modbus_Status: MODBUS_E_NOT_OK if the request is not valid or the master is busy
+ */
+Std_Modbus_Status modbusRequest(Std_Modbus_Types *modbus, uint8_t slave, uint8_t function, uint16_t address,
+                                uint16_t count, uint16_t *pValues);
+
+/**
+ * @name modbusGetResult
+ *
+ * @brief This function is used to get the result of the last request of the master
+ *
+ * @param modbus[in]: pointer to the master
+ * @param pException[out]: exception code when the result is MODBUS_E_EXCEPTION, can be 0
+ *
+ * @return Std_Modbus_Status: MODBUS_E_BUSY until the response is received or times out
+ */
+Std_Modbus_Status modbusGetResult(const Std_Modbus_Types *modbus, uint8_t *pException);
+
+/**
+ * @name modbusCrc
+ *
+ * @brief This function is used to feed data into a running Modbus CRC
+ *
+ * @param crc[in]: running CRC, 0xFFFF for a new computation
+ * @param data[in]: pointer to the data
+ * @param length[in]: length of the data
+ *
+ * @return uint16_t: updated CRC, sent low byte first
+ */
+uint16_t modbusCrc(uint16_t crc, const uint8_t *data, uint32_t length);
+
+#endif /* MODBUS_H_ */
@@ -15,7 +15,7 @@
 /*******************************************************************************
 * Include
 *******************************************************************************/
-#include "../src/Driver/PCC/Include/s32k144_PCC_hal.h"
+#include "s32k144_pcc_hal.h"
 
 /*******************************************************************************/
 /* Type Definitions                                                            */
@@ -25,6 +25,7 @@ typedef enum
 {
    SCG_E_OK     = 0U,
    SCG_E_NOT_OK = 1U,
+   SCG_E_TIMEOUT = 2U,                      /* clock source never became valid */
 }Std_SCG_Status;
 
 typedef enum
@@ -33,9 +34,55 @@ typedef enum
    PCC_E_NOT_OK = 1U,                       /* fail */
 }Std_PCC_Status;
 
+typedef void (*SCG_CallbackPtr)(uint32_t frequency);   /* Called after the system clock changed */
+
 /*******************************************************************************
 * Prototypes
 ******************************************************************************/
+/**
+ * @brief Enable a clock source, the system clock is moved back to FIRC if SOSC or SPLL never becomes valid.
+ *
+ * @param source              [Input] Clock source to enable.
+ * @return uint32_t           Returns E_OK if successful, E_TIMEOUT if the source never became valid within
+ *                            the cycle budget, otherwise E_NOT_OK.
+ */
+Std_SCG_Status SCG_SystemClock_Config( SCG_ClockSource_t source);
+
+/**
+ * @brief Set the cycles allowed to a clock source to become valid.
+ *
+ * @param budgetCycles        [Input] Budget in cycles of SCG_CYCLE_COUNTER.
+ * @return uint32_t           Returns E_OK.
+ */
+Std_SCG_Status SCG_SetWaitBudget( uint32_t budgetCycles);
+
+/**
+ * @brief Register the function called after SCG_SystemClock_Config changed the system clock, including the
+ *        fallback to FIRC.
+ *
+ * @param callback            [Input] Function called with the new frequency in Hz, 0 to remove it.
+ * @return uint32_t           Returns E_OK.
+ */
+Std_SCG_Status SCG_ClockChangeCallbackRegister( SCG_CallbackPtr callback);
+
+/**
+ * @brief Read how long the waits of a clock source took, to size the budget from measured data.
+ *
+ * @param source              [Input] Clock source.
+ * @param pStatistics         [Output] Copy of the measured waits.
+ * @return uint32_t           Returns E_OK if successful, otherwise E_NOT_OK.
+ */
+Std_SCG_Status SCG_GetWaitStatistics( SCG_ClockSource_t source, SCG_Wait_Statistics_t *pStatistics);
+
+/**
+ * @brief Enable SIRC for the peripherals, kept running in stop and very low power modes.
+ *
+ * @param sircDiv             [Input] Divider of SIRCDIV1 and SIRCDIV2.
+ * @return uint32_t           Returns E_OK if successful, E_NOT_OK if SIRC clocks the system, E_TIMEOUT if
+ *                            SIRC never became valid.
+ */
+Std_SCG_Status SCG_SIRC_Config( SCG_DIV sircDiv);
+
 /**
  * @brief Check the peripheral reset status.
  *
@@ -15,6 +15,7 @@
 * Include
 *******************************************************************************/
 #include "S32K144.h"
+#include "CycleCounter.h"
 
 /*******************************************************************************
 * MACRO
@@ -22,6 +23,30 @@
 #define PR_BIT_SET   1U                 /* Macro to set a peripheral reset (PR) bit. */
 #define PR_BIT_CLEAR 0U                 /* Macro to clear a peripheral reset (PR) bit. */
 
+#define SCG_HAL_OK      0U              /* Clock source configured */
+#define SCG_HAL_ERROR   1U              /* Clock source not configured */
+#define SCG_HAL_TIMEOUT 2U              /* Clock source never became valid within the cycle budget */
+
+#define SCG_SCS_FIRC    3U              /* System clock source field value of FIRC */
+
+#ifndef SCG_CYCLE_COUNTER
+#define SCG_CYCLE_COUNTER() CYCLE_COUNTER()     /* Cycle counter of the clock source waits */
+#endif
+
+#ifndef SCG_CYCLE_COUNTER_ENABLE
+/* The waits are bounded even before the application starts the counter */
+#define SCG_CYCLE_COUNTER_ENABLE() CYCLE_COUNTER_ENABLE()
+#endif
+
+#ifndef SCG_WAIT_BUDGET_CYCLES
+#define SCG_WAIT_BUDGET_CYCLES (480000U)    /* Default cycles allowed to a clock source to become valid, 10 ms on FIRC */
+#endif
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern uint32_t clock;                  /* System clock frequency in Hz */
+
 /*******************************************************************************/
 /* Type Definitions                                                            */
 /*******************************************************************************/
@@ -60,6 +85,15 @@ typedef enum {
 
 } SCG_ClockSource_t;
 
+#define SCG_CLOCK_SOURCE_NUM 4U                         /* Number of clock sources */
+
+typedef struct
+{
+    uint32_t lastCycles;                                /* Duration of the last wait, in SCG_CYCLE_COUNTER cycles */
+    uint32_t maxCycles;                                 /* Longest wait */
+    uint32_t timeouts;                                  /* Waits that ran out of budget */
+} SCG_Wait_Statistics_t;
+
 /**
  * @enum PeripheralClockSource
  * @brief Enumeration of possible clock sources for a peripheral.
@@ -157,6 +191,31 @@ uint32_t HAL_Clock_Divider_Select(uint32_t peripheralIndex, PeripheralClockDivid
  */
 uint32_t HAL_Disable_Peripheral_Clock(uint32_t peripheralIndex);
 
+/**
+ * @brief Enable a clock source and wait for it to be valid within the cycle budget. The system clock is moved
+ *        back to FIRC if SOSC or SPLL never becomes valid.
+ *
+ * @param source                    [Input] Clock source to enable.
+ * @return uint32_t                 Returns SCG_HAL_OK if successful, SCG_HAL_TIMEOUT if the source never
+ *                                  became valid, SCG_HAL_ERROR if the source is not known.
+ */
 uint32_t HAL_SystemClock_Config (SCG_ClockSource_t source);
 
+/**
+ * @brief Set the cycles allowed to a clock source to become valid.
+ *
+ * @param budgetCycles              [Input] Budget in cycles of SCG_CYCLE_COUNTER.
+ * @return uint32_t                 Returns 0 if successful
+ */
+uint32_t HAL_SCG_SetWaitBudget(uint32_t budgetCycles);
+
+/**
+ * @brief Read the measured waits of a clock source.
+ *
+ * @param source                    [Input] Clock source.
+ * @param pStatistics               [Output] Copy of the measured waits.
+ * @return uint32_t                 Returns 0 if successful
+ */
+uint32_t HAL_SCG_GetWaitStatistics(SCG_ClockSource_t source, SCG_Wait_Statistics_t *pStatistics);
+
 #endif /* INC_S32K1XX_PCC_HAL_H_ */
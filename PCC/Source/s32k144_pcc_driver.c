@@ -12,23 +12,121 @@
 /*******************************************************************************
 * Include
 *******************************************************************************/
-#include "../src/Driver/PCC/Include/s32k144_PCC_driver.h"
+#include "s32k144_pcc_driver.h"
+#include "Trace.h"
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static SCG_CallbackPtr SCG_ClockChangeCallback;    /* Called after the system clock changed */
 
 /*******************************************************************************
  * Code
  ******************************************************************************/
+/**
+ * @brief Enable a clock source, the system clock is moved back to FIRC if SOSC or SPLL never becomes valid.
+ *
+ * @param source              [Input] Clock source to enable.
+ * @return uint32_t           Returns E_OK if successful, E_TIMEOUT if the source never became valid within
+ *                            the cycle budget, otherwise E_NOT_OK.
+ */
 Std_SCG_Status SCG_SystemClock_Config(SCG_ClockSource_t source)
 {
     Std_SCG_Status status = SCG_E_OK;
-    status = HAL_SystemClock_Config(source);
+    uint32_t result = HAL_SystemClock_Config(source);
 
-    if(SCG_E_OK != status)
+    if(SCG_HAL_TIMEOUT == result)
+    {
+        status = SCG_E_TIMEOUT;
+    }
+    else if(SCG_HAL_OK != result)
     {
         status = SCG_E_NOT_OK;
     }
 
+    /* A timeout also changed the clock, back to FIRC */
+    if((SCG_E_NOT_OK != status) && (0 != SCG_ClockChangeCallback))
+    {
+        SCG_ClockChangeCallback(clock);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Set the cycles allowed to a clock source to become valid.
+ *
+ * @param budgetCycles        [Input] Budget in cycles of SCG_CYCLE_COUNTER.
+ * @return uint32_t           Returns E_OK.
+ */
+Std_SCG_Status SCG_SetWaitBudget( uint32_t budgetCycles)
+{
+    HAL_SCG_SetWaitBudget(budgetCycles);
+    return SCG_E_OK;
+}
+
+/**
+ * @brief Register the function called after SCG_SystemClock_Config changed the system clock, including the
+ *        fallback to FIRC.
+ *
+ * @param callback            [Input] Function called with the new frequency in Hz, 0 to remove it.
+ * @return uint32_t           Returns E_OK.
+ */
+Std_SCG_Status SCG_ClockChangeCallbackRegister(SCG_CallbackPtr callback)
+{
+    SCG_ClockChangeCallback = callback;
+
+    return SCG_E_OK;
+}
+
+/**
+ * @brief Read how long the waits of a clock source took, to size the budget from measured data.
+ *
+ * @param source              [Input] Clock source.
+ * @param pStatistics         [Output] Copy of the measured waits.
+ * @return uint32_t           Returns E_OK if successful, otherwise E_NOT_OK.
+ */
+Std_SCG_Status SCG_GetWaitStatistics( SCG_ClockSource_t source, SCG_Wait_Statistics_t *pStatistics)
+{
+    Std_SCG_Status status = SCG_E_NOT_OK;
+
+    if(((uint32_t)source < SCG_CLOCK_SOURCE_NUM) && (0 != pStatistics))
+    {
+        HAL_SCG_GetWaitStatistics(source, pStatistics);
+        status = SCG_E_OK;
+    }
+
     return status;
 }
+
+/**
+ * @brief Enable SIRC for the peripherals, kept running in stop and very low power modes.
+ *
+ * @param sircDiv             [Input] Divider of SIRCDIV1 and SIRCDIV2.
+ * @return uint32_t           Returns E_OK if successful, E_NOT_OK if SIRC clocks the system, E_TIMEOUT if
+ *                            SIRC never became valid.
+ */
+Std_SCG_Status SCG_SIRC_Config( SCG_DIV sircDiv)
+{
+    Std_SCG_Status status = SCG_E_NOT_OK;
+
+    if(sircDiv <= SCG_DIVIDE_BY_64)
+    {
+        uint32_t result = HAL_SIRC( (uint32_t)sircDiv);
+
+        if(SCG_HAL_OK == result)
+        {
+            status = SCG_E_OK;
+        }
+        else if(SCG_HAL_TIMEOUT == result)
+        {
+            status = SCG_E_TIMEOUT;
+        }
+    }
+
+    return status;
+}
+
 /**
  * @brief Initialize the specified peripheral.
  *
@@ -38,6 +136,9 @@ Std_SCG_Status SCG_SystemClock_Config(SCG_ClockSource_t source)
 Std_PCC_Status PCC_Init( uint32_t peripheralIndex)
 {
     Std_PCC_Status status = PCC_E_OK;
+
+    TRACE_ENTER(TRACE_ID_PCC_INIT);
+
     /* enable the peripheral clock using the HAL function */
     status = HAL_Enable_Peripheral_Clock( peripheralIndex);
 
@@ -47,6 +148,8 @@ Std_PCC_Status PCC_Init( uint32_t peripheralIndex)
         status = PCC_E_NOT_OK;
     }
 
+    TRACE_EXIT(TRACE_ID_PCC_INIT);
+
     return status;
 }
 
@@ -11,14 +11,120 @@
 /*******************************************************************************
 * Include
 *******************************************************************************/
-#include "../src/Driver/PCC/Include/s32k144_PCC_hal.h"
+#include "s32k144_pcc_hal.h"
 
 /*******************************************************************************
  * Code
  ******************************************************************************/
 uint32_t clock = 48000000;
+
+static uint32_t HAL_SCG_WaitBudget = SCG_WAIT_BUDGET_CYCLES;    /* Cycles allowed to a clock source to become valid */
+
+static SCG_Wait_Statistics_t HAL_SCG_WaitStatistics[SCG_CLOCK_SOURCE_NUM];  /* Measured waits of each clock source */
+
+/**
+ * @brief Wait for the valid flag of a clock source within the cycle budget and record how long it took.
+ *
+ * @param source                    [Input] Clock source waited for, selects the statistics.
+ * @param pCsr                      [Input] Control status register of the clock source.
+ * @param vldMask                   [Input] Mask of the valid flag in the register.
+ * @return uint32_t                 Returns SCG_HAL_OK if the flag is set, SCG_HAL_TIMEOUT otherwise.
+ */
+static uint32_t HAL_SCG_WaitValid(SCG_ClockSource_t source, volatile uint32_t *pCsr, uint32_t vldMask)
+{
+    uint32_t status = SCG_HAL_TIMEOUT;
+    uint32_t start;
+    uint32_t elapsed = 0;
+
+    SCG_CYCLE_COUNTER_ENABLE();
+    start = SCG_CYCLE_COUNTER();
+
+    /* The flag is checked once more after the budget, a source valid at the last moment is not lost */
+    do
+    {
+        if(*pCsr & vldMask)
+        {
+            status = SCG_HAL_OK;
+        }
+        else
+        {
+            elapsed = SCG_CYCLE_COUNTER() - start;
+        }
+    } while((SCG_HAL_OK != status) && (elapsed <= HAL_SCG_WaitBudget));
+
+    elapsed = SCG_CYCLE_COUNTER() - start;
+    HAL_SCG_WaitStatistics[source].lastCycles = elapsed;
+
+    if(elapsed > HAL_SCG_WaitStatistics[source].maxCycles)
+    {
+        HAL_SCG_WaitStatistics[source].maxCycles = elapsed;
+    }
+
+    if(SCG_HAL_OK != status)
+    {
+        HAL_SCG_WaitStatistics[source].timeouts++;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Move the system clock back to FIRC after a clock source failed, then disable the failed source.
+ *
+ * @param source                    [Input] Clock source that never became valid, SOSC or SPLL.
+ * @return void
+ */
+static void HAL_SCG_RollbackFirc(SCG_ClockSource_t source)
+{
+    uint32_t start;
+
+    /* FIRC runs out of reset, it is only enabled again if it was turned off */
+    if(!(SCG->FIRCCSR & SCG_FIRCCSR_FIRCVLD_MASK))
+    {
+        SCG->FIRCCSR = SCG_FIRCCSR_FIRCEN_MASK;
+        (void)HAL_SCG_WaitValid(SCG_CLOCK_FIRC, &SCG->FIRCCSR, SCG_FIRCCSR_FIRCVLD_MASK);
+    }
+
+    if(SCG->FIRCCSR & SCG_FIRCCSR_FIRCVLD_MASK)
+    {
+        /* 48 MHz core and bus, 24 MHz flash */
+        SCG->RCCR = SCG_RCCR_SCS(SCG_SCS_FIRC) | SCG_RCCR_DIVCORE(0) | SCG_RCCR_DIVBUS(0) | SCG_RCCR_DIVSLOW(1);
+
+        /* The switch takes a few cycles of both clocks, it is bounded like the other waits */
+        start = SCG_CYCLE_COUNTER();
+
+        while((((SCG->CSR & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT) != SCG_SCS_FIRC) &&
+              ((SCG_CYCLE_COUNTER() - start) <= HAL_SCG_WaitBudget))
+        {
+
+        }
+
+        clock = 48000000;
+    }
+
+    /* A source cannot be disabled while it clocks the system */
+    if(SCG_CLOCK_SOSC == source)
+    {
+        SCG->SOSCCSR &= ~SCG_SOSCCSR_SOSCEN_MASK;
+    }
+    else
+    {
+        SCG->SPLLCSR &= ~SCG_SPLLCSR_SPLLEN_MASK;
+    }
+}
+
+/**
+ * @brief Enable a clock source and wait for it to be valid within the cycle budget. The system clock is moved
+ *        back to FIRC if SOSC or SPLL never becomes valid.
+ *
+ * @param source                    [Input] Clock source to enable.
+ * @return uint32_t                 Returns SCG_HAL_OK if successful, SCG_HAL_TIMEOUT if the source never
+ *                                  became valid, SCG_HAL_ERROR if the source is not known.
+ */
 uint32_t HAL_SystemClock_Config (SCG_ClockSource_t source)
 {
+    uint32_t status = SCG_HAL_ERROR;
+
     switch (source)
     {
         case SCG_CLOCK_SOSC:
@@ -30,11 +136,8 @@ uint32_t HAL_SystemClock_Config (SCG_ClockSource_t source)
             SCG->SOSCCFG = SCG_SOSCCFG_RANGE(2) | SCG_SOSCCFG_EREFS_MASK;
             SCG->SOSCCSR = SCG_SOSCCSR_SOSCEN_MASK; /* Enable SOSC */
 
-            /* Wait for SOSC to be valid */
-            while (!(SCG->SOSCCSR & SCG_SOSCCSR_SOSCVLD_MASK))
-            {
-
-            }
+            /* Wait for SOSC to be valid, a missing crystal never sets the flag */
+            status = HAL_SCG_WaitValid(source, &SCG->SOSCCSR, SCG_SOSCCSR_SOSCVLD_MASK);
             break;
 
         case SCG_CLOCK_SIRC:
@@ -46,10 +149,7 @@ uint32_t HAL_SystemClock_Config (SCG_ClockSource_t source)
             SCG->SIRCCSR = SCG_SIRCCSR_SIRCEN_MASK;
 
             /* Wait for SIRC to be valid */
-            while (!(SCG->SIRCCSR & SCG_SIRCCSR_SIRCVLD_MASK))
-            {
-
-            }
+            status = HAL_SCG_WaitValid(source, &SCG->SIRCCSR, SCG_SIRCCSR_SIRCVLD_MASK);
             break;
 
         case SCG_CLOCK_FIRC:
@@ -61,10 +161,7 @@ uint32_t HAL_SystemClock_Config (SCG_ClockSource_t source)
             SCG->FIRCCSR = SCG_FIRCCSR_FIRCEN_MASK;
 
             /* Wait for FIRC to be valid */
-            while (!(SCG->FIRCCSR & SCG_FIRCCSR_FIRCVLD_MASK))
-            {
-
-            }
+            status = HAL_SCG_WaitValid(source, &SCG->FIRCCSR, SCG_FIRCCSR_FIRCVLD_MASK);
             break;
 
         case SCG_CLOCK_SPLL:
@@ -75,19 +172,80 @@ uint32_t HAL_SystemClock_Config (SCG_ClockSource_t source)
             /* Enable SPLL */
             SCG->SPLLCSR = SCG_SPLLCSR_SPLLEN_MASK;
 
-            /* Wait for SPLL to be valid */
-            while (!(SCG->SPLLCSR & SCG_SPLLCSR_SPLLVLD_MASK))
-            {
-
-            }
+            /* Wait for SPLL to be valid, it never locks without its SOSC reference */
+            status = HAL_SCG_WaitValid(source, &SCG->SPLLCSR, SCG_SPLLCSR_SPLLVLD_MASK);
             break;
 
         default:
-            // Không cần trả về mã lỗi, chỉ thực hiện các thao tác cấu hình
+            /* Unknown clock source */
             break;
     }
+
+    if((SCG_HAL_TIMEOUT == status) && ((SCG_CLOCK_SOSC == source) || (SCG_CLOCK_SPLL == source)))
+    {
+        HAL_SCG_RollbackFirc(source);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Set the cycles allowed to a clock source to become valid.
+ *
+ * @param budgetCycles              [Input] Budget in cycles of SCG_CYCLE_COUNTER.
+ * @return uint32_t                 Returns 0 if successful
+ */
+uint32_t HAL_SCG_SetWaitBudget(uint32_t budgetCycles)
+{
+    HAL_SCG_WaitBudget = budgetCycles;
+    return SCG_HAL_OK;
 }
 
+/**
+ * @brief Read the measured waits of a clock source.
+ *
+ * @param source                    [Input] Clock source.
+ * @param pStatistics               [Output] Copy of the measured waits.
+ * @return uint32_t                 Returns 0 if successful
+ */
+uint32_t HAL_SCG_GetWaitStatistics(SCG_ClockSource_t source, SCG_Wait_Statistics_t *pStatistics)
+{
+    *pStatistics = HAL_SCG_WaitStatistics[source];
+    return SCG_HAL_OK;
+}
+
+/**
+ * @brief Enable SIRC in high range with its peripheral dividers, SIRC keeps running in stop and
+ *        very low power modes so asynchronous peripherals can wake the MCU.
+ *
+ * @param sircDiv                    [Input] Divider of SIRCDIV1 and SIRCDIV2, a SCG_DIV value.
+ * @return uint32_t                  Returns SCG_HAL_OK if successful, SCG_HAL_ERROR if SIRC clocks the system,
+ *                                   SCG_HAL_TIMEOUT if SIRC never became valid.
+ */
+uint32_t HAL_SIRC( uint32_t sircDiv)
+{
+    uint32_t status = SCG_HAL_OK;
+
+    /* SIRC cannot be disabled for configuration while it is the system clock */
+    if(SCG->SIRCCSR & SCG_SIRCCSR_SIRCSEL_MASK)
+    {
+        status = SCG_HAL_ERROR;
+    }
+    else
+    {
+        SCG->SIRCCSR &= ~SCG_SIRCCSR_SIRCEN_MASK;
+
+        /* The divider field value 0 disables the output, SCG_DIV starts at divide by 1 */
+        SCG->SIRCDIV = SCG_SIRCDIV_SIRCDIV1(sircDiv + 1U) | SCG_SIRCDIV_SIRCDIV2(sircDiv + 1U);
+        SCG->SIRCCFG = SCG_SIRCCFG_RANGE(SIRC_RANGE_8MHZ);
+        SCG->SIRCCSR = SCG_SIRCCSR_SIRCEN_MASK | SCG_SIRCCSR_SIRCSTEN_MASK | SCG_SIRCCSR_SIRCLPEN_MASK;
+
+        /* Wait for SIRC to be valid */
+        status = HAL_SCG_WaitValid(SCG_CLOCK_SIRC, &SCG->SIRCCSR, SCG_SIRCCSR_SIRCVLD_MASK);
+    }
+
+    return status;
+}
 
 /**
  * @brief This bit shows whether the peripheral is present on this device.
@@ -126,8 +284,8 @@ uint32_t HAL_Clock_Source_Select( uint32_t peripheralIndex, PeripheralClockSourc
 {
     /* Clear the CGC bit before setting the source. */
     PCC->PCCn[peripheralIndex] &= ~PCC_PCCn_CGC_MASK;
-    /* Set the PCS bits to select the clock source. */
-    PCC->PCCn[peripheralIndex] |= (uint32_t)(source << PCC_PCCn_PCS_SHIFT);
+    /* Replace the PCS bits to select the clock source. */
+    PCC->PCCn[peripheralIndex] = (PCC->PCCn[peripheralIndex] & ~PCC_PCCn_PCS_MASK) | PCC_PCCn_PCS(source);
     return 0;
 }
 
@@ -16,15 +16,16 @@
  * Inclusion
  ******************************************************************************/
 
-#include "../include/S32K144.h"
+#include "S32K144.h"
 #include <stddef.h>
+#include "Det.h"
 
 /*******************************************************************************
  * Macro
  ******************************************************************************/
 
 #define PORT_MAX_PINS 32U
-#define PIN_IS_AVAILABLE(n) ((n) < PORT_MAX_PINS)
+#define PIN_IS_AVAILABLE(n) DET_CHECK((n) < PORT_MAX_PINS)    /* Compiled out in release builds */
 
 /*******************************************************************************
  * Typedef
@@ -13,7 +13,8 @@
  * Inclusion
  ******************************************************************************/
 
-#include "../src/Driver/PORT/Include/s32k144_port_driver.h"
+#include "s32k144_port_driver.h"
+#include "Trace.h"
 
 /*******************************************************************************
  * Variables
@@ -41,6 +42,8 @@ Std_PORT_Status PORT_Init(PORT_Type *PORTx, PORT_Config_t *config)
 {
     Std_PORT_Status result = PORT_E_OK;
 
+    TRACE_ENTER(TRACE_ID_PORT_INIT);
+
     if (NULL != PORTx && NULL != config)
     {
         if (PIN_IS_AVAILABLE(config->pin))
@@ -49,7 +52,7 @@ Std_PORT_Status PORT_Init(PORT_Type *PORTx, PORT_Config_t *config)
             /* Clear MUX field */
             HAL_Port_ClearMux(PORTx, config->pin);
             /* Set MUX field */
-            HAL_Port_SetMux(PORTx, config->pin, config->mux);
+            HAL_Port_SetMux(PORTx, config->pin, (HAL_MUX_MODE_type)config->mux);
             /* Toggle pull configuration */
             if (PORT_PIN_PULL_ENABLE == config->pull_enable)
             {
@@ -85,7 +88,7 @@ Std_PORT_Status PORT_Init(PORT_Type *PORTx, PORT_Config_t *config)
             /* Clear IRQC field */
             HAL_Port_ClearIrq(PORTx, config->pin);
             /* Set MUX field */
-            HAL_Port_SetIrqMode(PORTx, config->pin, config->irq_mode);
+            HAL_Port_SetIrqMode(PORTx, config->pin, (HAL_IRQ_MODE_type)config->irq_mode);
         }
         else
         {
@@ -97,6 +100,8 @@ Std_PORT_Status PORT_Init(PORT_Type *PORTx, PORT_Config_t *config)
         result = PORT_E_NOT_OK;
     }
 
+    TRACE_EXIT(TRACE_ID_PORT_INIT);
+
     return result;
 }
 
@@ -123,7 +128,7 @@ Std_PORT_Status PORT_EnableInterrupt(PORT_Type *PORTx, PORT_Pin_type pin, PORT_I
         {
             /* clear interrupt flat*/
             PORTx->PCR[pin] |= PORT_PCR_ISF(1);
-            HAL_Port_SetIrqMode(PORTx, pin, irq_mode);
+            HAL_Port_SetIrqMode(PORTx, pin, (HAL_IRQ_MODE_type)irq_mode);
         }
         else
         {
@@ -228,6 +233,8 @@ Std_PORT_Status Register_InterruptHandler(PORT_Type *PORTx, func_ptr App_Functio
 
 void PORTA_IRQHandler(void)
 {
+    TRACE_ENTER(TRACE_ID_PORTA_IRQ);
+
     if (NULL != PORT_callback_func_arr[0])
     {
         PORT_callback_func_arr[0]();
@@ -236,10 +243,14 @@ void PORTA_IRQHandler(void)
     {
         /* do nothing */
     }
+
+    TRACE_EXIT(TRACE_ID_PORTA_IRQ);
 }
 
 void PORTB_IRQHandler(void)
 {
+    TRACE_ENTER(TRACE_ID_PORTB_IRQ);
+
     if (NULL != PORT_callback_func_arr[1])
     {
         PORT_callback_func_arr[1]();
@@ -248,10 +259,14 @@ void PORTB_IRQHandler(void)
     {
         /* do nothing */
     }
+
+    TRACE_EXIT(TRACE_ID_PORTB_IRQ);
 }
 
 void PORTC_IRQHandler(void)
 {
+    TRACE_ENTER(TRACE_ID_PORTC_IRQ);
+
     if (NULL != PORT_callback_func_arr[2])
     {
         PORT_callback_func_arr[2]();
@@ -260,10 +275,14 @@ void PORTC_IRQHandler(void)
     {
         /* do nothing */
     }
+
+    TRACE_EXIT(TRACE_ID_PORTC_IRQ);
 }
 
 void PORTD_IRQHandler(void)
 {
+    TRACE_ENTER(TRACE_ID_PORTD_IRQ);
+
     if (NULL != PORT_callback_func_arr[3])
     {
         PORT_callback_func_arr[3]();
@@ -272,10 +291,14 @@ void PORTD_IRQHandler(void)
     {
         /* do nothing */
     }
+
+    TRACE_EXIT(TRACE_ID_PORTD_IRQ);
 }
 
 void PORTE_IRQHandler(void)
 {
+    TRACE_ENTER(TRACE_ID_PORTE_IRQ);
+
     if (NULL != PORT_callback_func_arr[4])
     {
         PORT_callback_func_arr[4]();
@@ -284,4 +307,6 @@ void PORTE_IRQHandler(void)
     {
         /* do nothing */
     }
+
+    TRACE_EXIT(TRACE_ID_PORTE_IRQ);
 }
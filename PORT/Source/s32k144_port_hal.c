@@ -13,7 +13,7 @@
  * Inclusion
  ******************************************************************************/
 
-#include "../src/Driver/PORT/Include/s32k144_port_hal.h"
+#include "s32k144_port_hal.h"
 
 /*******************************************************************************
  * Code
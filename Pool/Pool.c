@@ -0,0 +1,192 @@
+/**
+ * @file Pool.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the fixed-block memory pools shared by the protocol layers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Pool.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define POOL_NONE           (0xFFFFU)                       /* Index ending the free list */
+#define POOL_INDEX(head)    ((uint32_t)(head) & 0xFFFFU)    /* Block at the head of the free list */
+#define POOL_TAG(head)      ((uint32_t)(head) & 0xFFFF0000U)    /* Change count of the free list */
+#define POOL_TAG_STEP       (0x10000U)                      /* Change count increment */
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to cut the memory of a pool into free blocks
+ *
+ * @param pool[out]: pointer to the pool
+ * @param pMemory[in]: memory of POOL_MEMORY_WORDS(blockSize, nOfBlocks) words, owned by the pool from now on
+ * @param blockSize[in]: size of a block in bytes
+ * @param nOfBlocks[in]: number of blocks, from 1 to POOL_BLOCKS_MAX
+ *
+ * @return Std_Pool_Status: POOL_E_NOT_OK if a parameter is not valid
+ */
+Std_Pool_Status poolInit(Std_Pool_Types *pool, uint32_t *pMemory, uint32_t blockSize, uint32_t nOfBlocks)
+{
+    Std_Pool_Status status = POOL_E_NOT_OK;
+
+    if((0 != pool) && (0 != pMemory) && (0 != blockSize) && (0 != nOfBlocks) && (POOL_BLOCKS_MAX >= nOfBlocks))
+    {
+        pool->pMemory = pMemory;
+        pool->blockWords = (blockSize + 3U) / 4U;
+        pool->nOfBlocks = (uint16_t)nOfBlocks;
+
+        /* A free block holds the index of the next one in its first word */
+        for(uint32_t i = 0; i < nOfBlocks; i++)
+        {
+            pMemory[i * pool->blockWords] = ((i + 1U) < nOfBlocks) ? (i + 1U) : POOL_NONE;
+        }
+
+        atomic_store_explicit(&pool->freeHead, 0U, memory_order_relaxed);
+        atomic_store_explicit(&pool->inUse, 0U, memory_order_relaxed);
+        atomic_store_explicit(&pool->highWater, 0U, memory_order_relaxed);
+        atomic_store_explicit(&pool->allocs, 0U, memory_order_relaxed);
+        atomic_store_explicit(&pool->failures, 0U, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+        status = POOL_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to take a block from a pool in constant time, it can be called from any
+ *        context including ISR
+ *
+ * The head of the free list is replaced with a compare and swap. The change count in its high half makes
+ * the swap fail when the list changed in between, even if the same block is at the head again, so the
+ * next index read from a block taken meanwhile is never used.
+ *
+ * @param pool[in/out]: pointer to the pool
+ *
+ * @return void*: block aligned on 4 bytes, 0 if the pool is empty
+ */
+void *poolAlloc(Std_Pool_Types *pool)
+{
+    void *pBlock = 0;
+
+    if(0 != pool)
+    {
+        uint_fast32_t head = atomic_load_explicit(&pool->freeHead, memory_order_acquire);
+        uint8_t isTaken = 0;
+
+        while((0 == isTaken) && (POOL_NONE != POOL_INDEX(head)))
+        {
+            uint32_t next = pool->pMemory[POOL_INDEX(head) * pool->blockWords];
+
+            if(atomic_compare_exchange_weak_explicit(&pool->freeHead, &head,
+                                                     POOL_TAG(head + POOL_TAG_STEP) | POOL_INDEX(next),
+                                                     memory_order_acquire, memory_order_acquire))
+            {
+                isTaken = 1;
+            }
+            else
+            {
+                /* Preempted by another context, head has been reloaded */
+            }
+        }
+
+        if(0 != isTaken)
+        {
+            uint_fast32_t inUse = atomic_fetch_add_explicit(&pool->inUse, 1U, memory_order_relaxed) + 1U;
+            uint_fast32_t highWater = atomic_load_explicit(&pool->highWater, memory_order_relaxed);
+
+            while((inUse > highWater) &&
+                  (0 == atomic_compare_exchange_weak_explicit(&pool->highWater, &highWater, inUse,
+                                                              memory_order_relaxed, memory_order_relaxed)))
+            {
+                /* highWater has been reloaded */
+            }
+
+            atomic_fetch_add_explicit(&pool->allocs, 1U, memory_order_relaxed);
+            pBlock = &pool->pMemory[POOL_INDEX(head) * pool->blockWords];
+        }
+        else
+        {
+            atomic_fetch_add_explicit(&pool->failures, 1U, memory_order_relaxed);
+        }
+    }
+
+    return pBlock;
+}
+
+/**
+ * @brief This function is used to give a block back to its pool in constant time, it can be called from
+ *        any context including ISR
+ *
+ * @param pool[in/out]: pointer to the pool
+ * @param pBlock[in]: block given by poolAlloc of this pool, not used by the caller any more
+ *
+ * @return Std_Pool_Status: POOL_E_NOT_OK if the block does not belong to the pool
+ */
+Std_Pool_Status poolFree(Std_Pool_Types *pool, void *pBlock)
+{
+    Std_Pool_Status status = POOL_E_NOT_OK;
+
+    if((0 != pool) && (0 != pBlock) && ((uint32_t *)pBlock >= pool->pMemory))
+    {
+        uint32_t offset = (uint32_t)((uint32_t *)pBlock - pool->pMemory);
+        uint32_t index = offset / pool->blockWords;
+
+        if((index < pool->nOfBlocks) && (0 == (offset % pool->blockWords)))
+        {
+            uint_fast32_t head = atomic_load_explicit(&pool->freeHead, memory_order_relaxed);
+
+            do
+            {
+                pool->pMemory[offset] = POOL_INDEX(head);
+            } while(0 == atomic_compare_exchange_weak_explicit(&pool->freeHead, &head,
+                                                               POOL_TAG(head + POOL_TAG_STEP) | index,
+                                                               memory_order_release, memory_order_relaxed));
+
+            atomic_fetch_sub_explicit(&pool->inUse, 1U, memory_order_relaxed);
+            status = POOL_E_OK;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to get the usable size of the blocks of a pool
+ *
+ * @param pool[in]: pointer to the pool
+ *
+ * @return uint32_t: size of a block in bytes, at least the size given to poolInit
+ */
+uint32_t poolGetBlockSize(const Std_Pool_Types *pool)
+{
+    return (0 != pool) ? (pool->blockWords * 4U) : 0U;
+}
+
+/**
+ * @brief This function is used to read the statistics of a pool
+ *
+ * @param pool[in]: pointer to the pool
+ * @param pStatistics[out]: statistics of the pool
+ *
+ * @return void
+ */
+void poolGetStatistics(Std_Pool_Types *pool, Pool_Statistics_Types *pStatistics)
+{
+    if((0 != pool) && (0 != pStatistics))
+    {
+        pStatistics->allocs = (uint32_t)atomic_load_explicit(&pool->allocs, memory_order_relaxed);
+        pStatistics->failures = (uint32_t)atomic_load_explicit(&pool->failures, memory_order_relaxed);
+        pStatistics->inUse = (uint32_t)atomic_load_explicit(&pool->inUse, memory_order_relaxed);
+        pStatistics->highWater = (uint32_t)atomic_load_explicit(&pool->highWater, memory_order_relaxed);
+    }
+}
@@ -0,0 +1,121 @@
+/**
+ * @file Pool.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the fixed-block memory pools shared by the protocol layers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef POOL_H_
+#define POOL_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include <stdint.h>
+#include <stdatomic.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define POOL_BLOCKS_MAX     (0xFFFEU)   /* Maximum number of blocks of a pool */
+
+/* Size in 32-bit words of the memory of a pool, blocks are rounded up to a multiple of 4 bytes */
+#define POOL_MEMORY_WORDS(blockSize, nOfBlocks) ((((blockSize) + 3U) / 4U) * (nOfBlocks))
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    POOL_E_OK,          /* Operation completed without error */
+    POOL_E_NOT_OK,      /* Operation not completed */
+} Std_Pool_Status;      /* Standard status type */
+
+typedef struct
+{
+    uint32_t allocs;        /* Blocks given by poolAlloc */
+    uint32_t failures;      /* poolAlloc calls that found the pool empty */
+    uint32_t inUse;         /* Blocks allocated now */
+    uint32_t highWater;     /* Most blocks allocated at the same time */
+} Pool_Statistics_Types;    /* Statistics of a pool */
+
+typedef struct
+{
+    uint32_t *pMemory;                  /* Memory of the blocks */
+    uint32_t blockWords;                /* Size of a block in 32-bit words */
+    uint16_t nOfBlocks;                 /* Number of blocks */
+    atomic_uint_fast32_t freeHead;      /* First free block in the low half, changes of the list in the high half */
+    atomic_uint_fast32_t inUse;         /* Blocks allocated now */
+    atomic_uint_fast32_t highWater;     /* Most blocks allocated at the same time */
+    atomic_uint_fast32_t allocs;        /* Blocks given by poolAlloc */
+    atomic_uint_fast32_t failures;      /* poolAlloc calls that found the pool empty */
+} Std_Pool_Types;                       /* Pool of blocks of one size */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name poolInit
+ *
+ * @brief This function is used to cut the memory of a pool into free blocks
+ *
+ * @param pool[out]: pointer to the pool
+ * @param pMemory[in]: memory of POOL_MEMORY_WORDS(blockSize, nOfBlocks) words, owned by the pool from now on
+ * @param blockSize[in]: size of a block in bytes
+ * @param nOfBlocks[in]: number of blocks, from 1 to POOL_BLOCKS_MAX
+ *
+ * @return Std_Pool_Status: POOL_E_NOT_OK if a parameter is not valid
+ */
+Std_Pool_Status poolInit(Std_Pool_Types *pool, uint32_t *pMemory, uint32_t blockSize, uint32_t nOfBlocks);
+
+/**
+ * @name poolAlloc
+ *
+ * @brief This function is used to take a block from a pool in constant time, it can be called from any
+ *        context including ISR
+ *
+ * @param pool[in/out]: pointer to the pool
+ *
+ * @return void*: block aligned on 4 bytes, 0 if the pool is empty
+ */
+void *poolAlloc(Std_Pool_Types *pool);
+
+/**
+ * @name poolFree
+ *
+ * @brief This function is used to give a block back to its pool in constant time, it can be called from
+ *        any context including ISR
+ *
+ * @param pool[in/out]: pointer to the pool
+ * @param pBlock[in]: block given by poolAlloc of this pool, not used by the caller any more
+ *
+ * @return Std_Pool_Status: POOL_E_NOT_OK if the block does not belong to the pool
+ */
+Std_Pool_Status poolFree(Std_Pool_Types *pool, void *pBlock);
+
+/**
+ * @name poolGetBlockSize
+ *
+ * @brief This function is used to get the usable size of the blocks of a pool
+ *
+ * @param pool[in]: pointer to the pool
+ *
+ * @return uint32_t: size of a block in bytes, at least the size given to poolInit
+ */
+uint32_t poolGetBlockSize(const Std_Pool_Types *pool);
+
+/**
+ * @name poolGetStatistics
+ *
+ * @brief This function is used to read the statistics of a pool
+ *
+ * @param pool[in]: pointer to the pool
+ * @param pStatistics[out]: statistics of the pool
+ *
+ * @return void
+ */
+void poolGetStatistics(Std_Pool_Types *pool, Pool_Statistics_Types *pStatistics);
+
+#endif /* POOL_H_ */
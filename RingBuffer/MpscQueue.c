@@ -0,0 +1,155 @@
+/**
+ * @file MpscQueue.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the queue of slots filled by several producers, interrupts included,
+ *        and read by one consumer
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "MpscQueue.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+/* Sequence number at the start of the slot of an index */
+#define MPSC_QUEUE_SEQ(queue, index)    \
+    ((atomic_uint_fast32_t *)&(queue)->pSlots[((index) & (queue)->mask) * (queue)->slotSize])
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to empty a queue over an array of slots, without producer or consumer
+ *        running
+ *
+ * @param queue[out]: pointer to the queue
+ * @param pSlots[in/out]: slots, each one starting with an atomic_uint_fast32_t sequence number
+ * @param slotSize[in]: bytes of a slot
+ * @param nOfSlots[in]: number of slots, must be a power of 2
+ *
+ * @return void
+ */
+void mpscQueueInit(Std_MpscQueue_Types *queue, void *pSlots, uint32_t slotSize, uint32_t nOfSlots)
+{
+    queue->pSlots = (uint8_t *)pSlots;
+    queue->slotSize = slotSize;
+    queue->mask = nOfSlots - 1U;
+    atomic_init(&queue->head, 0U);
+    atomic_init(&queue->tail, 0U);
+
+    for(uint32_t i = 0; i < nOfSlots; i++)
+    {
+        atomic_init(MPSC_QUEUE_SEQ(queue, i), 0U);
+    }
+
+    atomic_thread_fence(memory_order_release);
+}
+
+/**
+ * @brief This function is used to reserve the slot at the head, it can be called from any context
+ *        including ISR
+ *
+ * The compare and swap fails when another producer reserved the head meanwhile, the head is then
+ * reloaded and checked again against the tail.
+ *
+ * @param queue[in/out]: pointer to the queue
+ * @param pIndex[out]: index of the slot, given to mpscQueuePublish
+ *
+ * @return void*: slot to fill, 0 if the queue is full
+ */
+void *mpscQueueReserve(Std_MpscQueue_Types *queue, uint_fast32_t *pIndex)
+{
+    uint_fast32_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    uint8_t *pSlot = 0;
+    uint8_t isFull = 0;
+
+    while((0 == pSlot) && (0 == isFull))
+    {
+        if((head - atomic_load_explicit(&queue->tail, memory_order_acquire)) > queue->mask)
+        {
+            isFull = 1;
+        }
+        else if(atomic_compare_exchange_weak_explicit(&queue->head, &head, head + 1U,
+                                                      memory_order_relaxed, memory_order_relaxed))
+        {
+            pSlot = &queue->pSlots[(head & queue->mask) * queue->slotSize];
+            *pIndex = head;
+        }
+        else
+        {
+            /* Preempted by another producer, head has been reloaded */
+        }
+    }
+
+    return pSlot;
+}
+
+/**
+ * @brief This function is used to hand a slot filled by its producer over to the consumer
+ *
+ * @param queue[in/out]: pointer to the queue
+ * @param index[in]: index given by mpscQueueReserve
+ *
+ * @return void
+ */
+void mpscQueuePublish(Std_MpscQueue_Types *queue, uint_fast32_t index)
+{
+    /* Release so the content of the slot is written before the consumer can see it */
+    atomic_store_explicit(MPSC_QUEUE_SEQ(queue, index), index + 1U, memory_order_release);
+}
+
+/**
+ * @brief This function is used by the consumer to read a slot after the tail without releasing it
+ *
+ * @param queue[in]: pointer to the queue
+ * @param offset[in]: slots after the tail
+ *
+ * @return void*: slot, 0 if it is not published yet
+ */
+void *mpscQueuePeek(Std_MpscQueue_Types *queue, uint32_t offset)
+{
+    uint_fast32_t index = atomic_load_explicit(&queue->tail, memory_order_relaxed) + offset;
+    uint8_t *pSlot = 0;
+
+    if((index + 1U) == atomic_load_explicit(MPSC_QUEUE_SEQ(queue, index), memory_order_acquire))
+    {
+        pSlot = &queue->pSlots[(index & queue->mask) * queue->slotSize];
+    }
+
+    return pSlot;
+}
+
+/**
+ * @brief This function is used by the consumer to give the slots read back to the producers
+ *
+ * @param queue[in/out]: pointer to the queue
+ * @param count[in]: slots released from the tail, all of them published
+ *
+ * @return void
+ */
+void mpscQueueRelease(Std_MpscQueue_Types *queue, uint32_t count)
+{
+    uint_fast32_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+    /* Release so the slots are read before a producer can fill them again */
+    atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+}
+
+/**
+ * @brief This function is used to get the number of slots reserved and not released yet
+ *
+ * @param queue[in]: pointer to the queue
+ *
+ * @return uint32_t: number of slots
+ */
+uint32_t mpscQueueCount(Std_MpscQueue_Types *queue)
+{
+    return (uint32_t)(atomic_load_explicit(&queue->head, memory_order_relaxed) -
+                      atomic_load_explicit(&queue->tail, memory_order_relaxed));
+}
@@ -0,0 +1,122 @@
+/**
+ * @file MpscQueue.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the queue of slots filled by several producers, interrupts included,
+ *        and read by one consumer
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef MPSCQUEUE_H_
+#define MPSCQUEUE_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include <stdint.h>
+#include <stdatomic.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+/* Static initializer of an empty queue over an array of slots, the number of slots must be a power of 2 */
+#define MPSC_QUEUE_INIT(slots)                                                                                  \
+    { .pSlots = (uint8_t *)(slots), .slotSize = (uint32_t)sizeof((slots)[0]),                                   \
+      .mask = (uint32_t)(sizeof(slots) / sizeof((slots)[0])) - 1U }
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+/* A producer reserves the index at the head with a compare and swap, so producers preempting each other
+   never share a slot, fills the slot and publishes it by writing its sequence number, the index plus 1.
+   The consumer reads a slot once its sequence number matches, so a slot reserved and not published yet
+   holds back the ones after it. Each slot starts with its atomic_uint_fast32_t sequence number. */
+typedef struct
+{
+    uint8_t *pSlots;                /* Slots, each one starts with its sequence number */
+    uint32_t slotSize;              /* Bytes of a slot */
+    uint32_t mask;                  /* Number of slots minus 1 */
+    atomic_uint_fast32_t head;      /* Next index to reserve, shared by the producers */
+    atomic_uint_fast32_t tail;      /* Next index to read, written by the consumer only */
+} Std_MpscQueue_Types;              /* Multiple producer, single consumer queue */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name mpscQueueInit
+ *
+ * @brief This function is used to empty a queue over an array of slots, without producer or consumer
+ *        running
+ *
+ * @param queue[out]: pointer to the queue
+ * @param pSlots[in/out]: slots, each one starting with an atomic_uint_fast32_t sequence number
+ * @param slotSize[in]: bytes of a slot
+ * @param nOfSlots[in]: number of slots, must be a power of 2
+ *
+ * @return void
+ */
+void mpscQueueInit(Std_MpscQueue_Types *queue, void *pSlots, uint32_t slotSize, uint32_t nOfSlots);
+
+/**
+ * @name mpscQueueReserve
+ *
+ * @brief This function is used to reserve the slot at the head, it can be called from any context
+ *        including ISR
+ *
+ * @param queue[in/out]: pointer to the queue
+ * @param pIndex[out]: index of the slot, given to mpscQueuePublish
+ *
+ * @return void*: slot to fill, 0 if the queue is full
+ */
+void *mpscQueueReserve(Std_MpscQueue_Types *queue, uint_fast32_t *pIndex);
+
+/**
+ * @name mpscQueuePublish
+ *
+ * @brief This function is used to hand a slot filled by its producer over to the consumer
+ *
+ * @param queue[in/out]: pointer to the queue
+ * @param index[in]: index given by mpscQueueReserve
+ *
+ * @return void
+ */
+void mpscQueuePublish(Std_MpscQueue_Types *queue, uint_fast32_t index);
+
+/**
+ * @name mpscQueuePeek
+ *
+ * @brief This function is used by the consumer to read a slot after the tail without releasing it
+ *
+ * @param queue[in]: pointer to the queue
+ * @param offset[in]: slots after the tail
+ *
+ * @return void*: slot, 0 if it is not published yet
+ */
+void *mpscQueuePeek(Std_MpscQueue_Types *queue, uint32_t offset);
+
+/**
+ * @name mpscQueueRelease
+ *
+ * @brief This function is used by the consumer to give the slots read back to the producers
+ *
+ * @param queue[in/out]: pointer to the queue
+ * @param count[in]: slots released from the tail, all of them published
+ *
+ * @return void
+ */
+void mpscQueueRelease(Std_MpscQueue_Types *queue, uint32_t count);
+
+/**
+ * @name mpscQueueCount
+ *
+ * @brief This function is used to get the number of slots reserved and not released yet
+ *
+ * @param queue[in]: pointer to the queue
+ *
+ * @return uint32_t: number of slots
+ */
+uint32_t mpscQueueCount(Std_MpscQueue_Types *queue);
+
+#endif /* MPSCQUEUE_H_ */
@@ -12,6 +12,7 @@
  *                                                 INCLUSION                                                    *
  ****************************************************************************************************************/
 #include "RingBuffer.h"
+#include "Trace.h"
 
 /****************************************************************************************************************
  *                                                   MACROS                                                     *
@@ -23,7 +24,8 @@
  *                                              API DEFINITIONS                                                 *
  ****************************************************************************************************************/
 /**
- * @brief This function is used to initialize the queue
+ * @brief This function is used to initialize the queue, empty with the QUEUE_DROP_NEWEST policy and its
+ *        counters cleared
  *
  * @param queue[in/out]: pointer to the queue
  * @param arr[in]: pointer to the array
@@ -33,12 +35,35 @@
  */
 void queueInit(Std_Queue_Types* queue, uint8_t* arr, uint8_t capacity)
 {
+    queue->front = 0;
+    queue->tail = 0;
+    queue->size = 0;
     queue->capacity = capacity;
+    queue->policy = (uint8_t)QUEUE_DROP_NEWEST;
     queue->queueArr = arr;
+    queue->dropped = 0;
+    queue->overwritten = 0;
 }
 
 /**
- * @brief This function is used to push data to the queue
+ * @brief This function is used to choose what a push does when the queue is full, the counters are not
+ *        reset
+ *
+ * @param queue[in/out]: pointer to the queue
+ * @param policy[in]: QUEUE_DROP_NEWEST or QUEUE_OVERWRITE_OLDEST
+ *
+ * @return void
+ */
+void queueSetPolicy(Std_Queue_Types* queue, Queue_Policy_Types policy)
+{
+    queue->policy = (uint8_t)policy;
+}
+
+/**
+ * @brief This function is used to push data to the queue, a full queue loses the data or its oldest
+ *        element depending on its policy
+ *
+ * The policy is only looked at once the queue is full, a push with room left runs as before.
  *
  * @param queue[in/out]: pointer to the queue
  * @param data[in]: data to push
@@ -47,16 +72,28 @@ void queueInit(Std_Queue_Types* queue, uint8_t* arr, uint8_t capacity)
  */
 void queuePush(Std_Queue_Types* queue, uint8_t data)
 {
+    TRACE_ENTER(TRACE_ID_QUEUE_PUSH);
+
     if(!QUEUE_IS_FULL(queue))
     {
         queue->queueArr[queue->tail] = data;
         queue->tail = (queue->tail + 1) % queue->capacity;
         queue->size += 1;
     }
+    else if((QUEUE_OVERWRITE_OLDEST == queue->policy) && (0 != queue->capacity))
+    {
+        /* tail is front when full: the oldest element is replaced and both move on, size stays the same */
+        queue->queueArr[queue->tail] = data;
+        queue->tail = (queue->tail + 1) % queue->capacity;
+        queue->front = queue->tail;
+        queue->overwritten += 1;
+    }
     else
     {
-        // Queue is full
+        queue->dropped += 1;
     }
+
+    TRACE_EXIT(TRACE_ID_QUEUE_PUSH);
 }
 
 /**
@@ -70,6 +107,8 @@ uint8_t queuePop(Std_Queue_Types* queue)
 {
 	uint8_t data = 0;
 
+    TRACE_ENTER(TRACE_ID_QUEUE_POP);
+
     if(!QUEUE_IS_EMPTY(queue))
     {
         data = queue->queueArr[queue->front];
@@ -81,5 +120,7 @@ uint8_t queuePop(Std_Queue_Types* queue)
         // Queue is empty
     }
 
+    TRACE_EXIT(TRACE_ID_QUEUE_POP);
+
     return data;
 }
@@ -3,19 +3,31 @@
 /****************************************************************************************************************
  *                                                 INCLUSIONS                                                   *
  ****************************************************************************************************************/
-#include <stdio.h>
+#include <stdint.h>
 
 /****************************************************************************************************************
  *                                              TYPE DEFINITIONS                                                *
  ****************************************************************************************************************/
-typedef unsigned char uint8_t;
+typedef enum
+{
+    QUEUE_DROP_NEWEST,          /* A push to a full queue is lost, the default */
+    QUEUE_OVERWRITE_OLDEST,     /* A push to a full queue replaces the oldest element */
+} Queue_Policy_Types;           /* What a push does when the queue is full */
+
+/* The producer pushes and the consumer pops. When the producer is an ISR, the consumer must pop with that
+   interrupt masked: the producer updates size, and with QUEUE_OVERWRITE_OLDEST it also advances front past
+   the element it replaces, so it is the only side moving front while the consumer is masked out. Data read
+   in place at front, without popping it, may be replaced by the producer under QUEUE_OVERWRITE_OLDEST. */
 typedef struct {
-    uint8_t front;      /* Index of the front element */
-    uint8_t tail;       /* Index of the rear element */
-    uint8_t size;       /* Size of the queue */
-    uint8_t capacity;   /* Capacity of the queue */
-    uint8_t *queueArr;  /* Pointer to the array */
-} Std_Queue_Types;      /* Structure of the queue */
+    uint8_t front;          /* Index of the front element */
+    uint8_t tail;           /* Index of the rear element */
+    uint8_t size;           /* Size of the queue */
+    uint8_t capacity;       /* Capacity of the queue */
+    uint8_t policy;         /* Queue_Policy_Types, 0 is QUEUE_DROP_NEWEST */
+    uint8_t *queueArr;      /* Pointer to the array */
+    uint32_t dropped;       /* Elements lost by a push to the full queue under QUEUE_DROP_NEWEST */
+    uint32_t overwritten;   /* Oldest elements replaced by a push under QUEUE_OVERWRITE_OLDEST */
+} Std_Queue_Types;          /* Structure of the queue */
 
 /****************************************************************************************************************
  *                                              API DECLARATIONS                                                *
@@ -23,7 +35,8 @@ typedef struct {
 /**
  * @name queueInit
  *
- * @brief This function is used to initialize the queue
+ * @brief This function is used to initialize the queue, empty with the QUEUE_DROP_NEWEST policy and its
+ *        counters cleared
  *
  * @param queue[in/out]: pointer to the queue
  * @param arr[in]: pointer to the array
@@ -33,10 +46,24 @@ typedef struct {
  */
 void queueInit(Std_Queue_Types* queue, uint8_t* Arr, uint8_t capacity);
 
+/**
+ * @name queueSetPolicy
+ *
+ * @brief This function is used to choose what a push does when the queue is full, the counters are not
+ *        reset
+ *
+ * @param queue[in/out]: pointer to the queue
+ * @param policy[in]: QUEUE_DROP_NEWEST or QUEUE_OVERWRITE_OLDEST
+ *
+ * @return void
+ */
+void queueSetPolicy(Std_Queue_Types* queue, Queue_Policy_Types policy);
+
 /**
  * @name queuePush
  *
- * @brief This function is used to push data to the queue
+ * @brief This function is used to push data to the queue, a full queue loses the data or its oldest
+ *        element depending on its policy
  *
  * @param queue[in/out]: pointer to the queue
  * @param data[in]: data to push
@@ -0,0 +1,343 @@
+/**
+ * @file Router.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the router forwarding data between LPUART instances
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Router.h"
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+/**
+ * @name routerForward
+ *
+ * @brief This function is used to filter data of the source Rx ring, send it and release it
+ *
+ * @param pRoute[in/out]: pointer to the route
+ * @param pHead[in]: first span of the data
+ * @param pTail[in]: second span of the data, used when len is greater than headLen
+ * @param headLen[in]: length of the first span
+ * @param len[in]: length of the data
+ *
+ * @return uint32_t: number of bytes forwarded, 0 when the data was dropped or not queued
+ */
+static uint32_t routerForward(Std_Router_Route_Types *pRoute, const uint8_t *pHead, const uint8_t *pTail,
+                              uint32_t headLen, uint32_t len);
+
+/**
+ * @name routerIsHeld
+ *
+ * @brief This function is used to know if another route holds the destination of a route, waiting for room
+ *        for a frame
+ *
+ * @param router[in]: pointer to the router
+ * @param pRoute[in]: pointer to the route
+ *
+ * @return uint8_t: 1 if the route must leave its turn
+ */
+static uint8_t routerIsHeld(const Std_Router_Types *router, const Std_Router_Route_Types *pRoute);
+
+/**
+ * @name routerServe
+ *
+ * @brief This function is used to give its turn to a route, a stream route moves up to ROUTER_QUANTUM
+ *        bytes and a frame route moves one complete frame
+ *
+ * @param pRoute[in/out]: pointer to the route
+ *
+ * @return uint32_t: number of bytes forwarded
+ */
+static uint32_t routerServe(Std_Router_Route_Types *pRoute);
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to filter data of the source Rx ring, send it and release it
+ *
+ * The data goes from the Rx ring of the source to the Tx ring of the destination in at most two
+ * copies of contiguous spans, the caller checked the destination has room for all of it. Only the data
+ * the destination queued is released and counted.
+ *
+ * @param pRoute[in/out]: pointer to the route
+ * @param pHead[in]: first span of the data
+ * @param pTail[in]: second span of the data, used when len is greater than headLen
+ * @param headLen[in]: length of the first span
+ * @param len[in]: length of the data
+ *
+ * @return uint32_t: number of bytes forwarded, 0 when the data was dropped or not queued
+ */
+static uint32_t routerForward(Std_Router_Route_Types *pRoute, const uint8_t *pHead, const uint8_t *pTail,
+                              uint32_t headLen, uint32_t len)
+{
+    uint32_t nOfBytes = 0;
+    uint32_t tailLen = (len > headLen) ? (len - headLen) : 0U;
+
+    if(0 == tailLen)
+    {
+        headLen = len;
+        pTail = 0;
+    }
+
+    if((0 == pRoute->filter) || (0 != pRoute->filter(pHead, headLen, pTail, tailLen)))
+    {
+        nOfBytes = LPUART_Send(pRoute->pDestination, pHead, headLen);
+
+        if((nOfBytes == headLen) && (0 != tailLen))
+        {
+            nOfBytes += LPUART_Send(pRoute->pDestination, pTail, tailLen);
+        }
+
+        /* Data the destination did not take stays in the source ring for the next turn */
+        pRoute->stats.bytes += nOfBytes;
+        LPUART_RxConsume(pRoute->pSource, nOfBytes);
+    }
+    else
+    {
+        pRoute->stats.filtered++;
+        LPUART_RxConsume(pRoute->pSource, len);
+    }
+
+    return nOfBytes;
+}
+
+/**
+ * @brief This function is used to know if another route holds the destination of a route, waiting for room
+ *        for a frame
+ *
+ * @param router[in]: pointer to the router
+ * @param pRoute[in]: pointer to the route
+ *
+ * @return uint8_t: 1 if the route must leave its turn
+ */
+static uint8_t routerIsHeld(const Std_Router_Types *router, const Std_Router_Route_Types *pRoute)
+{
+    uint8_t isHeld = 0;
+
+    for(uint8_t i = 0; i < router->nOfRoutes; i++)
+    {
+        const Std_Router_Route_Types *pOther = &router->routes[i];
+
+        if((pOther != pRoute) && (pOther->pDestination == pRoute->pDestination) && (0 != pOther->isWaiting))
+        {
+            isHeld = 1;
+        }
+    }
+
+    return isHeld;
+}
+
+/**
+ * @brief This function is used to give its turn to a route, a stream route moves up to ROUTER_QUANTUM
+ *        bytes and a frame route moves one complete frame
+ *
+ * @param pRoute[in/out]: pointer to the route
+ *
+ * @return uint32_t: number of bytes forwarded
+ */
+static uint32_t routerServe(Std_Router_Route_Types *pRoute)
+{
+    uint32_t nOfBytes = 0;
+    uint32_t start = LPUART_CYCLE_COUNTER();
+    const uint8_t *pHead = 0;
+    const uint8_t *pTail = 0;
+    uint32_t headLen = LPUART_RxPeek(pRoute->pSource, 0, &pHead);
+    uint32_t tailLen = (0 != headLen) ? LPUART_RxPeek(pRoute->pSource, headLen, &pTail) : 0U;
+    uint32_t txFree = LPUART_GetTxFree(pRoute->pDestination);
+
+    if(0 == headLen)
+    {
+        /* Nothing received */
+    }
+    else if(ROUTER_NO_DELIMITER == pRoute->delimiter)
+    {
+        uint32_t len = headLen + tailLen;
+
+        len = (len < ROUTER_QUANTUM) ? len : ROUTER_QUANTUM;
+        len = (len < txFree) ? len : txFree;
+
+        /* Wrapped data takes two sends, in packet mode each one has its length byte */
+        if((len > headLen) && (len >= txFree))
+        {
+            len = txFree - 1U;
+        }
+
+        if(0 != len)
+        {
+            nOfBytes = routerForward(pRoute, pHead, pTail, headLen, len);
+        }
+    }
+    else
+    {
+        const uint8_t *pEnd = memchr(pHead, (int)pRoute->delimiter, headLen);
+        uint32_t len = 0;
+
+        if(0 != pEnd)
+        {
+            len = (uint32_t)(pEnd - pHead) + 1U;
+        }
+        else if(0 != tailLen)
+        {
+            pEnd = memchr(pTail, (int)pRoute->delimiter, tailLen);
+
+            if(0 != pEnd)
+            {
+                len = headLen + (uint32_t)(pEnd - pTail) + 1U;
+            }
+        }
+        else
+        {
+            /* Frame not complete yet */
+        }
+
+        if(0 != len)
+        {
+            /* Frames are never split, so frames of several sources do not interleave. A wrapped frame
+               takes two sends, the room of the second length byte of packet mode is kept for it */
+            uint32_t room = len + ((len > headLen) ? 1U : 0U);
+
+            pRoute->isWaiting = 0;
+
+            if(room <= txFree)
+            {
+                nOfBytes = routerForward(pRoute, pHead, pTail, headLen, len);
+                pRoute->stats.frames += (len == nOfBytes) ? 1U : 0U;
+            }
+            else if(room > pRoute->txCapacity)
+            {
+                /* The frame can never be queued, drop it */
+                LPUART_RxConsume(pRoute->pSource, len);
+                pRoute->stats.oversized++;
+            }
+            else
+            {
+                /* The room freed by the destination is kept for this frame, otherwise the shorter frames of
+                   the other routes would always take it first */
+                pRoute->isWaiting = 1;
+            }
+        }
+        else if(0 == LPUART_GetRxFree(pRoute->pSource))
+        {
+            /* The frame can never complete, drop what was received */
+            LPUART_RxConsume(pRoute->pSource, headLen + tailLen);
+            pRoute->stats.oversized++;
+        }
+        else
+        {
+            /* Wait for the end of the frame */
+        }
+    }
+
+    if(0 != nOfBytes)
+    {
+        uint32_t cycles = LPUART_CYCLE_COUNTER() - start;
+
+        if(cycles > pRoute->stats.forwardCyclesMax)
+        {
+            pRoute->stats.forwardCyclesMax = cycles;
+        }
+    }
+
+    return nOfBytes;
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to initialize the router
+ *
+ * @param router[in/out]: pointer to the router
+ * @param routes[in/out]: route table, the instances must be set up with LPUART_BufferInit and their Tx rings
+ *                       empty
+ * @param nOfRoutes[in]: number of entries in the route table
+ *
+ * @return Std_Router_Status: ROUTER_E_NOT_OK if a route loops back or two routes share a source
+ */
+Std_Router_Status routerInit(Std_Router_Types *router, Std_Router_Route_Types *routes, uint8_t nOfRoutes)
+{
+    Std_Router_Status status = ROUTER_E_OK;
+
+    for(uint8_t i = 0; i < nOfRoutes; i++)
+    {
+        /* The source data is released once forwarded, so it can feed one route only */
+        for(uint8_t j = 0; j < i; j++)
+        {
+            if(routes[j].pSource == routes[i].pSource)
+            {
+                status = ROUTER_E_NOT_OK;
+            }
+        }
+
+        if((routes[i].pSource == routes[i].pDestination) ||
+           ((ROUTER_NO_DELIMITER != routes[i].delimiter) && (0xFFU < routes[i].delimiter)))
+        {
+            status = ROUTER_E_NOT_OK;
+        }
+    }
+
+    if(ROUTER_E_OK == status)
+    {
+        router->routes = routes;
+        router->nOfRoutes = nOfRoutes;
+        router->next = 0;
+
+        for(uint8_t i = 0; i < nOfRoutes; i++)
+        {
+            routes[i].stats = (Router_Statistics_Types){0};
+            routes[i].txCapacity = LPUART_GetTxFree(routes[i].pDestination);
+            routes[i].isWaiting = 0;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to give one turn to every route, it should be called from the background
+ *        loop
+ *
+ * The route after the last one that forwarded data comes first in the next turn, so routes sharing a
+ * destination get its Tx ring in turn whatever their order in the table. A frame route waiting for room
+ * holds the destination until its frame is queued.
+ *
+ * @param router[in/out]: pointer to the router
+ *
+ * @return uint32_t: number of bytes forwarded
+ */
+uint32_t routerPoll(Std_Router_Types *router)
+{
+    uint32_t nOfBytes = 0;
+    uint8_t index = router->next;
+
+    for(uint8_t i = 0; i < router->nOfRoutes; i++)
+    {
+        uint8_t next = ((index + 1U) < router->nOfRoutes) ? (uint8_t)(index + 1U) : 0U;
+        uint32_t nOfRouteBytes = 0;
+
+        if(0 == routerIsHeld(router, &router->routes[index]))
+        {
+            nOfRouteBytes = routerServe(&router->routes[index]);
+        }
+
+        /* The route after the last one served comes first in the next turn */
+        if(0 != nOfRouteBytes)
+        {
+            router->next = next;
+        }
+
+        nOfBytes += nOfRouteBytes;
+        index = next;
+    }
+
+    return nOfBytes;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file Router.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the router forwarding data between LPUART instances
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef ROUTER_H_
+#define ROUTER_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpuart_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define ROUTER_NO_DELIMITER (0xFFFFU)   /* Route forwarding a byte stream instead of frames */
+#define ROUTER_QUANTUM      (32U)       /* Maximum number of bytes a stream route moves in its turn */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    ROUTER_E_OK,        /* Operation completed without error */
+    ROUTER_E_NOT_OK,    /* Operation not completed */
+} Std_Router_Status;    /* Standard status type */
+
+/* Filter of a route, the data is given as the two spans of the Rx ring it is stored in, pTail is 0 when
+   the data does not wrap. Returns 1 to forward the data, 0 to drop it */
+typedef uint8_t (*Router_Filter_Types)(const uint8_t *pHead, uint32_t headLen, const uint8_t *pTail, uint32_t tailLen);
+
+typedef struct
+{
+    uint32_t bytes;             /* Bytes forwarded */
+    uint32_t frames;            /* Frames forwarded, frame routes only */
+    uint32_t filtered;          /* Frames or stream chunks dropped by the filter */
+    uint32_t oversized;         /* Frames dropped because they do not fit in the Rx ring */
+    uint32_t forwardCyclesMax;  /* Longest time in cycles spent forwarding in one turn */
+} Router_Statistics_Types;      /* Statistics of a route */
+
+typedef struct
+{
+    LPUART_Type *pSource;               /* Instance the data is taken from, used by one route only */
+    LPUART_Type *pDestination;          /* Instance the data is sent to */
+    uint16_t delimiter;                 /* Byte ending a frame, ROUTER_NO_DELIMITER for a byte stream */
+    Router_Filter_Types filter;         /* Filter called on each frame or stream chunk, 0 to forward all */
+    Router_Statistics_Types stats;      /* Statistics of the route */
+    uint32_t txCapacity;                /* Computed by routerInit: free space of the idle destination Tx ring */
+    uint8_t isWaiting;                  /* Set by the router: a complete frame waits for room in the destination */
+} Std_Router_Route_Types;               /* Entry of the route table */
+
+typedef struct
+{
+    Std_Router_Route_Types *routes;     /* Route table */
+    uint8_t nOfRoutes;                  /* Number of entries in the route table */
+    uint8_t next;                       /* Route served first in the next turn */
+} Std_Router_Types;                     /* Router */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name routerInit
+ *
+ * @brief This function is used to initialize the router
+ *
+ * @param router[in/out]: pointer to the router
+ * @param routes[in/out]: route table, the instances must be set up with LPUART_BufferInit and their Tx rings
+ *                       empty
+ * @param nOfRoutes[in]: number of entries in the route table
+ *
+ * @return Std_Router_Status: ROUTER_E_NOT_OK if a route loops back or two routes share a source
+ */
+Std_Router_Status routerInit(Std_Router_Types *router, Std_Router_Route_Types *routes, uint8_t nOfRoutes);
+
+/**
+ * @name routerPoll
+ *
+ * @brief This function is used to give one turn to every route, it should be called from the background
+ *        loop
+ *
+ * @param router[in/out]: pointer to the router
+ *
+ * @return uint32_t: number of bytes forwarded
+ */
+uint32_t routerPoll(Std_Router_Types *router);
+
+#endif /* ROUTER_H_ */
@@ -0,0 +1,421 @@
+/**
+ * @file Scheduler.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the cooperative run to completion scheduler fed by interrupt events
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Scheduler.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define SCHED_CLZ(x)            ((uint32_t)__builtin_clz(x))    /* Count leading zeros, one CLZ instruction on Cortex-M4 */
+#define SCHED_READY_BIT(prio)   (0x80000000UL >> (prio))        /* Bit of a priority in the ready list */
+
+#define SCHED_LPUART_NUM    (3U)    /* Number of LPUART instances */
+#define SCHED_PORT_NUM      (5U)    /* Number of ports */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    uint8_t prio;                       /* Priority of the task receiving the events */
+    atomic_uint_fast32_t isRxArmed;     /* 1 when no SCHED_SIGNAL_LPUART_RX event is pending */
+    uint8_t isTxBusy;                   /* Tx interrupt state seen by the previous interrupt */
+} Sched_Lpuart_Binding_Types;           /* Events posted for an LPUART instance */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+/**
+ * @name schedLpuartIrq
+ *
+ * @brief This function is used to post the events of an LPUART instance, after its rings were served
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return void
+ */
+static void schedLpuartIrq(uint8_t index);
+
+static void schedLpuartIrq0(void);
+static void schedLpuartIrq1(void);
+static void schedLpuartIrq2(void);
+
+/**
+ * @name schedPortIrq
+ *
+ * @brief This function is used to clear the pin interrupt flags of a port and post them
+ *
+ * @param index[in]: index of the port
+ *
+ * @return void
+ */
+static void schedPortIrq(uint8_t index);
+
+static void schedPortIrq0(void);
+static void schedPortIrq1(void);
+static void schedPortIrq2(void);
+static void schedPortIrq3(void);
+static void schedPortIrq4(void);
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Std_Sched_Task_Types *schedTasks[SCHED_PRIO_NUM];    /* Task attached to each priority */
+static atomic_uint_fast32_t schedReady;                     /* Ready list, bit 31 is priority 0 */
+
+static Sched_Lpuart_Binding_Types schedLpuart[SCHED_LPUART_NUM];    /* Binding of each LPUART instance */
+static uint8_t schedPortPrio[SCHED_PORT_NUM];                       /* Priority bound to each port */
+
+static LPUART_Type * const schedLpuartInstance[SCHED_LPUART_NUM] =
+{
+    LPUART0, LPUART1, LPUART2
+};  /* Base address of each LPUART instance */
+
+static const LPUART_CallbackPtr schedLpuartIrqs[SCHED_LPUART_NUM] =
+{
+    schedLpuartIrq0, schedLpuartIrq1, schedLpuartIrq2
+};  /* Callback registered for each LPUART instance */
+
+static PORT_Type * const schedPortInstance[SCHED_PORT_NUM] =
+{
+    PORTA, PORTB, PORTC, PORTD, PORTE
+};  /* Base address of each port */
+
+static const func_ptr schedPortIrqs[SCHED_PORT_NUM] =
+{
+    schedPortIrq0, schedPortIrq1, schedPortIrq2, schedPortIrq3, schedPortIrq4
+};  /* Callback registered for each port */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to post the events of an LPUART instance, after its rings were served
+ *
+ * Rx events are coalesced: one is pending at most, and the scheduler re-arms it right before the handler
+ * runs, so the handler must read the Rx ring until it is empty. A Tx event is posted when the driver has
+ * just disabled the Tx interrupt, that is when the Tx ring was drained.
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return void
+ */
+static void schedLpuartIrq(uint8_t index)
+{
+    Sched_Lpuart_Binding_Types *pBinding = &schedLpuart[index];
+    LPUART_Type *pLPUARTx = schedLpuartInstance[index];
+    const uint8_t *pSpan = 0;
+    uint8_t isTxBusy = (0 != (pLPUARTx->CTRL & LPUART_CTRL_TIE_MASK)) ? 1U : 0U;
+
+    if((0 != LPUART_RxPeek(pLPUARTx, 0, &pSpan)) &&
+       (0 != atomic_exchange_explicit(&pBinding->isRxArmed, 0U, memory_order_relaxed)))
+    {
+        if(SCHED_E_OK != schedPost(pBinding->prio, SCHED_SIGNAL_LPUART_RX, index, 0U))
+        {
+            /* Try again with the next byte */
+            atomic_store_explicit(&pBinding->isRxArmed, 1U, memory_order_relaxed);
+        }
+    }
+
+    if((0 != pBinding->isTxBusy) && (0 == isTxBusy))
+    {
+        schedPost(pBinding->prio, SCHED_SIGNAL_LPUART_TX, index, 0U);
+    }
+
+    pBinding->isTxBusy = isTxBusy;
+}
+
+static void schedLpuartIrq0(void)
+{
+    schedLpuartIrq(0);
+}
+
+static void schedLpuartIrq1(void)
+{
+    schedLpuartIrq(1);
+}
+
+static void schedLpuartIrq2(void)
+{
+    schedLpuartIrq(2);
+}
+
+/**
+ * @brief This function is used to clear the pin interrupt flags of a port and post them
+ *
+ * @param index[in]: index of the port
+ *
+ * @return void
+ */
+static void schedPortIrq(uint8_t index)
+{
+    PORT_Type *PORTx = schedPortInstance[index];
+    uint32_t flags = PORTx->ISFR;
+
+    /* Write 1 to clear the flags being posted only, a pin firing now stays pending */
+    PORTx->ISFR = flags;
+
+    if(0 != flags)
+    {
+        schedPost(schedPortPrio[index], SCHED_SIGNAL_PIN, index, flags);
+    }
+}
+
+static void schedPortIrq0(void)
+{
+    schedPortIrq(0);
+}
+
+static void schedPortIrq1(void)
+{
+    schedPortIrq(1);
+}
+
+static void schedPortIrq2(void)
+{
+    schedPortIrq(2);
+}
+
+static void schedPortIrq3(void)
+{
+    schedPortIrq(3);
+}
+
+static void schedPortIrq4(void)
+{
+    schedPortIrq(4);
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to attach a task to a priority
+ *
+ * @param prio[in]: priority of the task, from 0 (highest) to SCHED_PRIO_NUM - 1
+ * @param task[in/out]: pointer to the task
+ * @param handler[in]: handler of the task
+ * @param slots[in/out]: event queue of the task
+ * @param nOfSlots[in]: number of slots, must be a power of 2
+ *
+ * @return Std_Sched_Status: SCHED_E_NOT_OK if the priority is taken or the queue is not valid
+ */
+Std_Sched_Status schedTaskInit(uint8_t prio, Std_Sched_Task_Types *task, Sched_Handler_Types handler,
+                               Sched_Slot_Types *slots, uint32_t nOfSlots)
+{
+    Std_Sched_Status status = SCHED_E_NOT_OK;
+
+    if((SCHED_PRIO_NUM > prio) && (0 == schedTasks[prio]) && (0 != task) && (0 != handler) && (0 != slots) &&
+       (0 != nOfSlots) && (0 == (nOfSlots & (nOfSlots - 1U))))
+    {
+        task->handler = handler;
+        mpscQueueInit(&task->queue, slots, (uint32_t)sizeof(Sched_Slot_Types), nOfSlots);
+        atomic_init(&task->dropped, 0U);
+        task->events = 0;
+        task->runCyclesMax = 0;
+        schedTasks[prio] = task;
+        status = SCHED_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to queue an event to a task, it can be called from any context including ISR
+ *
+ * A slot is reserved with a compare and swap on the head so producers preempting each other never share
+ * a slot, the event is published by writing its sequence number, then the task is marked ready.
+ *
+ * @param prio[in]: priority of the task
+ * @param signal[in]: signal of the event
+ * @param param[in]: source of the event
+ * @param data[in]: payload of the event
+ *
+ * @return Std_Sched_Status: SCHED_E_NOT_OK if there is no task at this priority or its queue is full
+ */
+Std_Sched_Status schedPost(uint8_t prio, uint16_t signal, uint16_t param, uint32_t data)
+{
+    Std_Sched_Status status = SCHED_E_NOT_OK;
+    Std_Sched_Task_Types *task = (SCHED_PRIO_NUM > prio) ? schedTasks[prio] : 0;
+
+    if(0 != task)
+    {
+        uint_fast32_t index;
+        Sched_Slot_Types *pSlot = (Sched_Slot_Types *)mpscQueueReserve(&task->queue, &index);
+
+        if(0 != pSlot)
+        {
+            pSlot->event.signal = signal;
+            pSlot->event.param = param;
+            pSlot->event.data = data;
+
+            mpscQueuePublish(&task->queue, index);
+            atomic_fetch_or_explicit(&schedReady, SCHED_READY_BIT(prio), memory_order_release);
+            status = SCHED_E_OK;
+        }
+        else
+        {
+            atomic_fetch_add_explicit(&task->dropped, 1U, memory_order_relaxed);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to handle the oldest event of the highest priority ready task
+ *
+ * The ready bit is cleared before the queue is looked at and set again after an event is taken, so an
+ * event posted meanwhile always leaves its task ready. One event is handled per call, so an event posted
+ * to a higher priority task during a handler is the next one handled.
+ *
+ * @return uint8_t: 1 if an event was handled, 0 if no task is ready
+ */
+uint8_t schedRunOne(void)
+{
+    uint8_t isRun = 0;
+    uint32_t ready = (uint32_t)atomic_load_explicit(&schedReady, memory_order_acquire);
+
+    while((0 == isRun) && (0 != ready))
+    {
+        uint8_t prio = (uint8_t)SCHED_CLZ(ready);
+        Std_Sched_Task_Types *task = schedTasks[prio];
+        const Sched_Slot_Types *pSlot;
+
+        atomic_fetch_and_explicit(&schedReady, ~SCHED_READY_BIT(prio), memory_order_acq_rel);
+        pSlot = (const Sched_Slot_Types *)mpscQueuePeek(&task->queue, 0);
+
+        if(0 != pSlot)
+        {
+            Std_Sched_Event_Types event = pSlot->event;
+            uint32_t start;
+            uint32_t cycles;
+
+            mpscQueueRelease(&task->queue, 1U);
+
+            /* The next pick finds out whether more events are queued */
+            atomic_fetch_or_explicit(&schedReady, SCHED_READY_BIT(prio), memory_order_relaxed);
+
+            if((SCHED_SIGNAL_LPUART_RX == event.signal) && (SCHED_LPUART_NUM > event.param))
+            {
+                atomic_store_explicit(&schedLpuart[event.param].isRxArmed, 1U, memory_order_relaxed);
+            }
+
+            start = SCHED_CYCLE_COUNTER();
+            task->handler(&event);
+            cycles = SCHED_CYCLE_COUNTER() - start;
+
+            task->events++;
+
+            if(cycles > task->runCyclesMax)
+            {
+                task->runCyclesMax = cycles;
+            }
+
+            isRun = 1;
+        }
+        else
+        {
+            /* Empty, or the producer of the next event sets the bit again once it is published */
+            ready = (uint32_t)atomic_load_explicit(&schedReady, memory_order_acquire);
+        }
+    }
+
+    return isRun;
+}
+
+/**
+ * @brief This function is used to run the scheduler forever, the core sleeps while no task is ready
+ *
+ * @return void
+ */
+void schedRun(void)
+{
+    for(;;)
+    {
+        if(0 == schedRunOne())
+        {
+#if defined(__arm__)
+            /* A pending interrupt wakes WFI even when masked, so an event posted after the check is not
+               slept through */
+            __asm volatile ("cpsid i" ::: "memory");
+
+            if(0 == atomic_load_explicit(&schedReady, memory_order_acquire))
+            {
+                __asm volatile ("wfi");
+            }
+
+            __asm volatile ("cpsie i" ::: "memory");
+#endif
+        }
+    }
+}
+
+/**
+ * @brief This function is used to turn the interrupt of an LPUART instance into SCHED_SIGNAL_LPUART_RX and
+ *        SCHED_SIGNAL_LPUART_TX events, the instance must be set up with LPUART_BufferInit
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ * @param prio[in]: priority of the task receiving the events
+ *
+ * @return Std_Sched_Status: SCHED_E_NOT_OK if the instance is not valid
+ */
+Std_Sched_Status schedBindLpuart(LPUART_Type *pLPUARTx, uint8_t prio)
+{
+    Std_Sched_Status status = SCHED_E_NOT_OK;
+
+    for(uint8_t i = 0; i < SCHED_LPUART_NUM; i++)
+    {
+        if((schedLpuartInstance[i] == pLPUARTx) && (SCHED_PRIO_NUM > prio))
+        {
+            schedLpuart[i].prio = prio;
+            schedLpuart[i].isTxBusy = 0;
+            atomic_store_explicit(&schedLpuart[i].isRxArmed, 1U, memory_order_relaxed);
+
+            if(LPUART_E_OK == LPUART_CallbackRegister(pLPUARTx, schedLpuartIrqs[i]))
+            {
+                status = SCHED_E_OK;
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to turn the interrupt of a port into SCHED_SIGNAL_PIN events
+ *
+ * @param PORTx[in]: pointer to the port
+ * @param prio[in]: priority of the task receiving the events
+ *
+ * @return Std_Sched_Status: SCHED_E_NOT_OK if the port is not valid
+ */
+Std_Sched_Status schedBindPort(PORT_Type *PORTx, uint8_t prio)
+{
+    Std_Sched_Status status = SCHED_E_NOT_OK;
+
+    for(uint8_t i = 0; i < SCHED_PORT_NUM; i++)
+    {
+        if((schedPortInstance[i] == PORTx) && (SCHED_PRIO_NUM > prio))
+        {
+            schedPortPrio[i] = prio;
+
+            if(PORT_E_OK == Register_InterruptHandler(PORTx, schedPortIrqs[i]))
+            {
+                status = SCHED_E_OK;
+            }
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file Scheduler.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the cooperative run to completion scheduler fed by interrupt events
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpuart_driver.h"
+#include "s32k144_port_driver.h"
+#include "MpscQueue.h"
+#include <stdatomic.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define SCHED_PRIO_NUM  (32U)   /* Number of priorities, one task each, 0 is the highest */
+
+#ifndef SCHED_CYCLE_COUNTER
+#define SCHED_CYCLE_COUNTER() CYCLE_COUNTER()       /* Cycle counter used to time the handlers */
+#endif
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    SCHED_E_OK,         /* Operation completed without error */
+    SCHED_E_NOT_OK,     /* Operation not completed */
+} Std_Sched_Status;     /* Standard status type */
+
+typedef enum
+{
+    SCHED_SIGNAL_LPUART_RX,     /* Rx ring not empty, param is the LPUART index */
+    SCHED_SIGNAL_LPUART_TX,     /* Tx ring drained, param is the LPUART index */
+    SCHED_SIGNAL_PIN,           /* Pin interrupt, param is the port index, data the interrupt flags */
+    SCHED_SIGNAL_TIMER,         /* Timer expiry, param and data are set by the timer */
+    SCHED_SIGNAL_USER,          /* First signal free for the application */
+} Sched_Signal_Types;           /* Signals posted by the bindings */
+
+typedef struct
+{
+    uint16_t signal;    /* Sched_Signal_Types or application signal */
+    uint16_t param;     /* Source of the event */
+    uint32_t data;      /* Payload of the event */
+} Std_Sched_Event_Types;    /* Fixed size event */
+
+typedef void (*Sched_Handler_Types)(const Std_Sched_Event_Types *pEvent);  /* Task handler, runs to completion */
+
+typedef struct
+{
+    atomic_uint_fast32_t seq;       /* Index of the event plus 1 once it is completely written */
+    Std_Sched_Event_Types event;    /* Event */
+} Sched_Slot_Types;                 /* Slot of an event queue */
+
+typedef struct
+{
+    Sched_Handler_Types handler;    /* Handler called once per event */
+    Std_MpscQueue_Types queue;      /* Event queue over the slots of the task */
+    atomic_uint_fast32_t dropped;   /* Events lost because the queue was full */
+    uint32_t events;                /* Events handled */
+    uint32_t runCyclesMax;          /* Longest time in cycles spent in the handler */
+} Std_Sched_Task_Types;             /* Task */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name schedTaskInit
+ *
+ * @brief This function is used to attach a task to a priority
+ *
+ * @param prio[in]: priority of the task, from 0 (highest) to SCHED_PRIO_NUM - 1
+ * @param task[in/out]: pointer to the task
+ * @param handler[in]: handler of the task
+ * @param slots[in/out]: event queue of the task
+ * @param nOfSlots[in]: number of slots, must be a power of 2
+ *
+ * @return Std_Sched_Status: SCHED_E_NOT_OK if the priority is taken or the queue is not valid
+ */
+Std_Sched_Status schedTaskInit(uint8_t prio, Std_Sched_Task_Types *task, Sched_Handler_Types handler,
+                               Sched_Slot_Types *slots, uint32_t nOfSlots);
+
+/**
+ * @name schedPost
+ *
+ * @brief This function is used to queue an event to a task, it can be called from any context including ISR
+ *
+ * @param prio[in]: priority of the task
+ * @param signal[in]: signal of the event
+ * @param param[in]: source of the event
+ * @param data[in]: payload of the event
+ *
+ * @return Std_Sched_Status: SCHED_E_NOT_OK if there is no task at this priority or its queue is full
+ */
+Std_Sched_Status schedPost(uint8_t prio, uint16_t signal, uint16_t param, uint32_t data);
+
+/**
+ * @name schedRunOne
+ *
+ * @brief This function is used to handle the oldest event of the highest priority ready task
+ *
+ * @return uint8_t: 1 if an event was handled, 0 if no task is ready
+ */
+uint8_t schedRunOne(void);
+
+/**
+ * @name schedRun
+ *
+ * @brief This function is used to run the scheduler forever, the core sleeps while no task is ready
+ *
+ * @return void
+ */
+void schedRun(void);
+
+/**
+ * @name schedBindLpuart
+ *
+ * @brief This function is used to turn the interrupt of an LPUART instance into SCHED_SIGNAL_LPUART_RX and
+ *        SCHED_SIGNAL_LPUART_TX events, the instance must be set up with LPUART_BufferInit
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ * @param prio[in]: priority of the task receiving the events
+ *
+ * @return Std_Sched_Status: SCHED_E_NOT_OK if the instance is not valid
+ */
+Std_Sched_Status schedBindLpuart(LPUART_Type *pLPUARTx, uint8_t prio);
+
+/**
+ * @name schedBindPort
+ *
+ * @brief This function is used to turn the interrupt of a port into SCHED_SIGNAL_PIN events
+ *
+ * @param PORTx[in]: pointer to the port
+ * @param prio[in]: priority of the task receiving the events
+ *
+ * @return Std_Sched_Status: SCHED_E_NOT_OK if the port is not valid
+ */
+Std_Sched_Status schedBindPort(PORT_Type *PORTx, uint8_t prio);
+
+#endif /* SCHEDULER_H_ */
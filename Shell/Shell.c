@@ -0,0 +1,304 @@
+/**
+ * @file Shell.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the line oriented command shell running over LPUART
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Shell.h"
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define SHELL_PROMPT        "> "        /* Prompt printed before each line */
+#define SHELL_NEWLINE       "\r\n"      /* Line ending of the output */
+
+#define CHAR_IS_SPACE(c)    (((c) == ' ') || ((c) == '\t'))                 /* Check if the character separates tokens */
+#define CHAR_IS_EOL(c)      (((c) == '\r') || ((c) == '\n'))                /* Check if the character ends a line */
+#define CHAR_IS_BACKSPACE(c) (((c) == '\b') || ((c) == 0x7F))               /* Check if the character erases */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+/**
+ * @name shellTokenize
+ *
+ * @brief This function is used to split the line in place, separators are replaced by terminators
+ *
+ * @param line[in/out]: null terminated line
+ * @param argv[out]: pointers to the tokens
+ *
+ * @return uint8_t: number of tokens, SHELL_ARGC_MAX + 1 if the line holds more
+ */
+static uint8_t shellTokenize(char *line, char *argv[]);
+
+/**
+ * @name shellLookup
+ *
+ * @brief This function is used to find a command in the sorted table
+ *
+ * @param shell[in]: pointer to the shell
+ * @param name[in]: command name
+ *
+ * @return const Std_Shell_Command_Types*: entry found, 0 if the command is unknown
+ */
+static const Std_Shell_Command_Types* shellLookup(const Std_Shell_Types *shell, const char *name);
+
+/**
+ * @name shellExecute
+ *
+ * @brief This function is used to tokenize the assembled line and dispatch it
+ *
+ * @param shell[in/out]: pointer to the shell
+ *
+ * @return void
+ */
+static void shellExecute(Std_Shell_Types *shell);
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to split the line in place, separators are replaced by terminators
+ *
+ * @param line[in/out]: null terminated line
+ * @param argv[out]: pointers to the tokens
+ *
+ * @return uint8_t: number of tokens, SHELL_ARGC_MAX + 1 if the line holds more
+ */
+static uint8_t shellTokenize(char *line, char *argv[])
+{
+    uint8_t argc = 0;
+
+    while(('\0' != *line) && (argc <= SHELL_ARGC_MAX))
+    {
+        while(CHAR_IS_SPACE(*line))
+        {
+            *line = '\0';
+            line++;
+        }
+
+        if('\0' != *line)
+        {
+            /* A token past the last entry of argv only marks the line, the previous one is terminated */
+            if(argc < SHELL_ARGC_MAX)
+            {
+                argv[argc] = line;
+            }
+
+            argc++;
+
+            while(('\0' != *line) && !CHAR_IS_SPACE(*line))
+            {
+                line++;
+            }
+        }
+    }
+
+    return argc;
+}
+
+/**
+ * @brief This function is used to find a command in the sorted table
+ *
+ * @param shell[in]: pointer to the shell
+ * @param name[in]: command name
+ *
+ * @return const Std_Shell_Command_Types*: entry found, 0 if the command is unknown
+ */
+static const Std_Shell_Command_Types* shellLookup(const Std_Shell_Types *shell, const char *name)
+{
+    const Std_Shell_Command_Types *pCommand = 0;
+    int32_t low = 0;
+    int32_t high = (int32_t)shell->nOfCommands - 1;
+
+    while((low <= high) && (0 == pCommand))
+    {
+        int32_t mid = (low + high) / 2;
+        int cmp = strcmp(name, shell->table[mid].name);
+
+        if(0 == cmp)
+        {
+            pCommand = &shell->table[mid];
+        }
+        else if(cmp < 0)
+        {
+            high = mid - 1;
+        }
+        else
+        {
+            low = mid + 1;
+        }
+    }
+
+    return pCommand;
+}
+
+/**
+ * @brief This function is used to tokenize the assembled line and dispatch it
+ *
+ * @param shell[in/out]: pointer to the shell
+ *
+ * @return void
+ */
+static void shellExecute(Std_Shell_Types *shell)
+{
+    char *argv[SHELL_ARGC_MAX];
+    uint32_t start = SHELL_CYCLE_COUNTER();
+    uint8_t argc = 0;
+    const Std_Shell_Command_Types *pCommand = 0;
+
+    shell->line[shell->length] = '\0';
+
+    /* A line cut by the overflow is not run */
+    if(0 == shell->isOverflow)
+    {
+        argc = shellTokenize(shell->line, argv);
+    }
+
+    if((0 != argc) && (SHELL_ARGC_MAX >= argc))
+    {
+        pCommand = shellLookup(shell, argv[0]);
+    }
+
+    shell->dispatchCycles = SHELL_CYCLE_COUNTER() - start;
+
+    if(0 != shell->isOverflow)
+    {
+        shellWrite(shell, "line too long" SHELL_NEWLINE);
+    }
+    else if(SHELL_ARGC_MAX < argc)
+    {
+        shellWrite(shell, "too many arguments" SHELL_NEWLINE);
+    }
+    else if(0 != pCommand)
+    {
+        if(SHELL_E_OK != pCommand->handler(shell, argc, argv))
+        {
+            shellWrite(shell, "error" SHELL_NEWLINE);
+        }
+    }
+    else if(0 != argc)
+    {
+        shellWrite(shell, "unknown command: ");
+        shellWrite(shell, argv[0]);
+        shellWrite(shell, SHELL_NEWLINE);
+    }
+    else
+    {
+        /* Empty line */
+    }
+
+    shell->length = 0;
+    shell->isOverflow = 0;
+    shellWrite(shell, SHELL_PROMPT);
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to initialize the shell
+ *
+ * @param shell[in/out]: pointer to the shell
+ * @param pLPUARTx[in]: LPUART instance, must be set up with LPUART_BufferInit
+ * @param table[in]: command table sorted by name
+ * @param nOfCommands[in]: number of entries in the table
+ *
+ * @return Std_Shell_Status: SHELL_E_NOT_OK if the table is not sorted
+ */
+Std_Shell_Status shellInit(Std_Shell_Types *shell, LPUART_Type *pLPUARTx,
+                           const Std_Shell_Command_Types *table, uint8_t nOfCommands)
+{
+    Std_Shell_Status status = SHELL_E_OK;
+
+    /* The lookup is a binary search, reject tables that are not strictly sorted */
+    for(uint8_t i = 1; i < nOfCommands; i++)
+    {
+        if(strcmp(table[i - 1].name, table[i].name) >= 0)
+        {
+            status = SHELL_E_NOT_OK;
+        }
+    }
+
+    if(SHELL_E_OK == status)
+    {
+        shell->pLPUARTx = pLPUARTx;
+        shell->table = table;
+        shell->nOfCommands = nOfCommands;
+        shell->length = 0;
+        shell->lastChar = 0;
+        shell->isOverflow = 0;
+        shell->dispatchCycles = 0;
+
+        shellWrite(shell, SHELL_PROMPT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to process the received characters, it returns when the Rx ring is empty
+ *
+ * @param shell[in/out]: pointer to the shell
+ *
+ * @return void
+ */
+void shellPoll(Std_Shell_Types *shell)
+{
+    uint8_t data;
+
+    while(0 != LPUART_Receive(shell->pLPUARTx, &data, 1))
+    {
+        if(CHAR_IS_EOL(data))
+        {
+            /* CR LF ends only one line */
+            if(!(('\n' == data) && ('\r' == shell->lastChar)))
+            {
+                shellWrite(shell, SHELL_NEWLINE);
+                shellExecute(shell);
+            }
+        }
+        else if(CHAR_IS_BACKSPACE(data))
+        {
+            if(0 != shell->length)
+            {
+                shell->length--;
+                shellWrite(shell, "\b \b");
+            }
+        }
+        else if(shell->length < (SHELL_LINE_MAX - 1U))
+        {
+            shell->line[shell->length] = (char)data;
+            shell->length++;
+            LPUART_Send(shell->pLPUARTx, &data, 1);
+        }
+        else
+        {
+            /* Line is full, the character is dropped and the line is refused at its end */
+            shell->isOverflow = 1;
+        }
+
+        shell->lastChar = data;
+    }
+}
+
+/**
+ * @brief This function is used to queue a string to the shell output without waiting
+ *
+ * @param shell[in]: pointer to the shell
+ * @param str[in]: null terminated string
+ *
+ * @return uint32_t: number of characters queued
+ */
+uint32_t shellWrite(Std_Shell_Types *shell, const char *str)
+{
+    return LPUART_Send(shell->pLPUARTx, (const uint8_t *)str, (uint32_t)strlen(str));
+}
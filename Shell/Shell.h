@@ -0,0 +1,101 @@
+/**
+ * @file Shell.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the line oriented command shell running over LPUART
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef SHELL_H_
+#define SHELL_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "s32k144_lpuart_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define SHELL_LINE_MAX  (80U)   /* Maximum length of a command line, including the terminator */
+#define SHELL_ARGC_MAX  (8U)    /* Maximum number of tokens of a command line */
+
+#ifndef SHELL_CYCLE_COUNTER
+#define SHELL_CYCLE_COUNTER() CYCLE_COUNTER()       /* Cycle counter used to measure the dispatch */
+#endif
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    SHELL_E_OK,         /* Operation completed without error */
+    SHELL_E_NOT_OK,     /* Operation not completed */
+} Std_Shell_Status;     /* Standard status type */
+
+typedef struct Std_Shell_Types Std_Shell_Types;
+
+typedef Std_Shell_Status (*Shell_Handler_Types)(Std_Shell_Types *shell, uint8_t argc, char *argv[]);  /* Command handler */
+
+typedef struct
+{
+    const char *name;               /* Command name, the table must be sorted by name */
+    Shell_Handler_Types handler;    /* Handler called with the tokens of the line */
+    const char *help;               /* One line description */
+} Std_Shell_Command_Types;          /* Entry of the command table */
+
+struct Std_Shell_Types
+{
+    LPUART_Type *pLPUARTx;                  /* LPUART instance, must be set up with LPUART_BufferInit */
+    const Std_Shell_Command_Types *table;   /* Sorted command table */
+    uint8_t nOfCommands;                    /* Number of entries in the table */
+    uint8_t length;                         /* Number of characters in the line */
+    uint8_t lastChar;                       /* Last received character, used to merge CR LF */
+    uint8_t isOverflow;                     /* 1 if characters were dropped from the line, it is not run */
+    char line[SHELL_LINE_MAX];              /* Line being assembled, tokenized in place */
+    uint32_t dispatchCycles;                /* Cycles spent tokenizing and looking up the last command */
+};
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name shellInit
+ *
+ * @brief This function is used to initialize the shell
+ *
+ * @param shell[in/out]: pointer to the shell
+ * @param pLPUARTx[in]: LPUART instance, must be set up with LPUART_BufferInit
+ * @param table[in]: command table sorted by name
+ * @param nOfCommands[in]: number of entries in the table
+ *
+ * @return Std_Shell_Status: SHELL_E_NOT_OK if the table is not sorted
+ */
+Std_Shell_Status shellInit(Std_Shell_Types *shell, LPUART_Type *pLPUARTx,
+                           const Std_Shell_Command_Types *table, uint8_t nOfCommands);
+
+/**
+ * @name shellPoll
+ *
+ * @brief This function is used to process the received characters, it returns when the Rx ring is empty
+ *
+ * @param shell[in/out]: pointer to the shell
+ *
+ * @return void
+ */
+void shellPoll(Std_Shell_Types *shell);
+
+/**
+ * @name shellWrite
+ *
+ * @brief This function is used to queue a string to the shell output without waiting
+ *
+ * @param shell[in]: pointer to the shell
+ * @param str[in]: null terminated string
+ *
+ * @return uint32_t: number of characters queued
+ */
+uint32_t shellWrite(Std_Shell_Types *shell, const char *str);
+
+#endif /* SHELL_H_ */
@@ -0,0 +1,1013 @@
+/**
+ * @file S32K144.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to replace the device header of the S32K144 in the host builds, the peripherals
+ *        are plain memory of the simulator
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Only the registers and fields used by the drivers are declared, with the layout and names of the NXP
+ * header. A register keeps the last value written: the write 1 to clear flags, the NVIC set and clear
+ * registers and the GPIO set, clear and toggle registers are not modelled, the tests set the flags they
+ * need through the Sim.h helpers.
+ */
+#ifndef S32K144_H_
+#define S32K144_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include <stdint.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define __IO    volatile        /* Read and write register */
+#define __I     volatile const  /* Read only register */
+#define __O     volatile        /* Write only register */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    __I uint32_t VERID;
+    __I uint32_t PARAM;
+    __IO uint32_t GLOBAL;
+    __IO uint32_t PINCFG;
+    __IO uint32_t BAUD;
+    __IO uint32_t STAT;
+    __IO uint32_t CTRL;
+    __IO uint32_t DATA;
+    __IO uint32_t MATCH;
+    __IO uint32_t MODIR;
+    __IO uint32_t FIFO;
+    __IO uint32_t WATER;
+} LPUART_Type;
+
+typedef struct
+{
+    __IO uint32_t PCCn[116];
+} PCC_Type;
+
+typedef struct
+{
+    __I uint32_t VERID;
+    __I uint32_t PARAM;
+    uint8_t R0[8];
+    __I uint32_t CSR;
+    __IO uint32_t RCCR;
+    __IO uint32_t VCCR;
+    __IO uint32_t HCCR;
+    __IO uint32_t CLKOUTCNFG;
+    uint8_t R1[220];
+    __IO uint32_t SOSCCSR;
+    __IO uint32_t SOSCDIV;
+    __IO uint32_t SOSCCFG;
+    uint8_t R2[244];
+    __IO uint32_t SIRCCSR;
+    __IO uint32_t SIRCDIV;
+    __IO uint32_t SIRCCFG;
+    uint8_t R3[244];
+    __IO uint32_t FIRCCSR;
+    __IO uint32_t FIRCDIV;
+    __IO uint32_t FIRCCFG;
+    uint8_t R4[756];
+    __IO uint32_t SPLLCSR;
+    __IO uint32_t SPLLDIV;
+    __IO uint32_t SPLLCFG;
+} SCG_Type;
+
+typedef struct
+{
+    __IO uint32_t PCR[32];
+    __O uint32_t GPCLR;
+    __O uint32_t GPCHR;
+    uint8_t R0[24];
+    __IO uint32_t ISFR;
+    uint8_t R1[28];
+    __IO uint32_t DFER;
+    __IO uint32_t DFCR;
+    __IO uint32_t DFWR;
+} PORT_Type;
+
+typedef struct
+{
+    __IO uint32_t PDOR;
+    __O uint32_t PSOR;
+    __O uint32_t PCOR;
+    __O uint32_t PTOR;
+    __I uint32_t PDIR;
+    __IO uint32_t PDDR;
+    __IO uint32_t PIDR;
+} GPIO_Type;
+
+typedef struct
+{
+    union
+    {
+        __IO uint32_t DATA;
+        struct
+        {
+            __IO uint16_t L;
+            __IO uint16_t H;
+        } DATA_16;
+        struct
+        {
+            __IO uint8_t LL;
+            __IO uint8_t LU;
+            __IO uint8_t HL;
+            __IO uint8_t HU;
+        } DATA_8;
+    } DATAu;
+    __IO uint32_t GPOLY;
+    __IO uint32_t CTRL;
+} CRC_Type;
+
+typedef struct
+{
+    __I uint32_t VERID;
+    __I uint32_t PARAM;
+    __IO uint32_t MCR;
+    __IO uint32_t MSR;
+    __IO uint32_t MIER;
+    __IO uint32_t SETTEN;
+    __IO uint32_t CLRTEN;
+    uint8_t R0[4];
+    struct
+    {
+        __IO uint32_t TVAL;
+        __I uint32_t CVAL;
+        __IO uint32_t TCTRL;
+        uint8_t R[4];
+    } TMR[4];
+} LPIT_Type;
+
+typedef struct
+{
+    __I uint32_t VERID;
+    __I uint32_t PARAM;
+    __IO uint32_t PMPROT;
+    __IO uint32_t PMCTRL;
+    __IO uint32_t STOPCTRL;
+    __I uint32_t PMSTAT;
+} SMC_Type;
+
+typedef struct
+{
+    __IO uint32_t SCR;
+} S32_SCB_Type;
+
+typedef struct
+{
+    __IO uint32_t CSR;
+    __IO uint32_t RVR;
+    __IO uint32_t CVR;
+    __I uint32_t CALIB;
+} S32_SysTick_Type;
+
+typedef struct
+{
+    __IO uint32_t ISER[8];
+    uint32_t R0[24];
+    __IO uint32_t ICER[8];
+    uint32_t R1[24];
+    __IO uint32_t ISPR[8];
+    uint32_t R2[24];
+    __IO uint32_t ICPR[8];
+    uint32_t R3[24];
+    __IO uint32_t IABR[8];
+    uint32_t R4[56];
+    __IO uint8_t IP[240];
+} S32_NVIC_Type;
+
+typedef enum
+{
+    LPUART0_RxTx_IRQn = 31,
+    LPUART1_RxTx_IRQn = 33,
+    LPUART2_RxTx_IRQn = 35,
+    LPIT0_Ch0_IRQn = 48,
+    LPIT0_Ch1_IRQn = 49,
+    LPIT0_Ch2_IRQn = 50,
+    PORTA_IRQn = 59,
+    PORTB_IRQn = 60,
+    PORTC_IRQn = 61,
+    PORTD_IRQn = 62,
+    PORTE_IRQn = 63,
+} IRQn_Type;
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+extern LPUART_Type sim_lpuart[3];
+extern PCC_Type sim_pcc;
+extern SCG_Type sim_scg;
+extern PORT_Type sim_port[5];
+extern GPIO_Type sim_gpio[5];
+extern CRC_Type sim_crc;
+extern LPIT_Type sim_lpit;
+extern SMC_Type sim_smc;
+extern S32_SCB_Type sim_scb;
+extern S32_SysTick_Type sim_systick;
+extern S32_NVIC_Type sim_nvic;
+
+/****************************************************************************************************************
+ *                                                 PERIPHERALS                                                  *
+ ****************************************************************************************************************/
+#define LPUART0                (&sim_lpuart[0])
+#define LPUART1                (&sim_lpuart[1])
+#define LPUART2                (&sim_lpuart[2])
+#define PCC                    (&sim_pcc)
+#define SCG                    (&sim_scg)
+#define PORTA                  (&sim_port[0])
+#define PORTB                  (&sim_port[1])
+#define PORTC                  (&sim_port[2])
+#define PORTD                  (&sim_port[3])
+#define PORTE                  (&sim_port[4])
+#define PTA                    (&sim_gpio[0])
+#define PTB                    (&sim_gpio[1])
+#define PTC                    (&sim_gpio[2])
+#define PTD                    (&sim_gpio[3])
+#define PTE                    (&sim_gpio[4])
+#define CRC                    (&sim_crc)
+#define LPIT0                  (&sim_lpit)
+#define SMC                    (&sim_smc)
+#define S32_SCB                (&sim_scb)
+#define S32_SysTick            (&sim_systick)
+#define S32_NVIC               (&sim_nvic)
+
+#define LPUART_INSTANCE_COUNT  3u
+#define PCC_CRC_INDEX          50
+#define PCC_LPIT_INDEX         55
+#define PCC_PORTA_INDEX        73
+#define PCC_PORTB_INDEX        74
+#define PCC_PORTC_INDEX        75
+#define PCC_PORTD_INDEX        76
+#define PCC_PORTE_INDEX        77
+#define PCC_LPUART0_INDEX      106
+#define PCC_LPUART1_INDEX      107
+#define PCC_LPUART2_INDEX      108
+
+/****************************************************************************************************************
+ *                                            REGISTER ACCESS MODELS                                            *
+ ****************************************************************************************************************/
+/* The HAL makes these accesses through macros, the plain memory cannot give their effect so they go to the
+   models of Sim.c */
+#define LPIT_CVAL_READ(pLPITx, channel)     simLpitCvalRead((pLPITx), (channel))
+#define LPIT_SETTEN_WRITE(pLPITx, mask)     simLpitSettenWrite((pLPITx), (mask))
+#define LPIT_CLRTEN_WRITE(pLPITx, mask)     simLpitClrtenWrite((pLPITx), (mask))
+#define LPIT_MSR_WRITE(pLPITx, mask)        simLpitMsrWrite((pLPITx), (mask))
+
+uint32_t simLpitCvalRead(LPIT_Type *pLPITx, uint8_t channel);   /* Counter, the LPIT then runs 1 clock */
+void simLpitSettenWrite(LPIT_Type *pLPITx, uint32_t mask);      /* Channels started with TVAL loaded */
+void simLpitClrtenWrite(LPIT_Type *pLPITx, uint32_t mask);      /* Channels stopped */
+void simLpitMsrWrite(LPIT_Type *pLPITx, uint32_t mask);         /* Flags cleared */
+
+#define LPUART_STAT_WRITE(pLPUARTx, value)  simLpuartStatWrite((pLPUARTx), (value))
+#define LPUART_DATA_WRITE(pLPUARTx, data)   simLpuartDataWrite((pLPUARTx), (data))
+#define LPUART_DATA_READ(pLPUARTx)          simLpuartDataRead((pLPUARTx))
+#define LPUART_BREAK_QUEUE(pLPUARTx)        simLpuartBreakQueue((pLPUARTx))
+
+void simLpuartStatWrite(LPUART_Type *pLPUARTx, uint32_t value); /* Flags written 1 cleared */
+void simLpuartDataWrite(LPUART_Type *pLPUARTx, uint32_t data);  /* Character kept for simLpuartSent */
+uint32_t simLpuartDataRead(LPUART_Type *pLPUARTx);              /* Oldest character of the Rx FIFO */
+void simLpuartBreakQueue(LPUART_Type *pLPUARTx);                /* Break kept for simLpuartSent */
+
+/****************************************************************************************************************
+ *                                                REGISTER FIELDS                                               *
+ ****************************************************************************************************************/
+#define LPUART_BAUD_SBR_MASK 0x1FFFu
+#define LPUART_BAUD_SBR_SHIFT 0u
+#define LPUART_BAUD_SBR_WIDTH 13u
+#define LPUART_BAUD_SBR(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_SBR_SHIFT))&LPUART_BAUD_SBR_MASK)
+#define LPUART_BAUD_SBNS_MASK 0x2000u
+#define LPUART_BAUD_SBNS_SHIFT 13u
+#define LPUART_BAUD_SBNS_WIDTH 1u
+#define LPUART_BAUD_SBNS(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_SBNS_SHIFT))&LPUART_BAUD_SBNS_MASK)
+#define LPUART_BAUD_RXEDGIE_MASK 0x4000u
+#define LPUART_BAUD_RXEDGIE_SHIFT 14u
+#define LPUART_BAUD_RXEDGIE_WIDTH 1u
+#define LPUART_BAUD_RXEDGIE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_RXEDGIE_SHIFT))&LPUART_BAUD_RXEDGIE_MASK)
+#define LPUART_BAUD_LBKDIE_MASK 0x8000u
+#define LPUART_BAUD_LBKDIE_SHIFT 15u
+#define LPUART_BAUD_LBKDIE_WIDTH 1u
+#define LPUART_BAUD_LBKDIE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_LBKDIE_SHIFT))&LPUART_BAUD_LBKDIE_MASK)
+#define LPUART_BAUD_RESYNCDIS_MASK 0x10000u
+#define LPUART_BAUD_RESYNCDIS_SHIFT 16u
+#define LPUART_BAUD_RESYNCDIS_WIDTH 1u
+#define LPUART_BAUD_RESYNCDIS(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_RESYNCDIS_SHIFT))&LPUART_BAUD_RESYNCDIS_MASK)
+#define LPUART_BAUD_BOTHEDGE_MASK 0x20000u
+#define LPUART_BAUD_BOTHEDGE_SHIFT 17u
+#define LPUART_BAUD_BOTHEDGE_WIDTH 1u
+#define LPUART_BAUD_BOTHEDGE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_BOTHEDGE_SHIFT))&LPUART_BAUD_BOTHEDGE_MASK)
+#define LPUART_BAUD_MATCFG_MASK 0xC0000u
+#define LPUART_BAUD_MATCFG_SHIFT 18u
+#define LPUART_BAUD_MATCFG_WIDTH 2u
+#define LPUART_BAUD_MATCFG(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_MATCFG_SHIFT))&LPUART_BAUD_MATCFG_MASK)
+#define LPUART_BAUD_RIDMAE_MASK 0x100000u
+#define LPUART_BAUD_RIDMAE_SHIFT 20u
+#define LPUART_BAUD_RIDMAE_WIDTH 1u
+#define LPUART_BAUD_RIDMAE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_RIDMAE_SHIFT))&LPUART_BAUD_RIDMAE_MASK)
+#define LPUART_BAUD_RDMAE_MASK 0x200000u
+#define LPUART_BAUD_RDMAE_SHIFT 21u
+#define LPUART_BAUD_RDMAE_WIDTH 1u
+#define LPUART_BAUD_RDMAE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_RDMAE_SHIFT))&LPUART_BAUD_RDMAE_MASK)
+#define LPUART_BAUD_TDMAE_MASK 0x800000u
+#define LPUART_BAUD_TDMAE_SHIFT 23u
+#define LPUART_BAUD_TDMAE_WIDTH 1u
+#define LPUART_BAUD_TDMAE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_TDMAE_SHIFT))&LPUART_BAUD_TDMAE_MASK)
+#define LPUART_BAUD_OSR_MASK 0x1F000000u
+#define LPUART_BAUD_OSR_SHIFT 24u
+#define LPUART_BAUD_OSR_WIDTH 5u
+#define LPUART_BAUD_OSR(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_OSR_SHIFT))&LPUART_BAUD_OSR_MASK)
+#define LPUART_BAUD_M10_MASK 0x20000000u
+#define LPUART_BAUD_M10_SHIFT 29u
+#define LPUART_BAUD_M10_WIDTH 1u
+#define LPUART_BAUD_M10(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_M10_SHIFT))&LPUART_BAUD_M10_MASK)
+#define LPUART_BAUD_MAEN2_MASK 0x40000000u
+#define LPUART_BAUD_MAEN2_SHIFT 30u
+#define LPUART_BAUD_MAEN2_WIDTH 1u
+#define LPUART_BAUD_MAEN2(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_MAEN2_SHIFT))&LPUART_BAUD_MAEN2_MASK)
+#define LPUART_BAUD_MAEN1_MASK 0x80000000u
+#define LPUART_BAUD_MAEN1_SHIFT 31u
+#define LPUART_BAUD_MAEN1_WIDTH 1u
+#define LPUART_BAUD_MAEN1(x) (((uint32_t)(((uint32_t)(x))<<LPUART_BAUD_MAEN1_SHIFT))&LPUART_BAUD_MAEN1_MASK)
+#define LPUART_STAT_MA2F_MASK 0x4000u
+#define LPUART_STAT_MA2F_SHIFT 14u
+#define LPUART_STAT_MA2F_WIDTH 1u
+#define LPUART_STAT_MA2F(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_MA2F_SHIFT))&LPUART_STAT_MA2F_MASK)
+#define LPUART_STAT_MA1F_MASK 0x8000u
+#define LPUART_STAT_MA1F_SHIFT 15u
+#define LPUART_STAT_MA1F_WIDTH 1u
+#define LPUART_STAT_MA1F(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_MA1F_SHIFT))&LPUART_STAT_MA1F_MASK)
+#define LPUART_STAT_PF_MASK 0x10000u
+#define LPUART_STAT_PF_SHIFT 16u
+#define LPUART_STAT_PF_WIDTH 1u
+#define LPUART_STAT_PF(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_PF_SHIFT))&LPUART_STAT_PF_MASK)
+#define LPUART_STAT_FE_MASK 0x20000u
+#define LPUART_STAT_FE_SHIFT 17u
+#define LPUART_STAT_FE_WIDTH 1u
+#define LPUART_STAT_FE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_FE_SHIFT))&LPUART_STAT_FE_MASK)
+#define LPUART_STAT_NF_MASK 0x40000u
+#define LPUART_STAT_NF_SHIFT 18u
+#define LPUART_STAT_NF_WIDTH 1u
+#define LPUART_STAT_NF(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_NF_SHIFT))&LPUART_STAT_NF_MASK)
+#define LPUART_STAT_OR_MASK 0x80000u
+#define LPUART_STAT_OR_SHIFT 19u
+#define LPUART_STAT_OR_WIDTH 1u
+#define LPUART_STAT_OR(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_OR_SHIFT))&LPUART_STAT_OR_MASK)
+#define LPUART_STAT_IDLE_MASK 0x100000u
+#define LPUART_STAT_IDLE_SHIFT 20u
+#define LPUART_STAT_IDLE_WIDTH 1u
+#define LPUART_STAT_IDLE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_IDLE_SHIFT))&LPUART_STAT_IDLE_MASK)
+#define LPUART_STAT_RDRF_MASK 0x200000u
+#define LPUART_STAT_RDRF_SHIFT 21u
+#define LPUART_STAT_RDRF_WIDTH 1u
+#define LPUART_STAT_RDRF(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_RDRF_SHIFT))&LPUART_STAT_RDRF_MASK)
+#define LPUART_STAT_TC_MASK 0x400000u
+#define LPUART_STAT_TC_SHIFT 22u
+#define LPUART_STAT_TC_WIDTH 1u
+#define LPUART_STAT_TC(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_TC_SHIFT))&LPUART_STAT_TC_MASK)
+#define LPUART_STAT_TDRE_MASK 0x800000u
+#define LPUART_STAT_TDRE_SHIFT 23u
+#define LPUART_STAT_TDRE_WIDTH 1u
+#define LPUART_STAT_TDRE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_TDRE_SHIFT))&LPUART_STAT_TDRE_MASK)
+#define LPUART_STAT_RAF_MASK 0x1000000u
+#define LPUART_STAT_RAF_SHIFT 24u
+#define LPUART_STAT_RAF_WIDTH 1u
+#define LPUART_STAT_RAF(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_RAF_SHIFT))&LPUART_STAT_RAF_MASK)
+#define LPUART_STAT_LBKDE_MASK 0x2000000u
+#define LPUART_STAT_LBKDE_SHIFT 25u
+#define LPUART_STAT_LBKDE_WIDTH 1u
+#define LPUART_STAT_LBKDE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_LBKDE_SHIFT))&LPUART_STAT_LBKDE_MASK)
+#define LPUART_STAT_BRK13_MASK 0x4000000u
+#define LPUART_STAT_BRK13_SHIFT 26u
+#define LPUART_STAT_BRK13_WIDTH 1u
+#define LPUART_STAT_BRK13(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_BRK13_SHIFT))&LPUART_STAT_BRK13_MASK)
+#define LPUART_STAT_RWUID_MASK 0x8000000u
+#define LPUART_STAT_RWUID_SHIFT 27u
+#define LPUART_STAT_RWUID_WIDTH 1u
+#define LPUART_STAT_RWUID(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_RWUID_SHIFT))&LPUART_STAT_RWUID_MASK)
+#define LPUART_STAT_RXINV_MASK 0x10000000u
+#define LPUART_STAT_RXINV_SHIFT 28u
+#define LPUART_STAT_RXINV_WIDTH 1u
+#define LPUART_STAT_RXINV(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_RXINV_SHIFT))&LPUART_STAT_RXINV_MASK)
+#define LPUART_STAT_MSBF_MASK 0x20000000u
+#define LPUART_STAT_MSBF_SHIFT 29u
+#define LPUART_STAT_MSBF_WIDTH 1u
+#define LPUART_STAT_MSBF(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_MSBF_SHIFT))&LPUART_STAT_MSBF_MASK)
+#define LPUART_STAT_RXEDGIF_MASK 0x40000000u
+#define LPUART_STAT_RXEDGIF_SHIFT 30u
+#define LPUART_STAT_RXEDGIF_WIDTH 1u
+#define LPUART_STAT_RXEDGIF(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_RXEDGIF_SHIFT))&LPUART_STAT_RXEDGIF_MASK)
+#define LPUART_STAT_LBKDIF_MASK 0x80000000u
+#define LPUART_STAT_LBKDIF_SHIFT 31u
+#define LPUART_STAT_LBKDIF_WIDTH 1u
+#define LPUART_STAT_LBKDIF(x) (((uint32_t)(((uint32_t)(x))<<LPUART_STAT_LBKDIF_SHIFT))&LPUART_STAT_LBKDIF_MASK)
+#define LPUART_CTRL_PT_MASK 0x1u
+#define LPUART_CTRL_PT_SHIFT 0u
+#define LPUART_CTRL_PT_WIDTH 1u
+#define LPUART_CTRL_PT(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_PT_SHIFT))&LPUART_CTRL_PT_MASK)
+#define LPUART_CTRL_PE_MASK 0x2u
+#define LPUART_CTRL_PE_SHIFT 1u
+#define LPUART_CTRL_PE_WIDTH 1u
+#define LPUART_CTRL_PE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_PE_SHIFT))&LPUART_CTRL_PE_MASK)
+#define LPUART_CTRL_ILT_MASK 0x4u
+#define LPUART_CTRL_ILT_SHIFT 2u
+#define LPUART_CTRL_ILT_WIDTH 1u
+#define LPUART_CTRL_ILT(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_ILT_SHIFT))&LPUART_CTRL_ILT_MASK)
+#define LPUART_CTRL_WAKE_MASK 0x8u
+#define LPUART_CTRL_WAKE_SHIFT 3u
+#define LPUART_CTRL_WAKE_WIDTH 1u
+#define LPUART_CTRL_WAKE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_WAKE_SHIFT))&LPUART_CTRL_WAKE_MASK)
+#define LPUART_CTRL_M_MASK 0x10u
+#define LPUART_CTRL_M_SHIFT 4u
+#define LPUART_CTRL_M_WIDTH 1u
+#define LPUART_CTRL_M(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_M_SHIFT))&LPUART_CTRL_M_MASK)
+#define LPUART_CTRL_RSRC_MASK 0x20u
+#define LPUART_CTRL_RSRC_SHIFT 5u
+#define LPUART_CTRL_RSRC_WIDTH 1u
+#define LPUART_CTRL_RSRC(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_RSRC_SHIFT))&LPUART_CTRL_RSRC_MASK)
+#define LPUART_CTRL_DOZEEN_MASK 0x40u
+#define LPUART_CTRL_DOZEEN_SHIFT 6u
+#define LPUART_CTRL_DOZEEN_WIDTH 1u
+#define LPUART_CTRL_DOZEEN(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_DOZEEN_SHIFT))&LPUART_CTRL_DOZEEN_MASK)
+#define LPUART_CTRL_LOOPS_MASK 0x80u
+#define LPUART_CTRL_LOOPS_SHIFT 7u
+#define LPUART_CTRL_LOOPS_WIDTH 1u
+#define LPUART_CTRL_LOOPS(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_LOOPS_SHIFT))&LPUART_CTRL_LOOPS_MASK)
+#define LPUART_CTRL_IDLECFG_MASK 0x700u
+#define LPUART_CTRL_IDLECFG_SHIFT 8u
+#define LPUART_CTRL_IDLECFG_WIDTH 3u
+#define LPUART_CTRL_IDLECFG(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_IDLECFG_SHIFT))&LPUART_CTRL_IDLECFG_MASK)
+#define LPUART_CTRL_M7_MASK 0x800u
+#define LPUART_CTRL_M7_SHIFT 11u
+#define LPUART_CTRL_M7_WIDTH 1u
+#define LPUART_CTRL_M7(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_M7_SHIFT))&LPUART_CTRL_M7_MASK)
+#define LPUART_CTRL_MA2IE_MASK 0x4000u
+#define LPUART_CTRL_MA2IE_SHIFT 14u
+#define LPUART_CTRL_MA2IE_WIDTH 1u
+#define LPUART_CTRL_MA2IE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_MA2IE_SHIFT))&LPUART_CTRL_MA2IE_MASK)
+#define LPUART_CTRL_MA1IE_MASK 0x8000u
+#define LPUART_CTRL_MA1IE_SHIFT 15u
+#define LPUART_CTRL_MA1IE_WIDTH 1u
+#define LPUART_CTRL_MA1IE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_MA1IE_SHIFT))&LPUART_CTRL_MA1IE_MASK)
+#define LPUART_CTRL_SBK_MASK 0x10000u
+#define LPUART_CTRL_SBK_SHIFT 16u
+#define LPUART_CTRL_SBK_WIDTH 1u
+#define LPUART_CTRL_SBK(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_SBK_SHIFT))&LPUART_CTRL_SBK_MASK)
+#define LPUART_CTRL_RWU_MASK 0x20000u
+#define LPUART_CTRL_RWU_SHIFT 17u
+#define LPUART_CTRL_RWU_WIDTH 1u
+#define LPUART_CTRL_RWU(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_RWU_SHIFT))&LPUART_CTRL_RWU_MASK)
+#define LPUART_CTRL_RE_MASK 0x40000u
+#define LPUART_CTRL_RE_SHIFT 18u
+#define LPUART_CTRL_RE_WIDTH 1u
+#define LPUART_CTRL_RE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_RE_SHIFT))&LPUART_CTRL_RE_MASK)
+#define LPUART_CTRL_TE_MASK 0x80000u
+#define LPUART_CTRL_TE_SHIFT 19u
+#define LPUART_CTRL_TE_WIDTH 1u
+#define LPUART_CTRL_TE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_TE_SHIFT))&LPUART_CTRL_TE_MASK)
+#define LPUART_CTRL_ILIE_MASK 0x100000u
+#define LPUART_CTRL_ILIE_SHIFT 20u
+#define LPUART_CTRL_ILIE_WIDTH 1u
+#define LPUART_CTRL_ILIE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_ILIE_SHIFT))&LPUART_CTRL_ILIE_MASK)
+#define LPUART_CTRL_RIE_MASK 0x200000u
+#define LPUART_CTRL_RIE_SHIFT 21u
+#define LPUART_CTRL_RIE_WIDTH 1u
+#define LPUART_CTRL_RIE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_RIE_SHIFT))&LPUART_CTRL_RIE_MASK)
+#define LPUART_CTRL_TCIE_MASK 0x400000u
+#define LPUART_CTRL_TCIE_SHIFT 22u
+#define LPUART_CTRL_TCIE_WIDTH 1u
+#define LPUART_CTRL_TCIE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_TCIE_SHIFT))&LPUART_CTRL_TCIE_MASK)
+#define LPUART_CTRL_TIE_MASK 0x800000u
+#define LPUART_CTRL_TIE_SHIFT 23u
+#define LPUART_CTRL_TIE_WIDTH 1u
+#define LPUART_CTRL_TIE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_TIE_SHIFT))&LPUART_CTRL_TIE_MASK)
+#define LPUART_CTRL_PEIE_MASK 0x1000000u
+#define LPUART_CTRL_PEIE_SHIFT 24u
+#define LPUART_CTRL_PEIE_WIDTH 1u
+#define LPUART_CTRL_PEIE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_PEIE_SHIFT))&LPUART_CTRL_PEIE_MASK)
+#define LPUART_CTRL_FEIE_MASK 0x2000000u
+#define LPUART_CTRL_FEIE_SHIFT 25u
+#define LPUART_CTRL_FEIE_WIDTH 1u
+#define LPUART_CTRL_FEIE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_FEIE_SHIFT))&LPUART_CTRL_FEIE_MASK)
+#define LPUART_CTRL_NEIE_MASK 0x4000000u
+#define LPUART_CTRL_NEIE_SHIFT 26u
+#define LPUART_CTRL_NEIE_WIDTH 1u
+#define LPUART_CTRL_NEIE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_NEIE_SHIFT))&LPUART_CTRL_NEIE_MASK)
+#define LPUART_CTRL_ORIE_MASK 0x8000000u
+#define LPUART_CTRL_ORIE_SHIFT 27u
+#define LPUART_CTRL_ORIE_WIDTH 1u
+#define LPUART_CTRL_ORIE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_ORIE_SHIFT))&LPUART_CTRL_ORIE_MASK)
+#define LPUART_CTRL_TXINV_MASK 0x10000000u
+#define LPUART_CTRL_TXINV_SHIFT 28u
+#define LPUART_CTRL_TXINV_WIDTH 1u
+#define LPUART_CTRL_TXINV(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_TXINV_SHIFT))&LPUART_CTRL_TXINV_MASK)
+#define LPUART_CTRL_TXDIR_MASK 0x20000000u
+#define LPUART_CTRL_TXDIR_SHIFT 29u
+#define LPUART_CTRL_TXDIR_WIDTH 1u
+#define LPUART_CTRL_TXDIR(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_TXDIR_SHIFT))&LPUART_CTRL_TXDIR_MASK)
+#define LPUART_CTRL_R9T8_MASK 0x40000000u
+#define LPUART_CTRL_R9T8_SHIFT 30u
+#define LPUART_CTRL_R9T8_WIDTH 1u
+#define LPUART_CTRL_R9T8(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_R9T8_SHIFT))&LPUART_CTRL_R9T8_MASK)
+#define LPUART_CTRL_R8T9_MASK 0x80000000u
+#define LPUART_CTRL_R8T9_SHIFT 31u
+#define LPUART_CTRL_R8T9_WIDTH 1u
+#define LPUART_CTRL_R8T9(x) (((uint32_t)(((uint32_t)(x))<<LPUART_CTRL_R8T9_SHIFT))&LPUART_CTRL_R8T9_MASK)
+#define LPUART_DATA_R0T0_MASK 0x1u
+#define LPUART_DATA_R0T0_SHIFT 0u
+#define LPUART_DATA_R0T0_WIDTH 1u
+#define LPUART_DATA_R0T0(x) (((uint32_t)(((uint32_t)(x))<<LPUART_DATA_R0T0_SHIFT))&LPUART_DATA_R0T0_MASK)
+#define LPUART_DATA_IDLINE_MASK 0x800u
+#define LPUART_DATA_IDLINE_SHIFT 11u
+#define LPUART_DATA_IDLINE_WIDTH 1u
+#define LPUART_DATA_IDLINE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_DATA_IDLINE_SHIFT))&LPUART_DATA_IDLINE_MASK)
+#define LPUART_DATA_RXEMPT_MASK 0x1000u
+#define LPUART_DATA_RXEMPT_SHIFT 12u
+#define LPUART_DATA_RXEMPT_WIDTH 1u
+#define LPUART_DATA_RXEMPT(x) (((uint32_t)(((uint32_t)(x))<<LPUART_DATA_RXEMPT_SHIFT))&LPUART_DATA_RXEMPT_MASK)
+#define LPUART_DATA_FRETSC_MASK 0x2000u
+#define LPUART_DATA_FRETSC_SHIFT 13u
+#define LPUART_DATA_FRETSC_WIDTH 1u
+#define LPUART_DATA_FRETSC(x) (((uint32_t)(((uint32_t)(x))<<LPUART_DATA_FRETSC_SHIFT))&LPUART_DATA_FRETSC_MASK)
+#define LPUART_DATA_PARITYE_MASK 0x4000u
+#define LPUART_DATA_PARITYE_SHIFT 14u
+#define LPUART_DATA_PARITYE_WIDTH 1u
+#define LPUART_DATA_PARITYE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_DATA_PARITYE_SHIFT))&LPUART_DATA_PARITYE_MASK)
+#define LPUART_DATA_NOISY_MASK 0x8000u
+#define LPUART_DATA_NOISY_SHIFT 15u
+#define LPUART_DATA_NOISY_WIDTH 1u
+#define LPUART_DATA_NOISY(x) (((uint32_t)(((uint32_t)(x))<<LPUART_DATA_NOISY_SHIFT))&LPUART_DATA_NOISY_MASK)
+#define LPUART_MATCH_MA1_MASK 0x3FFu
+#define LPUART_MATCH_MA1_SHIFT 0u
+#define LPUART_MATCH_MA1_WIDTH 10u
+#define LPUART_MATCH_MA1(x) (((uint32_t)(((uint32_t)(x))<<LPUART_MATCH_MA1_SHIFT))&LPUART_MATCH_MA1_MASK)
+#define LPUART_MATCH_MA2_MASK 0x3FF0000u
+#define LPUART_MATCH_MA2_SHIFT 16u
+#define LPUART_MATCH_MA2_WIDTH 10u
+#define LPUART_MATCH_MA2(x) (((uint32_t)(((uint32_t)(x))<<LPUART_MATCH_MA2_SHIFT))&LPUART_MATCH_MA2_MASK)
+#define LPUART_FIFO_RXFIFOSIZE_MASK 0x7u
+#define LPUART_FIFO_RXFIFOSIZE_SHIFT 0u
+#define LPUART_FIFO_RXFIFOSIZE_WIDTH 3u
+#define LPUART_FIFO_RXFIFOSIZE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_RXFIFOSIZE_SHIFT))&LPUART_FIFO_RXFIFOSIZE_MASK)
+#define LPUART_FIFO_RXFE_MASK 0x8u
+#define LPUART_FIFO_RXFE_SHIFT 3u
+#define LPUART_FIFO_RXFE_WIDTH 1u
+#define LPUART_FIFO_RXFE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_RXFE_SHIFT))&LPUART_FIFO_RXFE_MASK)
+#define LPUART_FIFO_TXFIFOSIZE_MASK 0x70u
+#define LPUART_FIFO_TXFIFOSIZE_SHIFT 4u
+#define LPUART_FIFO_TXFIFOSIZE_WIDTH 3u
+#define LPUART_FIFO_TXFIFOSIZE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_TXFIFOSIZE_SHIFT))&LPUART_FIFO_TXFIFOSIZE_MASK)
+#define LPUART_FIFO_TXFE_MASK 0x80u
+#define LPUART_FIFO_TXFE_SHIFT 7u
+#define LPUART_FIFO_TXFE_WIDTH 1u
+#define LPUART_FIFO_TXFE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_TXFE_SHIFT))&LPUART_FIFO_TXFE_MASK)
+#define LPUART_FIFO_RXUFE_MASK 0x100u
+#define LPUART_FIFO_RXUFE_SHIFT 8u
+#define LPUART_FIFO_RXUFE_WIDTH 1u
+#define LPUART_FIFO_RXUFE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_RXUFE_SHIFT))&LPUART_FIFO_RXUFE_MASK)
+#define LPUART_FIFO_TXOFE_MASK 0x200u
+#define LPUART_FIFO_TXOFE_SHIFT 9u
+#define LPUART_FIFO_TXOFE_WIDTH 1u
+#define LPUART_FIFO_TXOFE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_TXOFE_SHIFT))&LPUART_FIFO_TXOFE_MASK)
+#define LPUART_FIFO_RXIDEN_MASK 0x1C00u
+#define LPUART_FIFO_RXIDEN_SHIFT 10u
+#define LPUART_FIFO_RXIDEN_WIDTH 3u
+#define LPUART_FIFO_RXIDEN(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_RXIDEN_SHIFT))&LPUART_FIFO_RXIDEN_MASK)
+#define LPUART_FIFO_RXFLUSH_MASK 0x4000u
+#define LPUART_FIFO_RXFLUSH_SHIFT 14u
+#define LPUART_FIFO_RXFLUSH_WIDTH 1u
+#define LPUART_FIFO_RXFLUSH(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_RXFLUSH_SHIFT))&LPUART_FIFO_RXFLUSH_MASK)
+#define LPUART_FIFO_TXFLUSH_MASK 0x8000u
+#define LPUART_FIFO_TXFLUSH_SHIFT 15u
+#define LPUART_FIFO_TXFLUSH_WIDTH 1u
+#define LPUART_FIFO_TXFLUSH(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_TXFLUSH_SHIFT))&LPUART_FIFO_TXFLUSH_MASK)
+#define LPUART_FIFO_RXUF_MASK 0x10000u
+#define LPUART_FIFO_RXUF_SHIFT 16u
+#define LPUART_FIFO_RXUF_WIDTH 1u
+#define LPUART_FIFO_RXUF(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_RXUF_SHIFT))&LPUART_FIFO_RXUF_MASK)
+#define LPUART_FIFO_TXOF_MASK 0x20000u
+#define LPUART_FIFO_TXOF_SHIFT 17u
+#define LPUART_FIFO_TXOF_WIDTH 1u
+#define LPUART_FIFO_TXOF(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_TXOF_SHIFT))&LPUART_FIFO_TXOF_MASK)
+#define LPUART_FIFO_RXEMPT_MASK 0x400000u
+#define LPUART_FIFO_RXEMPT_SHIFT 22u
+#define LPUART_FIFO_RXEMPT_WIDTH 1u
+#define LPUART_FIFO_RXEMPT(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_RXEMPT_SHIFT))&LPUART_FIFO_RXEMPT_MASK)
+#define LPUART_FIFO_TXEMPT_MASK 0x800000u
+#define LPUART_FIFO_TXEMPT_SHIFT 23u
+#define LPUART_FIFO_TXEMPT_WIDTH 1u
+#define LPUART_FIFO_TXEMPT(x) (((uint32_t)(((uint32_t)(x))<<LPUART_FIFO_TXEMPT_SHIFT))&LPUART_FIFO_TXEMPT_MASK)
+#define LPUART_WATER_TXWATER_MASK 0x3u
+#define LPUART_WATER_TXWATER_SHIFT 0u
+#define LPUART_WATER_TXWATER_WIDTH 2u
+#define LPUART_WATER_TXWATER(x) (((uint32_t)(((uint32_t)(x))<<LPUART_WATER_TXWATER_SHIFT))&LPUART_WATER_TXWATER_MASK)
+#define LPUART_WATER_TXCOUNT_MASK 0x700u
+#define LPUART_WATER_TXCOUNT_SHIFT 8u
+#define LPUART_WATER_TXCOUNT_WIDTH 3u
+#define LPUART_WATER_TXCOUNT(x) (((uint32_t)(((uint32_t)(x))<<LPUART_WATER_TXCOUNT_SHIFT))&LPUART_WATER_TXCOUNT_MASK)
+#define LPUART_WATER_RXWATER_MASK 0x30000u
+#define LPUART_WATER_RXWATER_SHIFT 16u
+#define LPUART_WATER_RXWATER_WIDTH 2u
+#define LPUART_WATER_RXWATER(x) (((uint32_t)(((uint32_t)(x))<<LPUART_WATER_RXWATER_SHIFT))&LPUART_WATER_RXWATER_MASK)
+#define LPUART_WATER_RXCOUNT_MASK 0x7000000u
+#define LPUART_WATER_RXCOUNT_SHIFT 24u
+#define LPUART_WATER_RXCOUNT_WIDTH 3u
+#define LPUART_WATER_RXCOUNT(x) (((uint32_t)(((uint32_t)(x))<<LPUART_WATER_RXCOUNT_SHIFT))&LPUART_WATER_RXCOUNT_MASK)
+#define LPUART_GLOBAL_RST_MASK 0x2u
+#define LPUART_GLOBAL_RST_SHIFT 1u
+#define LPUART_GLOBAL_RST_WIDTH 1u
+#define LPUART_GLOBAL_RST(x) (((uint32_t)(((uint32_t)(x))<<LPUART_GLOBAL_RST_SHIFT))&LPUART_GLOBAL_RST_MASK)
+#define LPUART_MODIR_TXCTSE_MASK 0x1u
+#define LPUART_MODIR_TXCTSE_SHIFT 0u
+#define LPUART_MODIR_TXCTSE_WIDTH 1u
+#define LPUART_MODIR_TXCTSE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_MODIR_TXCTSE_SHIFT))&LPUART_MODIR_TXCTSE_MASK)
+#define LPUART_MODIR_TXRTSE_MASK 0x2u
+#define LPUART_MODIR_TXRTSE_SHIFT 1u
+#define LPUART_MODIR_TXRTSE_WIDTH 1u
+#define LPUART_MODIR_TXRTSE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_MODIR_TXRTSE_SHIFT))&LPUART_MODIR_TXRTSE_MASK)
+#define LPUART_MODIR_RXRTSE_MASK 0x8u
+#define LPUART_MODIR_RXRTSE_SHIFT 3u
+#define LPUART_MODIR_RXRTSE_WIDTH 1u
+#define LPUART_MODIR_RXRTSE(x) (((uint32_t)(((uint32_t)(x))<<LPUART_MODIR_RXRTSE_SHIFT))&LPUART_MODIR_RXRTSE_MASK)
+#define LPUART_MODIR_TNP_MASK 0x30000u
+#define LPUART_MODIR_TNP_SHIFT 16u
+#define LPUART_MODIR_TNP_WIDTH 2u
+#define LPUART_MODIR_TNP(x) (((uint32_t)(((uint32_t)(x))<<LPUART_MODIR_TNP_SHIFT))&LPUART_MODIR_TNP_MASK)
+#define LPUART_MODIR_IREN_MASK 0x40000u
+#define LPUART_MODIR_IREN_SHIFT 18u
+#define LPUART_MODIR_IREN_WIDTH 1u
+#define LPUART_MODIR_IREN(x) (((uint32_t)(((uint32_t)(x))<<LPUART_MODIR_IREN_SHIFT))&LPUART_MODIR_IREN_MASK)
+#define PCC_PCCn_PCD_MASK 0x7u
+#define PCC_PCCn_PCD_SHIFT 0u
+#define PCC_PCCn_PCD_WIDTH 3u
+#define PCC_PCCn_PCD(x) (((uint32_t)(((uint32_t)(x))<<PCC_PCCn_PCD_SHIFT))&PCC_PCCn_PCD_MASK)
+#define PCC_PCCn_FRAC_MASK 0x8u
+#define PCC_PCCn_FRAC_SHIFT 3u
+#define PCC_PCCn_FRAC_WIDTH 1u
+#define PCC_PCCn_FRAC(x) (((uint32_t)(((uint32_t)(x))<<PCC_PCCn_FRAC_SHIFT))&PCC_PCCn_FRAC_MASK)
+#define PCC_PCCn_PCS_MASK 0x7000000u
+#define PCC_PCCn_PCS_SHIFT 24u
+#define PCC_PCCn_PCS_WIDTH 3u
+#define PCC_PCCn_PCS(x) (((uint32_t)(((uint32_t)(x))<<PCC_PCCn_PCS_SHIFT))&PCC_PCCn_PCS_MASK)
+#define PCC_PCCn_CGC_MASK 0x40000000u
+#define PCC_PCCn_CGC_SHIFT 30u
+#define PCC_PCCn_CGC_WIDTH 1u
+#define PCC_PCCn_CGC(x) (((uint32_t)(((uint32_t)(x))<<PCC_PCCn_CGC_SHIFT))&PCC_PCCn_CGC_MASK)
+#define PCC_PCCn_PR_MASK 0x80000000u
+#define PCC_PCCn_PR_SHIFT 31u
+#define PCC_PCCn_PR_WIDTH 1u
+#define PCC_PCCn_PR(x) (((uint32_t)(((uint32_t)(x))<<PCC_PCCn_PR_SHIFT))&PCC_PCCn_PR_MASK)
+#define SCG_SOSCCSR_SOSCEN_MASK 0x1u
+#define SCG_SOSCCSR_SOSCEN_SHIFT 0u
+#define SCG_SOSCCSR_SOSCEN_WIDTH 1u
+#define SCG_SOSCCSR_SOSCEN(x) (((uint32_t)(((uint32_t)(x))<<SCG_SOSCCSR_SOSCEN_SHIFT))&SCG_SOSCCSR_SOSCEN_MASK)
+#define SCG_SOSCCSR_SOSCCM_MASK 0x10000u
+#define SCG_SOSCCSR_SOSCCM_SHIFT 16u
+#define SCG_SOSCCSR_SOSCCM_WIDTH 1u
+#define SCG_SOSCCSR_SOSCCM(x) (((uint32_t)(((uint32_t)(x))<<SCG_SOSCCSR_SOSCCM_SHIFT))&SCG_SOSCCSR_SOSCCM_MASK)
+#define SCG_SOSCCSR_LK_MASK 0x800000u
+#define SCG_SOSCCSR_LK_SHIFT 23u
+#define SCG_SOSCCSR_LK_WIDTH 1u
+#define SCG_SOSCCSR_LK(x) (((uint32_t)(((uint32_t)(x))<<SCG_SOSCCSR_LK_SHIFT))&SCG_SOSCCSR_LK_MASK)
+#define SCG_SOSCCSR_SOSCVLD_MASK 0x1000000u
+#define SCG_SOSCCSR_SOSCVLD_SHIFT 24u
+#define SCG_SOSCCSR_SOSCVLD_WIDTH 1u
+#define SCG_SOSCCSR_SOSCVLD(x) (((uint32_t)(((uint32_t)(x))<<SCG_SOSCCSR_SOSCVLD_SHIFT))&SCG_SOSCCSR_SOSCVLD_MASK)
+#define SCG_SOSCCSR_SOSCSEL_MASK 0x2000000u
+#define SCG_SOSCCSR_SOSCSEL_SHIFT 25u
+#define SCG_SOSCCSR_SOSCSEL_WIDTH 1u
+#define SCG_SOSCCSR_SOSCSEL(x) (((uint32_t)(((uint32_t)(x))<<SCG_SOSCCSR_SOSCSEL_SHIFT))&SCG_SOSCCSR_SOSCSEL_MASK)
+#define SCG_SIRCCSR_SIRCEN_MASK 0x1u
+#define SCG_SIRCCSR_SIRCEN_SHIFT 0u
+#define SCG_SIRCCSR_SIRCEN_WIDTH 1u
+#define SCG_SIRCCSR_SIRCEN(x) (((uint32_t)(((uint32_t)(x))<<SCG_SIRCCSR_SIRCEN_SHIFT))&SCG_SIRCCSR_SIRCEN_MASK)
+#define SCG_SIRCCSR_SIRCSTEN_MASK 0x2u
+#define SCG_SIRCCSR_SIRCSTEN_SHIFT 1u
+#define SCG_SIRCCSR_SIRCSTEN_WIDTH 1u
+#define SCG_SIRCCSR_SIRCSTEN(x) (((uint32_t)(((uint32_t)(x))<<SCG_SIRCCSR_SIRCSTEN_SHIFT))&SCG_SIRCCSR_SIRCSTEN_MASK)
+#define SCG_SIRCCSR_SIRCLPEN_MASK 0x4u
+#define SCG_SIRCCSR_SIRCLPEN_SHIFT 2u
+#define SCG_SIRCCSR_SIRCLPEN_WIDTH 1u
+#define SCG_SIRCCSR_SIRCLPEN(x) (((uint32_t)(((uint32_t)(x))<<SCG_SIRCCSR_SIRCLPEN_SHIFT))&SCG_SIRCCSR_SIRCLPEN_MASK)
+#define SCG_SIRCCSR_LK_MASK 0x800000u
+#define SCG_SIRCCSR_LK_SHIFT 23u
+#define SCG_SIRCCSR_LK_WIDTH 1u
+#define SCG_SIRCCSR_LK(x) (((uint32_t)(((uint32_t)(x))<<SCG_SIRCCSR_LK_SHIFT))&SCG_SIRCCSR_LK_MASK)
+#define SCG_SIRCCSR_SIRCVLD_MASK 0x1000000u
+#define SCG_SIRCCSR_SIRCVLD_SHIFT 24u
+#define SCG_SIRCCSR_SIRCVLD_WIDTH 1u
+#define SCG_SIRCCSR_SIRCVLD(x) (((uint32_t)(((uint32_t)(x))<<SCG_SIRCCSR_SIRCVLD_SHIFT))&SCG_SIRCCSR_SIRCVLD_MASK)
+#define SCG_SIRCCSR_SIRCSEL_MASK 0x2000000u
+#define SCG_SIRCCSR_SIRCSEL_SHIFT 25u
+#define SCG_SIRCCSR_SIRCSEL_WIDTH 1u
+#define SCG_SIRCCSR_SIRCSEL(x) (((uint32_t)(((uint32_t)(x))<<SCG_SIRCCSR_SIRCSEL_SHIFT))&SCG_SIRCCSR_SIRCSEL_MASK)
+#define SCG_FIRCCSR_FIRCEN_MASK 0x1u
+#define SCG_FIRCCSR_FIRCEN_SHIFT 0u
+#define SCG_FIRCCSR_FIRCEN_WIDTH 1u
+#define SCG_FIRCCSR_FIRCEN(x) (((uint32_t)(((uint32_t)(x))<<SCG_FIRCCSR_FIRCEN_SHIFT))&SCG_FIRCCSR_FIRCEN_MASK)
+#define SCG_FIRCCSR_LK_MASK 0x800000u
+#define SCG_FIRCCSR_LK_SHIFT 23u
+#define SCG_FIRCCSR_LK_WIDTH 1u
+#define SCG_FIRCCSR_LK(x) (((uint32_t)(((uint32_t)(x))<<SCG_FIRCCSR_LK_SHIFT))&SCG_FIRCCSR_LK_MASK)
+#define SCG_FIRCCSR_FIRCVLD_MASK 0x1000000u
+#define SCG_FIRCCSR_FIRCVLD_SHIFT 24u
+#define SCG_FIRCCSR_FIRCVLD_WIDTH 1u
+#define SCG_FIRCCSR_FIRCVLD(x) (((uint32_t)(((uint32_t)(x))<<SCG_FIRCCSR_FIRCVLD_SHIFT))&SCG_FIRCCSR_FIRCVLD_MASK)
+#define SCG_FIRCCSR_FIRCSEL_MASK 0x2000000u
+#define SCG_FIRCCSR_FIRCSEL_SHIFT 25u
+#define SCG_FIRCCSR_FIRCSEL_WIDTH 1u
+#define SCG_FIRCCSR_FIRCSEL(x) (((uint32_t)(((uint32_t)(x))<<SCG_FIRCCSR_FIRCSEL_SHIFT))&SCG_FIRCCSR_FIRCSEL_MASK)
+#define SCG_SPLLCSR_SPLLEN_MASK 0x1u
+#define SCG_SPLLCSR_SPLLEN_SHIFT 0u
+#define SCG_SPLLCSR_SPLLEN_WIDTH 1u
+#define SCG_SPLLCSR_SPLLEN(x) (((uint32_t)(((uint32_t)(x))<<SCG_SPLLCSR_SPLLEN_SHIFT))&SCG_SPLLCSR_SPLLEN_MASK)
+#define SCG_SPLLCSR_LK_MASK 0x800000u
+#define SCG_SPLLCSR_LK_SHIFT 23u
+#define SCG_SPLLCSR_LK_WIDTH 1u
+#define SCG_SPLLCSR_LK(x) (((uint32_t)(((uint32_t)(x))<<SCG_SPLLCSR_LK_SHIFT))&SCG_SPLLCSR_LK_MASK)
+#define SCG_SPLLCSR_SPLLVLD_MASK 0x1000000u
+#define SCG_SPLLCSR_SPLLVLD_SHIFT 24u
+#define SCG_SPLLCSR_SPLLVLD_WIDTH 1u
+#define SCG_SPLLCSR_SPLLVLD(x) (((uint32_t)(((uint32_t)(x))<<SCG_SPLLCSR_SPLLVLD_SHIFT))&SCG_SPLLCSR_SPLLVLD_MASK)
+#define SCG_SPLLCSR_SPLLSEL_MASK 0x2000000u
+#define SCG_SPLLCSR_SPLLSEL_SHIFT 25u
+#define SCG_SPLLCSR_SPLLSEL_WIDTH 1u
+#define SCG_SPLLCSR_SPLLSEL(x) (((uint32_t)(((uint32_t)(x))<<SCG_SPLLCSR_SPLLSEL_SHIFT))&SCG_SPLLCSR_SPLLSEL_MASK)
+#define SCG_SOSCCFG_EREFS_MASK 0x4u
+#define SCG_SOSCCFG_EREFS_SHIFT 2u
+#define SCG_SOSCCFG_EREFS_WIDTH 1u
+#define SCG_SOSCCFG_EREFS(x) (((uint32_t)(((uint32_t)(x))<<SCG_SOSCCFG_EREFS_SHIFT))&SCG_SOSCCFG_EREFS_MASK)
+#define SCG_SOSCCFG_HGO_MASK 0x8u
+#define SCG_SOSCCFG_HGO_SHIFT 3u
+#define SCG_SOSCCFG_HGO_WIDTH 1u
+#define SCG_SOSCCFG_HGO(x) (((uint32_t)(((uint32_t)(x))<<SCG_SOSCCFG_HGO_SHIFT))&SCG_SOSCCFG_HGO_MASK)
+#define SCG_SOSCCFG_RANGE_MASK 0x30u
+#define SCG_SOSCCFG_RANGE_SHIFT 4u
+#define SCG_SOSCCFG_RANGE_WIDTH 2u
+#define SCG_SOSCCFG_RANGE(x) (((uint32_t)(((uint32_t)(x))<<SCG_SOSCCFG_RANGE_SHIFT))&SCG_SOSCCFG_RANGE_MASK)
+#define SCG_SIRCDIV_SIRCDIV1_MASK 0x7u
+#define SCG_SIRCDIV_SIRCDIV1_SHIFT 0u
+#define SCG_SIRCDIV_SIRCDIV1_WIDTH 3u
+#define SCG_SIRCDIV_SIRCDIV1(x) (((uint32_t)(((uint32_t)(x))<<SCG_SIRCDIV_SIRCDIV1_SHIFT))&SCG_SIRCDIV_SIRCDIV1_MASK)
+#define SCG_SIRCDIV_SIRCDIV2_MASK 0x700u
+#define SCG_SIRCDIV_SIRCDIV2_SHIFT 8u
+#define SCG_SIRCDIV_SIRCDIV2_WIDTH 3u
+#define SCG_SIRCDIV_SIRCDIV2(x) (((uint32_t)(((uint32_t)(x))<<SCG_SIRCDIV_SIRCDIV2_SHIFT))&SCG_SIRCDIV_SIRCDIV2_MASK)
+#define SCG_FIRCDIV_FIRCDIV1_MASK 0x7u
+#define SCG_FIRCDIV_FIRCDIV1_SHIFT 0u
+#define SCG_FIRCDIV_FIRCDIV1_WIDTH 3u
+#define SCG_FIRCDIV_FIRCDIV1(x) (((uint32_t)(((uint32_t)(x))<<SCG_FIRCDIV_FIRCDIV1_SHIFT))&SCG_FIRCDIV_FIRCDIV1_MASK)
+#define SCG_FIRCDIV_FIRCDIV2_MASK 0x700u
+#define SCG_FIRCDIV_FIRCDIV2_SHIFT 8u
+#define SCG_FIRCDIV_FIRCDIV2_WIDTH 3u
+#define SCG_FIRCDIV_FIRCDIV2(x) (((uint32_t)(((uint32_t)(x))<<SCG_FIRCDIV_FIRCDIV2_SHIFT))&SCG_FIRCDIV_FIRCDIV2_MASK)
+#define SCG_SIRCCFG_RANGE_MASK 0x1u
+#define SCG_SIRCCFG_RANGE_SHIFT 0u
+#define SCG_SIRCCFG_RANGE_WIDTH 1u
+#define SCG_SIRCCFG_RANGE(x) (((uint32_t)(((uint32_t)(x))<<SCG_SIRCCFG_RANGE_SHIFT))&SCG_SIRCCFG_RANGE_MASK)
+#define SCG_CSR_DIVSLOW_MASK 0xFu
+#define SCG_CSR_DIVSLOW_SHIFT 0u
+#define SCG_CSR_DIVSLOW_WIDTH 4u
+#define SCG_CSR_DIVSLOW(x) (((uint32_t)(((uint32_t)(x))<<SCG_CSR_DIVSLOW_SHIFT))&SCG_CSR_DIVSLOW_MASK)
+#define SCG_CSR_DIVBUS_MASK 0xF0u
+#define SCG_CSR_DIVBUS_SHIFT 4u
+#define SCG_CSR_DIVBUS_WIDTH 4u
+#define SCG_CSR_DIVBUS(x) (((uint32_t)(((uint32_t)(x))<<SCG_CSR_DIVBUS_SHIFT))&SCG_CSR_DIVBUS_MASK)
+#define SCG_CSR_DIVCORE_MASK 0xF0000u
+#define SCG_CSR_DIVCORE_SHIFT 16u
+#define SCG_CSR_DIVCORE_WIDTH 4u
+#define SCG_CSR_DIVCORE(x) (((uint32_t)(((uint32_t)(x))<<SCG_CSR_DIVCORE_SHIFT))&SCG_CSR_DIVCORE_MASK)
+#define SCG_CSR_SCS_MASK 0xF000000u
+#define SCG_CSR_SCS_SHIFT 24u
+#define SCG_CSR_SCS_WIDTH 4u
+#define SCG_CSR_SCS(x) (((uint32_t)(((uint32_t)(x))<<SCG_CSR_SCS_SHIFT))&SCG_CSR_SCS_MASK)
+#define SCG_RCCR_DIVSLOW_MASK 0xFu
+#define SCG_RCCR_DIVSLOW_SHIFT 0u
+#define SCG_RCCR_DIVSLOW_WIDTH 4u
+#define SCG_RCCR_DIVSLOW(x) (((uint32_t)(((uint32_t)(x))<<SCG_RCCR_DIVSLOW_SHIFT))&SCG_RCCR_DIVSLOW_MASK)
+#define SCG_RCCR_DIVBUS_MASK 0xF0u
+#define SCG_RCCR_DIVBUS_SHIFT 4u
+#define SCG_RCCR_DIVBUS_WIDTH 4u
+#define SCG_RCCR_DIVBUS(x) (((uint32_t)(((uint32_t)(x))<<SCG_RCCR_DIVBUS_SHIFT))&SCG_RCCR_DIVBUS_MASK)
+#define SCG_RCCR_DIVCORE_MASK 0xF0000u
+#define SCG_RCCR_DIVCORE_SHIFT 16u
+#define SCG_RCCR_DIVCORE_WIDTH 4u
+#define SCG_RCCR_DIVCORE(x) (((uint32_t)(((uint32_t)(x))<<SCG_RCCR_DIVCORE_SHIFT))&SCG_RCCR_DIVCORE_MASK)
+#define SCG_RCCR_SCS_MASK 0xF000000u
+#define SCG_RCCR_SCS_SHIFT 24u
+#define SCG_RCCR_SCS_WIDTH 4u
+#define SCG_RCCR_SCS(x) (((uint32_t)(((uint32_t)(x))<<SCG_RCCR_SCS_SHIFT))&SCG_RCCR_SCS_MASK)
+#define SCG_VCCR_DIVSLOW_MASK 0xFu
+#define SCG_VCCR_DIVSLOW_SHIFT 0u
+#define SCG_VCCR_DIVSLOW_WIDTH 4u
+#define SCG_VCCR_DIVSLOW(x) (((uint32_t)(((uint32_t)(x))<<SCG_VCCR_DIVSLOW_SHIFT))&SCG_VCCR_DIVSLOW_MASK)
+#define SCG_VCCR_DIVBUS_MASK 0xF0u
+#define SCG_VCCR_DIVBUS_SHIFT 4u
+#define SCG_VCCR_DIVBUS_WIDTH 4u
+#define SCG_VCCR_DIVBUS(x) (((uint32_t)(((uint32_t)(x))<<SCG_VCCR_DIVBUS_SHIFT))&SCG_VCCR_DIVBUS_MASK)
+#define SCG_VCCR_DIVCORE_MASK 0xF0000u
+#define SCG_VCCR_DIVCORE_SHIFT 16u
+#define SCG_VCCR_DIVCORE_WIDTH 4u
+#define SCG_VCCR_DIVCORE(x) (((uint32_t)(((uint32_t)(x))<<SCG_VCCR_DIVCORE_SHIFT))&SCG_VCCR_DIVCORE_MASK)
+#define SCG_VCCR_SCS_MASK 0xF000000u
+#define SCG_VCCR_SCS_SHIFT 24u
+#define SCG_VCCR_SCS_WIDTH 4u
+#define SCG_VCCR_SCS(x) (((uint32_t)(((uint32_t)(x))<<SCG_VCCR_SCS_SHIFT))&SCG_VCCR_SCS_MASK)
+#define PORT_PCR_PS_MASK 0x1u
+#define PORT_PCR_PS_SHIFT 0u
+#define PORT_PCR_PS_WIDTH 1u
+#define PORT_PCR_PS(x) (((uint32_t)(((uint32_t)(x))<<PORT_PCR_PS_SHIFT))&PORT_PCR_PS_MASK)
+#define PORT_PCR_PE_MASK 0x2u
+#define PORT_PCR_PE_SHIFT 1u
+#define PORT_PCR_PE_WIDTH 1u
+#define PORT_PCR_PE(x) (((uint32_t)(((uint32_t)(x))<<PORT_PCR_PE_SHIFT))&PORT_PCR_PE_MASK)
+#define PORT_PCR_PFE_MASK 0x10u
+#define PORT_PCR_PFE_SHIFT 4u
+#define PORT_PCR_PFE_WIDTH 1u
+#define PORT_PCR_PFE(x) (((uint32_t)(((uint32_t)(x))<<PORT_PCR_PFE_SHIFT))&PORT_PCR_PFE_MASK)
+#define PORT_PCR_DSE_MASK 0x40u
+#define PORT_PCR_DSE_SHIFT 6u
+#define PORT_PCR_DSE_WIDTH 1u
+#define PORT_PCR_DSE(x) (((uint32_t)(((uint32_t)(x))<<PORT_PCR_DSE_SHIFT))&PORT_PCR_DSE_MASK)
+#define PORT_PCR_MUX_MASK 0x700u
+#define PORT_PCR_MUX_SHIFT 8u
+#define PORT_PCR_MUX_WIDTH 3u
+#define PORT_PCR_MUX(x) (((uint32_t)(((uint32_t)(x))<<PORT_PCR_MUX_SHIFT))&PORT_PCR_MUX_MASK)
+#define PORT_PCR_LK_MASK 0x8000u
+#define PORT_PCR_LK_SHIFT 15u
+#define PORT_PCR_LK_WIDTH 1u
+#define PORT_PCR_LK(x) (((uint32_t)(((uint32_t)(x))<<PORT_PCR_LK_SHIFT))&PORT_PCR_LK_MASK)
+#define PORT_PCR_IRQC_MASK 0xF0000u
+#define PORT_PCR_IRQC_SHIFT 16u
+#define PORT_PCR_IRQC_WIDTH 4u
+#define PORT_PCR_IRQC(x) (((uint32_t)(((uint32_t)(x))<<PORT_PCR_IRQC_SHIFT))&PORT_PCR_IRQC_MASK)
+#define PORT_PCR_ISF_MASK 0x1000000u
+#define PORT_PCR_ISF_SHIFT 24u
+#define PORT_PCR_ISF_WIDTH 1u
+#define PORT_PCR_ISF(x) (((uint32_t)(((uint32_t)(x))<<PORT_PCR_ISF_SHIFT))&PORT_PCR_ISF_MASK)
+#define CRC_CTRL_TCRC_MASK 0x1000000u
+#define CRC_CTRL_TCRC_SHIFT 24u
+#define CRC_CTRL_TCRC_WIDTH 1u
+#define CRC_CTRL_TCRC(x) (((uint32_t)(((uint32_t)(x))<<CRC_CTRL_TCRC_SHIFT))&CRC_CTRL_TCRC_MASK)
+#define CRC_CTRL_WAS_MASK 0x2000000u
+#define CRC_CTRL_WAS_SHIFT 25u
+#define CRC_CTRL_WAS_WIDTH 1u
+#define CRC_CTRL_WAS(x) (((uint32_t)(((uint32_t)(x))<<CRC_CTRL_WAS_SHIFT))&CRC_CTRL_WAS_MASK)
+#define CRC_CTRL_FXOR_MASK 0x4000000u
+#define CRC_CTRL_FXOR_SHIFT 26u
+#define CRC_CTRL_FXOR_WIDTH 1u
+#define CRC_CTRL_FXOR(x) (((uint32_t)(((uint32_t)(x))<<CRC_CTRL_FXOR_SHIFT))&CRC_CTRL_FXOR_MASK)
+#define CRC_CTRL_TOTR_MASK 0x30000000u
+#define CRC_CTRL_TOTR_SHIFT 28u
+#define CRC_CTRL_TOTR_WIDTH 2u
+#define CRC_CTRL_TOTR(x) (((uint32_t)(((uint32_t)(x))<<CRC_CTRL_TOTR_SHIFT))&CRC_CTRL_TOTR_MASK)
+#define CRC_CTRL_TOT_MASK 0xC0000000u
+#define CRC_CTRL_TOT_SHIFT 30u
+#define CRC_CTRL_TOT_WIDTH 2u
+#define CRC_CTRL_TOT(x) (((uint32_t)(((uint32_t)(x))<<CRC_CTRL_TOT_SHIFT))&CRC_CTRL_TOT_MASK)
+#define CRC_GPOLY_LOW_MASK 0xFFFFu
+#define CRC_GPOLY_LOW_SHIFT 0u
+#define CRC_GPOLY_LOW_WIDTH 16u
+#define CRC_GPOLY_LOW(x) (((uint32_t)(((uint32_t)(x))<<CRC_GPOLY_LOW_SHIFT))&CRC_GPOLY_LOW_MASK)
+#define CRC_GPOLY_HIGH_MASK 0xFFFF0000u
+#define CRC_GPOLY_HIGH_SHIFT 16u
+#define CRC_GPOLY_HIGH_WIDTH 16u
+#define CRC_GPOLY_HIGH(x) (((uint32_t)(((uint32_t)(x))<<CRC_GPOLY_HIGH_SHIFT))&CRC_GPOLY_HIGH_MASK)
+#define LPIT_MCR_M_CEN_MASK 0x1u
+#define LPIT_MCR_M_CEN_SHIFT 0u
+#define LPIT_MCR_M_CEN_WIDTH 1u
+#define LPIT_MCR_M_CEN(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MCR_M_CEN_SHIFT))&LPIT_MCR_M_CEN_MASK)
+#define LPIT_MCR_SW_RST_MASK 0x2u
+#define LPIT_MCR_SW_RST_SHIFT 1u
+#define LPIT_MCR_SW_RST_WIDTH 1u
+#define LPIT_MCR_SW_RST(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MCR_SW_RST_SHIFT))&LPIT_MCR_SW_RST_MASK)
+#define LPIT_MCR_DOZE_EN_MASK 0x4u
+#define LPIT_MCR_DOZE_EN_SHIFT 2u
+#define LPIT_MCR_DOZE_EN_WIDTH 1u
+#define LPIT_MCR_DOZE_EN(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MCR_DOZE_EN_SHIFT))&LPIT_MCR_DOZE_EN_MASK)
+#define LPIT_MCR_DBG_EN_MASK 0x8u
+#define LPIT_MCR_DBG_EN_SHIFT 3u
+#define LPIT_MCR_DBG_EN_WIDTH 1u
+#define LPIT_MCR_DBG_EN(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MCR_DBG_EN_SHIFT))&LPIT_MCR_DBG_EN_MASK)
+#define LPIT_MIER_TIE0_MASK 0x1u
+#define LPIT_MIER_TIE0_SHIFT 0u
+#define LPIT_MIER_TIE0_WIDTH 1u
+#define LPIT_MIER_TIE0(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MIER_TIE0_SHIFT))&LPIT_MIER_TIE0_MASK)
+#define LPIT_MIER_TIE1_MASK 0x2u
+#define LPIT_MIER_TIE1_SHIFT 1u
+#define LPIT_MIER_TIE1_WIDTH 1u
+#define LPIT_MIER_TIE1(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MIER_TIE1_SHIFT))&LPIT_MIER_TIE1_MASK)
+#define LPIT_MIER_TIE2_MASK 0x4u
+#define LPIT_MIER_TIE2_SHIFT 2u
+#define LPIT_MIER_TIE2_WIDTH 1u
+#define LPIT_MIER_TIE2(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MIER_TIE2_SHIFT))&LPIT_MIER_TIE2_MASK)
+#define LPIT_MIER_TIE3_MASK 0x8u
+#define LPIT_MIER_TIE3_SHIFT 3u
+#define LPIT_MIER_TIE3_WIDTH 1u
+#define LPIT_MIER_TIE3(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MIER_TIE3_SHIFT))&LPIT_MIER_TIE3_MASK)
+#define LPIT_MSR_TIF0_MASK 0x1u
+#define LPIT_MSR_TIF0_SHIFT 0u
+#define LPIT_MSR_TIF0_WIDTH 1u
+#define LPIT_MSR_TIF0(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MSR_TIF0_SHIFT))&LPIT_MSR_TIF0_MASK)
+#define LPIT_MSR_TIF1_MASK 0x2u
+#define LPIT_MSR_TIF1_SHIFT 1u
+#define LPIT_MSR_TIF1_WIDTH 1u
+#define LPIT_MSR_TIF1(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MSR_TIF1_SHIFT))&LPIT_MSR_TIF1_MASK)
+#define LPIT_MSR_TIF2_MASK 0x4u
+#define LPIT_MSR_TIF2_SHIFT 2u
+#define LPIT_MSR_TIF2_WIDTH 1u
+#define LPIT_MSR_TIF2(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MSR_TIF2_SHIFT))&LPIT_MSR_TIF2_MASK)
+#define LPIT_MSR_TIF3_MASK 0x8u
+#define LPIT_MSR_TIF3_SHIFT 3u
+#define LPIT_MSR_TIF3_WIDTH 1u
+#define LPIT_MSR_TIF3(x) (((uint32_t)(((uint32_t)(x))<<LPIT_MSR_TIF3_SHIFT))&LPIT_MSR_TIF3_MASK)
+#define LPIT_TMR_TCTRL_T_EN_MASK 0x1u
+#define LPIT_TMR_TCTRL_T_EN_SHIFT 0u
+#define LPIT_TMR_TCTRL_T_EN_WIDTH 1u
+#define LPIT_TMR_TCTRL_T_EN(x) (((uint32_t)(((uint32_t)(x))<<LPIT_TMR_TCTRL_T_EN_SHIFT))&LPIT_TMR_TCTRL_T_EN_MASK)
+#define LPIT_TMR_TCTRL_CHAIN_MASK 0x2u
+#define LPIT_TMR_TCTRL_CHAIN_SHIFT 1u
+#define LPIT_TMR_TCTRL_CHAIN_WIDTH 1u
+#define LPIT_TMR_TCTRL_CHAIN(x) (((uint32_t)(((uint32_t)(x))<<LPIT_TMR_TCTRL_CHAIN_SHIFT))&LPIT_TMR_TCTRL_CHAIN_MASK)
+#define LPIT_TMR_TCTRL_MODE_MASK 0xCu
+#define LPIT_TMR_TCTRL_MODE_SHIFT 2u
+#define LPIT_TMR_TCTRL_MODE_WIDTH 2u
+#define LPIT_TMR_TCTRL_MODE(x) (((uint32_t)(((uint32_t)(x))<<LPIT_TMR_TCTRL_MODE_SHIFT))&LPIT_TMR_TCTRL_MODE_MASK)
+#define LPIT_TMR_TCTRL_TSOT_MASK 0x10000u
+#define LPIT_TMR_TCTRL_TSOT_SHIFT 16u
+#define LPIT_TMR_TCTRL_TSOT_WIDTH 1u
+#define LPIT_TMR_TCTRL_TSOT(x) (((uint32_t)(((uint32_t)(x))<<LPIT_TMR_TCTRL_TSOT_SHIFT))&LPIT_TMR_TCTRL_TSOT_MASK)
+#define LPIT_TMR_TCTRL_TSOI_MASK 0x20000u
+#define LPIT_TMR_TCTRL_TSOI_SHIFT 17u
+#define LPIT_TMR_TCTRL_TSOI_WIDTH 1u
+#define LPIT_TMR_TCTRL_TSOI(x) (((uint32_t)(((uint32_t)(x))<<LPIT_TMR_TCTRL_TSOI_SHIFT))&LPIT_TMR_TCTRL_TSOI_MASK)
+#define LPIT_TMR_TCTRL_TROT_MASK 0x40000u
+#define LPIT_TMR_TCTRL_TROT_SHIFT 18u
+#define LPIT_TMR_TCTRL_TROT_WIDTH 1u
+#define LPIT_TMR_TCTRL_TROT(x) (((uint32_t)(((uint32_t)(x))<<LPIT_TMR_TCTRL_TROT_SHIFT))&LPIT_TMR_TCTRL_TROT_MASK)
+#define LPIT_TMR_TCTRL_TRG_SRC_MASK 0x800000u
+#define LPIT_TMR_TCTRL_TRG_SRC_SHIFT 23u
+#define LPIT_TMR_TCTRL_TRG_SRC_WIDTH 1u
+#define LPIT_TMR_TCTRL_TRG_SRC(x) (((uint32_t)(((uint32_t)(x))<<LPIT_TMR_TCTRL_TRG_SRC_SHIFT))&LPIT_TMR_TCTRL_TRG_SRC_MASK)
+#define LPIT_TMR_TCTRL_TRG_SEL_MASK 0xF000000u
+#define LPIT_TMR_TCTRL_TRG_SEL_SHIFT 24u
+#define LPIT_TMR_TCTRL_TRG_SEL_WIDTH 4u
+#define LPIT_TMR_TCTRL_TRG_SEL(x) (((uint32_t)(((uint32_t)(x))<<LPIT_TMR_TCTRL_TRG_SEL_SHIFT))&LPIT_TMR_TCTRL_TRG_SEL_MASK)
+#define SMC_PMPROT_AVLP_MASK 0x20u
+#define SMC_PMPROT_AVLP_SHIFT 5u
+#define SMC_PMPROT_AVLP_WIDTH 1u
+#define SMC_PMPROT_AVLP(x) (((uint32_t)(((uint32_t)(x))<<SMC_PMPROT_AVLP_SHIFT))&SMC_PMPROT_AVLP_MASK)
+#define SMC_PMCTRL_STOPM_MASK 0x7u
+#define SMC_PMCTRL_STOPM_SHIFT 0u
+#define SMC_PMCTRL_STOPM_WIDTH 3u
+#define SMC_PMCTRL_STOPM(x) (((uint32_t)(((uint32_t)(x))<<SMC_PMCTRL_STOPM_SHIFT))&SMC_PMCTRL_STOPM_MASK)
+#define SMC_PMCTRL_VLPSA_MASK 0x8u
+#define SMC_PMCTRL_VLPSA_SHIFT 3u
+#define SMC_PMCTRL_VLPSA_WIDTH 1u
+#define SMC_PMCTRL_VLPSA(x) (((uint32_t)(((uint32_t)(x))<<SMC_PMCTRL_VLPSA_SHIFT))&SMC_PMCTRL_VLPSA_MASK)
+#define SMC_PMCTRL_RUNM_MASK 0x60u
+#define SMC_PMCTRL_RUNM_SHIFT 5u
+#define SMC_PMCTRL_RUNM_WIDTH 2u
+#define SMC_PMCTRL_RUNM(x) (((uint32_t)(((uint32_t)(x))<<SMC_PMCTRL_RUNM_SHIFT))&SMC_PMCTRL_RUNM_MASK)
+#define SMC_PMSTAT_PMSTAT_MASK 0xFFu
+#define SMC_PMSTAT_PMSTAT_SHIFT 0u
+#define SMC_PMSTAT_PMSTAT_WIDTH 8u
+#define SMC_PMSTAT_PMSTAT(x) (((uint32_t)(((uint32_t)(x))<<SMC_PMSTAT_PMSTAT_SHIFT))&SMC_PMSTAT_PMSTAT_MASK)
+#define S32_SCB_SCR_SLEEPONEXIT_MASK 0x2u
+#define S32_SCB_SCR_SLEEPONEXIT_SHIFT 1u
+#define S32_SCB_SCR_SLEEPONEXIT_WIDTH 1u
+#define S32_SCB_SCR_SLEEPONEXIT(x) (((uint32_t)(((uint32_t)(x))<<S32_SCB_SCR_SLEEPONEXIT_SHIFT))&S32_SCB_SCR_SLEEPONEXIT_MASK)
+#define S32_SCB_SCR_SLEEPDEEP_MASK 0x4u
+#define S32_SCB_SCR_SLEEPDEEP_SHIFT 2u
+#define S32_SCB_SCR_SLEEPDEEP_WIDTH 1u
+#define S32_SCB_SCR_SLEEPDEEP(x) (((uint32_t)(((uint32_t)(x))<<S32_SCB_SCR_SLEEPDEEP_SHIFT))&S32_SCB_SCR_SLEEPDEEP_MASK)
+#define S32_SysTick_CSR_ENABLE_MASK 0x1u
+#define S32_SysTick_CSR_ENABLE_SHIFT 0u
+#define S32_SysTick_CSR_ENABLE_WIDTH 1u
+#define S32_SysTick_CSR_ENABLE(x) (((uint32_t)(((uint32_t)(x))<<S32_SysTick_CSR_ENABLE_SHIFT))&S32_SysTick_CSR_ENABLE_MASK)
+#define S32_SysTick_CSR_TICKINT_MASK 0x2u
+#define S32_SysTick_CSR_TICKINT_SHIFT 1u
+#define S32_SysTick_CSR_TICKINT_WIDTH 1u
+#define S32_SysTick_CSR_TICKINT(x) (((uint32_t)(((uint32_t)(x))<<S32_SysTick_CSR_TICKINT_SHIFT))&S32_SysTick_CSR_TICKINT_MASK)
+#define S32_SysTick_CSR_CLKSOURCE_MASK 0x4u
+#define S32_SysTick_CSR_CLKSOURCE_SHIFT 2u
+#define S32_SysTick_CSR_CLKSOURCE_WIDTH 1u
+#define S32_SysTick_CSR_CLKSOURCE(x) (((uint32_t)(((uint32_t)(x))<<S32_SysTick_CSR_CLKSOURCE_SHIFT))&S32_SysTick_CSR_CLKSOURCE_MASK)
+#define S32_SysTick_CSR_COUNTFLAG_MASK 0x10000u
+#define S32_SysTick_CSR_COUNTFLAG_SHIFT 16u
+#define S32_SysTick_CSR_COUNTFLAG_WIDTH 1u
+#define S32_SysTick_CSR_COUNTFLAG(x) (((uint32_t)(((uint32_t)(x))<<S32_SysTick_CSR_COUNTFLAG_SHIFT))&S32_SysTick_CSR_COUNTFLAG_MASK)
+#define S32_SysTick_RVR_RELOAD_MASK 0xFFFFFFu
+#define S32_SysTick_RVR_RELOAD_SHIFT 0u
+#define S32_SysTick_RVR_RELOAD_WIDTH 24u
+#define S32_SysTick_RVR_RELOAD(x) (((uint32_t)(((uint32_t)(x))<<S32_SysTick_RVR_RELOAD_SHIFT))&S32_SysTick_RVR_RELOAD_MASK)
+#define S32_SysTick_CVR_CURRENT_MASK 0xFFFFFFu
+#define S32_SysTick_CVR_CURRENT_SHIFT 0u
+#define S32_SysTick_CVR_CURRENT_WIDTH 24u
+#define S32_SysTick_CVR_CURRENT(x) (((uint32_t)(((uint32_t)(x))<<S32_SysTick_CVR_CURRENT_SHIFT))&S32_SysTick_CVR_CURRENT_MASK)
+
+#endif /* S32K144_H_ */
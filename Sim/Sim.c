@@ -0,0 +1,537 @@
+/**
+ * @file Sim.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the host simulator of the S32K144 used by the tests and the benchmarks
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Sim.h"
+#include "s32k144_pcc_hal.h"
+#include "s32k144_lpuart_hal.h"
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define SIM_LPUART_FIFO_DEPTH   (4U)    /* Entries of the Rx FIFO of an LPUART instance */
+#define SIM_LPIT_CHANNEL_NUM    (4U)    /* Timer channels of the LPIT */
+#define SIM_LPIT_CVAL(channel)  (*(volatile uint32_t *)&sim_lpit.TMR[(channel)].CVAL)  /* Counter, read only */
+#define SIM_CLEAR(peripheral)   (void)memset((void *)&(peripheral), 0, sizeof(peripheral))     /* Zero the registers */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+LPUART_Type sim_lpuart[3];          /* LPUART0 to LPUART2 */
+PCC_Type sim_pcc;                   /* PCC */
+SCG_Type sim_scg;                   /* SCG */
+PORT_Type sim_port[5];              /* PORTA to PORTE */
+GPIO_Type sim_gpio[5];              /* PTA to PTE */
+CRC_Type sim_crc;                   /* CRC */
+LPIT_Type sim_lpit;                 /* LPIT0 */
+SMC_Type sim_smc;                   /* SMC */
+S32_SCB_Type sim_scb;               /* System control block */
+S32_SysTick_Type sim_systick;       /* SysTick */
+S32_NVIC_Type sim_nvic;             /* NVIC */
+
+static Sim_Cycle_Types simCycleMode = SIM_CYCLE_VIRTUAL;    /* Source of cycleCounterSim */
+static uint32_t simCycles;                                  /* Virtual cycles counted */
+static uint64_t simHostStart;                               /* Host time of the restart of the counter */
+static Sim_CycleHook_Types simCycleHook;                    /* Called on each read of the virtual counter */
+
+static uint32_t simLpuartTx[LPUART_INSTANCE_COUNT];        /* Character given to each transmitter */
+static uint8_t simLpuartRxFifo[LPUART_INSTANCE_COUNT][SIM_LPUART_FIFO_DEPTH];  /* Rx FIFO of each instance,
+                                                                                  oldest first */
+
+static const IRQn_Type simLpuartIrqn[LPUART_INSTANCE_COUNT] =
+{
+    LPUART0_RxTx_IRQn, LPUART1_RxTx_IRQn, LPUART2_RxTx_IRQn
+};  /* Interrupt of each LPUART instance */
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to read the cycle counter of the host simulator
+ *
+ * @return uint32_t: cycles counted since the last simCycleModeSet, wrapping like DWT CYCCNT
+ */
+uint32_t cycleCounterSim(void)
+{
+    uint32_t cycles;
+
+    if(SIM_CYCLE_HOST == simCycleMode)
+    {
+        uint64_t ns = simHostNs() - simHostStart;
+        uint64_t cyclesPerUs = clock / 1000000U;
+
+        cycles = (uint32_t)(((ns / 1000U) * cyclesPerUs) + (((ns % 1000U) * cyclesPerUs) / 1000U));
+    }
+    else
+    {
+        simCycles += SIM_CYCLES_PER_READ;
+        cycles = simCycles;
+
+        if(0 != simCycleHook)
+        {
+            simCycleHook(cycles);
+        }
+    }
+
+    return cycles;
+}
+
+/**
+ * @brief This function is used to clear every peripheral and set the reset values the drivers wait on,
+ *        the transmitters are empty and FIRC and SIRC are valid
+ *
+ * @return void
+ */
+void simReset(void)
+{
+    SIM_CLEAR(sim_lpuart);
+    SIM_CLEAR(sim_pcc);
+    SIM_CLEAR(sim_scg);
+    SIM_CLEAR(sim_port);
+    SIM_CLEAR(sim_gpio);
+    SIM_CLEAR(sim_crc);
+    SIM_CLEAR(sim_lpit);
+    SIM_CLEAR(sim_smc);
+    SIM_CLEAR(sim_scb);
+    SIM_CLEAR(sim_systick);
+    SIM_CLEAR(sim_nvic);
+
+    for(uint32_t i = 0; i < LPUART_INSTANCE_COUNT; i++)
+    {
+        sim_lpuart[i].STAT = LPUART_STAT_TDRE_MASK | LPUART_STAT_TC_MASK;
+        simLpuartTx[i] = SIM_LPUART_IDLE;
+    }
+
+    sim_scg.FIRCCSR = SCG_FIRCCSR_FIRCEN_MASK | SCG_FIRCCSR_FIRCVLD_MASK;
+    sim_scg.SIRCCSR = SCG_SIRCCSR_SIRCEN_MASK | SCG_SIRCCSR_SIRCVLD_MASK;
+    *(volatile uint32_t *)&sim_scg.CSR = SCG_CSR_SCS(3U);
+    simCycleHook = 0;
+}
+
+/**
+ * @brief This function is used to select the source of the cycle counter, the counter restarts at 0
+ *
+ * @param mode[in]: source of the cycle counter
+ *
+ * @return void
+ */
+void simCycleModeSet(Sim_Cycle_Types mode)
+{
+    simCycleMode = mode;
+    simCycles = 0;
+    simHostStart = simHostNs();
+}
+
+/**
+ * @brief This function is used to register the function called on each read of the virtual cycle counter,
+ *        so a test can drive the pins and the flags of the peripherals from the time. simReset removes it
+ *
+ * @param hook[in]: function called with the cycles counted, 0 for none
+ *
+ * @return void
+ */
+void simCycleHookSet(Sim_CycleHook_Types hook)
+{
+    simCycleHook = hook;
+}
+
+/**
+ * @brief This function is used to call the handler of an interrupt as the NVIC would, the NVIC registers
+ *        are not checked
+ *
+ * @param irqn[in]: interrupt number
+ *
+ * @return void
+ */
+void simIrq(IRQn_Type irqn)
+{
+    switch(irqn)
+    {
+        case LPUART0_RxTx_IRQn:
+            LPUART0_RxTx_IRQHandler();
+            break;
+        case LPUART1_RxTx_IRQn:
+            LPUART1_RxTx_IRQHandler();
+            break;
+        case LPUART2_RxTx_IRQn:
+            LPUART2_RxTx_IRQHandler();
+            break;
+        case LPIT0_Ch2_IRQn:
+            LPIT0_Ch2_IRQHandler();
+            break;
+        case PORTA_IRQn:
+            PORTA_IRQHandler();
+            break;
+        case PORTB_IRQn:
+            PORTB_IRQHandler();
+            break;
+        case PORTC_IRQn:
+            PORTC_IRQHandler();
+            break;
+        case PORTD_IRQn:
+            PORTD_IRQHandler();
+            break;
+        case PORTE_IRQn:
+            PORTE_IRQHandler();
+            break;
+        default:
+            /* No handler in the drivers */
+            break;
+    }
+}
+
+/**
+ * @brief This function is used to run the started channels of the LPIT for a number of functional clocks.
+ *        A chained channel counts the expiries of the channel below it, each expiry sets the flag of its
+ *        channel and calls the interrupt handler when the interrupt of the channel is enabled
+ *
+ * Every counter is moved before the first handler is called, so a handler reading the counters sees the
+ * time after the whole run.
+ *
+ * @param clocks[in]: functional clocks
+ *
+ * @return void
+ */
+void simLpitAdvance(uint64_t clocks)
+{
+    uint64_t expiries[SIM_LPIT_CHANNEL_NUM] = { 0 };
+
+    if(0 != (sim_lpit.MCR & LPIT_MCR_M_CEN_MASK))
+    {
+        for(uint32_t channel = 0; channel < SIM_LPIT_CHANNEL_NUM; channel++)
+        {
+            uint32_t tctrl = sim_lpit.TMR[channel].TCTRL;
+            uint64_t counts = clocks;
+            uint64_t value = SIM_LPIT_CVAL(channel);
+
+            if((0U != channel) && (0 != (tctrl & LPIT_TMR_TCTRL_CHAIN_MASK)))
+            {
+                counts = expiries[channel - 1U];
+            }
+
+            if(0 == (tctrl & LPIT_TMR_TCTRL_T_EN_MASK))
+            {
+                /* Stopped */
+            }
+            else if(counts <= value)
+            {
+                SIM_LPIT_CVAL(channel) = (uint32_t)(value - counts);
+            }
+            else
+            {
+                /* The counter reaches 0, then reloads TVAL on the next count */
+                uint64_t period = (uint64_t)sim_lpit.TMR[channel].TVAL + 1U;
+
+                counts -= value + 1U;
+                expiries[channel] = 1U + (counts / period);
+                SIM_LPIT_CVAL(channel) = (uint32_t)(sim_lpit.TMR[channel].TVAL - (counts % period));
+                sim_lpit.MSR |= (1UL << channel);
+            }
+        }
+
+        for(uint32_t channel = 0; channel < SIM_LPIT_CHANNEL_NUM; channel++)
+        {
+            for(uint64_t i = 0; (i < expiries[channel]) && (0 != (sim_lpit.MIER & (1UL << channel))); i++)
+            {
+                simIrq((IRQn_Type)((uint32_t)LPIT0_Ch0_IRQn + channel));
+            }
+        }
+    }
+}
+
+/**
+ * @brief This function is used to receive one character on an LPUART instance and call its interrupt
+ *        handler, RDRF is cleared on return like the read of DATA does
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: character received
+ *
+ * @return void
+ */
+void simLpuartReceive(LPUART_Type *pLPUARTx, uint8_t data)
+{
+    pLPUARTx->DATA = data;
+    pLPUARTx->STAT |= LPUART_STAT_RDRF_MASK;
+    simIrq(simLpuartIrqn[pLPUARTx - sim_lpuart]);
+    pLPUARTx->STAT &= ~LPUART_STAT_RDRF_MASK;
+}
+
+/**
+ * @brief This function is used to receive one character in the Rx FIFO of an LPUART instance without
+ *        calling its interrupt handler. RDRF is set above the watermark, MA1F and MA2F on a match and OR
+ *        when the FIFO is full. With the FIFO disabled the data register holds one character
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: character received
+ *
+ * @return void
+ */
+void simLpuartFifoReceive(LPUART_Type *pLPUARTx, uint8_t data)
+{
+    uint8_t *pFifo = simLpuartRxFifo[pLPUARTx - sim_lpuart];
+    uint32_t count = (pLPUARTx->WATER & LPUART_WATER_RXCOUNT_MASK) >> LPUART_WATER_RXCOUNT_SHIFT;
+    uint32_t water = (pLPUARTx->WATER & LPUART_WATER_RXWATER_MASK) >> LPUART_WATER_RXWATER_SHIFT;
+
+    if(0 == (pLPUARTx->FIFO & LPUART_FIFO_RXFE_MASK))
+    {
+        if(0 != (pLPUARTx->STAT & LPUART_STAT_RDRF_MASK))
+        {
+            pLPUARTx->STAT |= LPUART_STAT_OR_MASK;
+        }
+        else
+        {
+            pLPUARTx->DATA = data;
+            pLPUARTx->STAT |= LPUART_STAT_RDRF_MASK;
+        }
+    }
+    else if(SIM_LPUART_FIFO_DEPTH == count)
+    {
+        pLPUARTx->STAT |= LPUART_STAT_OR_MASK;
+    }
+    else
+    {
+        pFifo[count] = data;
+        count++;
+        pLPUARTx->WATER = (pLPUARTx->WATER & ~LPUART_WATER_RXCOUNT_MASK) | LPUART_WATER_RXCOUNT(count);
+        pLPUARTx->DATA = pFifo[0];
+
+        if(count > water)
+        {
+            pLPUARTx->STAT |= LPUART_STAT_RDRF_MASK;
+        }
+
+        if(data == ((pLPUARTx->MATCH & LPUART_MATCH_MA1_MASK) >> LPUART_MATCH_MA1_SHIFT))
+        {
+            pLPUARTx->STAT |= LPUART_STAT_MA1F_MASK;
+        }
+
+        if(data == ((pLPUARTx->MATCH & LPUART_MATCH_MA2_MASK) >> LPUART_MATCH_MA2_SHIFT))
+        {
+            pLPUARTx->STAT |= LPUART_STAT_MA2F_MASK;
+        }
+    }
+}
+
+/**
+ * @brief This function is used to keep the Rx line of an LPUART instance idle for the characters of
+ *        RXIDEN, RDRF is set if the Rx FIFO holds data
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return void
+ */
+void simLpuartFifoIdle(LPUART_Type *pLPUARTx)
+{
+    if((0 != (pLPUARTx->FIFO & LPUART_FIFO_RXIDEN_MASK)) && (0 != (pLPUARTx->WATER & LPUART_WATER_RXCOUNT_MASK)))
+    {
+        pLPUARTx->STAT |= LPUART_STAT_RDRF_MASK;
+    }
+}
+
+/**
+ * @brief This function is used to empty the transmitter of an LPUART instance and call its interrupt
+ *        handler if the Tx interrupt is enabled
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pData[out]: character written by the handler
+ *
+ * @return uint8_t: 1 if the handler wrote a character, 0 otherwise
+ */
+uint8_t simLpuartTransmit(LPUART_Type *pLPUARTx, uint8_t *pData)
+{
+    uint8_t isWritten = 0;
+
+    if(0 != (pLPUARTx->CTRL & LPUART_CTRL_TIE_MASK))
+    {
+        uint32_t sent;
+
+        simLpuartTx[pLPUARTx - sim_lpuart] = SIM_LPUART_IDLE;
+        pLPUARTx->STAT |= LPUART_STAT_TDRE_MASK | LPUART_STAT_TC_MASK;
+        simIrq(simLpuartIrqn[pLPUARTx - sim_lpuart]);
+        sent = simLpuartSent(pLPUARTx);
+
+        if(SIM_LPUART_IDLE != sent)
+        {
+            *pData = (uint8_t)sent;
+            isWritten = 1;
+        }
+    }
+
+    return isWritten;
+}
+
+/**
+ * @brief This function is used to take the character the transmitter of an LPUART instance was given
+ *        since the last call, the last one if there were several
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: character, SIM_LPUART_BREAK or SIM_LPUART_IDLE
+ */
+uint32_t simLpuartSent(LPUART_Type *pLPUARTx)
+{
+    uint32_t sent = simLpuartTx[pLPUARTx - sim_lpuart];
+
+    simLpuartTx[pLPUARTx - sim_lpuart] = SIM_LPUART_IDLE;
+
+    return sent;
+}
+
+/**
+ * @brief This function is used to write the status register of an LPUART instance as the hardware does,
+ *        the write 1 to clear flags written 1 are cleared and the ones written 0 kept, the plain memory of
+ *        the simulator would set them. The HAL writes it with LPUART_STAT_WRITE
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param value[in]: value written
+ *
+ * @return void
+ */
+void simLpuartStatWrite(LPUART_Type *pLPUARTx, uint32_t value)
+{
+    pLPUARTx->STAT = (value & ~LPUART_STAT_W1C_FLAGS) | (pLPUARTx->STAT & LPUART_STAT_W1C_FLAGS & ~value);
+}
+
+/**
+ * @brief This function is used to give a character to the transmitter of an LPUART instance, it is kept
+ *        apart from the received one for simLpuartSent. The HAL writes it with LPUART_DATA_WRITE
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: data to send
+ *
+ * @return void
+ */
+void simLpuartDataWrite(LPUART_Type *pLPUARTx, uint32_t data)
+{
+    pLPUARTx->DATA = data;
+    simLpuartTx[pLPUARTx - sim_lpuart] = data;
+}
+
+/**
+ * @brief This function is used to read the oldest character of the Rx FIFO of an LPUART instance, or its
+ *        data register with the FIFO disabled, RDRF is cleared once the FIFO is at or below the watermark.
+ *        The HAL reads it with LPUART_DATA_READ
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return uint32_t: character read
+ */
+uint32_t simLpuartDataRead(LPUART_Type *pLPUARTx)
+{
+    uint8_t *pFifo = simLpuartRxFifo[pLPUARTx - sim_lpuart];
+    uint32_t count = (pLPUARTx->WATER & LPUART_WATER_RXCOUNT_MASK) >> LPUART_WATER_RXCOUNT_SHIFT;
+    uint32_t water = (pLPUARTx->WATER & LPUART_WATER_RXWATER_MASK) >> LPUART_WATER_RXWATER_SHIFT;
+    uint32_t data = pLPUARTx->DATA;
+
+    if((0 != (pLPUARTx->FIFO & LPUART_FIFO_RXFE_MASK)) && (0U != count))
+    {
+        data = pFifo[0];
+        count--;
+        (void)memmove(pFifo, &pFifo[1], count);
+        pLPUARTx->WATER = (pLPUARTx->WATER & ~LPUART_WATER_RXCOUNT_MASK) | LPUART_WATER_RXCOUNT(count);
+        pLPUARTx->DATA = pFifo[0];
+    }
+
+    if(count <= water)
+    {
+        pLPUARTx->STAT &= ~LPUART_STAT_RDRF_MASK;
+    }
+
+    return data;
+}
+
+/**
+ * @brief This function is used to queue a break character on the transmitter of an LPUART instance for
+ *        simLpuartSent. The HAL queues it with LPUART_BREAK_QUEUE
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return void
+ */
+void simLpuartBreakQueue(LPUART_Type *pLPUARTx)
+{
+    simLpuartTx[pLPUARTx - sim_lpuart] = SIM_LPUART_BREAK;
+}
+
+/**
+ * @brief This function is used to read the down counter of an LPIT channel, the LPIT then runs for
+ *        SIM_LPIT_CLOCKS_PER_READ clocks so a wait on the LPIT ends. The HAL reads it with LPIT_CVAL_READ
+ *
+ * @param pLPITx[in]: pointer to the LPIT instance
+ * @param channel[in]: timer channel, from 0 to 3
+ *
+ * @return uint32_t: value of the counter before the clocks
+ */
+uint32_t simLpitCvalRead(LPIT_Type *pLPITx, uint8_t channel)
+{
+    uint32_t value = pLPITx->TMR[channel].CVAL;
+
+    simLpitAdvance(SIM_LPIT_CLOCKS_PER_READ);
+
+    return value;
+}
+
+/**
+ * @brief This function is used to start LPIT channels, each one loads its counter from TVAL as the
+ *        hardware does. The HAL writes SETTEN with LPIT_SETTEN_WRITE
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param mask[in]: bit n starts channel n
+ *
+ * @return void
+ */
+void simLpitSettenWrite(LPIT_Type *pLPITx, uint32_t mask)
+{
+    for(uint32_t channel = 0; channel < SIM_LPIT_CHANNEL_NUM; channel++)
+    {
+        if(0 != (mask & (1UL << channel)))
+        {
+            pLPITx->TMR[channel].TCTRL |= LPIT_TMR_TCTRL_T_EN_MASK;
+            *(volatile uint32_t *)&pLPITx->TMR[channel].CVAL = pLPITx->TMR[channel].TVAL;
+        }
+    }
+}
+
+/**
+ * @brief This function is used to stop LPIT channels, their counters keep their value. The HAL writes
+ *        CLRTEN with LPIT_CLRTEN_WRITE
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param mask[in]: bit n stops channel n
+ *
+ * @return void
+ */
+void simLpitClrtenWrite(LPIT_Type *pLPITx, uint32_t mask)
+{
+    for(uint32_t channel = 0; channel < SIM_LPIT_CHANNEL_NUM; channel++)
+    {
+        if(0 != (mask & (1UL << channel)))
+        {
+            pLPITx->TMR[channel].TCTRL &= ~LPIT_TMR_TCTRL_T_EN_MASK;
+        }
+    }
+}
+
+/**
+ * @brief This function is used to clear the flags of the LPIT channels as the hardware does with a write
+ *        1 to clear, the plain memory would set them. The HAL writes MSR with LPIT_MSR_WRITE
+ *
+ * @param pLPITx[in/out]: pointer to the LPIT instance
+ * @param mask[in]: bit n clears the flag of channel n
+ *
+ * @return void
+ */
+void simLpitMsrWrite(LPIT_Type *pLPITx, uint32_t mask)
+{
+    pLPITx->MSR &= ~mask;
+}
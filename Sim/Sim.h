@@ -0,0 +1,189 @@
+/**
+ * @file Sim.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the host simulator of the S32K144 used by the tests and the benchmarks
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef SIM_H_
+#define SIM_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "S32K144.h"
+#include "CycleCounter.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#ifndef SIM_CYCLES_PER_READ
+#define SIM_CYCLES_PER_READ (1U)        /* Cycles added by each read of the virtual cycle counter */
+#endif
+
+#ifndef SIM_LPIT_CLOCKS_PER_READ
+#define SIM_LPIT_CLOCKS_PER_READ (1U)   /* Functional clocks the LPIT runs after each read of a counter */
+#endif
+
+#define SIM_LPUART_IDLE     (0xFFFFFFFFU)   /* Nothing sent by the transmitter */
+#define SIM_LPUART_BREAK    (0x100U)        /* Break character sent by the transmitter */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    SIM_CYCLE_VIRTUAL,  /* Each read adds SIM_CYCLES_PER_READ, the waits end after the same reads on any host */
+    SIM_CYCLE_HOST,     /* Host monotonic time scaled to the system clock, for the benchmarks */
+} Sim_Cycle_Types;      /* Source of cycleCounterSim */
+
+typedef void (*Sim_CycleHook_Types)(uint32_t cycles);   /* Model of the signals driven by the time */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/* Interrupt handlers of the vector table, defined by the drivers */
+void LPUART0_RxTx_IRQHandler(void);
+void LPUART1_RxTx_IRQHandler(void);
+void LPUART2_RxTx_IRQHandler(void);
+void LPIT0_Ch2_IRQHandler(void);
+void PORTA_IRQHandler(void);
+void PORTB_IRQHandler(void);
+void PORTC_IRQHandler(void);
+void PORTD_IRQHandler(void);
+void PORTE_IRQHandler(void);
+
+/**
+ * @name simReset
+ *
+ * @brief This function is used to clear every peripheral and set the reset values the drivers wait on,
+ *        the transmitters are empty and FIRC and SIRC are valid
+ *
+ * @return void
+ */
+void simReset(void);
+
+/**
+ * @name simCycleModeSet
+ *
+ * @brief This function is used to select the source of the cycle counter, the counter restarts at 0
+ *
+ * @param mode[in]: source of the cycle counter
+ *
+ * @return void
+ */
+void simCycleModeSet(Sim_Cycle_Types mode);
+
+/**
+ * @name simCycleHookSet
+ *
+ * @brief This function is used to register the function called on each read of the virtual cycle counter,
+ *        so a test can drive the pins and the flags of the peripherals from the time. simReset removes it
+ *
+ * @param hook[in]: function called with the cycles counted, 0 for none
+ *
+ * @return void
+ */
+void simCycleHookSet(Sim_CycleHook_Types hook);
+
+/**
+ * @name simHostNs
+ *
+ * @brief This function is used to read the monotonic time of the host
+ *
+ * @return uint64_t: time in nanoseconds
+ */
+uint64_t simHostNs(void);
+
+/**
+ * @name simIrq
+ *
+ * @brief This function is used to call the handler of an interrupt as the NVIC would, the NVIC registers
+ *        are not checked
+ *
+ * @param irqn[in]: interrupt number
+ *
+ * @return void
+ */
+void simIrq(IRQn_Type irqn);
+
+/**
+ * @name simLpitAdvance
+ *
+ * @brief This function is used to run the started channels of the LPIT for a number of functional clocks.
+ *        A chained channel counts the expiries of the channel below it, each expiry sets the flag of its
+ *        channel and calls the interrupt handler when the interrupt of the channel is enabled
+ *
+ * @param clocks[in]: functional clocks
+ *
+ * @return void
+ */
+void simLpitAdvance(uint64_t clocks);
+
+/**
+ * @name simLpuartReceive
+ *
+ * @brief This function is used to receive one character on an LPUART instance and call its interrupt
+ *        handler, RDRF is cleared on return like the read of DATA does
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: character received
+ *
+ * @return void
+ */
+void simLpuartReceive(LPUART_Type *pLPUARTx, uint8_t data);
+
+/**
+ * @name simLpuartFifoReceive
+ *
+ * @brief This function is used to receive one character in the Rx FIFO of an LPUART instance without
+ *        calling its interrupt handler. RDRF is set above the watermark, MA1F and MA2F on a match and OR
+ *        when the FIFO is full. With the FIFO disabled the data register holds one character
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: character received
+ *
+ * @return void
+ */
+void simLpuartFifoReceive(LPUART_Type *pLPUARTx, uint8_t data);
+
+/**
+ * @name simLpuartFifoIdle
+ *
+ * @brief This function is used to keep the Rx line of an LPUART instance idle for the characters of
+ *        RXIDEN, RDRF is set if the Rx FIFO holds data
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return void
+ */
+void simLpuartFifoIdle(LPUART_Type *pLPUARTx);
+
+/**
+ * @name simLpuartTransmit
+ *
+ * @brief This function is used to empty the transmitter of an LPUART instance and call its interrupt
+ *        handler if the Tx interrupt is enabled
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pData[out]: character written by the handler
+ *
+ * @return uint8_t: 1 if the handler wrote a character, 0 otherwise
+ */
+uint8_t simLpuartTransmit(LPUART_Type *pLPUARTx, uint8_t *pData);
+
+/**
+ * @name simLpuartSent
+ *
+ * @brief This function is used to take the character the transmitter of an LPUART instance was given
+ *        since the last call, the last one if there were several
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: character, SIM_LPUART_BREAK or SIM_LPUART_IDLE
+ */
+uint32_t simLpuartSent(LPUART_Type *pLPUARTx);
+
+#endif /* SIM_H_ */
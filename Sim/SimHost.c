@@ -0,0 +1,34 @@
+/**
+ * @file SimHost.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the services of the host operating system used by the simulator
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * <time.h> declares clock(), which the driver global clock hides, so this file includes no driver header.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#define _POSIX_C_SOURCE 199309L
+#include "Sim.h"
+#include <time.h>
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to read the monotonic time of the host
+ *
+ * @return uint64_t: time in nanoseconds
+ */
+uint64_t simHostNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
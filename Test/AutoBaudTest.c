@@ -0,0 +1,192 @@
+/**
+ * @file AutoBaudTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the automatic baudrate detection from 1200 baud to 3 Mbaud
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The Rx pin of LPUART0 is a list of edges in cycles of the virtual counter. An edge sets RXEDGIF when it
+ * is the active one for RXINV, 0 to 11 cycles late as the polling loop of the target would see it.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "s32k144_lpuart_driver.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define AUTOBAUD_TEST_IDLE          (5000U)     /* Cycles of idle line before the character */
+#define AUTOBAUD_TEST_TIMEOUT       (1000000U)  /* Timeout of the detection, in cycles */
+#define AUTOBAUD_TEST_LATENCY       (12U)       /* Cycles of the polling latency, from 0 to this value - 1 */
+#define AUTOBAUD_TEST_ERROR_MAX     (3.0)       /* Largest error of the baudrate configured, in percent */
+#define AUTOBAUD_TEST_START_BIT_MAX (460800U)   /* Highest baudrate whose start bit covers 4 polling periods */
+#define AUTOBAUD_TEST_NON_STANDARD  (250000U)   /* Baudrate not in the standard list, kept as measured */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    uint32_t cycles;    /* Time of the edge */
+    uint8_t isRising;   /* 1 for a rising edge, 0 for a falling one */
+} AutoBaudTest_Edge_Types;  /* Edge of the Rx pin */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static AutoBaudTest_Edge_Types autoBaudTestEdge[10];    /* Edges of the character on the line */
+static uint32_t autoBaudTestEdgeCount;                  /* Number of edges of the character */
+static uint32_t autoBaudTestEdgeNext;                   /* First edge not yet on the pin */
+
+static const uint32_t autoBaudTestRate[] =
+{
+    1200U, 2400U, 4800U, 9600U, 19200U, 38400U, 57600U, 115200U, 230400U, 250000U, 460800U, 921600U, 1000000U,
+    2000000U, 3000000U
+};  /* Baudrates detected */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to put the edges reached by the time on the Rx pin of LPUART0
+ *
+ * @param cycles[in]: cycles counted
+ *
+ * @return void
+ */
+static void autoBaudTestPin(uint32_t cycles)
+{
+    while((autoBaudTestEdgeNext < autoBaudTestEdgeCount) &&
+          ((int32_t)(cycles - autoBaudTestEdge[autoBaudTestEdgeNext].cycles -
+                     ((autoBaudTestEdgeNext * 7U) % AUTOBAUD_TEST_LATENCY)) >= 0))
+    {
+        uint8_t isInverted = (0 != (LPUART0->STAT & LPUART_STAT_RXINV_MASK)) ? 1U : 0U;
+
+        if(autoBaudTestEdge[autoBaudTestEdgeNext].isRising == isInverted)
+        {
+            LPUART0->STAT |= LPUART_STAT_RXEDGIF_MASK;
+        }
+
+        autoBaudTestEdgeNext++;
+    }
+}
+
+/**
+ * @brief This function is used to send a character on the Rx pin of LPUART0 after an idle time
+ *
+ * @param data[in]: character, 8 bits LSB first with 1 stop bit
+ * @param baudRate[in]: baudrate of the character
+ *
+ * @return void
+ */
+static void autoBaudTestSend(uint8_t data, uint32_t baudRate)
+{
+    uint32_t start = cycleCounterSim() + AUTOBAUD_TEST_IDLE;
+    uint32_t level = 1U;
+
+    autoBaudTestEdgeCount = 0;
+    autoBaudTestEdgeNext = 0;
+
+    /* Start bit, 8 data bits and the stop bit */
+    for(uint32_t bit = 0; bit < 10U; bit++)
+    {
+        uint32_t next = (0U == bit) ? 0U : ((9U == bit) ? 1U : ((uint32_t)(data >> (bit - 1U)) & 1U));
+
+        if(next != level)
+        {
+            autoBaudTestEdge[autoBaudTestEdgeCount].cycles =
+                start + (uint32_t)(((uint64_t)bit * clock) / baudRate);
+            autoBaudTestEdge[autoBaudTestEdgeCount].isRising = (uint8_t)next;
+            autoBaudTestEdgeCount++;
+            level = next;
+        }
+    }
+}
+
+/**
+ * @brief This function is used to compute the baudrate LPUART0 is configured to
+ *
+ * @return uint32_t: baudrate
+ */
+static uint32_t autoBaudTestRateGet(void)
+{
+    uint32_t osr = ((LPUART0->BAUD & LPUART_BAUD_OSR_MASK) >> LPUART_BAUD_OSR_SHIFT) + 1U;
+    uint32_t sbr = LPUART0->BAUD & LPUART_BAUD_SBR_MASK;
+
+    return (0 != sbr) ? (clock / (osr * sbr)) : 0U;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    uint32_t baudRate;
+
+    simReset();
+    simCycleHookSet(autoBaudTestPin);
+
+    for(uint32_t i = 0; i < (sizeof(autoBaudTestRate) / sizeof(autoBaudTestRate[0])); i++)
+    {
+        uint32_t rate = autoBaudTestRate[i];
+        double error;
+
+        /* 0x55 at every baudrate, the receiver is enabled again once measured */
+        LPUART0->CTRL |= LPUART_CTRL_RE_MASK;
+        LPUART0->BAUD = 0;
+        autoBaudTestSend(0x55U, rate);
+        baudRate = 0;
+        TEST_CHECK(LPUART_E_OK == LPUART_AutoBaud(LPUART0, LPUART_AUTOBAUD_SYNC, AUTOBAUD_TEST_TIMEOUT, &baudRate));
+        TEST_CHECK(0U != (LPUART0->CTRL & LPUART_CTRL_RE_MASK));
+
+        error = (100.0 * ((double)autoBaudTestRateGet() - rate)) / rate;
+        TEST_CHECK((error <= AUTOBAUD_TEST_ERROR_MAX) && (error >= -AUTOBAUD_TEST_ERROR_MAX));
+        (void)printf("sync      %8u baud: %8u configured, error %+.2f%%\n", rate, autoBaudTestRateGet(), error);
+
+        /* CR measures the start bit only, too short for the polling at the highest baudrates. One bit of the
+           non standard baudrate is within the polling error of 230400 and snaps to it */
+        LPUART0->BAUD = 0;
+        autoBaudTestSend(0x0DU, rate);
+        baudRate = 0;
+
+        if(AUTOBAUD_TEST_NON_STANDARD == rate)
+        {
+            TEST_CHECK(LPUART_E_OK ==
+                       LPUART_AutoBaud(LPUART0, LPUART_AUTOBAUD_START_BIT, AUTOBAUD_TEST_TIMEOUT, &baudRate));
+        }
+        else if(AUTOBAUD_TEST_START_BIT_MAX >= rate)
+        {
+            TEST_CHECK(LPUART_E_OK ==
+                       LPUART_AutoBaud(LPUART0, LPUART_AUTOBAUD_START_BIT, AUTOBAUD_TEST_TIMEOUT, &baudRate));
+
+            error = (100.0 * ((double)autoBaudTestRateGet() - rate)) / rate;
+            TEST_CHECK((error <= AUTOBAUD_TEST_ERROR_MAX) && (error >= -AUTOBAUD_TEST_ERROR_MAX));
+            (void)printf("start bit %8u baud: %8u configured, error %+.2f%%\n", rate, autoBaudTestRateGet(), error);
+        }
+        else
+        {
+            TEST_CHECK(LPUART_E_NOT_OK ==
+                       LPUART_AutoBaud(LPUART0, LPUART_AUTOBAUD_START_BIT, AUTOBAUD_TEST_TIMEOUT, &baudRate));
+        }
+
+        TEST_CHECK(0U == (LPUART0->STAT & LPUART_STAT_RXINV_MASK));
+    }
+
+    /* CR has 3 falling edges, the sync mode waits for the other 2 until the timeout */
+    autoBaudTestSend(0x0DU, 115200U);
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_AutoBaud(LPUART0, LPUART_AUTOBAUD_SYNC, AUTOBAUD_TEST_TIMEOUT, &baudRate));
+
+    /* Idle line */
+    autoBaudTestEdgeCount = 0;
+    TEST_CHECK(LPUART_E_NOT_OK ==
+               LPUART_AutoBaud(LPUART0, LPUART_AUTOBAUD_START_BIT, AUTOBAUD_TEST_TIMEOUT, &baudRate));
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_AutoBaud(LPUART0, (LPUART_AutoBaudMode_Type)2, AUTOBAUD_TEST_TIMEOUT,
+                                                  &baudRate));
+
+    return testFinish();
+}
@@ -0,0 +1,267 @@
+/**
+ * @file BusTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the message bus: the order of the deliveries, the references to a message and the
+ *        subscribers removed
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Every subscriber adds its name and the payload of the message to a shared log, so the log gives the order
+ * of the calls. The blocks in use are read from the statistics of the pool.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "Bus.h"
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define BUS_TEST_PAYLOAD    (8U)                                /* Bytes of payload a block holds */
+#define BUS_TEST_BLOCK_SIZE (sizeof(Std_Bus_Message_Types) + BUS_TEST_PAYLOAD)  /* Bytes of a block */
+#define BUS_TEST_BLOCKS     (BUS_QUEUE_SIZE + 4U)               /* Blocks of the pool, more than the queue holds */
+#define BUS_TEST_LOG_MAX    (64U)                               /* Calls recorded */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    char name;                          /* Name of the subscriber in the log */
+    uint8_t nOfRetains;                 /* References taken on the next message */
+    Std_Bus_Message_Types *pRetained;   /* Last message retained, 0 for none */
+    uint8_t isRepublish;                /* 1 to publish the value plus 1 on the next message */
+} BusTest_Subscriber_Types;             /* Argument of the subscribers */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Std_Pool_Types busTestPool;                                                  /* Pool of the messages */
+static uint32_t busTestMemory[POOL_MEMORY_WORDS(BUS_TEST_BLOCK_SIZE, BUS_TEST_BLOCKS)];
+static char busTestLog[BUS_TEST_LOG_MAX + 1U];                                      /* Calls of the subscribers */
+static uint32_t busTestLogLen;                                                      /* Number of calls */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to publish a value
+ *
+ * @param topic[in]: topic of the message
+ * @param source[in]: instance publishing the message
+ * @param value[in]: payload
+ *
+ * @return Std_Bus_Status: status of busPublish, BUS_E_NOT_OK if no message was taken
+ */
+static Std_Bus_Status busTestPublish(Bus_Topic_Types topic, uint16_t source, uint32_t value)
+{
+    Std_Bus_Message_Types *pMessage = busAlloc(topic, source, sizeof(value));
+    Std_Bus_Status status = BUS_E_NOT_OK;
+
+    if(0 != pMessage)
+    {
+        memcpy(BUS_PAYLOAD(pMessage), &value, sizeof(value));
+        status = busPublish(pMessage);
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to read the value of a message
+ *
+ * @param pMessage[in]: message
+ *
+ * @return uint32_t: payload
+ */
+static uint32_t busTestValue(const Std_Bus_Message_Types *pMessage)
+{
+    uint32_t value;
+
+    memcpy(&value, BUS_PAYLOAD(pMessage), sizeof(value));
+
+    return value;
+}
+
+/**
+ * @brief This function is used to log a call, then retain the message or publish the next value as the
+ *        subscriber asks
+ *
+ * @param pMessage[in]: message delivered
+ * @param arg[in/out]: pointer to the subscriber
+ *
+ * @return void
+ */
+static void busTestHandler(Std_Bus_Message_Types *pMessage, void *arg)
+{
+    BusTest_Subscriber_Types *pSubscriber = (BusTest_Subscriber_Types *)arg;
+    uint32_t value = busTestValue(pMessage);
+
+    if((busTestLogLen + 2U) <= BUS_TEST_LOG_MAX)
+    {
+        busTestLog[busTestLogLen++] = pSubscriber->name;
+        busTestLog[busTestLogLen++] = (char)('0' + (value % 10U));
+    }
+
+    for(; 0U != pSubscriber->nOfRetains; pSubscriber->nOfRetains--)
+    {
+        busRetain(pMessage);
+        pSubscriber->pRetained = pMessage;
+    }
+
+    if(0 != pSubscriber->isRepublish)
+    {
+        pSubscriber->isRepublish = 0;
+        (void)busTestPublish((Bus_Topic_Types)pMessage->topic, pMessage->source, value + 1U);
+    }
+}
+
+/**
+ * @brief This function is used to deliver the queued messages with an empty log
+ *
+ * @return uint32_t: number of messages delivered
+ */
+static uint32_t busTestDispatch(void)
+{
+    busTestLogLen = 0;
+    (void)memset(busTestLog, 0, sizeof(busTestLog));
+
+    return busDispatch();
+}
+
+/**
+ * @brief This function is used to read the blocks of the pool in use
+ *
+ * @return uint32_t: number of messages held
+ */
+static uint32_t busTestInUse(void)
+{
+    Pool_Statistics_Types statistics;
+
+    poolGetStatistics(&busTestPool, &statistics);
+
+    return statistics.inUse;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    BusTest_Subscriber_Types a = { .name = 'a' };
+    BusTest_Subscriber_Types b = { .name = 'b' };
+    BusTest_Subscriber_Types c = { .name = 'c' };
+    BusTest_Subscriber_Types d = { .name = 'd' };
+    Bus_Statistics_Types statistics;
+    Pool_Statistics_Types poolStatistics;
+    Std_Bus_Message_Types *pMessage;
+    Std_Pool_Types smallPool;
+    Std_Pool_Types onePool;
+    uint32_t smallMemory[POOL_MEMORY_WORDS(sizeof(Std_Bus_Message_Types) - 4U, 1U)];
+    uint32_t oneMemory[POOL_MEMORY_WORDS(BUS_TEST_BLOCK_SIZE, 1U)];
+    uint8_t isPassed = 1;
+
+    simReset();
+    TEST_CHECK(POOL_E_OK == poolInit(&smallPool, smallMemory, sizeof(Std_Bus_Message_Types) - 4U, 1U));
+    TEST_CHECK(POOL_E_OK == poolInit(&busTestPool, busTestMemory, BUS_TEST_BLOCK_SIZE, BUS_TEST_BLOCKS));
+    TEST_CHECK(POOL_E_OK == poolInit(&onePool, oneMemory, BUS_TEST_BLOCK_SIZE, 1U));
+    TEST_CHECK((BUS_E_NOT_OK == busInit(0)) && (BUS_E_NOT_OK == busInit(&smallPool)));
+    TEST_CHECK(BUS_E_OK == busInit(&busTestPool));
+
+    TEST_CHECK(BUS_E_NOT_OK == busSubscribe(BUS_TOPIC_COUNT, busTestHandler, &a));
+    TEST_CHECK(BUS_E_NOT_OK == busSubscribe(BUS_TOPIC_PIN_EDGE, 0, &a));
+    TEST_CHECK(BUS_E_OK == busSubscribe(BUS_TOPIC_PIN_EDGE, busTestHandler, &a));
+    TEST_CHECK(BUS_E_OK == busSubscribe(BUS_TOPIC_PIN_EDGE, busTestHandler, &b));
+    TEST_CHECK(BUS_E_OK == busSubscribe(BUS_TOPIC_PIN_EDGE, busTestHandler, &c));
+    TEST_CHECK(BUS_E_OK == busSubscribe(BUS_TOPIC_CLOCK_CHANGE, busTestHandler, &d));
+
+    /* The messages go out in the order they were published, each one to its subscribers in the order they
+       subscribed, and the last reference gives the block back */
+    TEST_CHECK(BUS_E_OK == busTestPublish(BUS_TOPIC_PIN_EDGE, 0U, 1U));
+    TEST_CHECK(BUS_E_OK == busTestPublish(BUS_TOPIC_CLOCK_CHANGE, 0U, 2U));
+    TEST_CHECK(BUS_E_OK == busTestPublish(BUS_TOPIC_LPUART_RX, 0U, 3U));
+    TEST_CHECK(BUS_E_OK == busTestPublish(BUS_TOPIC_PIN_EDGE, 0U, 4U));
+    TEST_CHECK(4U == busTestInUse());
+    TEST_CHECK((4U == busTestDispatch()) && (0 == strcmp("a1b1c1d2a4b4c4", busTestLog)));
+    TEST_CHECK((0U == busTestInUse()) && (0U == busTestDispatch()));
+
+    /* A message published by a subscriber goes out after the ones already queued */
+    a.isRepublish = 1;
+    TEST_CHECK(BUS_E_OK == busTestPublish(BUS_TOPIC_PIN_EDGE, 0U, 5U));
+    TEST_CHECK(BUS_E_OK == busTestPublish(BUS_TOPIC_CLOCK_CHANGE, 0U, 7U));
+    TEST_CHECK((3U == busTestDispatch()) && (0 == strcmp("a5b5c5d7a6b6c6", busTestLog)));
+    TEST_CHECK(0U == busTestInUse());
+
+    /* A retained message outlives the dispatch with its payload, until its last reference is given back */
+    b.nOfRetains = 2U;
+    TEST_CHECK(BUS_E_OK == busTestPublish(BUS_TOPIC_PIN_EDGE, 3U, 8U));
+    TEST_CHECK((1U == busTestDispatch()) && (1U == busTestInUse()));
+    TEST_CHECK((0 != b.pRetained) && (8U == busTestValue(b.pRetained)) && (3U == b.pRetained->source));
+    busRelease(b.pRetained);
+    TEST_CHECK(1U == busTestInUse());
+    busRelease(b.pRetained);
+    TEST_CHECK(0U == busTestInUse());
+
+    /* A removed subscriber is not called, the others keep their order, a subscriber added again is last */
+    TEST_CHECK(BUS_E_NOT_OK == busUnsubscribe(BUS_TOPIC_PIN_EDGE, busTestHandler, &d));
+    TEST_CHECK(BUS_E_NOT_OK == busUnsubscribe(BUS_TOPIC_COUNT, busTestHandler, &b));
+    TEST_CHECK(BUS_E_OK == busUnsubscribe(BUS_TOPIC_PIN_EDGE, busTestHandler, &b));
+    TEST_CHECK(BUS_E_NOT_OK == busUnsubscribe(BUS_TOPIC_PIN_EDGE, busTestHandler, &b));
+    TEST_CHECK(BUS_E_OK == busTestPublish(BUS_TOPIC_PIN_EDGE, 0U, 9U));
+    TEST_CHECK((1U == busTestDispatch()) && (0 == strcmp("a9c9", busTestLog)));
+    TEST_CHECK(BUS_E_OK == busSubscribe(BUS_TOPIC_PIN_EDGE, busTestHandler, &b));
+    TEST_CHECK(BUS_E_OK == busUnsubscribe(BUS_TOPIC_PIN_EDGE, busTestHandler, &a));
+    TEST_CHECK(BUS_E_OK == busTestPublish(BUS_TOPIC_PIN_EDGE, 0U, 0U));
+    TEST_CHECK((1U == busTestDispatch()) && (0 == strcmp("c0b0", busTestLog)));
+
+    /* A full queue refuses the message and gives its block back */
+    for(uint32_t i = 0; i < BUS_QUEUE_SIZE; i++)
+    {
+        isPassed &= (BUS_E_OK == busTestPublish(BUS_TOPIC_CLOCK_CHANGE, 0U, i)) ? 1U : 0U;
+    }
+
+    TEST_CHECK(1U == isPassed);
+    TEST_CHECK(BUS_E_NOT_OK == busTestPublish(BUS_TOPIC_CLOCK_CHANGE, 0U, 0U));
+    TEST_CHECK(BUS_QUEUE_SIZE == busTestInUse());
+    TEST_CHECK((BUS_QUEUE_SIZE == busTestDispatch()) && (0U == busTestInUse()));
+    busGetStatistics(&statistics);
+    TEST_CHECK(((10U + BUS_QUEUE_SIZE) == statistics.published) && (1U == statistics.dropped));
+    TEST_CHECK((10U + BUS_QUEUE_SIZE) == statistics.dispatched);
+    TEST_CHECK((7U + 7U + 3U + 2U + 2U + BUS_QUEUE_SIZE) == statistics.handlerCalls);
+
+    /* A message is not taken for a payload larger than a block or a topic not valid, an empty pool is a
+       loss. A message goes back to the pool it was taken from */
+    TEST_CHECK(0 == busAlloc(BUS_TOPIC_PIN_EDGE, 0U, BUS_TEST_PAYLOAD + 1U));
+    TEST_CHECK(0 == busAlloc(BUS_TOPIC_COUNT, 0U, 1U));
+    TEST_CHECK(BUS_E_OK == busInit(&onePool));
+    pMessage = busAlloc(BUS_TOPIC_PIN_EDGE, 0U, BUS_TEST_PAYLOAD);
+    TEST_CHECK((0 != pMessage) && (0 == busAlloc(BUS_TOPIC_PIN_EDGE, 0U, 1U)));
+    busGetStatistics(&statistics);
+    TEST_CHECK((0U == statistics.published) && (1U == statistics.dropped));
+    busRelease(pMessage);
+    poolGetStatistics(&onePool, &poolStatistics);
+    TEST_CHECK(0U == poolStatistics.inUse);
+
+    /* busInit removes the subscribers, the interrupt flags of a port are published with its index */
+    TEST_CHECK(BUS_E_OK == busInit(&busTestPool));
+    TEST_CHECK(BUS_E_OK == busTestPublish(BUS_TOPIC_PIN_EDGE, 0U, 1U));
+    TEST_CHECK((1U == busTestDispatch()) && ('\0' == busTestLog[0]));
+    TEST_CHECK(BUS_E_OK == busSubscribe(BUS_TOPIC_PIN_EDGE, busTestHandler, &a));
+    TEST_CHECK(BUS_E_OK == busBindPort(PORTC));
+    PORTC->ISFR = 0x00000024U;
+    simIrq(PORTC_IRQn);
+    a.nOfRetains = 1U;
+    TEST_CHECK((1U == busTestDispatch()) && (0 == strcmp("a6", busTestLog)));
+    TEST_CHECK((2U == a.pRetained->source) && (0x24U == busTestValue(a.pRetained)));
+    busRelease(a.pRetained);
+
+    busGetStatistics(&statistics);
+    TEST_CHECK((2U == statistics.published) && (0U == statistics.dropped) && (2U == statistics.dispatched));
+    TEST_CHECK((1U == statistics.handlerCalls) && (0U == busTestInUse()));
+
+    return testFinish();
+}
@@ -0,0 +1,194 @@
+/**
+ * @file ClockTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the clock source waits: the timeout of SOSC and SPLL, the rollback to FIRC and the
+ *        statistics of the waits
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The SCG is modelled from the virtual cycle counter: FIRC and SIRC become valid a fixed number of cycles
+ * after they are enabled, SOSC and SPLL never do, as with a missing crystal, and the system clock status
+ * follows the source requested in RCCR. The system is put on SPLL before each source that fails.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "s32k144_pcc_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define CLOCK_TEST_BUDGET       (1000U)     /* Cycles allowed to a clock source to become valid */
+#define CLOCK_TEST_START        (40U)       /* Cycles FIRC and SIRC take to become valid */
+#define CLOCK_TEST_SPLL_HZ      (80000000U) /* System clock on SPLL */
+#define CLOCK_TEST_SCS_SPLL     (6U)        /* System clock source field value of SPLL */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint32_t clockTestFircStart;         /* Cycle FIRC was seen enabled and not valid, 0 for none */
+static uint32_t clockTestSircStart;         /* Cycle SIRC was seen enabled and not valid, 0 for none */
+static uint32_t clockTestChanges;           /* Calls of the clock change callback */
+static uint32_t clockTestFrequency;         /* Frequency given to the last call */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to set the valid flag of an internal oscillator CLOCK_TEST_START cycles after
+ *        it is enabled
+ *
+ * @param pCsr[in/out]: control status register of the oscillator
+ * @param enMask[in]: mask of the enable bit
+ * @param vldMask[in]: mask of the valid flag
+ * @param pStart[in/out]: cycle the oscillator was seen enabled, 0 for none
+ * @param cycles[in]: cycles counted
+ *
+ * @return void
+ */
+static void clockTestOscillator(volatile uint32_t *pCsr, uint32_t enMask, uint32_t vldMask, uint32_t *pStart,
+                                uint32_t cycles)
+{
+    if((0 == (*pCsr & enMask)) || (0 != (*pCsr & vldMask)))
+    {
+        *pStart = 0;
+    }
+    else if(0U == *pStart)
+    {
+        *pStart = cycles;
+    }
+    else if((cycles - *pStart) >= CLOCK_TEST_START)
+    {
+        *pCsr |= vldMask;
+    }
+    else
+    {
+        /* Starting */
+    }
+}
+
+/**
+ * @brief This function is used to model the SCG on each read of the virtual cycle counter
+ *
+ * @param cycles[in]: cycles counted
+ *
+ * @return void
+ */
+static void clockTestHook(uint32_t cycles)
+{
+    uint32_t scs = SCG->RCCR & SCG_RCCR_SCS_MASK;
+
+    clockTestOscillator(&SCG->FIRCCSR, SCG_FIRCCSR_FIRCEN_MASK, SCG_FIRCCSR_FIRCVLD_MASK, &clockTestFircStart,
+                        cycles);
+    clockTestOscillator(&SCG->SIRCCSR, SCG_SIRCCSR_SIRCEN_MASK, SCG_SIRCCSR_SIRCVLD_MASK, &clockTestSircStart,
+                        cycles);
+
+    /* The switch completes at the next cycle */
+    *(volatile uint32_t *)&SCG->CSR = (SCG->CSR & ~SCG_CSR_SCS_MASK) | scs;
+}
+
+/**
+ * @brief This function is used to record the frequency the system clock changed to
+ *
+ * @param frequency[in]: frequency in Hz
+ *
+ * @return void
+ */
+static void clockTestChange(uint32_t frequency)
+{
+    clockTestChanges++;
+    clockTestFrequency = frequency;
+}
+
+/**
+ * @brief This function is used to read the statistics of a clock source
+ *
+ * @param source[in]: clock source
+ *
+ * @return SCG_Wait_Statistics_t: statistics, all 0 if they cannot be read
+ */
+static SCG_Wait_Statistics_t clockTestStatistics(SCG_ClockSource_t source)
+{
+    SCG_Wait_Statistics_t statistics = { 0 };
+
+    (void)SCG_GetWaitStatistics(source, &statistics);
+
+    return statistics;
+}
+
+/**
+ * @brief This function is used to run the system on SPLL
+ *
+ * @return void
+ */
+static void clockTestOnSpll(void)
+{
+    SCG->RCCR = SCG_RCCR_SCS(CLOCK_TEST_SCS_SPLL);
+    *(volatile uint32_t *)&SCG->CSR = SCG_CSR_SCS(CLOCK_TEST_SCS_SPLL);
+    SCG->SPLLCSR = SCG_SPLLCSR_SPLLEN_MASK | SCG_SPLLCSR_SPLLVLD_MASK;
+    clock = CLOCK_TEST_SPLL_HZ;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    SCG_Wait_Statistics_t statistics;
+    SCG_Wait_Statistics_t sosc;
+
+    simReset();
+    SCG->RCCR = SCG_RCCR_SCS(SCG_SCS_FIRC);
+    simCycleHookSet(clockTestHook);
+    TEST_CHECK(SCG_E_OK == SCG_SetWaitBudget(CLOCK_TEST_BUDGET));
+    TEST_CHECK(SCG_E_OK == SCG_ClockChangeCallbackRegister(clockTestChange));
+    TEST_CHECK(SCG_E_NOT_OK == SCG_GetWaitStatistics((SCG_ClockSource_t)SCG_CLOCK_SOURCE_NUM, &statistics));
+
+    /* SIRC becomes valid within the budget, its wait is measured */
+    TEST_CHECK(SCG_E_OK == SCG_SystemClock_Config(SCG_CLOCK_SIRC));
+    statistics = clockTestStatistics(SCG_CLOCK_SIRC);
+    TEST_CHECK((CLOCK_TEST_START <= statistics.lastCycles) && (statistics.lastCycles < (2U * CLOCK_TEST_START)));
+    TEST_CHECK((statistics.maxCycles == statistics.lastCycles) && (0U == statistics.timeouts));
+    TEST_CHECK((1U == clockTestChanges) && (48000000U == clockTestFrequency));
+
+    /* SOSC never becomes valid: timeout once the budget is spent, back to FIRC and SOSC disabled */
+    clockTestOnSpll();
+    TEST_CHECK(SCG_E_TIMEOUT == SCG_SystemClock_Config(SCG_CLOCK_SOSC));
+    TEST_CHECK(SCG_SCS_FIRC == ((SCG->CSR & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT));
+    TEST_CHECK(SCG_SCS_FIRC == ((SCG->RCCR & SCG_RCCR_SCS_MASK) >> SCG_RCCR_SCS_SHIFT));
+    TEST_CHECK((48000000U == clock) && (0U == (SCG->SOSCCSR & SCG_SOSCCSR_SOSCEN_MASK)));
+    TEST_CHECK((2U == clockTestChanges) && (48000000U == clockTestFrequency));
+    sosc = clockTestStatistics(SCG_CLOCK_SOSC);
+    TEST_CHECK((CLOCK_TEST_BUDGET < sosc.lastCycles) && (sosc.lastCycles <= (CLOCK_TEST_BUDGET + 8U)));
+    TEST_CHECK((sosc.maxCycles == sosc.lastCycles) && (1U == sosc.timeouts));
+
+    /* SPLL never locks with FIRC off as well: FIRC is started again and waited for before the switch */
+    clockTestOnSpll();
+    SCG->FIRCCSR = 0;
+    TEST_CHECK(SCG_E_TIMEOUT == SCG_SystemClock_Config(SCG_CLOCK_SPLL));
+    TEST_CHECK(SCG_SCS_FIRC == ((SCG->CSR & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT));
+    TEST_CHECK((48000000U == clock) && (0U == (SCG->SPLLCSR & SCG_SPLLCSR_SPLLEN_MASK)));
+    TEST_CHECK(0U != (SCG->FIRCCSR & SCG_FIRCCSR_FIRCVLD_MASK));
+    statistics = clockTestStatistics(SCG_CLOCK_SPLL);
+    TEST_CHECK((CLOCK_TEST_BUDGET < statistics.lastCycles) && (1U == statistics.timeouts));
+    statistics = clockTestStatistics(SCG_CLOCK_FIRC);
+    TEST_CHECK((CLOCK_TEST_START <= statistics.lastCycles) && (0U == statistics.timeouts));
+
+    /* A longer budget raises the longest wait of SOSC, a shorter one leaves it */
+    TEST_CHECK(SCG_E_OK == SCG_SetWaitBudget(2U * CLOCK_TEST_BUDGET));
+    TEST_CHECK(SCG_E_TIMEOUT == SCG_SystemClock_Config(SCG_CLOCK_SOSC));
+    statistics = clockTestStatistics(SCG_CLOCK_SOSC);
+    TEST_CHECK(((2U * CLOCK_TEST_BUDGET) < statistics.lastCycles) && (statistics.maxCycles == statistics.lastCycles));
+    TEST_CHECK(2U == statistics.timeouts);
+    sosc = statistics;
+    TEST_CHECK(SCG_E_OK == SCG_SetWaitBudget(CLOCK_TEST_BUDGET));
+    TEST_CHECK(SCG_E_TIMEOUT == SCG_SystemClock_Config(SCG_CLOCK_SOSC));
+    statistics = clockTestStatistics(SCG_CLOCK_SOSC);
+    TEST_CHECK((statistics.lastCycles < sosc.maxCycles) && (statistics.maxCycles == sosc.maxCycles));
+    TEST_CHECK((3U == statistics.timeouts) && (5U == clockTestChanges));
+
+    return testFinish();
+}
@@ -0,0 +1,156 @@
+/**
+ * @file CrcTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the CRC engine against a bit by bit reference
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "s32k144_crc_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define CRC_TEST_RUNS       (2000U) /* Random buffers checked */
+#define CRC_TEST_LEN_MAX    (300U)  /* Longest random buffer */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint32_t crcTestSeed = 1U;   /* State of the pseudo random generator */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to draw a pseudo random number, the same sequence on every host
+ *
+ * @return uint32_t: number from 0 to 0x7FFF
+ */
+static uint32_t crcTestRandom(void)
+{
+    crcTestSeed = (crcTestSeed * 1103515245U) + 12345U;
+
+    return (crcTestSeed >> 16) & 0x7FFFU;
+}
+
+/**
+ * @brief This function is used to compute CRC-16-CCITT bit by bit
+ *
+ * @param crc[in]: CRC of the previous data
+ * @param pData[in]: data
+ * @param len[in]: length of the data
+ *
+ * @return uint16_t: CRC
+ */
+static uint16_t crcTestReference16(uint16_t crc, const uint8_t *pData, uint32_t len)
+{
+    for(uint32_t i = 0; i < len; i++)
+    {
+        crc ^= (uint16_t)(pData[i] << 8);
+
+        for(uint32_t bit = 0; bit < 8U; bit++)
+        {
+            crc = (0 != (crc & 0x8000U)) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief This function is used to compute the reflected CRC-32 bit by bit
+ *
+ * @param crc[in]: CRC of the previous data
+ * @param pData[in]: data
+ * @param len[in]: length of the data
+ *
+ * @return uint32_t: CRC
+ */
+static uint32_t crcTestReference32(uint32_t crc, const uint8_t *pData, uint32_t len)
+{
+    for(uint32_t i = 0; i < len; i++)
+    {
+        crc ^= pData[i];
+
+        for(uint32_t bit = 0; bit < 8U; bit++)
+        {
+            crc = (0 != (crc & 1U)) ? ((crc >> 1) ^ 0xEDB88320U) : (crc >> 1);
+        }
+    }
+
+    return crc;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static uint8_t buffer[CRC_TEST_LEN_MAX];
+    uint8_t arr[10];
+    uint8_t linear[9];
+    Std_Queue_Types queue;
+
+    simReset();
+
+    TEST_CHECK(CRC_E_OK == CRC_SelfTest());
+
+    /* Any split of the data gives the CRC of the whole */
+    for(uint32_t run = 0; run < CRC_TEST_RUNS; run++)
+    {
+        uint32_t len = crcTestRandom() % CRC_TEST_LEN_MAX;
+        uint32_t split = (0 != len) ? (crcTestRandom() % len) : 0U;
+
+        for(uint32_t i = 0; i < len; i++)
+        {
+            buffer[i] = (uint8_t)crcTestRandom();
+        }
+
+        TEST_CHECK(crcTestReference16(0xFFFFU, buffer, len) ==
+                   CRC16_Update(CRC16_Update(0xFFFFU, buffer, split), &buffer[split], len - split));
+        TEST_CHECK(crcTestReference32(0xFFFFFFFFU, buffer, len) ==
+                   CRC32_Update(CRC32_Update(0xFFFFFFFFU, buffer, split), &buffer[split], len - split));
+    }
+
+    /* A ring wrapped around its end is read as its two spans, in order and without popping */
+    queueInit(&queue, arr, sizeof(arr));
+
+    for(uint32_t i = 0; i < 7U; i++)
+    {
+        queuePush(&queue, (uint8_t)i);
+    }
+
+    for(uint32_t i = 0; i < 5U; i++)
+    {
+        (void)queuePop(&queue);
+    }
+
+    for(uint32_t i = 7U; i < 14U; i++)
+    {
+        queuePush(&queue, (uint8_t)i);
+    }
+
+    for(uint32_t i = 0; i < sizeof(linear); i++)
+    {
+        linear[i] = (uint8_t)(5U + i);
+    }
+
+    TEST_CHECK(crcTestReference16(0xFFFFU, linear, sizeof(linear)) == CRC16_UpdateQueue(0xFFFFU, &queue));
+    TEST_CHECK(crcTestReference32(0xFFFFFFFFU, linear, sizeof(linear)) == CRC32_UpdateQueue(0xFFFFFFFFU, &queue));
+    TEST_CHECK(9U == queue.size);
+
+    /* The peripheral path enables the clock of the CRC module */
+    TEST_CHECK(CRC_E_OK == CRC_HwInit());
+    TEST_CHECK(0U != (PCC->PCCn[PCC_CRC_INDEX] & PCC_PCCn_CGC_MASK));
+    TEST_CHECK(CRC_E_OK == CRC_HwStart(CRC_WIDTH_32BITS));
+    TEST_CHECK(CRC_E_NOT_OK == CRC_HwUpdate(0, 1U));
+
+    return testFinish();
+}
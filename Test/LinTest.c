@@ -0,0 +1,202 @@
+/**
+ * @file LinTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of a LIN master and a LIN slave on a simulated bus
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The master runs on LPUART0 and the slave on LPUART1. Every character a node sends is received by the
+ * nodes on the bus, the sender included, as the LIN transceiver reads the line back.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "Lin.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LIN_TEST_NO_FAULT   (0xFFFFFFFFU)   /* Character index meaning no character is corrupted */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t linTestIsSlaveOnBus = 1U;                /* 0 when the slave is disconnected */
+static uint32_t linTestCharacters;                      /* Characters sent on the bus */
+static uint32_t linTestFault = LIN_TEST_NO_FAULT;       /* Index of the character whose bit 4 is flipped */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to put a character on the bus, each node connected receives it
+ *
+ * @param sent[in]: character or SIM_LPUART_BREAK
+ *
+ * @return void
+ */
+static void linTestDeliver(uint32_t sent)
+{
+    LPUART_Type *const nodes[2] = { LPUART0, LPUART1 };
+    uint8_t nOfNodes = (0 != linTestIsSlaveOnBus) ? 2U : 1U;
+
+    if((SIM_LPUART_BREAK != sent) && (linTestFault == linTestCharacters++))
+    {
+        sent ^= 0x10U;
+    }
+
+    for(uint8_t i = 0; i < nOfNodes; i++)
+    {
+        if(SIM_LPUART_BREAK == sent)
+        {
+            nodes[i]->STAT |= LPUART_STAT_LBKDIF_MASK;
+            simIrq((0U == i) ? LPUART0_RxTx_IRQn : LPUART1_RxTx_IRQn);
+        }
+        else
+        {
+            simLpuartReceive(nodes[i], (uint8_t)sent);
+        }
+    }
+}
+
+/**
+ * @brief This function is used to run the bus until no node has anything left to send
+ *
+ * @return void
+ */
+static void linTestBus(void)
+{
+    uint8_t isBusy = 1U;
+
+    while(0 != isBusy)
+    {
+        uint32_t sent = simLpuartSent(LPUART0);
+
+        isBusy = 0;
+
+        if(SIM_LPUART_IDLE != sent)
+        {
+            linTestDeliver(sent);
+            isBusy = 1U;
+        }
+
+        sent = simLpuartSent(LPUART1);
+
+        if((SIM_LPUART_IDLE != sent) && (0 != linTestIsSlaveOnBus))
+        {
+            linTestDeliver(sent);
+            isBusy = 1U;
+        }
+    }
+}
+
+/**
+ * @brief This function is used to run a number of ticks of the master schedule with the bus
+ *
+ * @param master[in/out]: master node
+ * @param nOfTicks[in]: number of ticks
+ *
+ * @return void
+ */
+static void linTestRun(Std_Lin_Types *master, uint32_t nOfTicks)
+{
+    for(uint32_t i = 0; i < nOfTicks; i++)
+    {
+        linTick(master);
+        linTestBus();
+    }
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static Std_Lin_Types master;
+    static Std_Lin_Types slave;
+    uint8_t masterCommand[2] = { 0x11U, 0x22U };
+    uint8_t masterStatus[4] = { 0 };
+    uint8_t masterDiag[8] = { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U };
+    uint8_t slaveCommand[2] = { 0 };
+    uint8_t slaveStatus[4] = { 0xA1U, 0xB2U, 0xC3U, 0xD4U };
+    uint8_t slaveDiag[8] = { 0 };
+    Std_Lin_Frame_Types masterFrames[] =
+    {
+        { .id = 0x10U, .length = 2U, .checksum = LIN_CHECKSUM_ENHANCED,
+          .direction = LIN_FRAME_PUBLISH, .data = masterCommand },
+        { .id = 0x20U, .length = 4U, .checksum = LIN_CHECKSUM_ENHANCED,
+          .direction = LIN_FRAME_SUBSCRIBE, .data = masterStatus },
+        { .id = 0x3CU, .length = 8U, .checksum = LIN_CHECKSUM_ENHANCED,
+          .direction = LIN_FRAME_PUBLISH, .data = masterDiag },
+    };
+    Std_Lin_Frame_Types slaveFrames[] =
+    {
+        { .id = 0x10U, .length = 2U, .checksum = LIN_CHECKSUM_ENHANCED,
+          .direction = LIN_FRAME_SUBSCRIBE, .data = slaveCommand },
+        { .id = 0x20U, .length = 4U, .checksum = LIN_CHECKSUM_ENHANCED,
+          .direction = LIN_FRAME_PUBLISH, .data = slaveStatus },
+        { .id = 0x3CU, .length = 8U, .checksum = LIN_CHECKSUM_CLASSIC,
+          .direction = LIN_FRAME_SUBSCRIBE, .data = slaveDiag },
+    };
+    const Std_Lin_Slot_Types schedule[] = { { 0U, 2U }, { 1U, 2U }, { 2U, 2U } };
+    LPUART_Handle_Type masterHandle =
+    {
+        .pLPUARTx = LPUART0,
+        .LPUART_Config =
+        {
+            .frameLenth = LPUART_FRAME_8BITS,
+            .parityMode = LPUART_PARITY_DISABLE,
+            .nOfStopBits = LPUART_STOP_BITS_1,
+            .msbFirst = LPUART_LSB_FIRST,
+            .baudRate = 19200U,
+        },
+    };
+    LPUART_Handle_Type slaveHandle = masterHandle;
+
+    simReset();
+    slaveHandle.pLPUARTx = LPUART1;
+
+    /* Identifiers and checksums of the specification */
+    TEST_CHECK(0x3CU == linComputePid(0x3CU));
+    TEST_CHECK(0xC1U == linComputePid(0x01U));
+    TEST_CHECK(0x20U == linComputePid(0x20U));
+    TEST_CHECK(0xE6U == linChecksum(0x4AU, (const uint8_t[]){ 0x55U, 0x93U, 0xE5U }, 3U));
+
+    TEST_CHECK(LIN_E_OK == linInit(&master, &masterHandle, LIN_ROLE_MASTER, masterFrames, 3U));
+    TEST_CHECK(LIN_E_OK == linInit(&slave, &slaveHandle, LIN_ROLE_SLAVE, slaveFrames, 3U));
+    TEST_CHECK(LIN_E_NOT_OK == linSetSchedule(&slave, schedule, 3U));
+    TEST_CHECK(LIN_E_OK == linSetSchedule(&master, schedule, 3U));
+
+    /* One round of the schedule: command to the slave, status from it and a classic diagnostic frame */
+    linTestRun(&master, 6U);
+    TEST_CHECK((0x11U == slaveCommand[0]) && (0x22U == slaveCommand[1]) && (1U == slaveFrames[0].isUpdated));
+    TEST_CHECK((0xA1U == masterStatus[0]) && (0xD4U == masterStatus[3]) && (1U == masterFrames[1].isUpdated));
+    TEST_CHECK((1U == slaveDiag[0]) && (8U == slaveDiag[7]) && (1U == slaveFrames[2].isUpdated));
+    TEST_CHECK(0U == master.errors.checksumErrors + master.errors.readbackErrors + master.errors.noResponses);
+    TEST_CHECK(0U == slave.errors.checksumErrors + slave.errors.parityErrors + slave.errors.syncErrors);
+
+    /* A flipped bit in the first data byte of the command: the master reads back another byte and stops the
+       response, the slave does not take the frame */
+    slaveFrames[0].isUpdated = 0;
+    linTestFault = linTestCharacters + 2U;
+    linTestRun(&master, 2U);
+    TEST_CHECK(1U == master.errors.readbackErrors);
+    TEST_CHECK(0U == slaveFrames[0].isUpdated);
+
+    /* A flipped bit in the sync field, seen by both nodes */
+    linTestFault = linTestCharacters;
+    linTestRun(&master, 2U);
+    TEST_CHECK((1U == slave.errors.syncErrors) && (1U == master.errors.syncErrors));
+
+    /* Without the slave the status slot ends without a response, counted at the start of the next slot */
+    linTestFault = LIN_TEST_NO_FAULT;
+    linTestRun(&master, 2U);
+    linTestIsSlaveOnBus = 0;
+    linTestRun(&master, 6U);
+    TEST_CHECK(1U == master.errors.noResponses);
+
+    return testFinish();
+}
@@ -0,0 +1,193 @@
+/**
+ * @file LoggerTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the deferred logger: the frames drained over LPUART0, the loss of a full ring and
+ *        the cycles of a log call
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The frames sent by LPUART0 are written to LoggerTest.bin, behind a few bytes of noise and with a
+ * corrupted frame in the middle, and the text each message must give to LoggerTest.txt. ctest checks
+ * that Tools/LogDecoder turns the first file into the second. The test is built with TRACE_ENABLE and
+ * the cycle counter follows the host clock, so the TRACE_ID_LOG_RECORD point holds the cycles of
+ * logRecord.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "Logger.h"
+#include "Trace.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LOGGER_TEST_CAPTURE_MAX     (2048U)     /* Bytes of the capture */
+#define LOGGER_TEST_TEXT_MAX        (2048U)     /* Characters of the text expected */
+#define LOGGER_TEST_BURST           (LOG_RING_SIZE + 8U)    /* Messages recorded without drain */
+#define LOGGER_TEST_CYCLES_MAX      (50U)       /* Target of a log call */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t loggerTestRxArr[8];                          /* Rx ring of LPUART0, not used */
+static uint8_t loggerTestTxArr[255];                        /* Tx ring of LPUART0 */
+static uint8_t loggerTestCapture[LOGGER_TEST_CAPTURE_MAX];  /* Bytes sent by LPUART0 */
+static uint32_t loggerTestCaptureLen;                       /* Number of bytes in the capture */
+static char loggerTestText[LOGGER_TEST_TEXT_MAX];           /* Text expected from the decoder */
+static uint32_t loggerTestTextLen;                          /* Number of characters of the text */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to add bytes to the capture
+ *
+ * @param pData[in]: bytes
+ * @param len[in]: number of bytes
+ *
+ * @return void
+ */
+static void loggerTestCaptureAdd(const uint8_t *pData, uint32_t len)
+{
+    for(uint32_t i = 0; (i < len) && (loggerTestCaptureLen < LOGGER_TEST_CAPTURE_MAX); i++)
+    {
+        loggerTestCapture[loggerTestCaptureLen++] = pData[i];
+    }
+}
+
+/**
+ * @brief This function is used to drain the log and capture what LPUART0 sends
+ *
+ * @return uint32_t: number of messages drained
+ */
+static uint32_t loggerTestDrain(void)
+{
+    uint32_t nOfMessages = 0;
+    uint32_t nOfDrained;
+    uint8_t data;
+
+    do
+    {
+        nOfDrained = logDrain();
+        nOfMessages += nOfDrained;
+
+        while(0 != simLpuartTransmit(LPUART0, &data))
+        {
+            loggerTestCaptureAdd(&data, 1U);
+        }
+    } while(0 != nOfDrained);
+
+    return nOfMessages;
+}
+
+/**
+ * @brief This function is used to add a line to the text expected
+ *
+ * @param pLine[in]: line without its line feed
+ *
+ * @return void
+ */
+static void loggerTestExpect(const char *pLine)
+{
+    int len = snprintf(&loggerTestText[loggerTestTextLen], LOGGER_TEST_TEXT_MAX - loggerTestTextLen, "%s\n", pLine);
+
+    if((len > 0) && ((uint32_t)len < (LOGGER_TEST_TEXT_MAX - loggerTestTextLen)))
+    {
+        loggerTestTextLen += (uint32_t)len;
+    }
+}
+
+/**
+ * @brief This function is used to write a buffer to a file
+ *
+ * @param pPath[in]: path of the file
+ * @param pData[in]: data
+ * @param len[in]: bytes of the data
+ *
+ * @return uint8_t: 1 if the file is written
+ */
+static uint8_t loggerTestWrite(const char *pPath, const void *pData, uint32_t len)
+{
+    FILE *pFile = fopen(pPath, "wb");
+    uint8_t isWritten = 0;
+
+    if(0 != pFile)
+    {
+        isWritten = (len == fwrite(pData, 1U, len, pFile)) ? 1U : 0U;
+        isWritten = (0 == fclose(pFile)) ? isWritten : 0U;
+    }
+
+    return isWritten;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static const uint8_t noise[3] = { 0x00U, 0x5AU, 0x13U };
+    static const uint8_t corrupted[9] = { LOG_FRAME_SYNC, 0x01U, 0x00U, 0x01U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U };
+    Trace_Stats_Types stats;
+    char line[64];
+
+    simReset();
+    simCycleModeSet(SIM_CYCLE_HOST);
+    traceInit();
+    (void)LPUART_BufferInit(LPUART0, loggerTestRxArr, sizeof(loggerTestRxArr), loggerTestTxArr,
+                            sizeof(loggerTestTxArr));
+    logInit(LPUART0);
+    loggerTestCaptureAdd(noise, sizeof(noise));
+
+    /* Each message of the table, with its arguments at their limits */
+    LOG_1(LOG_ID_BOOT, 0xDEADBEEFU);
+    LOG_1(LOG_ID_CLOCK_SWITCH, 3U);
+    LOG_2(LOG_ID_UART_INIT, 1U, 115200U);
+    TEST_CHECK(3U == loggerTestDrain());
+    loggerTestCaptureAdd(corrupted, sizeof(corrupted));
+    LOG_2(LOG_ID_UART_ERROR, 2U, 0x0000000AU);
+    LOG_2(LOG_ID_GPIO_EDGE, 3U, 17U);
+    LOG_1(LOG_ID_SHELL_COMMAND, 4294967295U);
+    LOG_0(LOG_ID_BOOT);
+    TEST_CHECK(4U == loggerTestDrain());
+
+    loggerTestExpect("boot, reset cause 0xDEADBEEF");
+    loggerTestExpect("system clock switched to source 3");
+    loggerTestExpect("LPUART1 initialized at 115200 baud");
+    loggerTestExpect("LPUART2 error flags 0x0000000A");
+    loggerTestExpect("PORT3 pin 17 edge");
+    loggerTestExpect("shell command dispatched in 4294967295 cycles");
+    loggerTestExpect("boot, reset cause 0x00000000");
+
+    /* A full ring keeps the oldest messages in order and counts the others */
+    for(uint32_t i = 0; i < LOGGER_TEST_BURST; i++)
+    {
+        LOG_2(LOG_ID_GPIO_EDGE, 4U, i);
+    }
+
+    TEST_CHECK((LOGGER_TEST_BURST - LOG_RING_SIZE) == logGetDropped());
+    TEST_CHECK(LOG_RING_SIZE == loggerTestDrain());
+
+    for(uint32_t i = 0; i < LOG_RING_SIZE; i++)
+    {
+        (void)snprintf(line, sizeof(line), "PORT4 pin %u edge", i);
+        loggerTestExpect(line);
+    }
+
+    TEST_CHECK(0U == loggerTestDrain());
+    TEST_CHECK(loggerTestCaptureLen < LOGGER_TEST_CAPTURE_MAX);
+    TEST_CHECK(1U == loggerTestWrite("LoggerTest.bin", loggerTestCapture, loggerTestCaptureLen));
+    TEST_CHECK(1U == loggerTestWrite("LoggerTest.txt", loggerTestText, loggerTestTextLen));
+
+    /* Every call is measured, the dropped ones too */
+    TEST_CHECK(TRACE_E_OK == traceRead(TRACE_ID_LOG_RECORD, &stats));
+    TEST_CHECK((7U + LOGGER_TEST_BURST) == stats.count);
+    TEST_CHECK(stats.avg < LOGGER_TEST_CYCLES_MAX);
+    (void)printf("logRecord: %u calls, %u to %u cycles, %u on average at %u Hz\n", stats.count, stats.min,
+                 stats.max, stats.avg, clock);
+
+    return testFinish();
+}
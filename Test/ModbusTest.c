@@ -0,0 +1,290 @@
+/**
+ * @file ModbusTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the Modbus RTU slave: the functions served, the exceptions, the frames not answered,
+ *        the frames too short for their function and the silences timed with the LPIT
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Each request is received by LPUART0 and ended by the idle line interrupt, the slave is polled and its
+ * response is taken from the transmitter. The LPIT runs in the simulator and only moves on the reads of
+ * its counters, so each response is checked to wait for the 3.5 characters of silence after its request
+ * and to start at the first poll after them. The Rx ring is smaller than a few requests, so the frames
+ * are also split across its end. A master on LPUART1 checks the response timeout.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "Modbus.h"
+#include "s32k144_lpit_driver.h"
+#include <stdio.h>
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define MODBUS_TEST_ADDRESS     (0x11U)     /* Address of the slave */
+#define MODBUS_TEST_WIRE_MAX    (64U)       /* Characters of a response */
+#define MODBUS_TEST_FREQUENCY   (48000000U) /* Functional clock of the LPIT */
+#define MODBUS_TEST_TARGET      (MODBUS_TEST_FREQUENCY / 1000U) /* Response started within 1 ms of the silence */
+#define MODBUS_TEST_MARGIN      (32U)       /* LPIT counts polled before the end of a silence */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t modbusTestRxArr[24];                         /* Rx ring of LPUART0 */
+static uint8_t modbusTestTxArr[8];                          /* Tx ring of LPUART0 */
+static uint8_t modbusTestMasterRxArr[8];                    /* Rx ring of LPUART1, not used */
+static uint8_t modbusTestMasterTxArr[8];                    /* Tx ring of LPUART1 */
+static uint8_t modbusTestWire[MODBUS_TEST_WIRE_MAX];        /* Response sent by the slave */
+static uint32_t modbusTestEarly;                            /* Characters sent before the end of a silence */
+static Std_Modbus_Types modbusTestSlave;                    /* Slave under test */
+static Std_Modbus_Types modbusTestMaster;                   /* Master on LPUART1 */
+static uint16_t modbusTestValues[4] = { 0x1234U, 0xABCDU, 0x0007U, 0x0300U };   /* Values of the registers */
+
+static Std_Modbus_Register_Types modbusTestHolding[3] =
+{
+    { .address = 0x0010U, .pValue = &modbusTestValues[0], .isWritable = 1U },
+    { .address = 0x0011U, .pValue = &modbusTestValues[1], .isWritable = 1U },
+    { .address = 0x0012U, .pValue = &modbusTestValues[2], .isWritable = 0U },
+};  /* Holding registers, the last one read only */
+
+static Std_Modbus_Register_Types modbusTestInput[1] =
+{
+    { .address = 0x0000U, .pValue = &modbusTestValues[3], .isWritable = 0U },
+};  /* Input registers */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to send a request to the slave and take its response
+ *
+ * @param pRequest[in]: request without its CRC
+ * @param len[in]: bytes of the request
+ * @param isCrcWrong[in]: 1 to send a wrong CRC
+ *
+ * @return uint32_t: bytes of the response, 0 if the slave did not answer
+ */
+static uint32_t modbusTestExchange(const uint8_t *pRequest, uint32_t len, uint8_t isCrcWrong)
+{
+    uint16_t crc = modbusCrc(0xFFFFU, pRequest, len) ^ ((0 != isCrcWrong) ? 0x0100U : 0U);
+    uint32_t nOfSent = 0;
+    uint8_t data;
+
+    for(uint32_t i = 0; i < len; i++)
+    {
+        simLpuartReceive(LPUART0, pRequest[i]);
+    }
+
+    simLpuartReceive(LPUART0, (uint8_t)crc);
+    simLpuartReceive(LPUART0, (uint8_t)(crc >> 8U));
+
+    /* The line stays idle after the last character, the frame ended the idle time before */
+    LPUART0->STAT |= LPUART_STAT_IDLE_MASK;
+    simIrq(LPUART0_RxTx_IRQn);
+    modbusPoll(&modbusTestSlave);
+
+    /* Nothing is sent until the bus has been silent for 3.5 characters */
+    simLpitAdvance(modbusTestSlave.silenceCycles - modbusTestSlave.idleCycles - MODBUS_TEST_MARGIN);
+    modbusPoll(&modbusTestSlave);
+
+    while(0 != simLpuartTransmit(LPUART0, &data))
+    {
+        modbusTestEarly++;
+    }
+
+    simLpitAdvance(MODBUS_TEST_MARGIN);
+    modbusPoll(&modbusTestSlave);
+
+    while((0 != simLpuartTransmit(LPUART0, &data)) && (nOfSent < MODBUS_TEST_WIRE_MAX))
+    {
+        modbusTestWire[nOfSent++] = data;
+    }
+
+    modbusPoll(&modbusTestSlave);
+
+    return nOfSent;
+}
+
+/**
+ * @brief This function is used to check a response against the bytes expected and its CRC
+ *
+ * @param len[in]: bytes of the response
+ * @param pExpected[in]: response expected without its CRC
+ * @param expectedLen[in]: bytes of the response expected
+ *
+ * @return uint8_t: 1 if the response matches
+ */
+static uint8_t modbusTestIsResponse(uint32_t len, const uint8_t *pExpected, uint32_t expectedLen)
+{
+    return ((len == (expectedLen + 2U)) && (0 == memcmp(modbusTestWire, pExpected, expectedLen)) &&
+            (0U == modbusCrc(0xFFFFU, modbusTestWire, len))) ? 1U : 0U;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    LPUART_Handle_Type handle =
+    {
+        .pLPUARTx = LPUART0,
+        .LPUART_Config =
+        {
+            .frameLenth = LPUART_FRAME_8BITS,
+            .parityMode = LPUART_PARITY_EVEN,
+            .nOfStopBits = LPUART_STOP_BITS_1,
+            .msbFirst = LPUART_LSB_FIRST,
+            .rxInterrupt = LPUART_RX_INTERRUPT_ENABLE,
+            .baudRate = 19200U,
+        },
+    };
+    LPUART_Handle_Type masterHandle = handle;
+    static const LPIT_Timebase_Config_Type timebase =
+    {
+        .source = CLOCK_OPTION_3, .frequency = MODBUS_TEST_FREQUENCY, .tickRate = 0U
+    };
+    static const uint8_t readHolding[6] = { MODBUS_TEST_ADDRESS, 0x03U, 0x00U, 0x10U, 0x00U, 0x02U };
+    static const uint8_t readHoldingResponse[7] = { MODBUS_TEST_ADDRESS, 0x03U, 0x04U, 0x12U, 0x34U, 0xABU, 0xCDU };
+    static const uint8_t readInput[6] = { MODBUS_TEST_ADDRESS, 0x04U, 0x00U, 0x00U, 0x00U, 0x01U };
+    static const uint8_t readInputResponse[5] = { MODBUS_TEST_ADDRESS, 0x04U, 0x02U, 0x03U, 0x00U };
+    static const uint8_t writeSingle[6] = { MODBUS_TEST_ADDRESS, 0x06U, 0x00U, 0x11U, 0x55U, 0xAAU };
+    static const uint8_t writeReadOnly[6] = { MODBUS_TEST_ADDRESS, 0x06U, 0x00U, 0x12U, 0x00U, 0x01U };
+    static const uint8_t writeMultiple[11] =
+    {
+        MODBUS_TEST_ADDRESS, 0x10U, 0x00U, 0x10U, 0x00U, 0x02U, 0x04U, 0x01U, 0x02U, 0x03U, 0x04U
+    };
+    static const uint8_t writeAcrossReadOnly[11] =
+    {
+        MODBUS_TEST_ADDRESS, 0x10U, 0x00U, 0x11U, 0x00U, 0x02U, 0x04U, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+    };
+    static const uint8_t readUnknown[6] = { MODBUS_TEST_ADDRESS, 0x03U, 0x00U, 0x20U, 0x00U, 0x01U };
+    static const uint8_t unknownFunction[2] = { MODBUS_TEST_ADDRESS, 0x2BU };
+    static const uint8_t otherSlave[6] = { 0x05U, 0x06U, 0x00U, 0x10U, 0x00U, 0x09U };
+    static const uint8_t broadcast[6] = { MODBUS_BROADCAST, 0x06U, 0x00U, 0x10U, 0x0BU, 0x0CU };
+    static const uint8_t shortRead[2] = { MODBUS_TEST_ADDRESS, 0x03U };
+    static const uint8_t shortWriteSingle[2] = { MODBUS_TEST_ADDRESS, 0x06U };
+    static const uint8_t shortWriteMultiple[3] = { MODBUS_TEST_ADDRESS, 0x10U, 0x00U };
+    Std_Modbus_Register_Types unsorted[2] = { modbusTestHolding[1], modbusTestHolding[0] };
+    uint8_t expected[3] = { MODBUS_TEST_ADDRESS, 0U, 0U };
+    uint16_t values[2];
+    uint64_t silence;
+    uint32_t len;
+
+    simReset();
+    TEST_CHECK(LPUART_E_OK == LPUART_Init(&handle));
+    TEST_CHECK(LPUART_E_OK == LPUART_BufferInit(LPUART0, modbusTestRxArr, sizeof(modbusTestRxArr), modbusTestTxArr,
+                                                sizeof(modbusTestTxArr)));
+
+    /* The silences cannot be timed before the LPIT timebase runs */
+    TEST_CHECK(MODBUS_E_NOT_OK == modbusInit(&modbusTestSlave, LPUART0, MODBUS_ROLE_SLAVE, MODBUS_TEST_ADDRESS));
+    TEST_CHECK(LPIT_E_OK == LPIT_TimebaseInit(&timebase));
+    TEST_CHECK(MODBUS_E_OK == modbusInit(&modbusTestSlave, LPUART0, MODBUS_ROLE_SLAVE, MODBUS_TEST_ADDRESS));
+
+    /* 3.5 characters of 11 bits, up to the rounding of each step */
+    silence = (7ULL * MODBUS_TEST_FREQUENCY * 11U) / (2ULL * LPUART_GetBaudRate(LPUART0));
+    TEST_CHECK((modbusTestSlave.silenceCycles <= silence) && ((silence - 2U) <= modbusTestSlave.silenceCycles));
+    TEST_CHECK((modbusTestSlave.idleCycles + MODBUS_TEST_MARGIN) < modbusTestSlave.silenceCycles);
+    TEST_CHECK(MODBUS_E_NOT_OK == modbusSetRegisters(&modbusTestSlave, modbusTestHolding, 3U, unsorted, 2U));
+    TEST_CHECK(MODBUS_E_OK == modbusSetRegisters(&modbusTestSlave, modbusTestHolding, 3U, modbusTestInput, 1U));
+
+    /* A request too short for its function is the first data of the ring, nothing follows it there. Its
+       fields are not read, the slave answers an illegal value */
+    expected[1] = 0x83U;
+    expected[2] = MODBUS_EX_ILLEGAL_VALUE;
+    TEST_CHECK(1U == modbusTestIsResponse(modbusTestExchange(shortRead, sizeof(shortRead), 0), expected, 3U));
+    expected[1] = 0x86U;
+    TEST_CHECK(1U == modbusTestIsResponse(modbusTestExchange(shortWriteSingle, sizeof(shortWriteSingle), 0),
+                                          expected, 3U));
+    expected[1] = 0x90U;
+    TEST_CHECK(1U == modbusTestIsResponse(modbusTestExchange(shortWriteMultiple, sizeof(shortWriteMultiple), 0),
+                                          expected, 3U));
+    TEST_CHECK((0xABCDU == modbusTestValues[1]) && (0U == modbusTestHolding[1].isUpdated));
+
+    /* The functions served, the ring wraps inside some of the requests */
+    len = modbusTestExchange(readHolding, sizeof(readHolding), 0);
+    TEST_CHECK(1U == modbusTestIsResponse(len, readHoldingResponse, sizeof(readHoldingResponse)));
+    len = modbusTestExchange(readInput, sizeof(readInput), 0);
+    TEST_CHECK(1U == modbusTestIsResponse(len, readInputResponse, sizeof(readInputResponse)));
+
+    len = modbusTestExchange(writeSingle, sizeof(writeSingle), 0);
+    TEST_CHECK(1U == modbusTestIsResponse(len, writeSingle, sizeof(writeSingle)));
+    TEST_CHECK((0x55AAU == modbusTestValues[1]) && (1U == modbusTestHolding[1].isUpdated));
+    modbusTestHolding[1].isUpdated = 0;
+
+    len = modbusTestExchange(writeMultiple, sizeof(writeMultiple), 0);
+    TEST_CHECK(1U == modbusTestIsResponse(len, writeMultiple, 6U));
+    TEST_CHECK((0x0102U == modbusTestValues[0]) && (0x0304U == modbusTestValues[1]));
+    modbusTestHolding[0].isUpdated = 0;
+    modbusTestHolding[1].isUpdated = 0;
+
+    /* The exceptions, a write refused on one register writes none of them */
+    expected[1] = 0x86U;
+    expected[2] = MODBUS_EX_ILLEGAL_ADDRESS;
+    TEST_CHECK(1U == modbusTestIsResponse(modbusTestExchange(writeReadOnly, sizeof(writeReadOnly), 0), expected, 3U));
+    expected[1] = 0x90U;
+    TEST_CHECK(1U == modbusTestIsResponse(modbusTestExchange(writeAcrossReadOnly, sizeof(writeAcrossReadOnly), 0),
+                                          expected, 3U));
+    TEST_CHECK((0x0304U == modbusTestValues[1]) && (0x0007U == modbusTestValues[2]) &&
+               (0U == modbusTestHolding[1].isUpdated));
+    expected[1] = 0x83U;
+    TEST_CHECK(1U == modbusTestIsResponse(modbusTestExchange(readUnknown, sizeof(readUnknown), 0), expected, 3U));
+    expected[1] = 0xABU;
+    expected[2] = MODBUS_EX_ILLEGAL_FUNCTION;
+    TEST_CHECK(1U == modbusTestIsResponse(modbusTestExchange(unknownFunction, sizeof(unknownFunction), 0),
+                                          expected, 3U));
+
+    /* The requests of another slave and a wrong CRC are not answered, a broadcast is executed only */
+    TEST_CHECK(0U == modbusTestExchange(otherSlave, sizeof(otherSlave), 0));
+    TEST_CHECK(0U == modbusTestExchange(readHolding, sizeof(readHolding), 1U));
+    TEST_CHECK(0U == modbusTestExchange(broadcast, sizeof(broadcast), 0));
+    TEST_CHECK((0x0B0CU == modbusTestValues[0]) && (1U == modbusTestHolding[0].isUpdated));
+
+    /* The slave still answers after all of them */
+    len = modbusTestExchange(readInput, sizeof(readInput), 0);
+    TEST_CHECK(1U == modbusTestIsResponse(len, readInputResponse, sizeof(readInputResponse)));
+
+    TEST_CHECK((14U == modbusTestSlave.stats.frames) && (1U == modbusTestSlave.stats.crcErrors) &&
+               (7U == modbusTestSlave.stats.exceptions) && (0U == modbusTestSlave.stats.overruns));
+    TEST_CHECK(MODBUS_STATE_IDLE == modbusTestSlave.state);
+
+    /* Every response waited for the silence and started within 1 ms of its end */
+    TEST_CHECK(0U == modbusTestEarly);
+    TEST_CHECK(modbusTestSlave.silenceCycles <= modbusTestSlave.stats.latencyMax);
+    TEST_CHECK(modbusTestSlave.stats.latencyMax < (modbusTestSlave.silenceCycles + MODBUS_TEST_TARGET));
+
+    /* A request of the master without response times out after MODBUS_RESPONSE_TIMEOUT_US */
+    masterHandle.pLPUARTx = LPUART1;
+    TEST_CHECK(LPUART_E_OK == LPUART_Init(&masterHandle));
+    TEST_CHECK(LPUART_E_OK == LPUART_BufferInit(LPUART1, modbusTestMasterRxArr, sizeof(modbusTestMasterRxArr),
+                                                modbusTestMasterTxArr, sizeof(modbusTestMasterTxArr)));
+    TEST_CHECK(MODBUS_E_OK == modbusInit(&modbusTestMaster, LPUART1, MODBUS_ROLE_MASTER, 0U));
+    TEST_CHECK(MODBUS_E_OK == modbusRequest(&modbusTestMaster, MODBUS_TEST_ADDRESS, MODBUS_FC_READ_HOLDING, 0x0010U,
+                                            2U, values));
+    modbusPoll(&modbusTestMaster);
+    len = 0;
+
+    while(0 != simLpuartTransmit(LPUART1, &modbusTestWire[len]))
+    {
+        len++;
+    }
+
+    TEST_CHECK((8U == len) && (0 == memcmp(modbusTestWire, readHolding, sizeof(readHolding))));
+    modbusPoll(&modbusTestMaster);
+    TEST_CHECK(MODBUS_STATE_WAIT_REPLY == modbusTestMaster.state);
+    simLpitAdvance(((uint64_t)MODBUS_RESPONSE_TIMEOUT_US * (MODBUS_TEST_FREQUENCY / 1000000U)) - MODBUS_TEST_MARGIN);
+    modbusPoll(&modbusTestMaster);
+    TEST_CHECK(MODBUS_E_BUSY == modbusGetResult(&modbusTestMaster, 0));
+    simLpitAdvance(MODBUS_TEST_MARGIN);
+    modbusPoll(&modbusTestMaster);
+    TEST_CHECK(MODBUS_E_TIMEOUT == modbusGetResult(&modbusTestMaster, 0));
+    TEST_CHECK((1U == modbusTestMaster.stats.timeouts) && (MODBUS_STATE_IDLE == modbusTestMaster.state));
+    (void)printf("%u frames served, %u exceptions, %u CRC errors\n", modbusTestSlave.stats.frames,
+                 modbusTestSlave.stats.exceptions, modbusTestSlave.stats.crcErrors);
+
+    return testFinish();
+}
@@ -0,0 +1,227 @@
+/**
+ * @file ReconfigureTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the live switch of LPUART_Reconfigure, the data kept on both sides of it and the
+ *        switch-over gap on the wire
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The wire of LPUART0 is a list of character times. At the end of each one the transmitter has shifted
+ * out its character, TDRE and TC are set and the handler runs if TIE or TCIE is enabled, as the NVIC
+ * would call it. The write of a character clears both flags, so the receive interrupts in between do not
+ * write more. Each character is sent with the BAUD register it was written with, LPUART0 switches from
+ * 9600 8E1 to 115200 8N1.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "s32k144_lpuart_driver.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define RECONFIGURE_TEST_LEN        (30U)   /* Bytes queued with each setting */
+#define RECONFIGURE_TEST_AHEAD      (10U)   /* Character times sent before the switch is requested */
+#define RECONFIGURE_TEST_RX_LEN     (5U)    /* Bytes in the Rx ring at the switch */
+#define RECONFIGURE_TEST_SLOTS      (100U)  /* Character times of the run */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t reconfigureTestRxArr[32];    /* Rx ring of LPUART0 */
+static uint8_t reconfigureTestTxArr[64];    /* Tx ring of LPUART0 */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to run one character time of the wire of LPUART0
+ *
+ * @return uint32_t: character the handler wrote, SIM_LPUART_IDLE if none
+ */
+static uint32_t reconfigureTestSlot(void)
+{
+    uint32_t sent;
+
+    (void)simLpuartSent(LPUART0);
+    LPUART0->STAT |= LPUART_STAT_TDRE_MASK | LPUART_STAT_TC_MASK;
+
+    if(0 != (LPUART0->CTRL & (LPUART_CTRL_TIE_MASK | LPUART_CTRL_TCIE_MASK)))
+    {
+        simIrq(LPUART0_RxTx_IRQn);
+    }
+
+    sent = simLpuartSent(LPUART0);
+
+    /* The write of the data register clears the flags until the end of the character */
+    if(SIM_LPUART_IDLE != sent)
+    {
+        LPUART0->STAT &= ~(LPUART_STAT_TDRE_MASK | LPUART_STAT_TC_MASK);
+    }
+
+    return sent;
+}
+
+/**
+ * @brief This function is used to queue bytes following a sequence
+ *
+ * @param first[in]: value of the first byte
+ *
+ * @return uint32_t: number of bytes queued
+ */
+static uint32_t reconfigureTestQueue(uint8_t first)
+{
+    uint8_t data[RECONFIGURE_TEST_LEN];
+
+    for(uint32_t i = 0; i < RECONFIGURE_TEST_LEN; i++)
+    {
+        data[i] = (uint8_t)(first + i);
+    }
+
+    return LPUART_Send(LPUART0, data, RECONFIGURE_TEST_LEN);
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    LPUART_Handle_Type handles[2] =
+    {
+        {
+            .pLPUARTx = LPUART0,
+            .LPUART_Config =
+            {
+                .frameLenth = LPUART_FRAME_8BITS,
+                .parityMode = LPUART_PARITY_EVEN,
+                .nOfStopBits = LPUART_STOP_BITS_1,
+                .msbFirst = LPUART_LSB_FIRST,
+                .rxInterrupt = LPUART_RX_INTERRUPT_ENABLE,
+                .baudRate = 9600U,
+            },
+        },
+        {
+            .pLPUARTx = LPUART0,
+            .LPUART_Config =
+            {
+                .frameLenth = LPUART_FRAME_8BITS,
+                .parityMode = LPUART_PARITY_DISABLE,
+                .nOfStopBits = LPUART_STOP_BITS_1,
+                .msbFirst = LPUART_LSB_FIRST,
+                .rxInterrupt = LPUART_RX_INTERRUPT_ENABLE,
+                .baudRate = 115200U,
+            },
+        },
+    };
+    LPUART_Profile_Type profiles[2];
+    LPUART_Statistics_Type statistics;
+    uint8_t received[RECONFIGURE_TEST_RX_LEN + 1U];
+    uint32_t baudOld;
+    uint32_t nOfOld = 0;
+    uint32_t nOfNew = 0;
+    uint32_t nOfErrors = 0;
+    uint32_t lastOld = 0;
+    uint32_t firstNew = 0;
+    uint32_t switchSlot = 0;
+
+    simReset();
+    simCycleModeSet(SIM_CYCLE_VIRTUAL);
+    TEST_CHECK(LPUART_E_OK == LPUART_ProfileCompile(&handles[0], &profiles[0]));
+    TEST_CHECK(LPUART_E_OK == LPUART_ProfileCompile(&handles[1], &profiles[1]));
+    TEST_CHECK(profiles[0].baud != profiles[1].baud);
+    (void)LPUART_Init(&handles[0]);
+    (void)LPUART_BufferInit(LPUART0, reconfigureTestRxArr, sizeof(reconfigureTestRxArr), reconfigureTestTxArr,
+                            sizeof(reconfigureTestTxArr));
+    baudOld = LPUART0->BAUD;
+    TEST_CHECK(profiles[0].baud == baudOld);
+
+    /* Part of the old data is on the wire and the Rx ring holds data when the switch is requested */
+    TEST_CHECK(RECONFIGURE_TEST_LEN == reconfigureTestQueue(0));
+
+    for(uint32_t slot = 0; slot < RECONFIGURE_TEST_AHEAD; slot++)
+    {
+        nOfErrors += (slot == reconfigureTestSlot()) ? 0U : 1U;
+    }
+
+    for(uint32_t i = 0; i < RECONFIGURE_TEST_RX_LEN; i++)
+    {
+        simLpuartReceive(LPUART0, (uint8_t)('r' + i));
+    }
+
+    TEST_CHECK(LPUART_E_OK == LPUART_Reconfigure(LPUART0, &profiles[1], LPUART_SWITCH_DEFERRED, 1U));
+    TEST_CHECK(1U == LPUART_IsReconfigurePending(LPUART0));
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_Reconfigure(LPUART0, &profiles[0], LPUART_SWITCH_DEFERRED, 1U));
+
+    /* Nothing is queued behind the switch, the new data is sent as soon as it is applied */
+    TEST_CHECK(0U == reconfigureTestQueue(0x80U));
+    TEST_CHECK(0U == LPUART_GetTxFree(LPUART0));
+
+    for(uint32_t slot = RECONFIGURE_TEST_AHEAD; slot < RECONFIGURE_TEST_SLOTS; slot++)
+    {
+        uint32_t sent = reconfigureTestSlot();
+
+        if(SIM_LPUART_IDLE == sent)
+        {
+            /* Idle character time */
+        }
+        else if(sent < 0x80U)
+        {
+            nOfErrors += ((RECONFIGURE_TEST_AHEAD + nOfOld) == sent) && (baudOld == LPUART0->BAUD) ? 0U : 1U;
+            lastOld = slot;
+            nOfOld++;
+        }
+        else
+        {
+            nOfErrors += ((0x80U + nOfNew) == sent) && (profiles[1].baud == LPUART0->BAUD) ? 0U : 1U;
+            firstNew = (0U == nOfNew) ? slot : firstNew;
+            nOfNew++;
+        }
+
+        if((0U == switchSlot) && (0U == LPUART_IsReconfigurePending(LPUART0)))
+        {
+            switchSlot = slot;
+            TEST_CHECK(RECONFIGURE_TEST_LEN == reconfigureTestQueue(0x80U));
+        }
+    }
+
+    TEST_CHECK(0U == nOfErrors);
+    TEST_CHECK(((RECONFIGURE_TEST_LEN - RECONFIGURE_TEST_AHEAD) == nOfOld) && (RECONFIGURE_TEST_LEN == nOfNew));
+    TEST_CHECK((lastOld + 1U) == switchSlot);
+    TEST_CHECK((switchSlot + 1U) == firstNew);
+    (void)printf("Deferred switch %u character times after the request, %u idle character time between "
+                 "the old and the new settings, the one of the switch\n", switchSlot - RECONFIGURE_TEST_AHEAD + 1U,
+                 firstNew - lastOld - 1U);
+
+    /* The new frame and parity are applied whole, TCIE is back as before the switch, RWU waits for an idle
+       line and the Rx ring is kept */
+    TEST_CHECK((profiles[1].baud == LPUART0->BAUD) && (profiles[1].ctrl == (LPUART0->CTRL & ~LPUART_CTRL_RWU_MASK)));
+    TEST_CHECK(0U == (LPUART0->CTRL & LPUART_CTRL_TCIE_MASK));
+    TEST_CHECK(0U != (LPUART0->CTRL & LPUART_CTRL_RWU_MASK));
+    TEST_CHECK(RECONFIGURE_TEST_RX_LEN == LPUART_Receive(LPUART0, received, sizeof(received)));
+    TEST_CHECK(('r' == received[0]) &&
+               (('r' + RECONFIGURE_TEST_RX_LEN - 1U) == received[RECONFIGURE_TEST_RX_LEN - 1U]));
+    (void)LPUART_GetStatistics(LPUART0, &statistics);
+    TEST_CHECK(1U == statistics.reconfigures);
+
+    /* Without rings the drain mode switches at once on an idle transmitter */
+    handles[0].pLPUARTx = LPUART1;
+    handles[1].pLPUARTx = LPUART1;
+    (void)LPUART_Init(&handles[0]);
+    TEST_CHECK(LPUART_E_OK == LPUART_ProfileCompile(&handles[1], &profiles[1]));
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_Reconfigure(LPUART1, &profiles[1], LPUART_SWITCH_DEFERRED, 0));
+    TEST_CHECK(LPUART_E_OK == LPUART_Reconfigure(LPUART1, &profiles[1], LPUART_SWITCH_DRAIN, 0));
+    TEST_CHECK(profiles[1].baud == LPUART1->BAUD);
+
+    /* A character that never ends cancels the switch, the old settings stay */
+    baudOld = LPUART1->BAUD;
+    LPUART1->STAT &= ~LPUART_STAT_TC_MASK;
+    TEST_CHECK(LPUART_E_OK == LPUART_SetWaitBudget(LPUART1, 1000U));
+    TEST_CHECK(LPUART_E_TIMEOUT == LPUART_Reconfigure(LPUART1, &profiles[0], LPUART_SWITCH_DRAIN, 0));
+    TEST_CHECK((baudOld == LPUART1->BAUD) && (0U == LPUART_IsReconfigurePending(LPUART1)));
+
+    return testFinish();
+}
@@ -0,0 +1,245 @@
+/**
+ * @file RingBufferTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the full queue policies of RingBuffer with a concurrent producer and consumer
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * A producer thread stands in for the ISR: each push runs whole under a mutex, as an interrupt runs whole
+ * against the task. The consumer thread pops under the same mutex, as the drivers pop with the interrupt
+ * masked, and an observer thread reads size with no lock. The bytes pushed follow a sequence, so the
+ * consumer finds the lost ones as gaps and a reordering as a gap too large to match the loss counters.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "RingBuffer.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define RING_BUFFER_TEST_PUSHES     (500000U)   /* Bytes pushed by each run */
+#define RING_BUFFER_TEST_BURST      (16U)       /* Pushes of the producer before it yields, as an interrupt rate */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    uint32_t popped;        /* Bytes popped by the consumer */
+    uint32_t skipped;       /* Bytes of the sequence missing between two pops */
+    uint32_t sizeMax;       /* Largest size the observer read */
+} RingBufferTest_Result_Types;  /* What the threads saw in a run */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Std_Queue_Types ringBufferTestQueue;             /* Queue shared by the threads */
+static uint8_t ringBufferTestArr[255];                  /* Memory of the queue */
+static pthread_mutex_t ringBufferTestMask = PTHREAD_MUTEX_INITIALIZER;  /* Interrupt mask of the producer */
+static atomic_uint ringBufferTestIsDone;                /* 1 once the producer pushed everything */
+static RingBufferTest_Result_Types ringBufferTestResult;    /* What the threads saw in the current run */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to push the sequence, one interrupt per byte
+ *
+ * @param pArg[in]: not used
+ *
+ * @return void*: 0
+ */
+static void *ringBufferTestProducer(void *pArg)
+{
+    (void)pArg;
+
+    for(uint32_t i = 0; i < RING_BUFFER_TEST_PUSHES; i++)
+    {
+        (void)pthread_mutex_lock(&ringBufferTestMask);
+        queuePush(&ringBufferTestQueue, (uint8_t)i);
+        (void)pthread_mutex_unlock(&ringBufferTestMask);
+
+        if(0U == ((i + 1U) % RING_BUFFER_TEST_BURST))
+        {
+            (void)sched_yield();
+        }
+    }
+
+    atomic_store(&ringBufferTestIsDone, 1U);
+
+    return 0;
+}
+
+/**
+ * @brief This function is used to pop with the producer masked until the producer is done and the queue
+ *        empty, counting the bytes of the sequence missing between two pops
+ *
+ * @param pArg[in]: not used
+ *
+ * @return void*: 0
+ */
+static void *ringBufferTestConsumer(void *pArg)
+{
+    uint8_t next = 0;
+    uint8_t isEnd = 0;
+
+    (void)pArg;
+
+    while(0 == isEnd)
+    {
+        uint8_t isDone = (uint8_t)atomic_load(&ringBufferTestIsDone);
+        uint8_t isPopped = 0;
+        uint8_t data = 0;
+
+        (void)pthread_mutex_lock(&ringBufferTestMask);
+
+        if(0U != ringBufferTestQueue.size)
+        {
+            data = queuePop(&ringBufferTestQueue);
+            isPopped = 1;
+        }
+
+        (void)pthread_mutex_unlock(&ringBufferTestMask);
+
+        if(0 != isPopped)
+        {
+            ringBufferTestResult.skipped += (uint8_t)(data - next);
+            ringBufferTestResult.popped++;
+            next = (uint8_t)(data + 1U);
+        }
+        else if(0 != isDone)
+        {
+            /* The producer finished before this empty read, nothing more comes. The bytes lost after the
+               last pop are a gap too */
+            ringBufferTestResult.skipped += (uint8_t)((uint8_t)RING_BUFFER_TEST_PUSHES - next);
+            isEnd = 1;
+        }
+        else
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief This function is used to read size with no lock while the run goes on
+ *
+ * @param pArg[in]: not used
+ *
+ * @return void*: 0
+ */
+static void *ringBufferTestObserver(void *pArg)
+{
+    (void)pArg;
+
+    while(0U == atomic_load(&ringBufferTestIsDone))
+    {
+        uint32_t size = *(volatile uint8_t *)&ringBufferTestQueue.size;
+
+        ringBufferTestResult.sizeMax = (size > ringBufferTestResult.sizeMax) ? size : ringBufferTestResult.sizeMax;
+        (void)sched_yield();
+    }
+
+    return 0;
+}
+
+/**
+ * @brief This function is used to run the three threads on a queue
+ *
+ * @param capacity[in]: capacity of the queue
+ * @param policy[in]: policy of the queue when it is full
+ *
+ * @return void
+ */
+static void ringBufferTestRun(uint8_t capacity, Queue_Policy_Types policy)
+{
+    static const char *const names[2] = { "drop newest", "overwrite oldest" };
+    pthread_t threads[3];
+    uint32_t lost;
+
+    queueInit(&ringBufferTestQueue, ringBufferTestArr, capacity);
+    queueSetPolicy(&ringBufferTestQueue, policy);
+    ringBufferTestResult = (RingBufferTest_Result_Types){0};
+    atomic_store(&ringBufferTestIsDone, 0U);
+
+    (void)pthread_create(&threads[0], 0, ringBufferTestConsumer, 0);
+    (void)pthread_create(&threads[1], 0, ringBufferTestObserver, 0);
+    (void)pthread_create(&threads[2], 0, ringBufferTestProducer, 0);
+
+    for(uint32_t i = 0; i < 3U; i++)
+    {
+        (void)pthread_join(threads[i], 0);
+    }
+
+    /* Only the counter of the policy moves, every byte is popped or counted, and the gaps are the loss */
+    lost = (QUEUE_DROP_NEWEST == policy) ? ringBufferTestQueue.dropped : ringBufferTestQueue.overwritten;
+    TEST_CHECK(0U == ((QUEUE_DROP_NEWEST == policy) ? ringBufferTestQueue.overwritten : ringBufferTestQueue.dropped));
+    TEST_CHECK(RING_BUFFER_TEST_PUSHES == (ringBufferTestResult.popped + lost));
+    TEST_CHECK(ringBufferTestResult.skipped == lost);
+    TEST_CHECK((0U == ringBufferTestQueue.size) && (ringBufferTestResult.sizeMax <= capacity));
+    (void)printf("%-16s capacity %3u: %u pushed, %u popped, %u lost, largest size seen %u\n", names[policy],
+                 capacity, RING_BUFFER_TEST_PUSHES, ringBufferTestResult.popped, lost, ringBufferTestResult.sizeMax);
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    Std_Queue_Types queue;
+    uint8_t arr[7];
+    uint8_t isInOrder = 1;
+
+    /* Ten bytes into seven places: the first seven are kept, or the last seven */
+    queueInit(&queue, arr, sizeof(arr));
+
+    for(uint32_t i = 0; i < 10U; i++)
+    {
+        queuePush(&queue, (uint8_t)i);
+    }
+
+    for(uint32_t i = 0; i < sizeof(arr); i++)
+    {
+        isInOrder = (i == queuePop(&queue)) ? isInOrder : 0U;
+    }
+
+    TEST_CHECK((0U != isInOrder) && (3U == queue.dropped) && (0U == queue.overwritten));
+
+    queueInit(&queue, arr, sizeof(arr));
+    queueSetPolicy(&queue, QUEUE_OVERWRITE_OLDEST);
+
+    for(uint32_t i = 0; i < 10U; i++)
+    {
+        queuePush(&queue, (uint8_t)i);
+    }
+
+    TEST_CHECK(sizeof(arr) == queue.size);
+
+    for(uint32_t i = 3U; i < 10U; i++)
+    {
+        isInOrder = (i == queuePop(&queue)) ? isInOrder : 0U;
+    }
+
+    TEST_CHECK((0U != isInOrder) && (0U == queue.dropped) && (3U == queue.overwritten));
+
+    /* queueInit empties the queue and goes back to the default policy and counters */
+    queueInit(&queue, arr, sizeof(arr));
+    TEST_CHECK((0U == queue.size) && (QUEUE_DROP_NEWEST == queue.policy) && (0U == queue.overwritten));
+
+    ringBufferTestRun(32U, QUEUE_DROP_NEWEST);
+    ringBufferTestRun(7U, QUEUE_DROP_NEWEST);
+    ringBufferTestRun(32U, QUEUE_OVERWRITE_OLDEST);
+    ringBufferTestRun(7U, QUEUE_OVERWRITE_OLDEST);
+
+    return testFinish();
+}
@@ -0,0 +1,175 @@
+/**
+ * @file RouterTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the router bridging LPUART0 and LPUART1 to LPUART2
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "Router.h"
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define ROUTER_TEST_OUT_MAX (512U)  /* Bytes sent by LPUART2 kept by the test */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t routerTestRx0[32];                   /* Rx ring of LPUART0 */
+static uint8_t routerTestTx0[8];                    /* Tx ring of LPUART0 */
+static uint8_t routerTestRx1[32];                   /* Rx ring of LPUART1 */
+static uint8_t routerTestTx1[8];                    /* Tx ring of LPUART1 */
+static uint8_t routerTestRx2[8];                    /* Rx ring of LPUART2 */
+static uint8_t routerTestTx2[24];                   /* Tx ring of LPUART2 */
+static char routerTestOut[ROUTER_TEST_OUT_MAX];     /* Bytes sent by LPUART2 */
+static uint32_t routerTestOutLen;                   /* Number of bytes sent by LPUART2 */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to forward the frames starting with 'A' only
+ *
+ * @param pHead[in]: first span of the frame
+ * @param headLen[in]: length of the first span
+ * @param pTail[in]: second span of the frame
+ * @param tailLen[in]: length of the second span
+ *
+ * @return uint8_t: 1 to forward the frame
+ */
+static uint8_t routerTestFilter(const uint8_t *pHead, uint32_t headLen, const uint8_t *pTail, uint32_t tailLen)
+{
+    (void)headLen;
+    (void)pTail;
+    (void)tailLen;
+
+    return ('A' == pHead[0]) ? 1U : 0U;
+}
+
+/**
+ * @brief This function is used to receive a string on an instance
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pString[in]: characters received
+ *
+ * @return void
+ */
+static void routerTestReceive(LPUART_Type *pLPUARTx, const char *pString)
+{
+    while('\0' != *pString)
+    {
+        simLpuartReceive(pLPUARTx, (uint8_t)*pString);
+        pString++;
+    }
+}
+
+/**
+ * @brief This function is used to let LPUART2 send up to a number of bytes
+ *
+ * @param maxLen[in]: maximum number of bytes
+ *
+ * @return void
+ */
+static void routerTestDrain(uint32_t maxLen)
+{
+    uint8_t data;
+
+    for(uint32_t i = 0; (i < maxLen) && (0 != simLpuartTransmit(LPUART2, &data)); i++)
+    {
+        if(routerTestOutLen < (ROUTER_TEST_OUT_MAX - 1U))
+        {
+            routerTestOut[routerTestOutLen++] = (char)data;
+        }
+    }
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    Std_Router_Types router;
+    Std_Router_Route_Types routes[2] =
+    {
+        { .pSource = LPUART0, .pDestination = LPUART2, .delimiter = '\n', .filter = routerTestFilter },
+        { .pSource = LPUART1, .pDestination = LPUART2, .delimiter = '\n', .filter = 0 },
+    };
+    Std_Router_Route_Types invalid[2] =
+    {
+        { .pSource = LPUART0, .pDestination = LPUART2, .delimiter = ROUTER_NO_DELIMITER },
+        { .pSource = LPUART0, .pDestination = LPUART1, .delimiter = ROUTER_NO_DELIMITER },
+    };
+    uint32_t frames0;
+    uint32_t frames1;
+
+    simReset();
+    (void)LPUART_BufferInit(LPUART0, routerTestRx0, sizeof(routerTestRx0), routerTestTx0, sizeof(routerTestTx0));
+    (void)LPUART_BufferInit(LPUART1, routerTestRx1, sizeof(routerTestRx1), routerTestTx1, sizeof(routerTestTx1));
+    (void)LPUART_BufferInit(LPUART2, routerTestRx2, sizeof(routerTestRx2), routerTestTx2, sizeof(routerTestTx2));
+
+    TEST_CHECK(ROUTER_E_NOT_OK == routerInit(&router, invalid, 2U));
+    invalid[0].pDestination = LPUART0;
+    TEST_CHECK(ROUTER_E_NOT_OK == routerInit(&router, invalid, 1U));
+    TEST_CHECK(ROUTER_E_OK == routerInit(&router, routes, 2U));
+
+    /* Frames are forwarded whole, the ones the filter rejects are dropped */
+    routerTestReceive(LPUART0, "A1\nX\nA2\n");
+    routerTestReceive(LPUART1, "b1\n");
+
+    for(uint32_t i = 0; i < 4U; i++)
+    {
+        (void)routerPoll(&router);
+        routerTestDrain(UINT32_MAX);
+    }
+
+    TEST_CHECK(9U == routerTestOutLen);
+    TEST_CHECK(0 == memcmp(routerTestOut, "A1\nb1\nA2\n", routerTestOutLen));
+    TEST_CHECK((2U == routes[0].stats.frames) && (1U == routes[0].stats.filtered) && (6U == routes[0].stats.bytes));
+    TEST_CHECK((1U == routes[1].stats.frames) && (3U == routes[1].stats.bytes));
+
+    /* A frame filling the Rx ring without a delimiter can never complete */
+    routerTestReceive(LPUART1, "zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz");
+    (void)routerPoll(&router);
+    TEST_CHECK(1U == routes[1].stats.oversized);
+    TEST_CHECK(32U == LPUART_GetRxFree(LPUART1));
+
+    /* A frame longer than the Tx ring of LPUART2 can never be queued */
+    routerTestReceive(LPUART1, "bbbbbbbbbbbbbbbbbbbbbbbbbb\n");
+    (void)routerPoll(&router);
+    TEST_CHECK(2U == routes[1].stats.oversized);
+    TEST_CHECK(32U == LPUART_GetRxFree(LPUART1));
+
+    /* LPUART2 sends 4 bytes per turn while both sources always have a frame, the long frames of LPUART0 are
+       not starved by the short ones of LPUART1 */
+    routerTestOutLen = 0;
+
+    for(uint32_t i = 0; i < 400U; i++)
+    {
+        if(LPUART_GetRxFree(LPUART0) >= 12U)
+        {
+            routerTestReceive(LPUART0, "A-long-one\n");
+        }
+
+        if(LPUART_GetRxFree(LPUART1) >= 3U)
+        {
+            routerTestReceive(LPUART1, "s\n");
+        }
+
+        (void)routerPoll(&router);
+        routerTestDrain(4U);
+    }
+
+    frames0 = routes[0].stats.frames - 2U;
+    frames1 = routes[1].stats.frames - 1U;
+    TEST_CHECK((0U != frames0) && ((frames0 + 1U) >= frames1) && ((frames1 + 1U) >= frames0));
+
+    return testFinish();
+}
@@ -0,0 +1,183 @@
+/**
+ * @file RxMatchTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the end of message interrupts on character match, against one interrupt per character
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Lines of 10 to 80 characters ended by '\n' are received on LPUART0 through the Rx FIFO of the simulator,
+ * with 2 idle characters between them. The test is the NVIC: after each character it calls the handler
+ * while RDRF, MA1F or MA2F is pending with its interrupt enabled.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "s32k144_lpuart_driver.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define RX_MATCH_TEST_LINES     (2000U) /* Lines received in each mode */
+#define RX_MATCH_TEST_LEN_MIN   (10U)   /* Shortest line, terminator included */
+#define RX_MATCH_TEST_LEN_SPAN  (71U)   /* Line lengths from the shortest one */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t rxMatchTestRxArr[255];   /* Rx ring of LPUART0 */
+static uint8_t rxMatchTestTxArr[8];     /* Tx ring of LPUART0 */
+static uint32_t rxMatchTestMessages;    /* Calls of the end of message callback */
+static uint32_t rxMatchTestSeed;        /* State of the line length generator */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to count the end of message callbacks
+ *
+ * @return void
+ */
+static void rxMatchTestOnMessage(void)
+{
+    rxMatchTestMessages++;
+}
+
+/**
+ * @brief This function is used to call the handler of LPUART0 while one of its enabled flags is pending
+ *
+ * @return void
+ */
+static void rxMatchTestNvic(void)
+{
+    while(((0 != (LPUART0->CTRL & LPUART_CTRL_RIE_MASK)) && (0 != (LPUART0->STAT & LPUART_STAT_RDRF_MASK))) ||
+          ((0 != (LPUART0->CTRL & LPUART_CTRL_MA1IE_MASK)) && (0 != (LPUART0->STAT & LPUART_STAT_MA1F_MASK))) ||
+          ((0 != (LPUART0->CTRL & LPUART_CTRL_MA2IE_MASK)) && (0 != (LPUART0->STAT & LPUART_STAT_MA2F_MASK))))
+    {
+        simIrq(LPUART0_RxTx_IRQn);
+    }
+}
+
+/**
+ * @brief This function is used to receive a line and check the application reads it back whole
+ *
+ * @param len[in]: characters of the line, '\n' included
+ * @param isEnded[in]: 0 to leave out the terminator, the idle line then ends the message
+ *
+ * @return uint8_t: 1 if the Rx ring holds exactly the line
+ */
+static uint8_t rxMatchTestLine(uint32_t len, uint8_t isEnded)
+{
+    uint8_t line[RX_MATCH_TEST_LEN_MIN + RX_MATCH_TEST_LEN_SPAN];
+    uint8_t received[sizeof(line) + 1U];
+    uint32_t nOfReceived;
+    uint8_t isOk = 1U;
+
+    for(uint32_t i = 0; i < len; i++)
+    {
+        line[i] = (uint8_t)(((0 == isEnded) || ((i + 1U) < len)) ? ('A' + ((i + len) % 26U)) : '\n');
+        simLpuartFifoReceive(LPUART0, line[i]);
+        rxMatchTestNvic();
+    }
+
+    simLpuartFifoIdle(LPUART0);
+    rxMatchTestNvic();
+
+    nOfReceived = LPUART_Receive(LPUART0, received, sizeof(received));
+
+    for(uint32_t i = 0; i < len; i++)
+    {
+        isOk = (line[i] == received[i]) ? isOk : 0U;
+    }
+
+    return ((len == nOfReceived) && (0U != isOk)) ? 1U : 0U;
+}
+
+/**
+ * @brief This function is used to receive the same lines in the current mode
+ *
+ * @param pStatistics[out]: statistics of LPUART0 after the lines
+ *
+ * @return uint32_t: characters received
+ */
+static uint32_t rxMatchTestRun(LPUART_Statistics_Type *pStatistics)
+{
+    uint32_t nOfBytes = 0;
+    uint32_t nOfBad = 0;
+
+    (void)LPUART_ResetStatistics(LPUART0);
+    rxMatchTestSeed = 12345U;
+    rxMatchTestMessages = 0;
+
+    for(uint32_t i = 0; i < RX_MATCH_TEST_LINES; i++)
+    {
+        uint32_t len;
+
+        rxMatchTestSeed = (rxMatchTestSeed * 1103515245U) + 12345U;
+        len = RX_MATCH_TEST_LEN_MIN + ((rxMatchTestSeed >> 16) % RX_MATCH_TEST_LEN_SPAN);
+        nOfBad += (0 != rxMatchTestLine(len, 1U)) ? 0U : 1U;
+        nOfBytes += len;
+    }
+
+    TEST_CHECK(0U == nOfBad);
+    (void)LPUART_GetStatistics(LPUART0, pStatistics);
+    TEST_CHECK((nOfBytes == pStatistics->rxFrames) && (0U == pStatistics->overRunErrors));
+
+    return nOfBytes;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    LPUART_RxMatch_Config_Type config =
+    {
+        .terminator1 = '\n', .terminator2 = '\r', .isTerminator2 = 1U, .timeout = LPUART_IDLE_2_CHARS,
+        .onMessage = rxMatchTestOnMessage,
+    };
+    LPUART_Statistics_Type perByte;
+    LPUART_Statistics_Type match;
+    uint32_t nOfBytes;
+
+    simReset();
+    LPUART0->CTRL |= LPUART_CTRL_RE_MASK;
+    (void)LPUART_BufferInit(LPUART0, rxMatchTestRxArr, sizeof(rxMatchTestRxArr), rxMatchTestTxArr,
+                            sizeof(rxMatchTestTxArr));
+
+    /* One interrupt per character, the application scans for the terminator */
+    nOfBytes = rxMatchTestRun(&perByte);
+    TEST_CHECK(nOfBytes == perByte.rxInterrupts);
+
+    /* The FIFO holds up to 4 characters, the terminator or the idle line ends the message */
+    TEST_CHECK(LPUART_E_OK == LPUART_RxMatchConfig(LPUART0, &config));
+    TEST_CHECK(0U != (LPUART0->CTRL & LPUART_CTRL_RE_MASK));
+    (void)rxMatchTestRun(&match);
+    TEST_CHECK((RX_MATCH_TEST_LINES == match.rxMessages) && (RX_MATCH_TEST_LINES == rxMatchTestMessages));
+    TEST_CHECK((match.rxInterrupts * 3U) < perByte.rxInterrupts);
+
+    (void)printf("%u lines, %u bytes: %u interrupts per byte, %u in the match mode (%.1f and %.1f per line, "
+                 "%.2fx fewer)\n", RX_MATCH_TEST_LINES, nOfBytes, perByte.rxInterrupts, match.rxInterrupts,
+                 (double)perByte.rxInterrupts / RX_MATCH_TEST_LINES, (double)match.rxInterrupts / RX_MATCH_TEST_LINES,
+                 (double)perByte.rxInterrupts / match.rxInterrupts);
+
+    /* A line without terminator is ended by the idle line, once */
+    rxMatchTestMessages = 0;
+    TEST_CHECK(1U == rxMatchTestLine(7U, 0));
+    TEST_CHECK(1U == rxMatchTestMessages);
+
+    /* The second terminator ends a message too */
+    TEST_CHECK(1U == rxMatchTestLine(RX_MATCH_TEST_LEN_MIN, 1U));
+    simLpuartFifoReceive(LPUART0, '\r');
+    rxMatchTestNvic();
+    TEST_CHECK(3U == rxMatchTestMessages);
+
+    /* Back to one interrupt per character */
+    TEST_CHECK(LPUART_E_OK == LPUART_RxMatchConfig(LPUART0, 0));
+    TEST_CHECK(0U == (LPUART0->CTRL & (LPUART_CTRL_MA1IE_MASK | LPUART_CTRL_MA2IE_MASK)));
+
+    return testFinish();
+}
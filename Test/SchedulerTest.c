@@ -0,0 +1,316 @@
+/**
+ * @file SchedulerTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the scheduler: the pick order of the priorities, the queue of a task and the events
+ *        of the LPUART and port bindings
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Every handler records the events it is given in one log, so the order the scheduler ran them in is
+ * checked across the tasks. A task stays attached to its priority for the whole test, so each part uses
+ * its own priorities.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "Scheduler.h"
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define SCHED_TEST_LOG_MAX      (32U)   /* Events recorded */
+
+#define SCHED_TEST_PRIO_HIGH    (0U)    /* Task posted to by the handler of the middle one */
+#define SCHED_TEST_PRIO_IO      (3U)    /* Task of the LPUART and port events */
+#define SCHED_TEST_PRIO_MID     (7U)    /* Task of the order checks */
+#define SCHED_TEST_PRIO_LOW     (20U)   /* Task with the smallest queue */
+#define SCHED_TEST_PRIO_FREE    (31U)   /* Priority without task */
+
+#define SCHED_TEST_SIGNAL_CHAIN (SCHED_SIGNAL_USER + 1U)    /* Middle task posts to the high and the low ones */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    uint8_t prio;               /* Priority of the task that handled the event */
+    Std_Sched_Event_Types event;    /* Event handled */
+    uint32_t rxCount;           /* Characters read from the Rx ring by the handler */
+} SchedTest_Record_Types;       /* Event seen by a handler */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+static void schedTestHigh(const Std_Sched_Event_Types *pEvent);
+static void schedTestIo(const Std_Sched_Event_Types *pEvent);
+static void schedTestMid(const Std_Sched_Event_Types *pEvent);
+static void schedTestLow(const Std_Sched_Event_Types *pEvent);
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Std_Sched_Task_Types schedTestTasks[4];              /* Tasks high, io, middle and low */
+static Sched_Slot_Types schedTestHighSlots[4];              /* Queue of the high task */
+static Sched_Slot_Types schedTestIoSlots[8];                /* Queue of the io task */
+static Sched_Slot_Types schedTestMidSlots[8];               /* Queue of the middle task */
+static Sched_Slot_Types schedTestLowSlots[4];               /* Queue of the low task */
+
+static SchedTest_Record_Types schedTestLog[SCHED_TEST_LOG_MAX];    /* Events in the order they were handled */
+static uint32_t schedTestLogLen;                            /* Number of events recorded */
+
+static uint8_t schedTestRxArr[16];                          /* Rx ring of LPUART0 */
+static uint8_t schedTestTxArr[16];                          /* Tx ring of LPUART0 */
+static uint8_t schedTestRxData[16];                         /* Characters read by the io task */
+static uint32_t schedTestRxLen;                             /* Number of characters read */
+static uint8_t schedTestIsRxInjected;                       /* 1 to receive a character during the next Rx event */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to record an event in the log
+ *
+ * @param prio[in]: priority of the task
+ * @param pEvent[in]: event handled
+ * @param rxCount[in]: characters read from the Rx ring
+ *
+ * @return void
+ */
+static void schedTestRecord(uint8_t prio, const Std_Sched_Event_Types *pEvent, uint32_t rxCount)
+{
+    if(schedTestLogLen < SCHED_TEST_LOG_MAX)
+    {
+        schedTestLog[schedTestLogLen].prio = prio;
+        schedTestLog[schedTestLogLen].event = *pEvent;
+        schedTestLog[schedTestLogLen].rxCount = rxCount;
+        schedTestLogLen++;
+    }
+}
+
+/**
+ * @brief This function is used to record the events of the high task
+ *
+ * @param pEvent[in]: event
+ *
+ * @return void
+ */
+static void schedTestHigh(const Std_Sched_Event_Types *pEvent)
+{
+    schedTestRecord(SCHED_TEST_PRIO_HIGH, pEvent, 0U);
+}
+
+/**
+ * @brief This function is used to read the Rx ring of LPUART0 on an Rx event and record the events of the
+ *        io task. A character can be received first, as an interrupt preempting the handler would
+ *
+ * @param pEvent[in]: event
+ *
+ * @return void
+ */
+static void schedTestIo(const Std_Sched_Event_Types *pEvent)
+{
+    uint32_t rxCount = 0;
+
+    if(SCHED_SIGNAL_LPUART_RX == pEvent->signal)
+    {
+        if(0 != schedTestIsRxInjected)
+        {
+            schedTestIsRxInjected = 0;
+            simLpuartReceive(LPUART0, 'c');
+        }
+
+        rxCount = LPUART_Receive(LPUART0, &schedTestRxData[schedTestRxLen], sizeof(schedTestRxData) - schedTestRxLen);
+        schedTestRxLen += rxCount;
+    }
+
+    schedTestRecord(SCHED_TEST_PRIO_IO, pEvent, rxCount);
+}
+
+/**
+ * @brief This function is used to record the events of the middle task, a chain event posts one event to
+ *        the high task and one to the low task
+ *
+ * @param pEvent[in]: event
+ *
+ * @return void
+ */
+static void schedTestMid(const Std_Sched_Event_Types *pEvent)
+{
+    if(SCHED_TEST_SIGNAL_CHAIN == pEvent->signal)
+    {
+        (void)schedPost(SCHED_TEST_PRIO_LOW, SCHED_SIGNAL_USER, 0U, pEvent->data);
+        (void)schedPost(SCHED_TEST_PRIO_HIGH, SCHED_SIGNAL_USER, 0U, pEvent->data);
+    }
+
+    schedTestRecord(SCHED_TEST_PRIO_MID, pEvent, 0U);
+}
+
+/**
+ * @brief This function is used to record the events of the low task
+ *
+ * @param pEvent[in]: event
+ *
+ * @return void
+ */
+static void schedTestLow(const Std_Sched_Event_Types *pEvent)
+{
+    schedTestRecord(SCHED_TEST_PRIO_LOW, pEvent, 0U);
+}
+
+/**
+ * @brief This function is used to count the events queued to a task
+ *
+ * @param task[in]: pointer to the task
+ *
+ * @return uint32_t: number of events not handled yet
+ */
+static uint32_t schedTestQueued(Std_Sched_Task_Types *task)
+{
+    return mpscQueueCount(&task->queue);
+}
+
+/**
+ * @brief This function is used to run the scheduler until no task is ready, the log is emptied first
+ *
+ * @return uint32_t: number of events handled
+ */
+static uint32_t schedTestRunAll(void)
+{
+    uint32_t nOfEvents = 0;
+
+    schedTestLogLen = 0;
+
+    while(0 != schedRunOne())
+    {
+        nOfEvents++;
+    }
+
+    return nOfEvents;
+}
+
+/**
+ * @brief This function is used to check one entry of the log
+ *
+ * @param index[in]: entry
+ * @param prio[in]: priority of the task expected
+ * @param signal[in]: signal expected
+ * @param data[in]: payload expected
+ *
+ * @return uint8_t: 1 if the entry matches
+ */
+static uint8_t schedTestIs(uint32_t index, uint8_t prio, uint16_t signal, uint32_t data)
+{
+    return ((index < schedTestLogLen) && (prio == schedTestLog[index].prio) &&
+            (signal == schedTestLog[index].event.signal) && (data == schedTestLog[index].event.data)) ? 1U : 0U;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static const uint8_t message[3] = { 'x', 'y', 'z' };
+    uint8_t data;
+
+    simReset();
+    (void)LPUART_BufferInit(LPUART0, schedTestRxArr, sizeof(schedTestRxArr), schedTestTxArr,
+                            sizeof(schedTestTxArr));
+
+    /* The queue must be a power of 2 and a priority takes one task */
+    TEST_CHECK(SCHED_E_NOT_OK == schedTaskInit(SCHED_TEST_PRIO_MID, &schedTestTasks[2], schedTestMid,
+                                               schedTestMidSlots, 6U));
+    TEST_CHECK(SCHED_E_NOT_OK == schedTaskInit(SCHED_PRIO_NUM, &schedTestTasks[2], schedTestMid,
+                                               schedTestMidSlots, 8U));
+    TEST_CHECK(SCHED_E_OK == schedTaskInit(SCHED_TEST_PRIO_HIGH, &schedTestTasks[0], schedTestHigh,
+                                           schedTestHighSlots, 4U));
+    TEST_CHECK(SCHED_E_OK == schedTaskInit(SCHED_TEST_PRIO_IO, &schedTestTasks[1], schedTestIo,
+                                           schedTestIoSlots, 8U));
+    TEST_CHECK(SCHED_E_OK == schedTaskInit(SCHED_TEST_PRIO_MID, &schedTestTasks[2], schedTestMid,
+                                           schedTestMidSlots, 8U));
+    TEST_CHECK(SCHED_E_OK == schedTaskInit(SCHED_TEST_PRIO_LOW, &schedTestTasks[3], schedTestLow,
+                                           schedTestLowSlots, 4U));
+    TEST_CHECK(SCHED_E_NOT_OK == schedTaskInit(SCHED_TEST_PRIO_LOW, &schedTestTasks[3], schedTestLow,
+                                               schedTestLowSlots, 4U));
+    TEST_CHECK(SCHED_E_NOT_OK == schedPost(SCHED_TEST_PRIO_FREE, SCHED_SIGNAL_USER, 0U, 0U));
+    TEST_CHECK(0U == schedRunOne());
+
+    /* The highest priority ready runs first whatever the order of the posts, each queue in FIFO order */
+    TEST_CHECK(SCHED_E_OK == schedPost(SCHED_TEST_PRIO_LOW, SCHED_SIGNAL_USER, 0U, 1U));
+    TEST_CHECK(SCHED_E_OK == schedPost(SCHED_TEST_PRIO_MID, SCHED_SIGNAL_USER, 0U, 2U));
+    TEST_CHECK(SCHED_E_OK == schedPost(SCHED_TEST_PRIO_LOW, SCHED_SIGNAL_USER, 0U, 3U));
+    TEST_CHECK(SCHED_E_OK == schedPost(SCHED_TEST_PRIO_HIGH, SCHED_SIGNAL_USER, 0U, 4U));
+    TEST_CHECK(SCHED_E_OK == schedPost(SCHED_TEST_PRIO_MID, SCHED_SIGNAL_USER, 0U, 5U));
+    TEST_CHECK(5U == schedTestRunAll());
+    TEST_CHECK(schedTestIs(0, SCHED_TEST_PRIO_HIGH, SCHED_SIGNAL_USER, 4U));
+    TEST_CHECK(schedTestIs(1, SCHED_TEST_PRIO_MID, SCHED_SIGNAL_USER, 2U));
+    TEST_CHECK(schedTestIs(2, SCHED_TEST_PRIO_MID, SCHED_SIGNAL_USER, 5U));
+    TEST_CHECK(schedTestIs(3, SCHED_TEST_PRIO_LOW, SCHED_SIGNAL_USER, 1U));
+    TEST_CHECK(schedTestIs(4, SCHED_TEST_PRIO_LOW, SCHED_SIGNAL_USER, 3U));
+    TEST_CHECK((2U == schedTestTasks[2].events) && (2U == schedTestTasks[3].events));
+
+    /* A full queue refuses the post and counts it, the events queued before are kept in order */
+    for(uint32_t i = 0; i < 6U; i++)
+    {
+        TEST_CHECK((i < 4U) == (SCHED_E_OK == schedPost(SCHED_TEST_PRIO_LOW, SCHED_SIGNAL_USER, 0U, 10U + i)));
+    }
+
+    TEST_CHECK(2U == atomic_load(&schedTestTasks[3].dropped));
+    TEST_CHECK(4U == schedTestRunAll());
+    TEST_CHECK(schedTestIs(0, SCHED_TEST_PRIO_LOW, SCHED_SIGNAL_USER, 10U) &&
+               schedTestIs(3, SCHED_TEST_PRIO_LOW, SCHED_SIGNAL_USER, 13U));
+    TEST_CHECK(SCHED_E_OK == schedPost(SCHED_TEST_PRIO_LOW, SCHED_SIGNAL_USER, 0U, 14U));
+    TEST_CHECK(1U == schedTestRunAll());
+
+    /* An event posted by a handler to a higher priority runs before the rest of the current queue */
+    TEST_CHECK(SCHED_E_OK == schedPost(SCHED_TEST_PRIO_MID, SCHED_TEST_SIGNAL_CHAIN, 0U, 20U));
+    TEST_CHECK(SCHED_E_OK == schedPost(SCHED_TEST_PRIO_MID, SCHED_SIGNAL_USER, 0U, 21U));
+    TEST_CHECK(4U == schedTestRunAll());
+    TEST_CHECK(schedTestIs(0, SCHED_TEST_PRIO_MID, SCHED_TEST_SIGNAL_CHAIN, 20U));
+    TEST_CHECK(schedTestIs(1, SCHED_TEST_PRIO_HIGH, SCHED_SIGNAL_USER, 20U));
+    TEST_CHECK(schedTestIs(2, SCHED_TEST_PRIO_MID, SCHED_SIGNAL_USER, 21U));
+    TEST_CHECK(schedTestIs(3, SCHED_TEST_PRIO_LOW, SCHED_SIGNAL_USER, 20U));
+
+    /* The Rx events are coalesced until the handler runs, a character received by then posts a new one */
+    TEST_CHECK(SCHED_E_NOT_OK == schedBindLpuart(0, SCHED_TEST_PRIO_IO));
+    TEST_CHECK(SCHED_E_NOT_OK == schedBindLpuart(LPUART0, SCHED_PRIO_NUM));
+    TEST_CHECK(SCHED_E_OK == schedBindLpuart(LPUART0, SCHED_TEST_PRIO_IO));
+    simLpuartReceive(LPUART0, 'a');
+    simLpuartReceive(LPUART0, 'b');
+    TEST_CHECK(1U == schedTestQueued(&schedTestTasks[1]));
+    schedTestIsRxInjected = 1;
+    TEST_CHECK(1U == schedRunOne());
+    TEST_CHECK((1U == schedTestTasks[1].events) && (1U == schedTestQueued(&schedTestTasks[1])));
+    TEST_CHECK((3U == schedTestRxLen) && (0 == memcmp("abc", schedTestRxData, 3U)));
+    TEST_CHECK(1U == schedTestRunAll());
+    TEST_CHECK(schedTestIs(0, SCHED_TEST_PRIO_IO, SCHED_SIGNAL_LPUART_RX, 0U) && (0U == schedTestLog[0].rxCount));
+    simLpuartReceive(LPUART0, 'd');
+    TEST_CHECK(1U == schedTestRunAll());
+    TEST_CHECK((1U == schedTestLog[0].rxCount) && (4U == schedTestRxLen));
+
+    /* The Tx event is posted once, when the interrupt that found the Tx ring drained disables itself */
+    TEST_CHECK(sizeof(message) == LPUART_Send(LPUART0, message, sizeof(message)));
+    TEST_CHECK((1U == simLpuartTransmit(LPUART0, &data)) && ('x' == data));
+    TEST_CHECK(0U == schedTestRunAll());
+    TEST_CHECK(1U == simLpuartTransmit(LPUART0, &data));
+    TEST_CHECK((1U == simLpuartTransmit(LPUART0, &data)) && ('z' == data));
+    TEST_CHECK(0U == simLpuartTransmit(LPUART0, &data));
+    TEST_CHECK(0U == (LPUART0->CTRL & LPUART_CTRL_TIE_MASK));
+    TEST_CHECK(1U == schedTestRunAll());
+    TEST_CHECK(schedTestIs(0, SCHED_TEST_PRIO_IO, SCHED_SIGNAL_LPUART_TX, 0U) && (0U == schedTestLog[0].event.param));
+
+    /* The pin interrupt flags are posted with the index of the port */
+    TEST_CHECK(SCHED_E_NOT_OK == schedBindPort(0, SCHED_TEST_PRIO_IO));
+    TEST_CHECK(SCHED_E_OK == schedBindPort(PORTC, SCHED_TEST_PRIO_IO));
+    PORTC->ISFR = 0x00000024U;
+    simIrq(PORTC_IRQn);
+    TEST_CHECK(1U == schedTestRunAll());
+    TEST_CHECK(schedTestIs(0, SCHED_TEST_PRIO_IO, SCHED_SIGNAL_PIN, 0x00000024U));
+    TEST_CHECK(2U == schedTestLog[0].event.param);
+    TEST_CHECK(0U == atomic_load(&schedTestTasks[1].dropped));
+
+    return testFinish();
+}
@@ -0,0 +1,245 @@
+/**
+ * @file SendBlockTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the pool blocks handed over to the Tx interrupt: their order against the Tx ring,
+ *        their return to the pool and the frames the logger builds in them
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Each call of simLpuartTransmit is one character time of LPUART0, the blocks in use are read from the
+ * statistics of their pool after each one.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "Logger.h"
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define SEND_BLOCK_TEST_WIRE_MAX    (256U)  /* Characters sent on the wire */
+#define SEND_BLOCK_TEST_SIZE        (16U)   /* Bytes of a block of the driver test, less than LOG_FRAME_MAX */
+#define SEND_BLOCK_TEST_LOG_SIZE    (48U)   /* Bytes of a block of the logger, 4 frames of one argument */
+#define SEND_BLOCK_TEST_BLOCKS      (5U)    /* Blocks of each pool, one more than LPUART_TX_BLOCK_QUEUE */
+#define SEND_BLOCK_TEST_MESSAGES    (20U)   /* Messages the logger sends through its pool */
+#define SEND_BLOCK_TEST_FRAME_LEN   (LOG_FRAME_HEADER + 4U + 1U)    /* Frame of a message of one argument */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t sendBlockTestRxArr[8];                           /* Rx ring of LPUART0, not used */
+static uint8_t sendBlockTestTxArr[32];                          /* Tx ring of LPUART0 */
+static uint8_t sendBlockTestWire[SEND_BLOCK_TEST_WIRE_MAX];     /* Characters sent on the wire */
+static uint32_t sendBlockTestLen;                               /* Number of characters sent */
+static Std_Pool_Types sendBlockTestPool;                        /* Pool of the driver test */
+static Std_Pool_Types sendBlockTestLogPool;                     /* Pool of the logger */
+static uint32_t sendBlockTestMemory[POOL_MEMORY_WORDS(SEND_BLOCK_TEST_SIZE, SEND_BLOCK_TEST_BLOCKS)];
+static uint32_t sendBlockTestLogMemory[POOL_MEMORY_WORDS(SEND_BLOCK_TEST_LOG_SIZE, SEND_BLOCK_TEST_BLOCKS)];
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to run the wire for a number of character times
+ *
+ * @param nOfSlots[in]: number of character times
+ *
+ * @return uint32_t: number of characters sent
+ */
+static uint32_t sendBlockTestWireRun(uint32_t nOfSlots)
+{
+    uint32_t nOfSent = 0;
+    uint8_t data;
+
+    for(uint32_t slot = 0; (slot < nOfSlots) && (sendBlockTestLen < SEND_BLOCK_TEST_WIRE_MAX); slot++)
+    {
+        if(0 != simLpuartTransmit(LPUART0, &data))
+        {
+            sendBlockTestWire[sendBlockTestLen++] = data;
+            nOfSent++;
+        }
+    }
+
+    return nOfSent;
+}
+
+/**
+ * @brief This function is used to read the blocks of a pool in use
+ *
+ * @param pool[in/out]: pointer to the pool
+ *
+ * @return uint32_t: number of blocks allocated
+ */
+static uint32_t sendBlockTestInUse(Std_Pool_Types *pool)
+{
+    Pool_Statistics_Types statistics;
+
+    poolGetStatistics(pool, &statistics);
+
+    return statistics.inUse;
+}
+
+/**
+ * @brief This function is used to read the blocks LPUART0 sent and gave back to their pool
+ *
+ * @return uint32_t: number of blocks sent
+ */
+static uint32_t sendBlockTestTxBlocks(void)
+{
+    LPUART_Statistics_Type statistics = { 0 };
+
+    (void)LPUART_GetStatistics(LPUART0, &statistics);
+
+    return statistics.txBlocks;
+}
+
+/**
+ * @brief This function is used to check that the frame of a message of one argument was sent
+ *
+ * @param pFrame[in]: frame on the wire
+ * @param id[in]: message identifier
+ * @param arg[in]: argument
+ *
+ * @return uint8_t: 1 if the frame matches
+ */
+static uint8_t sendBlockTestIsFrame(const uint8_t *pFrame, uint16_t id, uint32_t arg)
+{
+    uint8_t expected[SEND_BLOCK_TEST_FRAME_LEN] =
+    {
+        LOG_FRAME_SYNC, (uint8_t)id, (uint8_t)(id >> 8U), 1U,
+        (uint8_t)arg, (uint8_t)(arg >> 8U), (uint8_t)(arg >> 16U), (uint8_t)(arg >> 24U), 0U
+    };
+
+    for(uint32_t i = 0; i < (SEND_BLOCK_TEST_FRAME_LEN - 1U); i++)
+    {
+        expected[SEND_BLOCK_TEST_FRAME_LEN - 1U] += expected[i];
+    }
+
+    return (0 == memcmp(pFrame, expected, SEND_BLOCK_TEST_FRAME_LEN)) ? 1U : 0U;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static const uint8_t bulk[3] = { 'x', 'y', 'z' };
+    uint8_t expected[SEND_BLOCK_TEST_WIRE_MAX];
+    uint32_t expectedLen = 0;
+    Pool_Statistics_Types statistics;
+    uint8_t *pBlocks[SEND_BLOCK_TEST_BLOCKS];
+    uint8_t *pBlock;
+    uint32_t allocs;
+    uint8_t isPassed = 1;
+
+    simReset();
+    TEST_CHECK(LPUART_E_OK == LPUART_BufferInit(LPUART0, sendBlockTestRxArr, sizeof(sendBlockTestRxArr),
+                                                sendBlockTestTxArr, sizeof(sendBlockTestTxArr)));
+    TEST_CHECK(POOL_E_OK == poolInit(&sendBlockTestPool, sendBlockTestMemory, SEND_BLOCK_TEST_SIZE,
+                                     SEND_BLOCK_TEST_BLOCKS));
+    TEST_CHECK(POOL_E_OK == poolInit(&sendBlockTestLogPool, sendBlockTestLogMemory, SEND_BLOCK_TEST_LOG_SIZE,
+                                     SEND_BLOCK_TEST_BLOCKS));
+
+    /* A block is refused empty, larger than its pool or without its pool */
+    pBlock = (uint8_t *)poolAlloc(&sendBlockTestPool);
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_SendBlock(LPUART0, &sendBlockTestPool, pBlock, 0U));
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_SendBlock(LPUART0, &sendBlockTestPool, pBlock, SEND_BLOCK_TEST_SIZE + 1U));
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_SendBlock(LPUART0, 0, pBlock, 1U));
+    TEST_CHECK(POOL_E_OK == poolFree(&sendBlockTestPool, pBlock));
+
+    /* LPUART_TX_BLOCK_QUEUE blocks are queued, the next one is refused and stays with the caller */
+    for(uint32_t i = 0; i < SEND_BLOCK_TEST_BLOCKS; i++)
+    {
+        pBlocks[i] = (uint8_t *)poolAlloc(&sendBlockTestPool);
+
+        for(uint32_t j = 0; j < (i + 2U); j++)
+        {
+            pBlocks[i][j] = (uint8_t)((i << 4U) | j);
+        }
+    }
+
+    for(uint32_t i = 0; i < LPUART_TX_BLOCK_QUEUE; i++)
+    {
+        isPassed &= (LPUART_E_OK == LPUART_SendBlock(LPUART0, &sendBlockTestPool, pBlocks[i], i + 2U)) ? 1U : 0U;
+        (void)memcpy(&expected[expectedLen], pBlocks[i], i + 2U);
+        expectedLen += i + 2U;
+    }
+
+    TEST_CHECK(1U == isPassed);
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_SendBlock(LPUART0, &sendBlockTestPool, pBlocks[4], 6U));
+    TEST_CHECK(POOL_E_OK == poolFree(&sendBlockTestPool, pBlocks[4]));
+
+    /* The Tx ring goes out after the blocks, no block can be put behind its data */
+    TEST_CHECK(sizeof(bulk) == LPUART_Send(LPUART0, bulk, sizeof(bulk)));
+    (void)memcpy(&expected[expectedLen], bulk, sizeof(bulk));
+    expectedLen += sizeof(bulk);
+    pBlock = (uint8_t *)poolAlloc(&sendBlockTestPool);
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_SendBlock(LPUART0, &sendBlockTestPool, pBlock, 1U));
+    TEST_CHECK(POOL_E_OK == poolFree(&sendBlockTestPool, pBlock));
+
+    /* A block goes back to its pool with its last byte, not before */
+    TEST_CHECK((1U == sendBlockTestWireRun(1U)) && (4U == sendBlockTestInUse(&sendBlockTestPool)));
+    TEST_CHECK((1U == sendBlockTestWireRun(1U)) && (3U == sendBlockTestInUse(&sendBlockTestPool)));
+    TEST_CHECK((2U == sendBlockTestWireRun(2U)) && (3U == sendBlockTestInUse(&sendBlockTestPool)));
+    TEST_CHECK((1U == sendBlockTestWireRun(1U)) && (2U == sendBlockTestInUse(&sendBlockTestPool)));
+    TEST_CHECK((expectedLen - 5U) == sendBlockTestWireRun(SEND_BLOCK_TEST_WIRE_MAX));
+    TEST_CHECK((expectedLen == sendBlockTestLen) && (0 == memcmp(sendBlockTestWire, expected, expectedLen)));
+    TEST_CHECK((0U == sendBlockTestInUse(&sendBlockTestPool)) && (4U == sendBlockTestTxBlocks()));
+
+    /* The blocks not sent yet go back to their pool when the rings are attached again */
+    pBlocks[0] = (uint8_t *)poolAlloc(&sendBlockTestPool);
+    pBlocks[1] = (uint8_t *)poolAlloc(&sendBlockTestPool);
+    TEST_CHECK(LPUART_E_OK == LPUART_SendBlock(LPUART0, &sendBlockTestPool, pBlocks[0], 3U));
+    TEST_CHECK(LPUART_E_OK == LPUART_SendBlock(LPUART0, &sendBlockTestPool, pBlocks[1], 3U));
+    TEST_CHECK((1U == sendBlockTestWireRun(1U)) && (2U == sendBlockTestInUse(&sendBlockTestPool)));
+    TEST_CHECK(LPUART_E_OK == LPUART_BufferInit(LPUART0, sendBlockTestRxArr, sizeof(sendBlockTestRxArr),
+                                                sendBlockTestTxArr, sizeof(sendBlockTestTxArr)));
+    TEST_CHECK((0U == sendBlockTestInUse(&sendBlockTestPool)) && (0U == sendBlockTestWireRun(4U)));
+
+    /* A pool of blocks shorter than LOG_FRAME_MAX is not taken, the logger keeps the Tx ring */
+    logInit(LPUART0);
+    poolGetStatistics(&sendBlockTestPool, &statistics);
+    logSetPool(&sendBlockTestPool);
+    LOG_1(LOG_ID_BOOT, 0xFFU);
+    TEST_CHECK(1U == logDrain());
+    sendBlockTestLen = 0;
+    TEST_CHECK(SEND_BLOCK_TEST_FRAME_LEN == sendBlockTestWireRun(SEND_BLOCK_TEST_WIRE_MAX));
+    TEST_CHECK(1U == sendBlockTestIsFrame(sendBlockTestWire, LOG_ID_BOOT, 0xFFU));
+    allocs = statistics.allocs;
+    poolGetStatistics(&sendBlockTestPool, &statistics);
+    TEST_CHECK(allocs == statistics.allocs);
+
+    /* 4 frames fill a block of the logger, 4 blocks are queued and the fifth one goes back to the pool */
+    logSetPool(&sendBlockTestLogPool);
+
+    for(uint32_t i = 0; i < SEND_BLOCK_TEST_MESSAGES; i++)
+    {
+        LOG_1(LOG_ID_BOOT, 0x01020300U + i);
+    }
+
+    TEST_CHECK(16U == logDrain());
+    TEST_CHECK(4U == sendBlockTestInUse(&sendBlockTestLogPool));
+    sendBlockTestLen = 0;
+    TEST_CHECK((16U * SEND_BLOCK_TEST_FRAME_LEN) == sendBlockTestWireRun(SEND_BLOCK_TEST_WIRE_MAX));
+    TEST_CHECK(4U == logDrain());
+    TEST_CHECK((4U * SEND_BLOCK_TEST_FRAME_LEN) == sendBlockTestWireRun(SEND_BLOCK_TEST_WIRE_MAX));
+    TEST_CHECK(0U == logDrain());
+    isPassed = 1;
+
+    for(uint32_t i = 0; i < SEND_BLOCK_TEST_MESSAGES; i++)
+    {
+        isPassed &= sendBlockTestIsFrame(&sendBlockTestWire[i * SEND_BLOCK_TEST_FRAME_LEN], LOG_ID_BOOT,
+                                         0x01020300U + i);
+    }
+
+    TEST_CHECK(1U == isPassed);
+    poolGetStatistics(&sendBlockTestLogPool, &statistics);
+    TEST_CHECK((0U == statistics.inUse) && (SEND_BLOCK_TEST_BLOCKS == statistics.highWater));
+    TEST_CHECK((0U == statistics.failures) && ((4U + 5U) == sendBlockTestTxBlocks()));
+
+    return testFinish();
+}
@@ -0,0 +1,221 @@
+/**
+ * @file ShellTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the command shell: the tokenizer limits, the line endings, the backspace and the
+ *        lines too long
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Each line is received by LPUART0 before the shell is polled, the echo and the replies are then taken
+ * from the transmitter. The handler of "args" keeps a copy of the tokens it is called with.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "Shell.h"
+#include <stdio.h>
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define SHELL_TEST_OUT_MAX      (512U)      /* Characters sent by the shell for one line */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+static Std_Shell_Status shellTestArgs(Std_Shell_Types *shell, uint8_t argc, char *argv[]);
+static Std_Shell_Status shellTestFail(Std_Shell_Types *shell, uint8_t argc, char *argv[]);
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t shellTestRxArr[200];                         /* Rx ring of LPUART0 */
+static uint8_t shellTestTxArr[255];                         /* Tx ring of LPUART0 */
+static char shellTestOut[SHELL_TEST_OUT_MAX];               /* Characters sent by the shell, null terminated */
+static Std_Shell_Types shellTestShell;                      /* Shell under test */
+static uint32_t shellTestCalls;                             /* Calls of the handler of "args" */
+static uint8_t shellTestArgc;                               /* Tokens of its last call */
+static char shellTestArgv[SHELL_ARGC_MAX][SHELL_LINE_MAX];  /* Copy of the tokens of its last call */
+
+static const Std_Shell_Command_Types shellTestTable[3] =
+{
+    { .name = "args", .handler = shellTestArgs, .help = "keep the tokens" },
+    { .name = "fail", .handler = shellTestFail, .help = "always fail" },
+    { .name = "zz", .handler = shellTestArgs, .help = "last entry" },
+};  /* Commands of the shell, sorted by name */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to keep a copy of the tokens of the command
+ *
+ * @param shell[in]: pointer to the shell
+ * @param argc[in]: number of tokens
+ * @param argv[in]: tokens
+ *
+ * @return Std_Shell_Status: SHELL_E_OK
+ */
+static Std_Shell_Status shellTestArgs(Std_Shell_Types *shell, uint8_t argc, char *argv[])
+{
+    (void)shell;
+
+    shellTestCalls++;
+    shellTestArgc = argc;
+
+    for(uint8_t i = 0; i < argc; i++)
+    {
+        (void)snprintf(shellTestArgv[i], SHELL_LINE_MAX, "%s", argv[i]);
+    }
+
+    return SHELL_E_OK;
+}
+
+/**
+ * @brief This function is used to fail the command
+ *
+ * @param shell[in]: pointer to the shell
+ * @param argc[in]: number of tokens
+ * @param argv[in]: tokens
+ *
+ * @return Std_Shell_Status: SHELL_E_NOT_OK
+ */
+static Std_Shell_Status shellTestFail(Std_Shell_Types *shell, uint8_t argc, char *argv[])
+{
+    (void)shell;
+    (void)argc;
+    (void)argv;
+
+    return SHELL_E_NOT_OK;
+}
+
+/**
+ * @brief This function is used to send characters to the shell, poll it and take what it sends
+ *
+ * @param pChars[in]: characters received
+ * @param len[in]: number of characters
+ *
+ * @return void
+ */
+static void shellTestInput(const char *pChars, uint32_t len)
+{
+    uint32_t nOfSent = 0;
+    uint8_t data;
+
+    for(uint32_t i = 0; i < len; i++)
+    {
+        simLpuartReceive(LPUART0, (uint8_t)pChars[i]);
+    }
+
+    shellPoll(&shellTestShell);
+
+    while(0 != simLpuartTransmit(LPUART0, &data))
+    {
+        if(nOfSent < (SHELL_TEST_OUT_MAX - 1U))
+        {
+            shellTestOut[nOfSent++] = (char)data;
+        }
+    }
+
+    shellTestOut[nOfSent] = '\0';
+}
+
+/**
+ * @brief This function is used to send a null terminated line to the shell
+ *
+ * @param pLine[in]: line with its ending
+ *
+ * @return void
+ */
+static void shellTestLine(const char *pLine)
+{
+    shellTestInput(pLine, (uint32_t)strlen(pLine));
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static const Std_Shell_Command_Types unsorted[2] =
+    {
+        { .name = "fail", .handler = shellTestFail, .help = "" },
+        { .name = "args", .handler = shellTestArgs, .help = "" },
+    };
+    char line[SHELL_LINE_MAX + 32U];
+    uint32_t len;
+
+    simReset();
+    (void)LPUART_BufferInit(LPUART0, shellTestRxArr, sizeof(shellTestRxArr), shellTestTxArr,
+                            sizeof(shellTestTxArr));
+    TEST_CHECK(SHELL_E_NOT_OK == shellInit(&shellTestShell, LPUART0, unsorted, 2U));
+    TEST_CHECK(SHELL_E_OK == shellInit(&shellTestShell, LPUART0, shellTestTable, 3U));
+    shellTestInput("", 0);
+    TEST_CHECK(0 == strcmp("> ", shellTestOut));
+
+    /* CR LF ends one line, CR and LF alone end one each and LF CR two, the line is echoed */
+    shellTestLine("args a b\r\n");
+    TEST_CHECK((1U == shellTestCalls) && (3U == shellTestArgc) && (0 == strcmp("b", shellTestArgv[2])));
+    TEST_CHECK(0 == strcmp("args a b\r\n> ", shellTestOut));
+    TEST_CHECK(0U != shellTestShell.dispatchCycles);
+    shellTestLine("args\r");
+    shellTestLine("args\n");
+    TEST_CHECK((3U == shellTestCalls) && (1U == shellTestArgc));
+    shellTestLine("args\n\r");
+    TEST_CHECK(4U == shellTestCalls);
+    TEST_CHECK(0 == strcmp("args\r\n> \r\n> ", shellTestOut));
+
+    /* Spaces and tabs separate the tokens, the first and the last entries of the table are found */
+    shellTestLine("  \targs   one\t\ttwo  \r");
+    TEST_CHECK((5U == shellTestCalls) && (3U == shellTestArgc) && (0 == strcmp("one", shellTestArgv[1])) &&
+               (0 == strcmp("two", shellTestArgv[2])));
+    shellTestLine("zz\r");
+    TEST_CHECK((6U == shellTestCalls) && (1U == shellTestArgc) && (0 == strcmp("zz", shellTestArgv[0])));
+
+    /* SHELL_ARGC_MAX tokens are run with the last one whole, one more refuses the line */
+    shellTestLine("args b c d e f g h\r");
+    TEST_CHECK((7U == shellTestCalls) && (SHELL_ARGC_MAX == shellTestArgc) && (0 == strcmp("h", shellTestArgv[7])));
+    shellTestLine("args b c d e f g h i j\r");
+    TEST_CHECK(7U == shellTestCalls);
+    TEST_CHECK(0 != strstr(shellTestOut, "too many arguments\r\n> "));
+    shellTestLine("args b c d e f g h   \r");
+    TEST_CHECK((8U == shellTestCalls) && (SHELL_ARGC_MAX == shellTestArgc) && (0 == strcmp("h", shellTestArgv[7])));
+
+    /* Backspace and delete erase the last character and its echo, nothing on an empty line */
+    shellTestLine("\b\x7F");
+    TEST_CHECK('\0' == shellTestOut[0]);
+    shellTestLine("argz\bs qx\x7F\r");
+    TEST_CHECK((9U == shellTestCalls) && (2U == shellTestArgc) && (0 == strcmp("q", shellTestArgv[1])));
+    TEST_CHECK(0 == strcmp("argz\b \bs qx\b \b\r\n> ", shellTestOut));
+
+    /* The longest line is run, one more character refuses it and the next line is run again */
+    len = (uint32_t)snprintf(line, sizeof(line), "args %0*u", (int)(SHELL_LINE_MAX - 1U - 5U), 7U);
+    TEST_CHECK((SHELL_LINE_MAX - 1U) == len);
+    line[len] = '\r';
+    shellTestInput(line, len + 1U);
+    TEST_CHECK((10U == shellTestCalls) && (2U == shellTestArgc) &&
+               ((SHELL_LINE_MAX - 1U - 5U) == strlen(shellTestArgv[1])));
+    line[len] = '8';
+    line[len + 1U] = '9';
+    line[len + 2U] = '\r';
+    shellTestInput(line, len + 3U);
+    TEST_CHECK(10U == shellTestCalls);
+    TEST_CHECK(0 != strstr(shellTestOut, "line too long\r\n> "));
+    TEST_CHECK(0 == strchr(shellTestOut, '8'));
+    shellTestLine("args x\r");
+    TEST_CHECK((11U == shellTestCalls) && (2U == shellTestArgc));
+
+    /* Unknown commands and failed handlers are reported, empty lines only prompt */
+    shellTestLine("nope 1\r");
+    TEST_CHECK(0 == strcmp("nope 1\r\nunknown command: nope\r\n> ", shellTestOut));
+    shellTestLine("fail\r");
+    TEST_CHECK(0 == strcmp("fail\r\nerror\r\n> ", shellTestOut));
+    shellTestLine("   \r");
+    TEST_CHECK((0 == strcmp("   \r\n> ", shellTestOut)) && (11U == shellTestCalls));
+
+    return testFinish();
+}
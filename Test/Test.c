@@ -0,0 +1,59 @@
+/**
+ * @file Test.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the checks shared by the host tests
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint32_t testCount;      /* Checks done */
+static uint32_t testFailed;     /* Checks failed */
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to count a check and print it when it fails, use TEST_CHECK
+ *
+ * @param isPassed[in]: 1 if the condition holds
+ * @param cond[in]: text of the condition
+ * @param file[in]: file of the check
+ * @param line[in]: line of the check
+ *
+ * @return uint8_t: isPassed
+ */
+uint8_t testCheck(uint8_t isPassed, const char *cond, const char *file, int line)
+{
+    testCount++;
+
+    if(0 == isPassed)
+    {
+        testFailed++;
+        (void)printf("%s:%d: check failed: %s\n", file, line, cond);
+    }
+
+    return isPassed;
+}
+
+/**
+ * @brief This function is used to print the number of checks failed
+ *
+ * @return int: exit status of the test, 0 if every check passed
+ */
+int testFinish(void)
+{
+    (void)printf("%u checks, %u failed\n", testCount, testFailed);
+
+    return (0 == testFailed) ? 0 : 1;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file Test.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the checks shared by the host tests
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef TEST_H_
+#define TEST_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Sim.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define TEST_CHECK(cond)    testCheck(((cond) ? 1U : 0U), #cond, __FILE__, __LINE__)  /* Check a condition */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name testCheck
+ *
+ * @brief This function is used to count a check and print it when it fails, use TEST_CHECK
+ *
+ * @param isPassed[in]: 1 if the condition holds
+ * @param cond[in]: text of the condition
+ * @param file[in]: file of the check
+ * @param line[in]: line of the check
+ *
+ * @return uint8_t: isPassed
+ */
+uint8_t testCheck(uint8_t isPassed, const char *cond, const char *file, int line);
+
+/**
+ * @name testFinish
+ *
+ * @brief This function is used to print the number of checks failed
+ *
+ * @return int: exit status of the test, 0 if every check passed
+ */
+int testFinish(void);
+
+#endif /* TEST_H_ */
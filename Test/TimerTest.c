@@ -0,0 +1,228 @@
+/**
+ * @file TimerTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the timing wheel and of the LPIT timebase that drives it
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Each timer is checked to be still running one tick before its expiry and expired at it, around the
+ * ticks where a wheel cascades into the one below. The LPIT runs in the simulator: LPIT_TimebaseInit
+ * starts it, simLpitAdvance moves it and each read of a counter moves it by one clock.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "Timer.h"
+#include "s32k144_lpit_driver.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define TIMER_TEST_FREQUENCY    (48000000U)     /* Functional clock of the LPIT */
+#define TIMER_TEST_TICK_RATE    (1000U)         /* Tick of the timebase */
+#define TIMER_TEST_TICK_CLOCKS  (TIMER_TEST_FREQUENCY / TIMER_TEST_TICK_RATE)  /* Clocks of a tick */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    uint32_t calls;                 /* Number of callbacks */
+    uint32_t delay;                 /* Delay of a restart from the callback, 0 for none */
+    Std_Timer_Types *pStopped;      /* Timer stopped by the callback, 0 for none */
+} TimerTest_Context_Types;          /* Argument of the callbacks */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint64_t timerTestNow;       /* Tick the wheels were last advanced to */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to count the expiries of a timer, then stop another timer or restart this
+ *        one as its context asks
+ *
+ * @param timer[in/out]: pointer to the timer expired
+ * @param arg[in/out]: pointer to the context
+ *
+ * @return void
+ */
+static void timerTestCallback(Std_Timer_Types *timer, void *arg)
+{
+    TimerTest_Context_Types *pContext = (TimerTest_Context_Types *)arg;
+
+    pContext->calls++;
+
+    if(0 != pContext->pStopped)
+    {
+        timerStop(pContext->pStopped);
+    }
+
+    if(0 != pContext->delay)
+    {
+        (void)timerStart(timer, pContext->delay, 0U, timerTestCallback, arg);
+    }
+}
+
+/**
+ * @brief This function is used to advance the wheels to a tick
+ *
+ * @param now[in]: tick
+ *
+ * @return uint32_t: number of callbacks called
+ */
+static uint32_t timerTestAdvance(uint64_t now)
+{
+    timerTestNow = now;
+
+    return timerAdvance(now);
+}
+
+/**
+ * @brief This function is used to advance the wheels to the tick of the LPIT, from its interrupt
+ *
+ * @return void
+ */
+static void timerTestTick(void)
+{
+    (void)timerTestAdvance(LPIT_GetTickCount());
+}
+
+/**
+ * @brief This function is used to check that a one-shot timer started now expires after exactly a delay
+ *
+ * @param delay[in]: ticks before the expiry
+ *
+ * @return uint8_t: 1 if the timer runs until the tick before and has expired at the tick
+ */
+static uint8_t timerTestExpiry(uint32_t delay)
+{
+    TimerTest_Context_Types context = { 0 };
+    Std_Timer_Types timer = { 0 };
+    uint64_t start = timerTestNow;
+    uint8_t isPassed;
+
+    (void)timerStart(&timer, delay, 0U, timerTestCallback, &context);
+    (void)timerTestAdvance(start + delay - 1U);
+    isPassed = ((0U == context.calls) && (1U == timerIsActive(&timer))) ? 1U : 0U;
+    (void)timerTestAdvance(start + delay);
+    isPassed = ((1U == isPassed) && (1U == context.calls) && (0U == timerIsActive(&timer))) ? 1U : 0U;
+
+    return isPassed;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static const uint32_t delays[] =
+    {
+        1U, 2U, 63U, 64U, 65U, 4095U, 4096U, 4097U, 262143U, 262144U, 16777215U, 16777216U, 16777217U,
+        (3U << 24) + 5U,
+    };  /* Delays around the range of each wheel, the last ones beyond the top wheel */
+    static const LPIT_Timebase_Config_Type timebase =
+    {
+        .source = CLOCK_OPTION_3, .frequency = TIMER_TEST_FREQUENCY, .tickRate = TIMER_TEST_TICK_RATE
+    };
+    TimerTest_Context_Types contexts[4] = { 0 };
+    Std_Timer_Types timers[4] = { 0 };
+    uint64_t deadline;
+    uint64_t timestamp;
+
+    /* Each delay expires at its tick, from any phase of the lowest wheel */
+    timerInit(0U);
+    TEST_CHECK(TIMER_E_NOT_OK == timerStart(&timers[0], 1U, 0U, 0, 0));
+
+    for(uint32_t i = 0; i < (sizeof(delays) / sizeof(delays[0])); i++)
+    {
+        TEST_CHECK(1U == timerTestExpiry(delays[i]));
+        (void)timerTestAdvance(timerTestNow + 37U);
+        TEST_CHECK(1U == timerTestExpiry(delays[i]));
+    }
+
+    /* A periodic timer is put back at each expiry, across the cascade of the second wheel */
+    timerInit(60U);
+    timerTestNow = 60U;
+    (void)timerStart(&timers[0], 3U, 10U, timerTestCallback, &contexts[0]);
+    TEST_CHECK((0U == timerTestAdvance(62U)) && (1U == timerTestAdvance(63U)));
+    TEST_CHECK((0U == timerTestAdvance(72U)) && (1U == timerTestAdvance(73U)));
+    TEST_CHECK(3U == timerTestAdvance(103U));
+    TEST_CHECK((5U == contexts[0].calls) && (1U == timerIsActive(&timers[0])));
+    timerStop(&timers[0]);
+    timerStop(&timers[0]);
+    TEST_CHECK((0U == timerTestAdvance(200U)) && (0U == timerIsActive(&timers[0])));
+
+    /* A callback stops a timer of the same slot not called yet, another one restarts itself */
+    contexts[0] = (TimerTest_Context_Types){ .pStopped = &timers[1] };
+    contexts[1] = (TimerTest_Context_Types){ 0 };
+    contexts[2] = (TimerTest_Context_Types){ .delay = 7U };
+    (void)timerStart(&timers[0], 5U, 0U, timerTestCallback, &contexts[0]);
+    (void)timerStart(&timers[1], 5U, 0U, timerTestCallback, &contexts[1]);
+    (void)timerStart(&timers[2], 5U, 0U, timerTestCallback, &contexts[2]);
+    TEST_CHECK(2U == timerTestAdvance(205U));
+    TEST_CHECK((1U == contexts[0].calls) && (0U == contexts[1].calls) && (0U == timerIsActive(&timers[1])));
+    TEST_CHECK((1U == contexts[2].calls) && (1U == timerIsActive(&timers[2])));
+    TEST_CHECK((0U == timerTestAdvance(211U)) && (1U == timerTestAdvance(212U)));
+    TEST_CHECK(2U == contexts[2].calls);
+    contexts[2].delay = 0U;
+    TEST_CHECK(1U == timerTestAdvance(219U));
+
+    /* A periodic timer stopping itself is not put back */
+    contexts[3] = (TimerTest_Context_Types){ .pStopped = &timers[3] };
+    (void)timerStart(&timers[3], 1U, 1U, timerTestCallback, &contexts[3]);
+    TEST_CHECK(1U == timerTestAdvance(300U));
+    TEST_CHECK((1U == contexts[3].calls) && (0U == timerIsActive(&timers[3])));
+
+    /* Without a running timer the wheels jump to the tick, the next timer counts from there */
+    TEST_CHECK(0U == timerTestAdvance(1ULL << 40));
+    TEST_CHECK(1U == timerTestExpiry(100U));
+
+    /* The timebase is stopped before LPIT_TimebaseInit: no time and no deadline */
+    simReset();
+    TEST_CHECK((0U == LPIT_GetTimestamp()) && (0U == LPIT_GetFrequency()));
+    TEST_CHECK(LPIT_DEADLINE_NEVER == LPIT_Deadline(10U));
+    TEST_CHECK(0U == LPIT_IsExpired(LPIT_DEADLINE_NEVER));
+
+    /* The ticks of the LPIT drive the wheels */
+    TEST_CHECK(LPIT_E_OK == LPIT_TimebaseInit(&timebase));
+    TEST_CHECK(TIMER_TEST_FREQUENCY == LPIT_GetFrequency());
+    TEST_CHECK(LPIT_E_OK == LPIT_TickCallbackRegister(timerTestTick));
+    timerInit(LPIT_GetTickCount());
+    timerTestNow = 0U;
+    contexts[0] = (TimerTest_Context_Types){ 0 };
+    (void)timerStart(&timers[0], 3U, 0U, timerTestCallback, &contexts[0]);
+    simLpitAdvance((2U * TIMER_TEST_TICK_CLOCKS) + 100U);
+    TEST_CHECK((2U == LPIT_GetTickCount()) && (0U == contexts[0].calls));
+    simLpitAdvance(TIMER_TEST_TICK_CLOCKS);
+    TEST_CHECK((3U == LPIT_GetTickCount()) && (1U == contexts[0].calls));
+    timestamp = LPIT_GetTimestamp();
+    TEST_CHECK(((3U * TIMER_TEST_TICK_CLOCKS) + 100U) <= timestamp);
+    TEST_CHECK(timestamp < LPIT_GetTimestamp());
+
+    /* A deadline expires once its time has passed */
+    deadline = LPIT_Deadline(100U);
+    TEST_CHECK(0U == LPIT_IsExpired(deadline));
+    simLpitAdvance((100U * (TIMER_TEST_FREQUENCY / 1000000U)) - 16U);
+    TEST_CHECK(0U == LPIT_IsExpired(deadline));
+    simLpitAdvance(16U);
+    TEST_CHECK(1U == LPIT_IsExpired(deadline));
+
+    /* The low channel wraps between the reads of the high channel, the read is done again. Reading them
+       once would give 0: the high channel from before the wrap and the low channel from after it */
+    *(volatile uint32_t *)&LPIT0->TMR[0].CVAL = 0U;
+    *(volatile uint32_t *)&LPIT0->TMR[1].CVAL = 0xFFFFFFFFU;
+    timestamp = LPIT_GetTimestamp();
+    TEST_CHECK(((1ULL << 32) <= timestamp) && (timestamp < ((1ULL << 32) + 8U)));
+
+    /* A stopped timebase gives no time again */
+    TEST_CHECK(LPIT_E_OK == LPIT_DeInit());
+    TEST_CHECK((0U == LPIT_GetTimestamp()) && (LPIT_DEADLINE_NEVER == LPIT_Deadline(10U)));
+
+    return testFinish();
+}
@@ -0,0 +1,116 @@
+/**
+ * @file TraceTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the trace points: the statistics, the carry of the sum, the histogram buckets and the
+ *        JSON line
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The test links s32k144_trace, built with TRACE_ENABLE=1. The measures are given to traceRecord directly,
+ * on points the test never runs the code of.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "Trace.h"
+#include <string.h>
+
+#if (1 != TRACE_ENABLE)
+#error "TraceTest must be built with TRACE_ENABLE=1"
+#endif
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to measure an empty section with the trace macros
+ *
+ * @return void
+ */
+static void traceTestSection(void)
+{
+    TRACE_ENTER(TRACE_ID_GPIO_TOGGLE);
+    TRACE_EXIT(TRACE_ID_GPIO_TOGGLE);
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static const char expected[] = "{\"point\":\"PORT_INIT\",\"count\":5,\"min\":0,\"max\":4,\"avg\":2,\"sum\":10,"
+                                   "\"histogram\":[1,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0]}\n";
+    Trace_Stats_Types stats;
+    char line[TRACE_JSON_MAX];
+    uint32_t len;
+
+    simReset();
+    traceInit();
+
+    /* A point without measure reads as zeros, the others are refused */
+    TEST_CHECK(TRACE_E_OK == traceRead(TRACE_ID_PORT_INIT, &stats));
+    TEST_CHECK((0U == stats.count) && (0U == stats.min) && (0U == stats.max) && (0U == stats.avg));
+    TEST_CHECK(0U == stats.sum);
+    TEST_CHECK(TRACE_E_NOT_OK == traceRead(TRACE_ID_COUNT, &stats));
+    TEST_CHECK(TRACE_E_NOT_OK == traceRead(TRACE_ID_PORT_INIT, 0));
+
+    /* Minimum, maximum, average and the buckets of 0 to 3 significant bits */
+    for(uint32_t cycles = 0; cycles < 5U; cycles++)
+    {
+        traceRecord(TRACE_ID_PORT_INIT, cycles);
+    }
+
+    traceRecord(TRACE_ID_COUNT, 7U);
+    TEST_CHECK(TRACE_E_OK == traceRead(TRACE_ID_PORT_INIT, &stats));
+    TEST_CHECK((5U == stats.count) && (0U == stats.min) && (4U == stats.max) && (2U == stats.avg));
+    TEST_CHECK((10U == stats.sum) && (1U == stats.histogram[0]) && (1U == stats.histogram[1]));
+    TEST_CHECK((2U == stats.histogram[2]) && (1U == stats.histogram[3]) && (0U == stats.histogram[4]));
+
+    /* The sum carries into its upper word, the average is taken on the 64-bit sum */
+    traceRecord(TRACE_ID_QUEUE_PUSH, 0xFFFFFFFFU);
+    traceRecord(TRACE_ID_QUEUE_PUSH, 0xFFFFFFFFU);
+    traceRecord(TRACE_ID_QUEUE_PUSH, 2U);
+    TEST_CHECK(TRACE_E_OK == traceRead(TRACE_ID_QUEUE_PUSH, &stats));
+    TEST_CHECK((3U == stats.count) && ((1ULL << 33) == stats.sum) && (0xAAAAAAAAU == stats.avg));
+    TEST_CHECK((2U == stats.min) && (0xFFFFFFFFU == stats.max));
+
+    /* The last bucket counts the measures of 15 significant bits and every longer one */
+    traceRecord(TRACE_ID_QUEUE_POP, (1U << 13) + 1U);
+    traceRecord(TRACE_ID_QUEUE_POP, (1U << 14) - 1U);
+    traceRecord(TRACE_ID_QUEUE_POP, 1U << 14);
+    traceRecord(TRACE_ID_QUEUE_POP, (1U << 15) - 1U);
+    traceRecord(TRACE_ID_QUEUE_POP, 1U << 15);
+    traceRecord(TRACE_ID_QUEUE_POP, 0xFFFFFFFFU);
+    TEST_CHECK(TRACE_E_OK == traceRead(TRACE_ID_QUEUE_POP, &stats));
+    TEST_CHECK((2U == stats.histogram[TRACE_HIST_BUCKETS - 2U]) && (4U == stats.histogram[TRACE_HIST_BUCKETS - 1U]));
+
+    /* The macros measure the section between them */
+    traceTestSection();
+    TEST_CHECK(TRACE_E_OK == traceRead(TRACE_ID_GPIO_TOGGLE, &stats));
+    TEST_CHECK((1U == stats.count) && (SIM_CYCLES_PER_READ == stats.max));
+
+    /* The line fits its exact length, one character less gives 0 and an empty string */
+    len = traceFormatJson(TRACE_ID_PORT_INIT, line, sizeof(line));
+    TEST_CHECK(((sizeof(expected) - 1U) == len) && (0 == strcmp(expected, line)));
+    TEST_CHECK(len == traceFormatJson(TRACE_ID_PORT_INIT, line, len + 1U));
+    TEST_CHECK(0 == strcmp(expected, line));
+    TEST_CHECK((0U == traceFormatJson(TRACE_ID_PORT_INIT, line, len)) && ('\0' == line[0]));
+    TEST_CHECK((0U == traceFormatJson(TRACE_ID_PORT_INIT, line, 1U)) && ('\0' == line[0]));
+    TEST_CHECK(0U == traceFormatJson(TRACE_ID_PORT_INIT, line, 0U));
+    TEST_CHECK(0U == traceFormatJson(TRACE_ID_COUNT, line, sizeof(line)));
+    TEST_CHECK(0U == traceFormatJson(TRACE_ID_PORT_INIT, 0, sizeof(line)));
+
+    /* The largest values recorded still fit TRACE_JSON_MAX */
+    len = traceFormatJson(TRACE_ID_LPUART_PROFILE_APPLY, line, sizeof(line));
+    TEST_CHECK((0U != len) && (len < TRACE_JSON_MAX));
+    traceRecord(TRACE_ID_LPUART_PROFILE_APPLY, 0xFFFFFFFFU);
+    traceRecord(TRACE_ID_LPUART_PROFILE_APPLY, 0xFFFFFFFFU);
+    len = traceFormatJson(TRACE_ID_LPUART_PROFILE_APPLY, line, sizeof(line));
+    TEST_CHECK((0U != len) && (len < TRACE_JSON_MAX) && ('\n' == line[len - 1U]));
+    TEST_CHECK(0 != strstr(line, "\"sum\":8589934590,"));
+
+    return testFinish();
+}
@@ -0,0 +1,128 @@
+/**
+ * @file TransmitVTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the scatter-gather transmission, its byte stream and the idle time on the wire
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The wire of LPUART0 is a list of character times. In each one the transmitter takes the character of
+ * the data register and the Tx interrupt may write the next one, a character time without a character
+ * between the first and the last one is idle time.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "s32k144_lpuart_driver.h"
+#include <stdio.h>
+#include <string.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define TRANSMITV_TEST_WIRE_MAX (128U)  /* Character times on the wire */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t transmitVTestRxArr[8];                       /* Rx ring of LPUART0 */
+static uint8_t transmitVTestTxArr[8];                       /* Tx ring of LPUART0 */
+static uint8_t transmitVTestWire[TRANSMITV_TEST_WIRE_MAX];  /* Characters sent on the wire */
+static uint32_t transmitVTestLen;                           /* Number of characters sent */
+static uint32_t transmitVTestIdle;                          /* Idle character times between characters */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to run the wire for a number of character times
+ *
+ * @param nOfSlots[in]: number of character times
+ *
+ * @return void
+ */
+static void transmitVTestWireRun(uint32_t nOfSlots)
+{
+    uint32_t first = 0;
+    uint32_t last = 0;
+    uint8_t data;
+
+    transmitVTestLen = 0;
+
+    for(uint32_t slot = 0; slot < nOfSlots; slot++)
+    {
+        if(0 != simLpuartTransmit(LPUART0, &data))
+        {
+            first = (0U == transmitVTestLen) ? slot : first;
+            last = slot;
+            transmitVTestWire[transmitVTestLen++] = data;
+        }
+    }
+
+    transmitVTestIdle = (0U != transmitVTestLen) ? ((last - first + 1U) - transmitVTestLen) : 0U;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static const uint8_t header[4] = { 0x7EU, 0x01U, 0x25U, 0x00U };
+    static const uint8_t crc[2] = { 0xC3U, 0x5AU };
+    uint8_t payload[37];
+    uint8_t expected[sizeof(header) + sizeof(payload) + sizeof(crc) + 4U];
+    const LPUART_IoVec_Type segments[4] =
+    {
+        { .pData = header, .len = sizeof(header) },
+        { .pData = 0, .len = 0 },
+        { .pData = payload, .len = sizeof(payload) },
+        { .pData = crc, .len = sizeof(crc) },
+    };
+    LPUART_Statistics_Type statistics;
+
+    for(uint32_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = (uint8_t)(i * 7U);
+    }
+
+    (void)memcpy(expected, header, sizeof(header));
+    (void)memcpy(&expected[sizeof(header)], payload, sizeof(payload));
+    (void)memcpy(&expected[sizeof(header) + sizeof(payload)], crc, sizeof(crc));
+    (void)memcpy(&expected[sizeof(header) + sizeof(payload) + sizeof(crc)], "tail", 4U);
+
+    simReset();
+    (void)LPUART_BufferInit(LPUART0, transmitVTestRxArr, sizeof(transmitVTestRxArr), transmitVTestTxArr,
+                            sizeof(transmitVTestTxArr));
+
+    /* Header, empty segment, payload and CRC back to back, then the data queued meanwhile */
+    TEST_CHECK(LPUART_E_OK == LPUART_TransmitV(LPUART0, segments, 4U));
+    TEST_CHECK(1U == LPUART_IsTransmitVBusy(LPUART0));
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_TransmitV(LPUART0, segments, 4U));
+    TEST_CHECK(4U == LPUART_Send(LPUART0, (const uint8_t *)"tail", 4U));
+
+    transmitVTestWireRun(TRANSMITV_TEST_WIRE_MAX);
+    TEST_CHECK(sizeof(expected) == transmitVTestLen);
+    TEST_CHECK(0 == memcmp(transmitVTestWire, expected, sizeof(expected)));
+    TEST_CHECK(0U == transmitVTestIdle);
+    TEST_CHECK(0U == LPUART_IsTransmitVBusy(LPUART0));
+    (void)LPUART_GetStatistics(LPUART0, &statistics);
+    TEST_CHECK(sizeof(expected) == statistics.txBytes);
+    (void)printf("TransmitV of 4 segments and a Send: %u bytes in %u character times, %u idle\n",
+                 transmitVTestLen, transmitVTestLen + transmitVTestIdle, transmitVTestIdle);
+
+    /* Bytes already in the Tx ring go out first, the segments cannot be put behind them */
+    TEST_CHECK(4U == LPUART_Send(LPUART0, (const uint8_t *)"tail", 4U));
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_TransmitV(LPUART0, segments, 4U));
+    transmitVTestWireRun(8U);
+    TEST_CHECK(LPUART_E_OK == LPUART_TransmitV(LPUART0, &segments[3], 1U));
+    transmitVTestWireRun(8U);
+    TEST_CHECK((2U == transmitVTestLen) && (0 == memcmp(transmitVTestWire, crc, sizeof(crc))));
+
+    /* Only empty segments send nothing and leave the transmitter free */
+    TEST_CHECK(LPUART_E_OK == LPUART_TransmitV(LPUART0, &segments[1], 1U));
+    TEST_CHECK(0U == LPUART_IsTransmitVBusy(LPUART0));
+
+    return testFinish();
+}
@@ -0,0 +1,206 @@
+/**
+ * @file UrgentTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the urgent Tx ring, its latency under saturation and the share left to the bulk data
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The wire of LPUART0 is a list of character times, in each one the Tx interrupt writes the next
+ * character. Bulk bytes carry a 7 bit sequence number and urgent bytes the same with bit 7 set, so a lost,
+ * repeated or split packet shows on the wire.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "s32k144_lpuart_driver.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define URGENT_TEST_SLOTS       (4000U) /* Character times of each run */
+#define URGENT_TEST_BULK_LEN    (20U)   /* Bytes of a bulk packet */
+#define URGENT_TEST_URGENT_LEN  (3U)    /* Bytes of an urgent message */
+#define URGENT_TEST_PERIOD      (23U)   /* Character times between urgent messages, prime to the packet length */
+#define URGENT_TEST_BURST       (4U)    /* Urgent frames or packets in a row while bulk data waits */
+#define URGENT_TEST_FLAG        (0x80U) /* Bit of the urgent bytes */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    uint32_t latencyMax;    /* Most bulk characters sent between LPUART_SendUrgent and the urgent data */
+    uint32_t runMax;        /* Most urgent characters in a row while bulk data waits */
+    uint32_t bulkBytes;     /* Bulk characters sent */
+    uint32_t urgentBytes;   /* Urgent characters sent */
+    uint32_t errors;        /* Characters out of sequence, or urgent ones inside a bulk packet in packet mode */
+} UrgentTest_Result_Types;  /* What the wire saw in a run */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t urgentTestRxArr[8];      /* Rx ring of LPUART0 */
+static uint8_t urgentTestTxArr[255];    /* Bulk Tx ring of LPUART0 */
+static uint8_t urgentTestUrgentArr[32]; /* Urgent Tx ring of LPUART0 */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to queue a message whose bytes follow a sequence number
+ *
+ * @param isUrgent[in]: 1 for the urgent ring, 0 for the bulk ring
+ * @param len[in]: bytes of the message
+ * @param pSequence[in/out]: sequence number of the first byte, moved past the bytes queued
+ *
+ * @return uint32_t: number of bytes queued
+ */
+static uint32_t urgentTestQueue(uint8_t isUrgent, uint32_t len, uint32_t *pSequence)
+{
+    uint8_t message[URGENT_TEST_BULK_LEN];
+    uint32_t nOfBytes;
+
+    for(uint32_t i = 0; i < len; i++)
+    {
+        message[i] = (uint8_t)(((*pSequence + i) & 0x7FU) | ((0 != isUrgent) ? URGENT_TEST_FLAG : 0U));
+    }
+
+    nOfBytes = (0 != isUrgent) ? LPUART_SendUrgent(LPUART0, message, len) : LPUART_Send(LPUART0, message, len);
+    *pSequence += nOfBytes;
+
+    return nOfBytes;
+}
+
+/**
+ * @brief This function is used to run the wire with the bulk ring kept full of packets
+ *
+ * @param preempt[in]: points where the urgent data preempts the bulk data
+ * @param isUrgentFull[in]: 1 to keep the urgent ring full too, 0 to queue an urgent message every
+ *                          URGENT_TEST_PERIOD character times
+ * @param pResult[out]: what the wire saw
+ *
+ * @return void
+ */
+static void urgentTestRun(LPUART_TxPreempt_Type preempt, uint8_t isUrgentFull, UrgentTest_Result_Types *pResult)
+{
+    uint32_t bulkQueued = 0;
+    uint32_t urgentQueued = 0;
+    uint32_t bulkSent = 0;
+    uint32_t urgentSent = 0;
+    uint32_t pending = 0;
+    uint32_t pendingBulk = 0;
+    uint32_t run = 0;
+    uint8_t data;
+
+    *pResult = (UrgentTest_Result_Types){0};
+    TEST_CHECK(LPUART_E_OK == LPUART_TxPriorityInit(LPUART0, urgentTestUrgentArr, sizeof(urgentTestUrgentArr),
+                                                    preempt, URGENT_TEST_BURST));
+
+    for(uint32_t slot = 0; slot < URGENT_TEST_SLOTS; slot++)
+    {
+        while((LPUART_GetTxFree(LPUART0) > URGENT_TEST_BULK_LEN) &&
+              (0U != urgentTestQueue(0, URGENT_TEST_BULK_LEN, &bulkQueued)))
+        {
+            /* Keep the bulk ring full */
+        }
+
+        if((0 != isUrgentFull) || ((urgentQueued == urgentSent) && (0U == (slot % URGENT_TEST_PERIOD))))
+        {
+            while(0U != urgentTestQueue(1U, URGENT_TEST_URGENT_LEN, &urgentQueued))
+            {
+                /* Fill the urgent ring */
+            }
+
+            pendingBulk = (urgentQueued != urgentSent) ? bulkSent : pendingBulk;
+            pending = urgentQueued - urgentSent;
+        }
+
+        if(0 == simLpuartTransmit(LPUART0, &data))
+        {
+            pResult->errors++;
+        }
+        else if(0 != (data & URGENT_TEST_FLAG))
+        {
+            /* An urgent byte: in sequence, and in packet mode never inside a bulk packet */
+            if(((data & 0x7FU) != (urgentSent & 0x7FU)) ||
+               ((LPUART_PREEMPT_PACKET == preempt) && (0U != (bulkSent % URGENT_TEST_BULK_LEN))))
+            {
+                pResult->errors++;
+            }
+
+            if((0 == isUrgentFull) && (0U != pending) && ((bulkSent - pendingBulk) > pResult->latencyMax))
+            {
+                pResult->latencyMax = bulkSent - pendingBulk;
+            }
+
+            pending = 0;
+            urgentSent++;
+            run++;
+            pResult->runMax = (run > pResult->runMax) ? run : pResult->runMax;
+        }
+        else
+        {
+            if((data & 0x7FU) != (bulkSent & 0x7FU))
+            {
+                pResult->errors++;
+            }
+
+            bulkSent++;
+            run = 0;
+        }
+    }
+
+    pResult->bulkBytes = bulkSent;
+    pResult->urgentBytes = urgentSent;
+
+    /* Let the rings empty for the next run */
+    while(0 != simLpuartTransmit(LPUART0, &data))
+    {
+        /* Send what is left */
+    }
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static const char *const names[2] = { "frame", "packet" };
+    UrgentTest_Result_Types result;
+    LPUART_Statistics_Type statistics;
+
+    simReset();
+    (void)LPUART_BufferInit(LPUART0, urgentTestRxArr, sizeof(urgentTestRxArr), urgentTestTxArr,
+                            sizeof(urgentTestTxArr));
+
+    for(uint32_t preempt = LPUART_PREEMPT_FRAME; preempt <= LPUART_PREEMPT_PACKET; preempt++)
+    {
+        uint32_t bulkRun = (LPUART_PREEMPT_FRAME == preempt) ? 1U : URGENT_TEST_BULK_LEN;
+        uint32_t urgentRun = (LPUART_PREEMPT_FRAME == preempt) ? URGENT_TEST_BURST :
+                                                                 (URGENT_TEST_BURST * URGENT_TEST_URGENT_LEN);
+
+        /* Urgent messages at every phase of the bulk packets: the wait is at most the rest of a packet */
+        (void)LPUART_ResetStatistics(LPUART0);
+        urgentTestRun((LPUART_TxPreempt_Type)preempt, 0, &result);
+        (void)LPUART_GetStatistics(LPUART0, &statistics);
+        TEST_CHECK(0U == result.errors);
+        TEST_CHECK((result.latencyMax < bulkRun) && (0U != statistics.urgentLatencyMax));
+        (void)printf("%-6s preemption, bulk saturated: urgent waits at most %2u bulk characters\n",
+                     names[preempt], result.latencyMax);
+
+        /* Both rings saturated: the bulk data still gets one frame or packet after each burst */
+        urgentTestRun((LPUART_TxPreempt_Type)preempt, 1U, &result);
+        TEST_CHECK(0U == result.errors);
+        TEST_CHECK(result.runMax == urgentRun);
+        TEST_CHECK((result.bulkBytes * urgentRun) >= ((result.urgentBytes * bulkRun) - urgentRun));
+        (void)printf("%-6s preemption, both saturated: urgent runs of at most %2u characters, bulk share %.1f%%\n",
+                     names[preempt], result.runMax,
+                     (100.0 * result.bulkBytes) / (result.bulkBytes + result.urgentBytes));
+    }
+
+    return testFinish();
+}
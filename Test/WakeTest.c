@@ -0,0 +1,299 @@
+/**
+ * @file WakeTest.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host test of the low power reception on SIRC, its wake-up latency and the bytes it drops
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The Rx line of LPUART0 is a list of characters timed in cycles of the virtual counter. A character is
+ * received only if the receiver is enabled from its start bit to its stop bit, at a baudrate within 3% of
+ * the line, from the clock selected in the PCC. The test is the CPU: it takes the interrupts and calls
+ * LPUART_ExitLowPower from the first one until the instance is back at full speed.
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Test.h"
+#include "s32k144_lpuart_driver.h"
+#include "s32k144_pcc_driver.h"
+#include <stdio.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define WAKE_TEST_SLEEP_CLOCK   (8000000U)  /* SIRCDIV2 frequency */
+#define WAKE_TEST_CHAR_MAX      (64U)       /* Characters on the line */
+#define WAKE_TEST_IDLE_BITS     (10U)       /* Idle bits after which the receiver clears RAF */
+#define WAKE_TEST_ADDRESS       (0x42U)     /* Address of the match wake-up */
+#define WAKE_TEST_RATE_ERROR    (3U)        /* Largest baudrate error of a character received, in percent */
+#define WAKE_TEST_RATE_MASK     (LPUART_BAUD_OSR_MASK | LPUART_BAUD_SBR_MASK | LPUART_BAUD_BOTHEDGE_MASK)  /* Bits of
+                                                                                               the bit time */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint8_t wakeTestChar[WAKE_TEST_CHAR_MAX];    /* Characters on the line */
+static uint32_t wakeTestCount;                      /* Number of characters on the line */
+static uint32_t wakeTestNext;                       /* First character not started */
+static uint32_t wakeTestStart;                      /* Start bit of the first character */
+static uint32_t wakeTestBitCycles;                  /* Cycles of a bit on the line */
+static uint32_t wakeTestBaud;                       /* Bit time bits of BAUD at the start bit being received */
+static uint32_t wakeTestPcc;                        /* PCC register at the start bit being received */
+static uint8_t wakeTestIsReceiving;                 /* 1 from a start bit to its stop bit */
+static uint32_t wakeTestLost;                       /* Characters the receiver missed or overran */
+static uint8_t wakeTestRxArr[WAKE_TEST_CHAR_MAX];   /* Rx ring of LPUART0 */
+static uint8_t wakeTestTxArr[8];                    /* Tx ring of LPUART0 */
+
+static const uint32_t wakeTestRate[] = { 9600U, 115200U, 460800U };     /* Baudrates of the line */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to know if the receiver of LPUART0 can take a character of the line
+ *
+ * @return uint8_t: 1 if the receiver is enabled at a baudrate close enough to the one of the line
+ */
+static uint8_t wakeTestIsInSync(void)
+{
+    uint32_t pcs = (PCC->PCCn[PCC_LPUART0_INDEX] & PCC_PCCn_PCS_MASK) >> PCC_PCCn_PCS_SHIFT;
+    uint32_t source = (CLOCK_OPTION_2 == pcs) ? WAKE_TEST_SLEEP_CLOCK : clock;
+    uint32_t osr = ((LPUART0->BAUD & LPUART_BAUD_OSR_MASK) >> LPUART_BAUD_OSR_SHIFT) + 1U;
+    uint32_t sbr = LPUART0->BAUD & LPUART_BAUD_SBR_MASK;
+    uint64_t bitCycles = ((uint64_t)clock * osr * sbr) / source;
+    uint64_t error = (bitCycles > wakeTestBitCycles) ? (bitCycles - wakeTestBitCycles) :
+                                                       (wakeTestBitCycles - bitCycles);
+
+    return ((0 != (LPUART0->CTRL & LPUART_CTRL_RE_MASK)) && (0 != sbr) &&
+            ((error * 100U) <= ((uint64_t)wakeTestBitCycles * WAKE_TEST_RATE_ERROR))) ? 1U : 0U;
+}
+
+/**
+ * @brief This function is used to put the line events reached by the time on LPUART0
+ *
+ * @param cycles[in]: cycles counted
+ *
+ * @return void
+ */
+static void wakeTestLine(uint32_t cycles)
+{
+    uint32_t charCycles = wakeTestBitCycles * 10U;
+
+    if((0 != wakeTestIsReceiving) &&
+       ((int32_t)(cycles - (wakeTestStart + ((wakeTestNext - 1U) * charCycles) + ((wakeTestBitCycles * 19U) / 2U))) >= 0))
+    {
+        uint8_t data = wakeTestChar[wakeTestNext - 1U];
+
+        /* Middle of the stop bit, the settings must not have changed since the start bit */
+        wakeTestIsReceiving = 0;
+
+        if((0 == wakeTestIsInSync()) || (wakeTestBaud != (LPUART0->BAUD & WAKE_TEST_RATE_MASK)) ||
+           (wakeTestPcc != PCC->PCCn[PCC_LPUART0_INDEX]))
+        {
+            wakeTestLost++;
+        }
+        else if((0 != (LPUART0->BAUD & LPUART_BAUD_MAEN1_MASK)) &&
+                (data != (LPUART0->MATCH & LPUART_MATCH_MA1_MASK)))
+        {
+            /* Discarded by the match address mode */
+        }
+        else if(0 != (LPUART0->STAT & LPUART_STAT_RDRF_MASK))
+        {
+            LPUART0->STAT |= LPUART_STAT_OR_MASK;
+            wakeTestLost++;
+        }
+        else
+        {
+            LPUART0->DATA = data;
+            LPUART0->STAT |= LPUART_STAT_RDRF_MASK |
+                             ((0 != (LPUART0->BAUD & LPUART_BAUD_MAEN1_MASK)) ? LPUART_STAT_MA1F_MASK : 0U);
+        }
+    }
+
+    if((0 == wakeTestIsReceiving) && (wakeTestNext < wakeTestCount) &&
+       ((int32_t)(cycles - (wakeTestStart + (wakeTestNext * charCycles))) >= 0))
+    {
+        /* Falling edge of the start bit */
+        wakeTestIsReceiving = 1;
+        wakeTestNext++;
+        wakeTestBaud = LPUART0->BAUD & WAKE_TEST_RATE_MASK;
+        wakeTestPcc = PCC->PCCn[PCC_LPUART0_INDEX];
+        LPUART0->STAT |= LPUART_STAT_RXEDGIF_MASK | LPUART_STAT_RAF_MASK;
+    }
+
+    if((0 == wakeTestIsReceiving) && (0 != wakeTestCount) &&
+       ((int32_t)(cycles - (wakeTestStart + (wakeTestCount * charCycles) + (wakeTestBitCycles * WAKE_TEST_IDLE_BITS))) >= 0))
+    {
+        LPUART0->STAT &= ~LPUART_STAT_RAF_MASK;
+    }
+}
+
+/**
+ * @brief This function is used to put characters on the line after a short idle time
+ *
+ * @param pData[in]: characters
+ * @param len[in]: number of characters
+ * @param baudRate[in]: baudrate of the line
+ *
+ * @return void
+ */
+static void wakeTestSend(const uint8_t *pData, uint32_t len, uint32_t baudRate)
+{
+    wakeTestBitCycles = clock / baudRate;
+    wakeTestStart = cycleCounterSim() + (wakeTestBitCycles * 3U);
+    wakeTestNext = 0;
+    wakeTestIsReceiving = 0;
+
+    for(uint32_t i = 0; i < len; i++)
+    {
+        wakeTestChar[i] = pData[i];
+    }
+
+    wakeTestCount = len;
+}
+
+/**
+ * @brief This function is used to run the CPU until the line is idle, it takes the interrupts of LPUART0
+ *        and calls LPUART_ExitLowPower from the first one until it succeeds
+ *
+ * @return uint32_t: cycles from the first start bit to the return of the successful LPUART_ExitLowPower,
+ *         0 if the instance did not go back to full speed
+ */
+static uint32_t wakeTestRun(void)
+{
+    uint32_t end = wakeTestStart + (wakeTestBitCycles * 10U * (wakeTestCount + WAKE_TEST_IDLE_BITS));
+    uint8_t isWoken = 0;
+    uint8_t isAwake = 0;
+    uint32_t latency = 0;
+    uint32_t now = cycleCounterSim();
+
+    while((int32_t)(now - end) < 0)
+    {
+        if(((0 != (LPUART0->BAUD & LPUART_BAUD_RXEDGIE_MASK)) && (0 != (LPUART0->STAT & LPUART_STAT_RXEDGIF_MASK))) ||
+           ((0 != (LPUART0->CTRL & LPUART_CTRL_RIE_MASK)) && (0 != (LPUART0->STAT & LPUART_STAT_RDRF_MASK))))
+        {
+            simIrq(LPUART0_RxTx_IRQn);
+
+            /* The handler read DATA */
+            LPUART0->STAT &= ~LPUART_STAT_RDRF_MASK;
+            isWoken = 1;
+        }
+
+        if((0 != isWoken) && (0 == isAwake) && (LPUART_E_OK == LPUART_ExitLowPower(LPUART0)))
+        {
+            latency = cycleCounterSim() - wakeTestStart;
+            isAwake = 1;
+        }
+
+        now = cycleCounterSim();
+    }
+
+    wakeTestCount = 0;
+
+    return latency;
+}
+
+/**
+ * @brief This function is used to sleep, receive characters and wake up at a baudrate, then check every
+ *        character after the wake-up one reached the Rx ring
+ *
+ * @param pConfig[in]: low power reception settings
+ * @param pData[in]: characters on the line
+ * @param len[in]: number of characters
+ * @param nOfSkipped[in]: leading characters discarded before the wake-up
+ * @param baudRate[in]: baudrate of the line
+ *
+ * @return void
+ */
+static void wakeTestCase(const LPUART_LowPower_Config_Type *pConfig, const uint8_t *pData, uint32_t len,
+                         uint32_t nOfSkipped, uint32_t baudRate)
+{
+    uint32_t baud = LPUART0->BAUD;
+    uint32_t pcc = PCC->PCCn[PCC_LPUART0_INDEX];
+    LPUART_Statistics_Type statistics;
+    uint8_t received[WAKE_TEST_CHAR_MAX];
+    uint32_t nOfReceived;
+    uint32_t latency;
+
+    (void)LPUART_ResetStatistics(LPUART0);
+    wakeTestLost = 0;
+    TEST_CHECK(LPUART_E_OK == LPUART_EnterLowPower(LPUART0, pConfig));
+    TEST_CHECK(CLOCK_OPTION_2 == ((PCC->PCCn[PCC_LPUART0_INDEX] & PCC_PCCn_PCS_MASK) >> PCC_PCCn_PCS_SHIFT));
+
+    wakeTestSend(pData, len, baudRate);
+    latency = wakeTestRun();
+    nOfReceived = LPUART_Receive(LPUART0, received, sizeof(received));
+    (void)LPUART_GetStatistics(LPUART0, &statistics);
+
+    TEST_CHECK(0U != latency);
+    TEST_CHECK((baud == LPUART0->BAUD) && (pcc == PCC->PCCn[PCC_LPUART0_INDEX]));
+    TEST_CHECK((0U == wakeTestLost) && (0U == statistics.rxDropped) && (0U == statistics.overRunErrors));
+    TEST_CHECK((nOfReceived == (len - nOfSkipped)) && (pData[nOfSkipped] == received[0]) &&
+               (pData[len - 1U] == received[nOfReceived - 1U]));
+    TEST_CHECK(1U == statistics.wakeUps);
+
+    (void)printf("%-7s %6u baud, %2u bytes: %u of %u kept, wake-up to full speed %7u cycles, exit %7u cycles\n",
+                 (LPUART_WAKE_RX_EDGE == pConfig->wakeSource) ? "edge" : "address", baudRate, len, nOfReceived,
+                 len - nOfSkipped, latency, statistics.wakeCyclesMax);
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    LPUART_Handle_Type handle =
+    {
+        .pLPUARTx = LPUART0,
+        .LPUART_Config =
+        {
+            .frameLenth = LPUART_FRAME_8BITS,
+            .parityMode = LPUART_PARITY_DISABLE,
+            .nOfStopBits = LPUART_STOP_BITS_1,
+            .msbFirst = LPUART_LSB_FIRST,
+        },
+    };
+    LPUART_LowPower_Config_Type edge = { .wakeSource = LPUART_WAKE_RX_EDGE, .sleepClock = WAKE_TEST_SLEEP_CLOCK };
+    LPUART_LowPower_Config_Type address =
+    {
+        .wakeSource = LPUART_WAKE_ADDRESS_MATCH, .address = WAKE_TEST_ADDRESS, .sleepClock = WAKE_TEST_SLEEP_CLOCK
+    };
+    uint8_t burst[32];
+    uint8_t message[20] = { 0x10U, 0x11U, 0x12U, WAKE_TEST_ADDRESS };
+
+    for(uint32_t i = 0; i < sizeof(burst); i++)
+    {
+        burst[i] = (uint8_t)(0xA0U + i);
+    }
+
+    for(uint32_t i = 4U; i < sizeof(message); i++)
+    {
+        message[i] = (uint8_t)i;
+    }
+
+    simReset();
+    simCycleHookSet(wakeTestLine);
+    PCC->PCCn[PCC_LPUART0_INDEX] = PCC_PCCn_PCS(CLOCK_OPTION_3) | PCC_PCCn_CGC_MASK;
+
+    for(uint32_t i = 0; i < (sizeof(wakeTestRate) / sizeof(wakeTestRate[0])); i++)
+    {
+        handle.LPUART_Config.baudRate = wakeTestRate[i];
+        (void)LPUART_Init(&handle);
+        (void)LPUART_BufferInit(LPUART0, wakeTestRxArr, sizeof(wakeTestRxArr), wakeTestTxArr, sizeof(wakeTestTxArr));
+
+        /* The wake-up byte alone, then at the head of a burst, then an address after other traffic */
+        wakeTestCase(&edge, burst, 1U, 0U, wakeTestRate[i]);
+        wakeTestCase(&edge, burst, sizeof(burst), 0U, wakeTestRate[i]);
+        wakeTestCase(&address, message, sizeof(message), 3U, wakeTestRate[i]);
+    }
+
+    /* Nothing to restore at full speed, and no clock switch while a character is received */
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_ExitLowPower(LPUART0));
+    LPUART0->STAT |= LPUART_STAT_RAF_MASK;
+    TEST_CHECK(LPUART_E_NOT_OK == LPUART_EnterLowPower(LPUART0, &edge));
+    TEST_CHECK(CLOCK_OPTION_3 == ((PCC->PCCn[PCC_LPUART0_INDEX] & PCC_PCCn_PCS_MASK) >> PCC_PCCn_PCS_SHIFT));
+
+    return testFinish();
+}
@@ -0,0 +1,356 @@
+/**
+ * @file Timer.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the hierarchical timing wheel of software timers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Timer.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define TIMER_SLOT_MASK     ((uint64_t)TIMER_SLOT_NUM - 1U)                         /* Mask of a slot index */
+#define TIMER_RANGE         (1ULL << (TIMER_SLOT_BITS * TIMER_LEVEL_NUM))           /* Ticks covered by the wheels */
+#define TIMER_LEVEL_RANGE(level) (1ULL << (TIMER_SLOT_BITS * ((level) + 1U)))       /* Ticks covered up to a wheel */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+/**
+ * @name timerLink
+ *
+ * @brief This function is used to add a timer at the end of a list
+ *
+ * @param pList[in/out]: head of the list
+ * @param timer[in/out]: pointer to the timer
+ *
+ * @return void
+ */
+static void timerLink(Timer_Link_Types *pList, Std_Timer_Types *timer);
+
+/**
+ * @name timerUnlink
+ *
+ * @brief This function is used to remove a timer from its list and mark it stopped
+ *
+ * @param timer[in/out]: pointer to the timer
+ *
+ * @return void
+ */
+static void timerUnlink(Std_Timer_Types *timer);
+
+/**
+ * @name timerSplice
+ *
+ * @brief This function is used to move all the timers of a slot to another list
+ *
+ * @param pSlot[in/out]: slot emptied
+ * @param pList[out]: list receiving the timers, its previous content is lost
+ *
+ * @return void
+ */
+static void timerSplice(Timer_Link_Types *pSlot, Timer_Link_Types *pList);
+
+/**
+ * @name timerInsert
+ *
+ * @brief This function is used to put a timer in the slot matching its expiry
+ *
+ * @param timer[in/out]: pointer to the timer, expiry later than the current tick
+ *
+ * @return void
+ */
+static void timerInsert(Std_Timer_Types *timer);
+
+/**
+ * @name timerCascade
+ *
+ * @brief This function is used to move the timers of a slot of an upper wheel to the lower wheels
+ *
+ * @param level[in]: wheel of the slot
+ * @param index[in]: index of the slot
+ *
+ * @return void
+ */
+static void timerCascade(uint32_t level, uint32_t index);
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Timer_Link_Types timerWheel[TIMER_LEVEL_NUM][TIMER_SLOT_NUM];   /* Slots of each wheel */
+static uint64_t timerNow;                                               /* Last tick processed */
+static uint32_t timerNumActive;                                         /* Number of running timers */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to add a timer at the end of a list
+ *
+ * @param pList[in/out]: head of the list
+ * @param timer[in/out]: pointer to the timer
+ *
+ * @return void
+ */
+static void timerLink(Timer_Link_Types *pList, Std_Timer_Types *timer)
+{
+    timer->link.next = pList;
+    timer->link.prev = pList->prev;
+    pList->prev->next = &timer->link;
+    pList->prev = &timer->link;
+}
+
+/**
+ * @brief This function is used to remove a timer from its list and mark it stopped
+ *
+ * @param timer[in/out]: pointer to the timer
+ *
+ * @return void
+ */
+static void timerUnlink(Std_Timer_Types *timer)
+{
+    timer->link.prev->next = timer->link.next;
+    timer->link.next->prev = timer->link.prev;
+    timer->link.next = 0;
+    timer->link.prev = 0;
+}
+
+/**
+ * @brief This function is used to move all the timers of a slot to another list
+ *
+ * @param pSlot[in/out]: slot emptied
+ * @param pList[out]: list receiving the timers, its previous content is lost
+ *
+ * @return void
+ */
+static void timerSplice(Timer_Link_Types *pSlot, Timer_Link_Types *pList)
+{
+    if(pSlot->next == pSlot)
+    {
+        pList->next = pList;
+        pList->prev = pList;
+    }
+    else
+    {
+        pList->next = pSlot->next;
+        pList->prev = pSlot->prev;
+        pList->next->prev = pList;
+        pList->prev->next = pList;
+        pSlot->next = pSlot;
+        pSlot->prev = pSlot;
+    }
+}
+
+/**
+ * @brief This function is used to put a timer in the slot matching its expiry
+ *
+ * The wheel is the lowest one whose range covers the remaining time, the slot is taken from the bits of
+ * the expiry for that wheel. Expiries beyond the top wheel go to its farthest slot and are placed again
+ * when it cascades.
+ *
+ * @param timer[in/out]: pointer to the timer, expiry later than the current tick
+ *
+ * @return void
+ */
+static void timerInsert(Std_Timer_Types *timer)
+{
+    uint64_t delta = timer->expires - timerNow;
+    uint64_t expires = timer->expires;
+    uint32_t level = 0;
+
+    while(((TIMER_LEVEL_NUM - 1U) > level) && (TIMER_LEVEL_RANGE(level) <= delta))
+    {
+        level++;
+    }
+
+    if(TIMER_RANGE <= delta)
+    {
+        expires = timerNow + TIMER_RANGE - 1U;
+    }
+
+    timerLink(&timerWheel[level][(expires >> (TIMER_SLOT_BITS * level)) & TIMER_SLOT_MASK], timer);
+}
+
+/**
+ * @brief This function is used to move the timers of a slot of an upper wheel to the lower wheels
+ *
+ * @param level[in]: wheel of the slot
+ * @param index[in]: index of the slot
+ *
+ * @return void
+ */
+static void timerCascade(uint32_t level, uint32_t index)
+{
+    Timer_Link_Types list;
+
+    timerSplice(&timerWheel[level][index], &list);
+
+    while(list.next != &list)
+    {
+        Std_Timer_Types *timer = (Std_Timer_Types *)list.next;
+
+        timerUnlink(timer);
+        timerInsert(timer);
+    }
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to empty the wheels and set the current tick
+ *
+ * @param now[in]: current tick, as LPIT_GetTickCount
+ *
+ * @return void
+ */
+void timerInit(uint64_t now)
+{
+    for(uint32_t level = 0; level < TIMER_LEVEL_NUM; level++)
+    {
+        for(uint32_t index = 0; index < TIMER_SLOT_NUM; index++)
+        {
+            timerWheel[level][index].next = &timerWheel[level][index];
+            timerWheel[level][index].prev = &timerWheel[level][index];
+        }
+    }
+
+    timerNow = now;
+    timerNumActive = 0;
+}
+
+/**
+ * @brief This function is used to start a timer, a running timer is restarted
+ *
+ * @param timer[in/out]: pointer to the timer
+ * @param delay[in]: ticks before the first expiry, at least 1
+ * @param period[in]: ticks between the next expiries, 0 for a one-shot timer
+ * @param callback[in]: called at expiry
+ * @param arg[in]: argument of the callback
+ *
+ * @return Std_Timer_Status: TIMER_E_NOT_OK if the timer or the callback is not valid
+ */
+Std_Timer_Status timerStart(Std_Timer_Types *timer, uint32_t delay, uint32_t period,
+                            Timer_Callback_Types callback, void *arg)
+{
+    Std_Timer_Status status = TIMER_E_NOT_OK;
+
+    if((0 != timer) && (0 != callback))
+    {
+        timerStop(timer);
+
+        /* The current tick is already processed, the earliest expiry is the next one */
+        timer->expires = timerNow + ((0 != delay) ? delay : 1U);
+        timer->period = period;
+        timer->callback = callback;
+        timer->arg = arg;
+
+        timerInsert(timer);
+        timerNumActive++;
+        status = TIMER_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to stop a timer, stopping a stopped timer does nothing
+ *
+ * @param timer[in/out]: pointer to the timer
+ *
+ * @return void
+ */
+void timerStop(Std_Timer_Types *timer)
+{
+    if((0 != timer) && (0 != timer->link.next))
+    {
+        timerUnlink(timer);
+        timerNumActive--;
+    }
+}
+
+/**
+ * @brief This function is used to check whether a timer is running
+ *
+ * @param timer[in]: pointer to the timer
+ *
+ * @return uint8_t: 1 if the timer is running, 0 otherwise
+ */
+uint8_t timerIsActive(const Std_Timer_Types *timer)
+{
+    return ((0 != timer) && (0 != timer->link.next)) ? 1U : 0U;
+}
+
+/**
+ * @brief This function is used to move the wheels up to a tick and call the callbacks of the expired timers
+ *
+ * Every tick runs one slot of the lowest wheel, and when its index wraps the matching slot of the next
+ * wheel is cascaded first. The wheels jump straight to the tick when no timer is running.
+ *
+ * @param now[in]: current tick, as LPIT_GetTickCount
+ *
+ * @return uint32_t: number of callbacks called
+ */
+uint32_t timerAdvance(uint64_t now)
+{
+    uint32_t nOfExpired = 0;
+
+    while(timerNow < now)
+    {
+        if(0 == timerNumActive)
+        {
+            timerNow = now;
+        }
+        else
+        {
+            Timer_Link_Types list;
+
+            timerNow++;
+
+            if(0 == (timerNow & TIMER_SLOT_MASK))
+            {
+                uint32_t level = 1;
+                uint32_t index;
+
+                do
+                {
+                    index = (uint32_t)((timerNow >> (TIMER_SLOT_BITS * level)) & TIMER_SLOT_MASK);
+                    timerCascade(level, index);
+                    level++;
+                } while((TIMER_LEVEL_NUM > level) && (0 == index));
+            }
+
+            /* Callbacks may start or stop any timer, including the ones of this slot not called yet */
+            timerSplice(&timerWheel[0][timerNow & TIMER_SLOT_MASK], &list);
+
+            while(list.next != &list)
+            {
+                Std_Timer_Types *timer = (Std_Timer_Types *)list.next;
+
+                timerUnlink(timer);
+
+                if(0 != timer->period)
+                {
+                    timer->expires += timer->period;
+                    timerInsert(timer);
+                }
+                else
+                {
+                    timerNumActive--;
+                }
+
+                timer->callback(timer, timer->arg);
+                nOfExpired++;
+            }
+        }
+    }
+
+    return nOfExpired;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file Timer.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the hierarchical timing wheel of software timers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef TIMER_H_
+#define TIMER_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include <stdint.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define TIMER_LEVEL_NUM     (4U)    /* Number of wheels */
+#define TIMER_SLOT_BITS     (6U)    /* Each wheel has 2^TIMER_SLOT_BITS slots */
+#define TIMER_SLOT_NUM      (1U << TIMER_SLOT_BITS)     /* Number of slots of a wheel */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    TIMER_E_OK,         /* Operation completed without error */
+    TIMER_E_NOT_OK,     /* Operation not completed */
+} Std_Timer_Status;     /* Standard status type */
+
+typedef struct Timer_Link
+{
+    struct Timer_Link *next;    /* Next entry of the slot */
+    struct Timer_Link *prev;    /* Previous entry of the slot */
+} Timer_Link_Types;             /* Link of a circular list, a slot is its own empty list */
+
+typedef struct Std_Timer Std_Timer_Types;
+
+typedef void (*Timer_Callback_Types)(Std_Timer_Types *timer, void *arg);    /* Expiry callback */
+
+struct Std_Timer
+{
+    Timer_Link_Types link;          /* Place in its slot, must stay first */
+    uint64_t expires;               /* Tick the timer expires at */
+    uint32_t period;                /* Ticks between two expiries, 0 for a one-shot timer */
+    Timer_Callback_Types callback;  /* Called at expiry */
+    void *arg;                      /* Argument of the callback */
+};                                  /* Software timer, owned by the caller */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name timerInit
+ *
+ * @brief This function is used to empty the wheels and set the current tick
+ *
+ * @param now[in]: current tick, as LPIT_GetTickCount
+ *
+ * @return void
+ */
+void timerInit(uint64_t now);
+
+/**
+ * @name timerStart
+ *
+ * @brief This function is used to start a timer, a running timer is restarted
+ *
+ * @param timer[in/out]: pointer to the timer
+ * @param delay[in]: ticks before the first expiry, at least 1
+ * @param period[in]: ticks between the next expiries, 0 for a one-shot timer
+ * @param callback[in]: called at expiry
+ * @param arg[in]: argument of the callback
+ *
+ * @return Std_Timer_Status: TIMER_E_NOT_OK if the timer or the callback is not valid
+ */
+Std_Timer_Status timerStart(Std_Timer_Types *timer, uint32_t delay, uint32_t period,
+                            Timer_Callback_Types callback, void *arg);
+
+/**
+ * @name timerStop
+ *
+ * @brief This function is used to stop a timer, stopping a stopped timer does nothing
+ *
+ * @param timer[in/out]: pointer to the timer
+ *
+ * @return void
+ */
+void timerStop(Std_Timer_Types *timer);
+
+/**
+ * @name timerIsActive
+ *
+ * @brief This function is used to check whether a timer is running
+ *
+ * @param timer[in]: pointer to the timer
+ *
+ * @return uint8_t: 1 if the timer is running, 0 otherwise
+ */
+uint8_t timerIsActive(const Std_Timer_Types *timer);
+
+/**
+ * @name timerAdvance
+ *
+ * @brief This function is used to move the wheels up to a tick and call the callbacks of the expired timers
+ *
+ * @param now[in]: current tick, as LPIT_GetTickCount
+ *
+ * @return uint32_t: number of callbacks called
+ */
+uint32_t timerAdvance(uint64_t now);
+
+#endif /* TIMER_H_ */
@@ -0,0 +1,145 @@
+/**
+ * @file Decompress.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host tool rebuilding the data sent by the streaming LZ compressor
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Build on the host with the same settings as the firmware:
+ *     cc -o Decompress Decompress.c
+ * Usage:
+ *     Decompress < capture.bin > data.bin
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#ifndef COMPRESS_WINDOW_BITS
+#define COMPRESS_WINDOW_BITS    (8U)    /* Must match Compress.h */
+#endif
+
+#ifndef COMPRESS_LENGTH_BITS
+#define COMPRESS_LENGTH_BITS    (4U)    /* Must match Compress.h */
+#endif
+
+#define COMPRESS_MATCH_MIN      (2U)    /* Must match Compress.h */
+#define COMPRESS_WINDOW_MASK    ((1U << COMPRESS_WINDOW_BITS) - 1U)
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static uint32_t bits;       /* Bits read and not used yet, right aligned */
+static uint32_t nOfBits;    /* Number of bits in bits */
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to read bits of the capture, most significant first
+ *
+ * @param n[in]: number of bits, at most 16
+ * @param pValue[out]: bits read, right aligned
+ *
+ * @return int: 0 at the end of the capture, 1 otherwise
+ */
+static int readBits(uint32_t n, uint32_t *pValue)
+{
+    int isValid = 1;
+
+    while((1 == isValid) && (nOfBits < n))
+    {
+        int c = getchar();
+
+        if(EOF == c)
+        {
+            isValid = 0;
+        }
+        else
+        {
+            bits = (bits << 8) | (uint32_t)c;
+            nOfBits += 8U;
+        }
+    }
+
+    if(1 == isValid)
+    {
+        nOfBits -= n;
+        *pValue = (bits >> nOfBits) & ((1UL << n) - 1U);
+    }
+
+    return isValid;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    static uint8_t window[COMPRESS_WINDOW_MASK + 1U];  /* Starts filled with zeros, as the compressor */
+    uint32_t pos = 0;
+    unsigned long nOfBytes = 0;
+    unsigned long nOfFlushes = 0;
+    uint32_t flag;
+
+    while(0 != readBits(1U, &flag))
+    {
+        uint32_t value;
+
+        if(1U == flag)
+        {
+            if(0 == readBits(8U, &value))
+            {
+                break;
+            }
+
+            window[pos & COMPRESS_WINDOW_MASK] = (uint8_t)value;
+            putchar((int)value);
+            pos++;
+            nOfBytes++;
+        }
+        else
+        {
+            uint32_t dist;
+
+            if(0 == readBits(COMPRESS_WINDOW_BITS, &dist))
+            {
+                break;
+            }
+
+            if(0U == dist)
+            {
+                /* Flush marker, the rest of the byte is padding */
+                nOfBits -= nOfBits % 8U;
+                nOfFlushes++;
+            }
+            else if(0 != readBits(COMPRESS_LENGTH_BITS, &value))
+            {
+                /* The match may overlap the bytes it writes, copy one at a time */
+                for(uint32_t i = 0; i < (value + COMPRESS_MATCH_MIN); i++)
+                {
+                    uint8_t byte = window[(pos - dist) & COMPRESS_WINDOW_MASK];
+
+                    window[pos & COMPRESS_WINDOW_MASK] = byte;
+                    putchar(byte);
+                    pos++;
+                    nOfBytes++;
+                }
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    fprintf(stderr, "%lu bytes decoded, %lu flushes\n", nOfBytes, nOfFlushes);
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file LogDecoder.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief Host tool rebuilding the text of the deferred log captured from the LPUART
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Build on the host with the same message table as the firmware:
+ *     cc -I../../Logger -o LogDecoder LogDecoder.c
+ * Usage:
+ *     LogDecoder < capture.bin
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LOG_ARGS_MAX        (4U)    /* Must match Logger.h */
+#define LOG_FRAME_SYNC      (0xA5U) /* Must match Logger.h */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+#define LOG_MESSAGE(id, format) { #id, format },
+static const struct
+{
+    const char *name;   /* Identifier of the message */
+    const char *format; /* Format string of the message */
+} logTable[] =
+{
+#include "LogMessages.def"
+};
+#undef LOG_MESSAGE
+
+#define LOG_TABLE_SIZE (sizeof(logTable) / sizeof(logTable[0]))
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to read one byte of the capture and add it to the frame checksum
+ *
+ * @param pChecksum[in/out]: running checksum
+ *
+ * @return int: byte read, EOF at the end of the capture
+ */
+static int readByte(uint8_t *pChecksum)
+{
+    int c = getchar();
+
+    if(EOF != c)
+    {
+        *pChecksum = (uint8_t)(*pChecksum + (uint8_t)c);
+    }
+
+    return c;
+}
+
+/****************************************************************************************************************
+ *                                              MAIN                                                            *
+ ****************************************************************************************************************/
+int main(void)
+{
+    unsigned long nOfFrames = 0;
+    unsigned long nOfErrors = 0;
+    int c;
+
+    while(EOF != (c = getchar()))
+    {
+        uint8_t checksum = LOG_FRAME_SYNC;
+        uint32_t args[LOG_ARGS_MAX] = {0};
+        int idLow;
+        int idHigh;
+        int nOfArgs;
+        int isValid = 1;
+
+        /* Resynchronize on the next sync byte */
+        if(LOG_FRAME_SYNC != c)
+        {
+            continue;
+        }
+
+        idLow = readByte(&checksum);
+        idHigh = readByte(&checksum);
+        nOfArgs = readByte(&checksum);
+
+        if((EOF == idLow) || (EOF == idHigh) || (EOF == nOfArgs) || (nOfArgs > (int)LOG_ARGS_MAX))
+        {
+            isValid = 0;
+        }
+
+        for(int i = 0; (1 == isValid) && (i < nOfArgs); i++)
+        {
+            for(int b = 0; (1 == isValid) && (b < 4); b++)
+            {
+                int byte = readByte(&checksum);
+
+                if(EOF == byte)
+                {
+                    isValid = 0;
+                }
+                else
+                {
+                    args[i] |= (uint32_t)byte << (8 * b);
+                }
+            }
+        }
+
+        if((1 == isValid) && ((uint8_t)getchar() == checksum))
+        {
+            unsigned int id = (unsigned int)idLow | ((unsigned int)idHigh << 8);
+
+            if(id < LOG_TABLE_SIZE)
+            {
+                printf(logTable[id].format, args[0], args[1], args[2], args[3]);
+                putchar('\n');
+            }
+            else
+            {
+                printf("<unknown message %u>\n", id);
+            }
+            nOfFrames++;
+        }
+        else
+        {
+            nOfErrors++;
+        }
+    }
+
+    fprintf(stderr, "%lu frames decoded, %lu corrupted\n", nOfFrames, nOfErrors);
+
+    return 0;
+}
@@ -0,0 +1,329 @@
+/**
+ * @file Trace.c
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to define the cycle count profiling of the driver trace points
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include "Trace.h"
+#include <stdatomic.h>
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define TRACE_CLZ(x)        ((uint32_t)__builtin_clz(x))    /* Count leading zeros, one CLZ instruction on Cortex-M4 */
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef struct
+{
+    atomic_uint_fast32_t count;                         /* Number of measures                 */
+    atomic_uint_fast32_t min;                           /* Shortest measure                   */
+    atomic_uint_fast32_t max;                           /* Longest measure                    */
+    atomic_uint_fast32_t sumLow;                        /* Lower 32 bits of the sum           */
+    atomic_uint_fast32_t sumHigh;                       /* Carries of the lower 32 bits       */
+    atomic_uint_fast32_t histogram[TRACE_HIST_BUCKETS]; /* Measures by number of significant bits */
+} Trace_Point_Types;    /* Accumulators of a trace point, updated without lock */
+
+/****************************************************************************************************************
+ *                                              GLOBAL VARIABLES                                                *
+ ****************************************************************************************************************/
+static Trace_Point_Types tracePoint[TRACE_ID_COUNT];    /* Accumulators of each trace point */
+
+#define TRACE_POINT(id) (#id) + (sizeof("TRACE_ID_") - 1U),
+static const char * const traceName[TRACE_ID_COUNT] =
+{
+#include "TracePoints.def"
+};  /* Name of each trace point, without the prefix */
+#undef TRACE_POINT
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DECLARATIONS                                        *
+ ****************************************************************************************************************/
+/**
+ * @name traceAppend
+ *
+ * @brief This function is used to add a string to a line
+ *
+ * @param buffer[out]: line
+ * @param size[in]: size of the buffer
+ * @param pLength[in/out]: length of the line, set above size once the buffer is too small
+ * @param str[in]: null terminated string
+ *
+ * @return void
+ */
+static void traceAppend(char *buffer, uint32_t size, uint32_t *pLength, const char *str);
+
+/**
+ * @name traceAppendNumber
+ *
+ * @brief This function is used to add a decimal number to a line
+ *
+ * @param buffer[out]: line
+ * @param size[in]: size of the buffer
+ * @param pLength[in/out]: length of the line, set above size once the buffer is too small
+ * @param value[in]: number
+ *
+ * @return void
+ */
+static void traceAppendNumber(char *buffer, uint32_t size, uint32_t *pLength, uint64_t value);
+
+/****************************************************************************************************************
+ *                                         STATIC FUNCTIONS DEFINITIONS                                         *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to add a string to a line
+ *
+ * @param buffer[out]: line
+ * @param size[in]: size of the buffer
+ * @param pLength[in/out]: length of the line, set above size once the buffer is too small
+ * @param str[in]: null terminated string
+ *
+ * @return void
+ */
+static void traceAppend(char *buffer, uint32_t size, uint32_t *pLength, const char *str)
+{
+    while(('\0' != *str) && (*pLength < size))
+    {
+        buffer[*pLength] = *str;
+        (*pLength)++;
+        str++;
+    }
+
+    /* One more character than the buffer holds marks the overflow */
+    if('\0' != *str)
+    {
+        *pLength = size + 1U;
+    }
+}
+
+/**
+ * @brief This function is used to add a decimal number to a line
+ *
+ * @param buffer[out]: line
+ * @param size[in]: size of the buffer
+ * @param pLength[in/out]: length of the line, set above size once the buffer is too small
+ * @param value[in]: number
+ *
+ * @return void
+ */
+static void traceAppendNumber(char *buffer, uint32_t size, uint32_t *pLength, uint64_t value)
+{
+    char digits[21];
+    uint32_t index = sizeof(digits) - 1U;
+
+    digits[index] = '\0';
+
+    do
+    {
+        index--;
+        digits[index] = (char)('0' + (value % 10U));
+        value /= 10U;
+    } while(0U != value);
+
+    traceAppend(buffer, size, pLength, &digits[index]);
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to start the cycle counter and clear all the trace points
+ *
+ * @return void
+ */
+void traceInit(void)
+{
+    CYCLE_COUNTER_ENABLE();
+
+    for(uint32_t id = 0; id < TRACE_ID_COUNT; id++)
+    {
+        atomic_init(&tracePoint[id].count, 0U);
+        atomic_init(&tracePoint[id].min, 0xFFFFFFFFU);
+        atomic_init(&tracePoint[id].max, 0U);
+        atomic_init(&tracePoint[id].sumLow, 0U);
+        atomic_init(&tracePoint[id].sumHigh, 0U);
+
+        for(uint32_t bucket = 0; bucket < TRACE_HIST_BUCKETS; bucket++)
+        {
+            atomic_init(&tracePoint[id].histogram[bucket], 0U);
+        }
+    }
+}
+
+/**
+ * @brief This function is used to add a measure to a trace point, it can be called from any context
+ *        including ISR
+ *
+ * Each accumulator is updated on its own with a single atomic operation, or a compare and swap loop for
+ * the minimum and the maximum, so a preempted record never blocks the interrupt that preempted it.
+ *
+ * @param id[in]: trace point
+ * @param cycles[in]: duration in cycles
+ *
+ * @return void
+ */
+void traceRecord(Trace_Id_Types id, uint32_t cycles)
+{
+    if(TRACE_ID_COUNT > id)
+    {
+        Trace_Point_Types *pPoint = &tracePoint[id];
+        uint32_t bucket = (0U != cycles) ? (32U - TRACE_CLZ(cycles)) : 0U;
+        uint_fast32_t old;
+
+        if(TRACE_HIST_BUCKETS <= bucket)
+        {
+            bucket = TRACE_HIST_BUCKETS - 1U;
+        }
+
+        atomic_fetch_add_explicit(&pPoint->histogram[bucket], 1U, memory_order_relaxed);
+
+        /* A 64-bit atomic is not lock free on Cortex-M4, the sum carries into a second word */
+        old = atomic_fetch_add_explicit(&pPoint->sumLow, cycles, memory_order_relaxed);
+
+        if((uint32_t)(old + cycles) < (uint32_t)old)
+        {
+            atomic_fetch_add_explicit(&pPoint->sumHigh, 1U, memory_order_relaxed);
+        }
+
+        old = atomic_load_explicit(&pPoint->min, memory_order_relaxed);
+
+        while((cycles < old) &&
+              (0 == atomic_compare_exchange_weak_explicit(&pPoint->min, &old, cycles,
+                                                          memory_order_relaxed, memory_order_relaxed)))
+        {
+            /* old is reloaded by the failed exchange */
+        }
+
+        old = atomic_load_explicit(&pPoint->max, memory_order_relaxed);
+
+        while((cycles > old) &&
+              (0 == atomic_compare_exchange_weak_explicit(&pPoint->max, &old, cycles,
+                                                          memory_order_relaxed, memory_order_relaxed)))
+        {
+            /* old is reloaded by the failed exchange */
+        }
+
+        /* Counted last so a reader never sees more measures than the sum holds */
+        atomic_fetch_add_explicit(&pPoint->count, 1U, memory_order_release);
+    }
+}
+
+/**
+ * @brief This function is used to take a snapshot of a trace point
+ *
+ * The accumulators are read one by one, a record running at the same time may be partly included.
+ *
+ * @param id[in]: trace point
+ * @param pStats[out]: snapshot
+ *
+ * @return Std_Trace_Status: TRACE_E_NOT_OK if the trace point or the pointer is not valid
+ */
+Std_Trace_Status traceRead(Trace_Id_Types id, Trace_Stats_Types *pStats)
+{
+    Std_Trace_Status status = TRACE_E_NOT_OK;
+
+    if((TRACE_ID_COUNT > id) && (0 != pStats))
+    {
+        Trace_Point_Types *pPoint = &tracePoint[id];
+        uint32_t high;
+        uint32_t low;
+
+        pStats->count = (uint32_t)atomic_load_explicit(&pPoint->count, memory_order_acquire);
+        pStats->min = (uint32_t)atomic_load_explicit(&pPoint->min, memory_order_relaxed);
+        pStats->max = (uint32_t)atomic_load_explicit(&pPoint->max, memory_order_relaxed);
+
+        /* Read again if a carry came in between */
+        do
+        {
+            high = (uint32_t)atomic_load_explicit(&pPoint->sumHigh, memory_order_relaxed);
+            low = (uint32_t)atomic_load_explicit(&pPoint->sumLow, memory_order_relaxed);
+        } while(high != (uint32_t)atomic_load_explicit(&pPoint->sumHigh, memory_order_relaxed));
+
+        pStats->sum = ((uint64_t)high << 32U) | low;
+        pStats->avg = 0;
+
+        if(0U != pStats->count)
+        {
+            pStats->avg = (uint32_t)(pStats->sum / pStats->count);
+        }
+        else
+        {
+            pStats->min = 0;
+        }
+
+        for(uint32_t bucket = 0; bucket < TRACE_HIST_BUCKETS; bucket++)
+        {
+            pStats->histogram[bucket] = (uint32_t)atomic_load_explicit(&pPoint->histogram[bucket],
+                                                                       memory_order_relaxed);
+        }
+
+        status = TRACE_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to write a snapshot of a trace point as one line of JSON, the lines of all
+ *        the points sent in a row make the benchmark report tracked from release to release
+ *
+ * The line is {"point":"LPUART_INIT","count":n,"min":n,"max":n,"avg":n,"sum":n,"histogram":[n,...]}, all
+ * durations in cycles of TRACE_CYCLE_COUNTER.
+ *
+ * @param id[in]: trace point
+ * @param buffer[out]: text of the line, ended by a line feed and a null character
+ * @param size[in]: size of the buffer, TRACE_JSON_MAX is always enough
+ *
+ * @return uint32_t: length of the line without the null character, 0 if the buffer is too small or the
+ *                   trace point is not valid
+ */
+uint32_t traceFormatJson(Trace_Id_Types id, char *buffer, uint32_t size)
+{
+    Trace_Stats_Types stats;
+    uint32_t length = 0;
+
+    if((0 != buffer) && (0U != size) && (TRACE_E_OK == traceRead(id, &stats)))
+    {
+        /* The last character of the buffer is kept for the null character */
+        size--;
+
+        traceAppend(buffer, size, &length, "{\"point\":\"");
+        traceAppend(buffer, size, &length, traceName[id]);
+        traceAppend(buffer, size, &length, "\",\"count\":");
+        traceAppendNumber(buffer, size, &length, stats.count);
+        traceAppend(buffer, size, &length, ",\"min\":");
+        traceAppendNumber(buffer, size, &length, stats.min);
+        traceAppend(buffer, size, &length, ",\"max\":");
+        traceAppendNumber(buffer, size, &length, stats.max);
+        traceAppend(buffer, size, &length, ",\"avg\":");
+        traceAppendNumber(buffer, size, &length, stats.avg);
+        traceAppend(buffer, size, &length, ",\"sum\":");
+        traceAppendNumber(buffer, size, &length, stats.sum);
+        traceAppend(buffer, size, &length, ",\"histogram\":[");
+
+        for(uint32_t bucket = 0; bucket < TRACE_HIST_BUCKETS; bucket++)
+        {
+            traceAppend(buffer, size, &length, (0U != bucket) ? "," : "");
+            traceAppendNumber(buffer, size, &length, stats.histogram[bucket]);
+        }
+
+        traceAppend(buffer, size, &length, "]}\n");
+
+        if(length > size)
+        {
+            length = 0;
+        }
+
+        buffer[length] = '\0';
+    }
+
+    return length;
+}
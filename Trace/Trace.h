@@ -0,0 +1,123 @@
+/**
+ * @file Trace.h
+ * @author Minh Nguyen Nhat (nhatminhd27th@gmail.com)
+ * @brief This file is used to declare the cycle count profiling of the driver trace points
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#ifndef TRACE_H_
+#define TRACE_H_
+/****************************************************************************************************************
+ *                                                 INCLUSIONS                                                   *
+ ****************************************************************************************************************/
+#include <stdint.h>
+#include "CycleCounter.h"
+
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE        (0)     /* 1 to build the trace points, 0 compiles them to nothing */
+#endif
+
+#define TRACE_HIST_BUCKETS  (16U)   /* Bucket n counts the durations of n significant bits, the last one */
+                                    /* also counts the longer ones                                       */
+
+#define TRACE_JSON_MAX      (128U + (11U * (4U + TRACE_HIST_BUCKETS)) + 20U)  /* Longest line of traceFormatJson, */
+                                                                            /* names up to 32 characters        */
+
+#ifndef TRACE_CYCLE_COUNTER
+#define TRACE_CYCLE_COUNTER() CYCLE_COUNTER()   /* Cycle counter of the trace points, started by traceInit */
+#endif
+
+#if (1 == TRACE_ENABLE)
+#define TRACE_ENTER(id)     uint32_t traceStart_##id = TRACE_CYCLE_COUNTER()   /* Start of a measure */
+#define TRACE_EXIT(id)      traceRecord((id), TRACE_CYCLE_COUNTER() - traceStart_##id)  /* End of a measure */
+#else
+#define TRACE_ENTER(id)
+#define TRACE_EXIT(id)
+#endif
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    TRACE_E_OK,         /* Operation completed without error */
+    TRACE_E_NOT_OK,     /* Operation not completed */
+} Std_Trace_Status;     /* Standard status type */
+
+#define TRACE_POINT(id) id,
+typedef enum
+{
+#include "TracePoints.def"
+    TRACE_ID_COUNT      /* Number of trace points */
+} Trace_Id_Types;       /* Trace point identifiers generated from TracePoints.def */
+#undef TRACE_POINT
+
+typedef struct
+{
+    uint32_t count;                         /* Number of measures                        */
+    uint32_t min;                           /* Shortest measure in cycles, 0 if no measure */
+    uint32_t max;                           /* Longest measure in cycles                 */
+    uint32_t avg;                           /* Average measure in cycles                 */
+    uint64_t sum;                           /* Sum of the measures in cycles             */
+    uint32_t histogram[TRACE_HIST_BUCKETS]; /* Measures by number of significant bits    */
+} Trace_Stats_Types;                        /* Snapshot of a trace point */
+
+/****************************************************************************************************************
+ *                                              API DECLARATIONS                                                *
+ ****************************************************************************************************************/
+/**
+ * @name traceInit
+ *
+ * @brief This function is used to start the cycle counter and clear all the trace points
+ *
+ * @return void
+ */
+void traceInit(void);
+
+/**
+ * @name traceRecord
+ *
+ * @brief This function is used to add a measure to a trace point, it can be called from any context
+ *        including ISR
+ *
+ * @param id[in]: trace point
+ * @param cycles[in]: duration in cycles
+ *
+ * @return void
+ */
+void traceRecord(Trace_Id_Types id, uint32_t cycles);
+
+/**
+ * @name traceRead
+ *
+ * @brief This function is used to take a snapshot of a trace point
+ *
+ * @param id[in]: trace point
+ * @param pStats[out]: snapshot
+ *
+ * @return Std_Trace_Status: TRACE_E_NOT_OK if the trace point or the pointer is not valid
+ */
+Std_Trace_Status traceRead(Trace_Id_Types id, Trace_Stats_Types *pStats);
+
+/**
+ * @name traceFormatJson
+ *
+ * @brief This function is used to write a snapshot of a trace point as one line of JSON, the lines of all
+ *        the points sent in a row make the benchmark report tracked from release to release
+ *
+ * @param id[in]: trace point
+ * @param buffer[out]: text of the line, ended by a line feed and a null character
+ * @param size[in]: size of the buffer, TRACE_JSON_MAX is always enough
+ *
+ * @return uint32_t: length of the line without the null character, 0 if the buffer is too small or the
+ *                   trace point is not valid
+ */
+uint32_t traceFormatJson(Trace_Id_Types id, char *buffer, uint32_t size);
+
+#endif /* TRACE_H_ */
@@ -15,6 +15,9 @@
  *                                                 INCLUSIONS                                                   *
  ****************************************************************************************************************/
 #include "s32k144_lpuart_hal.h"
+#include "RingBuffer.h"
+#include "Pool.h"
+#include "CycleCounter.h"
 
 #define LPUART_FRAME_10BITS (0xA)   /* Frame length is 10 bits */
 #define LPUART_FRAME_9BITS  (0x9)   /* Frame length is 9 bits */
@@ -58,6 +61,30 @@
 #define LPUART_RX_DATA_INVERSION_ENABLE (0x1)   /* Enable Rx data inversion */
 #define LPUART_RX_DATA_INVERSION_DISABLE (0x0)  /* Disable Rx data inversion */
 
+#ifndef LPUART_CYCLE_COUNTER
+#define LPUART_CYCLE_COUNTER() CYCLE_COUNTER()  /* Cycle counter of the waits, CYCLE_COUNTER_ENABLE is called by the application */
+#endif
+
+#ifndef LPUART_CYCLE_COUNTER_FREQ
+#define LPUART_CYCLE_COUNTER_FREQ (clock)   /* Frequency of LPUART_CYCLE_COUNTER in Hz */
+#endif
+
+#ifndef LPUART_TIMEOUT_US
+#define LPUART_TIMEOUT_US (10000U)  /* Default time allowed to each flag wait of the blocking transfers */
+#endif
+
+#ifndef LPUART_WAIT_BUDGET_CYCLES
+#define LPUART_WAIT_BUDGET_CYCLES (480000U) /* Default cycles allowed to each flag wait, bounds it without the LPIT */
+#endif
+
+#ifndef LPUART_TX_BLOCK_QUEUE
+#define LPUART_TX_BLOCK_QUEUE (4U)  /* Blocks of LPUART_SendBlock queued per instance, must be a power of 2 */
+#endif
+
+#ifndef LPUART_AUTOBAUD_POLL_CYCLES
+#define LPUART_AUTOBAUD_POLL_CYCLES (16U)   /* Worst case latency of the edge polling loop, in counter cycles */
+#endif
+
 /****************************************************************************************************************
  *                                              GLOBAL VARIABLES                                                *
  ****************************************************************************************************************/
@@ -70,6 +97,7 @@ typedef enum
 {
     LPUART_E_OK,       /* Operation completed without error */
     LPUART_E_NOT_OK,   /* Operation not completed */
+    LPUART_E_TIMEOUT,  /* A flag wait ran out of time */
 } Std_LPUART_Status;   /* Standard status type */
 
 typedef struct
@@ -98,6 +126,93 @@ typedef struct
 
 typedef void (*LPUART_CallbackPtr) (void);      /*LPUART Callback type for the pointer to callback fuction*/
 
+typedef enum
+{
+    LPUART_AUTOBAUD_SYNC,       /* Measure the 8 bit times of a 0x55 character, as the LIN sync field */
+    LPUART_AUTOBAUD_START_BIT,  /* Measure the start bit of any character whose bit 0 is 1, as CR or 'a' */
+} LPUART_AutoBaudMode_Type;     /* Character measured by the automatic baudrate detection */
+
+typedef struct
+{
+    uint32_t rxBytes;           /* Bytes taken from the Rx ring by LPUART_Receive and LPUART_RxConsume  */
+    uint32_t txBytes;           /* Bytes accepted for the interrupt driven transmission by LPUART_Send, */
+                                /* LPUART_SendUrgent, LPUART_TransmitV and LPUART_SendBlock             */
+    uint32_t rxFrames;          /* Frames read from the data register by the interrupt                  */
+    uint32_t txFrames;          /* Frames written to the data register by the interrupt                 */
+    uint32_t rxDropped;         /* Frames lost because the Rx ring was full                             */
+    uint32_t overRunErrors;     /* Receiver overrun events                                              */
+    uint32_t noiseErrors;       /* Noise flag events                                                    */
+    uint32_t frameErrors;       /* Framing error events                                                 */
+    uint32_t parityErrors;      /* Parity error events                                                  */
+    uint32_t txQueueTimeMax;    /* Longest time in cycles between queuing to an empty Tx ring and the   */
+                                /* ring becoming empty again                                            */
+    uint32_t wakeUps;           /* Wake-ups from low power reception                                    */
+    uint32_t wakeCyclesMax;     /* Longest time in cycles between the wake-up interrupt and the end of  */
+                                /* LPUART_ExitLowPower                                                  */
+    uint32_t waitCyclesMax;     /* Longest flag wait of the blocking transfers, in cycles               */
+    uint32_t waitTimeouts;      /* Flag waits of the blocking transfers that timed out                  */
+    uint32_t urgentLatencyMax;  /* Longest time in cycles between queuing to an empty urgent ring and   */
+                                /* the first byte written                                               */
+    uint32_t rxInterrupts;      /* Interrupts that read received data                                   */
+    uint32_t rxMessages;        /* Messages ended by a terminator or a timeout in the match mode        */
+    uint32_t reconfigures;      /* Settings switched by LPUART_Reconfigure                              */
+    uint32_t reconfigureCyclesMax;  /* Longest time in cycles between LPUART_Reconfigure and the switch */
+    uint32_t txBlocks;          /* Blocks of LPUART_SendBlock sent and given back to their pool         */
+    uint8_t rxPeakFill;         /* Highest fill level reached by the Rx ring                            */
+} LPUART_Statistics_Type;       /* Runtime statistics of an instance */
+
+typedef enum
+{
+    LPUART_WAKE_RX_EDGE,        /* Wake on the start bit of any character */
+    LPUART_WAKE_ADDRESS_MATCH,  /* Wake on a character equal to the address, the others are discarded */
+} LPUART_WakeSource_Type;       /* Event waking the MCU from low power reception */
+
+typedef struct
+{
+    LPUART_WakeSource_Type wakeSource;  /* Event waking the MCU                                             */
+    uint16_t address;                   /* Character to match with LPUART_WAKE_ADDRESS_MATCH                */
+    uint32_t sleepClock;                /* SIRCDIV2 frequency in Hz, SIRC enabled with SCG_SIRC_Config      */
+} LPUART_LowPower_Config_Type;          /* Low power reception settings */
+
+typedef enum
+{
+    LPUART_PREEMPT_FRAME,       /* The urgent ring takes over after any frame */
+    LPUART_PREEMPT_PACKET,      /* The urgent ring takes over after the current LPUART_Send call or */
+                                /* LPUART_TransmitV, each call is queued completely or not at all   */
+} LPUART_TxPreempt_Type;        /* Points where the urgent Tx ring preempts the bulk data */
+
+typedef struct
+{
+    uint16_t terminator1;           /* Character ending a message, matched with MA1                     */
+    uint16_t terminator2;           /* Second character ending a message, matched with MA2              */
+    uint8_t isTerminator2;          /* 1 to use terminator2                                             */
+    LPUART_IdleChars_Type timeout;  /* Silence ending a message without terminator, up to 64 characters */
+    LPUART_CallbackPtr onMessage;   /* Called from the interrupt at the end of a message, can be 0      */
+} LPUART_RxMatch_Config_Type;       /* Reception of messages ended by a terminator */
+
+typedef struct
+{
+    const uint8_t *pData;   /* First byte of the segment */
+    uint32_t len;           /* Number of bytes of the segment, 0 to skip it */
+} LPUART_IoVec_Type;        /* Segment of a scatter-gather transmission */
+
+typedef struct
+{
+    uint32_t baud;          /* BAUD register                                            */
+    uint32_t stat;          /* Settings of STAT, without the flags                      */
+    uint32_t ctrl;          /* CTRL register, with the transmitter and receiver enables */
+    uint32_t match;         /* MATCH register                                           */
+    uint32_t modir;         /* MODIR register                                           */
+    uint32_t fifo;          /* Enables of FIFO, without the flags                       */
+    uint32_t water;         /* Watermarks of WATER, without the counts                  */
+} LPUART_Profile_Type;      /* Register values of a configuration, switched to by LPUART_ProfileApply */
+
+typedef enum
+{
+    LPUART_SWITCH_DRAIN,        /* Wait until the data queued so far is sent and the settings are switched */
+    LPUART_SWITCH_DEFERRED,     /* Return at once, the interrupt switches after the data queued so far */
+} LPUART_Switch_Type;           /* Point where LPUART_Reconfigure switches the settings */
+
 /****************************************************************************************************************
  *                                              API DECLARATIONS                                                *
  ****************************************************************************************************************/
@@ -112,6 +227,83 @@ typedef void (*LPUART_CallbackPtr) (void);      /*LPUART Callback type for the p
  */
 Std_LPUART_Status LPUART_Init(LPUART_Handle_Type *pLPUARTHandle);
 
+/**
+ * @name LPUART_ProfileCompile
+ *
+ * @brief This function is used to compute once the register values LPUART_Init would leave for a
+ *        configuration, starting from the reset state of the instance
+ *
+ * @param pLPUARTHandle[in]: pointer to the LPUART handle
+ * @param pProfile[out]: register values of the configuration
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the configuration is not valid
+ */
+Std_LPUART_Status LPUART_ProfileCompile(LPUART_Handle_Type *pLPUARTHandle, LPUART_Profile_Type *pProfile);
+
+/**
+ * @name LPUART_ProfileCapture
+ *
+ * @brief This function is used to take the register values of an instance as a profile, including the
+ *        settings LPUART_Init does not cover as the idle line, match and FIFO ones
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ * @param pProfile[out]: register values of the instance
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_ProfileCapture(LPUART_Type *pLPUARTx, LPUART_Profile_Type *pProfile);
+
+/**
+ * @name LPUART_ProfileApply
+ *
+ * @brief This function is used to switch an instance to a profile, it must be called between two characters
+ *
+ * The transmitter and the receiver are disabled once and enabled again by the last write, no register is
+ * read back, so the switch costs a few bus writes. The rings and the callback of the instance are kept.
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pProfile[in]: register values given by LPUART_ProfileCompile or LPUART_ProfileCapture
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK while a character is sent or received, or during low power
+ *                            reception
+ */
+Std_LPUART_Status LPUART_ProfileApply(LPUART_Type *pLPUARTx, const LPUART_Profile_Type *pProfile);
+
+/**
+ * @name LPUART_Reconfigure
+ *
+ * @brief This function is used to change the baudrate and frame format while the instance is running,
+ *        the data queued before goes out with the previous settings and the received data is kept
+ *
+ * The switch is made once the Tx rings are empty and the last stop bit is sent. Until then LPUART_Send,
+ * LPUART_SendUrgent, LPUART_TransmitV and LPUART_SendBlock queue nothing, so no data can be sent with the
+ * wrong settings.
+ * The Rx ring and FIFO are kept, only a character being received at the switch is lost. Without rings
+ * only LPUART_SWITCH_DRAIN is possible.
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pProfile[in]: new settings, copied
+ * @param mode[in]: wait for the switch or leave it to the interrupt
+ * @param isRxResync[in]: 1 to hold the receiver after the switch until the line has been idle for one
+ *                        character, so the characters of the peer are not read from their middle
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if a switch is already pending, LPUART_E_TIMEOUT if the data
+ *                            stopped draining for the timeout of the instance, the switch is then cancelled
+ */
+Std_LPUART_Status LPUART_Reconfigure(LPUART_Type *pLPUARTx, const LPUART_Profile_Type *pProfile,
+                                     LPUART_Switch_Type mode, uint8_t isRxResync);
+
+/**
+ * @name LPUART_IsReconfigurePending
+ *
+ * @brief This function is used to check whether a switch of LPUART_Reconfigure is still waiting
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint8_t: 1 until the new settings are applied, 0 otherwise
+ */
+uint8_t LPUART_IsReconfigurePending(LPUART_Type *pLPUARTx);
+
 /**
  * @name LPUART_SetTxState
  *
@@ -148,6 +340,99 @@ Std_LPUART_Status LPUART_SetRxState(LPUART_Type *pLPUARTx, uint8_t enable);
  */
 Std_LPUART_Status LPUART_BaudRateConfig(LPUART_Type *pLPUARTx, uint32_t baudRate);
 
+/**
+ * @name LPUART_AutoBaud
+ *
+ * @brief This function is used to detect the baudrate from the first character received and configure it,
+ *        it must be called while the line is idle and returns once the character has been measured
+ *
+ * The edges are timestamped with LPUART_CYCLE_COUNTER by polling the Rx edge flag with the receiver
+ * disabled, so the measured character is not received. The sync mode averages 8 bit times and checks
+ * the edges are evenly spaced, it is the one to use at high baudrates.
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param mode[in]: character to measure
+ * @param timeoutCycles[in]: maximum time to wait for the character, in cycles of LPUART_CYCLE_COUNTER
+ * @param pBaudRate[out]: baudrate configured
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK on timeout or if the character cannot be measured
+ */
+Std_LPUART_Status LPUART_AutoBaud(LPUART_Type *pLPUARTx, LPUART_AutoBaudMode_Type mode,
+                                  uint32_t timeoutCycles, uint32_t *pBaudRate);
+
+/**
+ * @name LPUART_LinModeConfig
+ *
+ * @brief This function is used to configure the LIN break handling, 13 bit break generation, break
+ *        detection and its interrupt, and enable the interrupt of the instance
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_LinModeConfig(LPUART_Type *pLPUARTx, uint8_t enable);
+
+/**
+ * @name LPUART_IdleLineConfig
+ *
+ * @brief This function is used to configure the idle line interrupt, ending a frame after a silence
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param idleChars[in]: silence setting the IDLE flag, counted from the stop bit of the last character
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_IdleLineConfig(LPUART_Type *pLPUARTx, LPUART_IdleChars_Type idleChars, uint8_t enable);
+
+/**
+ * @name LPUART_GetBaudRate
+ *
+ * @brief This function is used to get the baudrate given by the oversampling ratio and the divisor
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: baudrate in bit/s, 0 if the instance is not valid
+ */
+uint32_t LPUART_GetBaudRate(LPUART_Type *pLPUARTx);
+
+/**
+ * @name LPUART_SendBreak
+ *
+ * @brief This function is used to queue a break character in the transmit stream
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_SendBreak(LPUART_Type *pLPUARTx);
+
+/**
+ * @name LPUART_SetTimeout
+ *
+ * @brief This function is used to set the time allowed to each flag wait of the blocking transfers
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param timeoutUs[in]: timeout in microseconds, measured on the LPIT timebase
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_SetTimeout(LPUART_Type *pLPUARTx, uint32_t timeoutUs);
+
+/**
+ * @name LPUART_SetWaitBudget
+ *
+ * @brief This function is used to set the cycles allowed to each flag wait of the blocking transfers, the
+ *        wait ends at the timeout or at the budget, whichever comes first
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param budgetCycles[in]: budget in cycles of LPUART_CYCLE_COUNTER
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_SetWaitBudget(LPUART_Type *pLPUARTx, uint32_t budgetCycles);
+
 /**
  * @name LPUART_TxFrame7_8
  *
@@ -156,7 +441,7 @@ Std_LPUART_Status LPUART_BaudRateConfig(LPUART_Type *pLPUARTx, uint32_t baudRate
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
  * @param data[in]: data to send
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if a flag wait timed out
  */
 Std_LPUART_Status LPUART_TxFrame7_8(LPUART_Type *pLPUARTx, uint8_t data);
 
@@ -169,7 +454,7 @@ Std_LPUART_Status LPUART_TxFrame7_8(LPUART_Type *pLPUARTx, uint8_t data);
  * @param pTxBuffer[in]: pointer to the data buffer
  * @param len[in]: length of the data buffer
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if a flag wait timed out
  */
 Std_LPUART_Status LPUART_TxMultiFrame7_8(LPUART_Type *pLPUARTx, uint8_t *pTxBuffer, uint32_t len);
 
@@ -181,7 +466,7 @@ Std_LPUART_Status LPUART_TxMultiFrame7_8(LPUART_Type *pLPUARTx, uint8_t *pTxBuff
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
  * @param data[in]: data to send
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if a flag wait timed out
  */
 Std_LPUART_Status LPUART_TxFrame9_10(LPUART_Type *pLPUARTx, uint16_t data);
 
@@ -194,7 +479,7 @@ Std_LPUART_Status LPUART_TxFrame9_10(LPUART_Type *pLPUARTx, uint16_t data);
  * @param pTxBuffer[in]: pointer to the data buffer
  * @param len[in]: length of the data buffer
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if a flag wait timed out
  */
 Std_LPUART_Status LPUART_TxMultiFrame9_10(LPUART_Type *pLPUARTx, uint16_t *pTxBuffer, uint32_t len);
 
@@ -206,7 +491,7 @@ Std_LPUART_Status LPUART_TxMultiFrame9_10(LPUART_Type *pLPUARTx, uint16_t *pTxBu
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
  * @param RxBuffer[in]: pointer to the buffer to store the received data
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if a flag wait timed out
  */
 Std_LPUART_Status LPUART_RxFrame(LPUART_Type *pLPUARTx, uint8_t* RxBuffer);
 
@@ -219,7 +504,7 @@ Std_LPUART_Status LPUART_RxFrame(LPUART_Type *pLPUARTx, uint8_t* RxBuffer);
  * @param pRxBuffer[in]: pointer to the buffer to store the received data
  * @param len[in]: length of the buffer
  *
- * @return uint32_t: number of data received
+ * @return uint32_t: number of data received before the end of the buffer or a timeout
  */
 uint32_t LPUART_RxMultiFrame(LPUART_Type *pLPUARTx, uint16_t *pRxBuffer, uint32_t len);
 
@@ -319,6 +604,246 @@ Std_LPUART_Status LPUART_SetParityErrorInterrupt(LPUART_Type *pLPUARTx, uint8_t
  */
 Std_LPUART_Status LPUART_CallbackRegister(LPUART_Type *pLPUARTx, LPUART_CallbackPtr IRQHandler);
 
+/**
+ * @name LPUART_BufferInit
+ *
+ * @brief This function is used to attach Rx and Tx rings to the LPUART and enable its interrupt driven transfer
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pRxArr[in]: pointer to the array of the Rx ring
+ * @param rxCapacity[in]: capacity of the Rx ring
+ * @param pTxArr[in]: pointer to the array of the Tx ring
+ * @param txCapacity[in]: capacity of the Tx ring
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_BufferInit(LPUART_Type *pLPUARTx, uint8_t *pRxArr, uint8_t rxCapacity, uint8_t *pTxArr, uint8_t txCapacity);
+
+/**
+ * @name LPUART_Send
+ *
+ * @brief This function is used to queue data to the Tx ring without waiting, the Tx interrupt sends it out
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pTxBuffer[in]: pointer to the data buffer
+ * @param len[in]: length of the data buffer
+ *
+ * @return uint32_t: number of data queued, less than len when the Tx ring is full, 0 while a switch of
+ *                   LPUART_Reconfigure is pending
+ */
+uint32_t LPUART_Send(LPUART_Type *pLPUARTx, const uint8_t *pTxBuffer, uint32_t len);
+
+/**
+ * @name LPUART_TxPriorityInit
+ *
+ * @brief This function is used to attach the urgent Tx ring, the Tx interrupt serves it before the bulk
+ *        data of LPUART_Send and LPUART_TransmitV
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance, its rings must be attached and the Tx idle
+ * @param pUrgentArr[in]: pointer to the array of the urgent ring
+ * @param urgentCapacity[in]: capacity of the urgent ring
+ * @param preempt[in]: points where the urgent data preempts the bulk data
+ * @param urgentBurst[in]: urgent frames or packets sent in a row before one of the waiting bulk data, 0
+ *                         to never serve the bulk data while urgent data is queued
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the rings are not attached or data is being sent
+ */
+Std_LPUART_Status LPUART_TxPriorityInit(LPUART_Type *pLPUARTx, uint8_t *pUrgentArr, uint8_t urgentCapacity,
+                                        LPUART_TxPreempt_Type preempt, uint8_t urgentBurst);
+
+/**
+ * @name LPUART_SendUrgent
+ *
+ * @brief This function is used to queue data to the urgent Tx ring without waiting
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pTxBuffer[in]: pointer to the data buffer
+ * @param len[in]: length of the data buffer
+ *
+ * @return uint32_t: number of data queued, less than len when the urgent ring is full, 0 or len with
+ *                   LPUART_PREEMPT_PACKET
+ */
+uint32_t LPUART_SendUrgent(LPUART_Type *pLPUARTx, const uint8_t *pTxBuffer, uint32_t len);
+
+/**
+ * @name LPUART_GetTxFree
+ *
+ * @brief This function is used to get the free space of the Tx ring
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: number of data that can be queued, 0 when the Tx ring is not attached or a switch of
+ *                   LPUART_Reconfigure is pending
+ */
+uint32_t LPUART_GetTxFree(LPUART_Type *pLPUARTx);
+
+/**
+ * @name LPUART_TransmitV
+ *
+ * @brief This function is used to send several segments back to back from the Tx interrupt without copying
+ *        them, the segments and their table must stay unchanged until LPUART_IsTransmitVBusy returns 0
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance, its rings must be attached
+ * @param pIoVec[in]: table of segments
+ * @param count[in]: number of segments
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the Tx ring is not empty, blocks of LPUART_SendBlock or a
+ *                            previous transmission are not finished, or a switch of LPUART_Reconfigure is
+ *                            pending
+ */
+Std_LPUART_Status LPUART_TransmitV(LPUART_Type *pLPUARTx, const LPUART_IoVec_Type *pIoVec, uint32_t count);
+
+/**
+ * @name LPUART_IsTransmitVBusy
+ *
+ * @brief This function is used to check whether the segments of LPUART_TransmitV are still being sent
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint8_t: 1 until the last byte is written to the transmitter, 0 otherwise
+ */
+uint8_t LPUART_IsTransmitVBusy(LPUART_Type *pLPUARTx);
+
+/**
+ * @name LPUART_SendBlock
+ *
+ * @brief This function is used to hand a pool block over to the Tx interrupt, which sends it without
+ *        copying and gives it back to its pool once its last byte is written to the transmitter
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance, its rings must be attached
+ * @param pPool[in/out]: pool of the block
+ * @param pBlock[in]: block given by poolAlloc, owned by the driver if the block is accepted
+ * @param len[in]: number of bytes to send from the start of the block
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the Tx ring is not empty, LPUART_TX_BLOCK_QUEUE blocks are
+ *                            queued or a switch of LPUART_Reconfigure is pending, the caller keeps the
+ *                            block then
+ */
+Std_LPUART_Status LPUART_SendBlock(LPUART_Type *pLPUARTx, Std_Pool_Types *pPool, void *pBlock, uint32_t len);
+
+/**
+ * @name LPUART_RxMatchConfig
+ *
+ * @brief This function is used to receive messages ended by a terminator: the data gathers in the Rx
+ *        FIFO and the interrupt comes when it is full, on a terminator or after a silence
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance, its rings must be attached
+ * @param pConfig[in]: terminators and timeout, 0 to go back to one interrupt per character
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the rings are not attached or the timeout is too long
+ */
+Std_LPUART_Status LPUART_RxMatchConfig(LPUART_Type *pLPUARTx, const LPUART_RxMatch_Config_Type *pConfig);
+
+/**
+ * @name LPUART_Receive
+ *
+ * @brief This function is used to take received data from the Rx ring without waiting
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pRxBuffer[out]: pointer to the buffer to store the received data
+ * @param len[in]: length of the buffer
+ *
+ * @return uint32_t: number of data received
+ */
+uint32_t LPUART_Receive(LPUART_Type *pLPUARTx, uint8_t *pRxBuffer, uint32_t len);
+
+/**
+ * @name LPUART_RxPeek
+ *
+ * @brief This function is used to look at received data in place, without taking it from the Rx ring
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ * @param offset[in]: number of data to skip from the oldest one
+ * @param ppSpan[out]: start of the contiguous span of the ring holding the data at offset
+ *
+ * @return uint32_t: length of the span, 0 when there is no data at offset
+ */
+uint32_t LPUART_RxPeek(LPUART_Type *pLPUARTx, uint32_t offset, const uint8_t **ppSpan);
+
+/**
+ * @name LPUART_RxConsume
+ *
+ * @brief This function is used to release data looked at with LPUART_RxPeek
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param len[in]: number of data to release
+ *
+ * @return uint32_t: number of data released
+ */
+uint32_t LPUART_RxConsume(LPUART_Type *pLPUARTx, uint32_t len);
+
+/**
+ * @name LPUART_GetRxFree
+ *
+ * @brief This function is used to get the free space of the Rx ring
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: number of data that can still be received, 0 when the Rx ring is not attached
+ */
+uint32_t LPUART_GetRxFree(LPUART_Type *pLPUARTx);
+
+/**
+ * @name LPUART_GetRxCount
+ *
+ * @brief This function is used to count the data pushed to the Rx ring, the difference of two counts
+ *        is the data received in between
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: data pushed to the Rx ring since LPUART_BufferInit, dropped data is not counted
+ */
+uint32_t LPUART_GetRxCount(LPUART_Type *pLPUARTx);
+
+/**
+ * @name LPUART_GetStatistics
+ *
+ * @brief This function is used to take a consistent snapshot of the runtime statistics of the LPUART
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ * @param pStatistics[out]: pointer to the snapshot
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_GetStatistics(LPUART_Type *pLPUARTx, LPUART_Statistics_Type *pStatistics);
+
+/**
+ * @name LPUART_ResetStatistics
+ *
+ * @brief This function is used to clear the runtime statistics of the LPUART
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_ResetStatistics(LPUART_Type *pLPUARTx);
+
+/**
+ * @name LPUART_EnterLowPower
+ *
+ * @brief This function is used to move the LPUART clock to SIRC and arm its wake-up, before the
+ *        application enters a stop or very low power mode
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pConfig[in]: low power reception settings
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the line is busy or the baudrate cannot be reached from
+ *         the sleep clock, the instance then stays at full speed
+ */
+Std_LPUART_Status LPUART_EnterLowPower(LPUART_Type *pLPUARTx, const LPUART_LowPower_Config_Type *pConfig);
+
+/**
+ * @name LPUART_ExitLowPower
+ *
+ * @brief This function is used to move the LPUART clock back to its full speed source after a wake-up
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the instance is not in low power or a character is being
+ *         received, call it again once the character is in the Rx ring
+ */
+Std_LPUART_Status LPUART_ExitLowPower(LPUART_Type *pLPUARTx);
+
 /**
  * @name LPUART_DeInit
  *
@@ -16,6 +16,36 @@
  ****************************************************************************************************************/
 #include "S32K144.h"
 
+/****************************************************************************************************************
+ *                                                   MACROS                                                     *
+ ****************************************************************************************************************/
+#define LPUART_STAT_W1C_FLAGS   (LPUART_STAT_LBKDIF_MASK | LPUART_STAT_RXEDGIF_MASK | LPUART_STAT_IDLE_MASK | \
+                                 LPUART_STAT_OR_MASK | LPUART_STAT_NF_MASK | LPUART_STAT_FE_MASK | \
+                                 LPUART_STAT_PF_MASK | LPUART_STAT_MA1F_MASK | LPUART_STAT_MA2F_MASK)  /* Write 1 to clear flags of STAT */
+
+/* Register accesses whose effect goes beyond the memory, the device header of the host simulator gives its
+   models of them instead */
+#ifndef LPUART_STAT_WRITE
+#define LPUART_STAT_WRITE(pLPUARTx, value)  ((pLPUARTx)->STAT = (value))    /* Write 1 to clear flags */
+#endif
+
+#ifndef LPUART_DATA_WRITE
+#define LPUART_DATA_WRITE(pLPUARTx, data)   ((pLPUARTx)->DATA = (data))     /* Load the transmitter */
+#endif
+
+#ifndef LPUART_DATA_READ
+#define LPUART_DATA_READ(pLPUARTx)          ((pLPUARTx)->DATA)              /* Pop the receiver or its FIFO */
+#endif
+
+#ifndef LPUART_BREAK_QUEUE
+#define LPUART_BREAK_QUEUE(pLPUARTx)                                                                            \
+    do                                                                                                          \
+    {                                                                                                           \
+        (pLPUARTx)->CTRL |= LPUART_CTRL_SBK_MASK;                                                               \
+        (pLPUARTx)->CTRL &= ~LPUART_CTRL_SBK_MASK;                                                              \
+    } while(0)                                                              /* Write 1 then 0 to SBK */
+#endif
+
 /****************************************************************************************************************
  *                                              TYPE DEFINITIONS                                                *
  ****************************************************************************************************************/
@@ -34,6 +64,18 @@ typedef enum
     FRAME_10BITS,   /* 10-bit data frame */
 } LPUART_FrameLength_Type;  /* Data frame length */
 
+typedef enum
+{
+    LPUART_IDLE_1_CHAR,     /* 1 idle character */
+    LPUART_IDLE_2_CHARS,    /* 2 idle characters */
+    LPUART_IDLE_4_CHARS,    /* 4 idle characters */
+    LPUART_IDLE_8_CHARS,    /* 8 idle characters */
+    LPUART_IDLE_16_CHARS,   /* 16 idle characters */
+    LPUART_IDLE_32_CHARS,   /* 32 idle characters */
+    LPUART_IDLE_64_CHARS,   /* 64 idle characters */
+    LPUART_IDLE_128_CHARS,  /* 128 idle characters */
+} LPUART_IdleChars_Type;    /* Idle time setting the IDLE flag, counted from the stop bit */
+
 /****************************************************************************************************************
  *                                              API DECLARATIONS                                                *
  ****************************************************************************************************************/
@@ -166,10 +208,151 @@ void HAL_LPUART_ClearRE(LPUART_Type *pLPUARTx);
  */
 void HAL_LPUART_SetBaudrate(LPUART_Type *pLPUARTx, uint8_t OSRVal, uint16_t SBRVal);
 
+/**
+ * @name HAL_LPUART_BothEdgeConfig
+ *
+ * @brief This function is used to configure the sampling on both edges of the baud clock, it is required
+ *        for oversampling ratios from 4 to 7
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPUART_BothEdgeConfig(LPUART_Type *pLPUARTx, uint8_t enable);
+
+/**
+ * @name HAL_LPUART_SendBreak
+ *
+ * @brief This function is used to queue a break character in the transmit stream
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return void
+ */
+void HAL_LPUART_SendBreak(LPUART_Type *pLPUARTx);
+
+/**
+ * @name HAL_LPUART_BreakConfig
+ *
+ * @brief This function is used to configure the 13 bit break generation and the break detection
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPUART_BreakConfig(LPUART_Type *pLPUARTx, uint8_t enable);
+
+/**
+ * @name HAL_LPUART_BreakDetectInterruptConfig
+ *
+ * @brief This function is used to configure the LPUART break detect interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPUART_BreakDetectInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable);
+
+/**
+ * @name HAL_LPUART_RxEdgeInterruptConfig
+ *
+ * @brief This function is used to configure the LPUART Rx input active edge interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPUART_RxEdgeInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable);
+
+/**
+ * @name HAL_LPUART_IdleLineConfig
+ *
+ * @brief This function is used to configure the idle time setting the IDLE flag, counted from the stop
+ *        bit of the last character, the receiver must be disabled
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param idleChars[in]: idle time in characters
+ *
+ * @return void
+ */
+void HAL_LPUART_IdleLineConfig(LPUART_Type *pLPUARTx, LPUART_IdleChars_Type idleChars);
+
+/**
+ * @name HAL_LPUART_IdleInterruptConfig
+ *
+ * @brief This function is used to configure the LPUART idle line interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPUART_IdleInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable);
+
+/**
+ * @name HAL_LPUART_MatchInterruptConfig
+ *
+ * @brief This function is used to configure the match interrupts, the characters matching MA1 or MA2
+ *        are received like the others and set MA1F or MA2F when they are the next data to read
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param match1[in]: character to match with MA1
+ * @param match2[in]: character to match with MA2
+ * @param enable1[in]: state to set for the MA1 interrupt
+ * @param enable2[in]: state to set for the MA2 interrupt
+ *
+ * @return void
+ */
+void HAL_LPUART_MatchInterruptConfig(LPUART_Type *pLPUARTx, uint16_t match1, uint16_t match2, uint8_t enable1,
+                                     uint8_t enable2);
+
+/**
+ * @name HAL_LPUART_RxFifoConfig
+ *
+ * @brief This function is used to configure the Rx FIFO, the receiver must be disabled
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set, the FIFO is flushed
+ * @param rxWater[in]: RDRF is set when the FIFO holds more data than this value, from 0 to 3
+ * @param rxIdle[in]: 0 to disable, n to also set RDRF after 2^(n-1) idle characters with data in the FIFO
+ *
+ * @return void
+ */
+void HAL_LPUART_RxFifoConfig(LPUART_Type *pLPUARTx, uint8_t enable, uint8_t rxWater, uint8_t rxIdle);
+
+/**
+ * @name HAL_LPUART_GetRxCount
+ *
+ * @brief This function is used to get the number of data in the Rx FIFO
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: number of data
+ */
+uint32_t HAL_LPUART_GetRxCount(LPUART_Type *pLPUARTx);
+
+/**
+ * @name HAL_LPUART_MatchAddressConfig
+ *
+ * @brief This function is used to configure the match address 1, received data not matching it are
+ *        discarded while the match is enabled
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param address[in]: address to match
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPUART_MatchAddressConfig(LPUART_Type *pLPUARTx, uint16_t address, uint8_t enable);
+
 /**
  * @name HAL_LPUART_TxFrame7_8
  *
- * @brief This function is used to send a frame of 7 or 8 bits
+ * @brief This function is used to write a frame of 7 or 8 bits, the transmit data register must be empty
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
  * @param data[in]: data to send
@@ -181,7 +364,7 @@ void HAL_LPUART_TxFrame7_8(LPUART_Type *pLPUARTx, uint8_t data);
 /**
  * @name HAL_LPUART_TxFrame9_10
  *
- * @brief This function is used to send a frame of 9 or 10 bits
+ * @brief This function is used to write a frame of 9 or 10 bits, the transmit data register must be empty
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
  * @param data[in]: data to send
@@ -193,7 +376,7 @@ void HAL_LPUART_TxFrame9_10(LPUART_Type *pLPUARTx, uint16_t data);
 /**
  * @name HAL_LPUART_RxFrame
  *
- * @brief This function is used to receive a frame
+ * @brief This function is used to read a received frame, the receive data register must be full
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
  *
@@ -201,6 +384,52 @@ void HAL_LPUART_TxFrame9_10(LPUART_Type *pLPUARTx, uint16_t data);
  */
 uint16_t HAL_LPUART_RxFrame(LPUART_Type *pLPUARTx);
 
+/**
+ * @name HAL_LPUART_GetStatus
+ *
+ * @brief This function is used to read the status register of the LPUART
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: value of the status register
+ */
+uint32_t HAL_LPUART_GetStatus(LPUART_Type *pLPUARTx);
+
+/**
+ * @name HAL_LPUART_ClearStatusFlags
+ *
+ * @brief This function is used to clear write 1 to clear flags of the LPUART without touching the other STAT fields
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param flags[in]: mask of the flags to clear
+ *
+ * @return void
+ */
+void HAL_LPUART_ClearStatusFlags(LPUART_Type *pLPUARTx, uint32_t flags);
+
+/**
+ * @name HAL_LPUART_WriteData
+ *
+ * @brief This function is used to write the data register of the LPUART without waiting
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: data to write
+ *
+ * @return void
+ */
+void HAL_LPUART_WriteData(LPUART_Type *pLPUARTx, uint16_t data);
+
+/**
+ * @name HAL_LPUART_ReadData
+ *
+ * @brief This function is used to read the data register of the LPUART without waiting
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return uint16_t: received data
+ */
+uint16_t HAL_LPUART_ReadData(LPUART_Type *pLPUARTx);
+
 /**
  * @name HAL_LPUART_TxInterruptConfig
  *
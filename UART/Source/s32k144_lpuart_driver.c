@@ -12,22 +12,161 @@
  *                                                 INCLUSIONS                                                   *
  ****************************************************************************************************************/
 #include "s32k144_lpuart_driver.h"
+#include "s32k144_pcc_driver.h"
+#include "s32k144_lpit_driver.h"
+#include "Trace.h"
+#include "Det.h"
 
 /****************************************************************************************************************
  *                                                   MACROS                                                     *
  ****************************************************************************************************************/
 #define MAX_BAUDRATE    (clock / 4) /* Maximum baudrate */
 
-#define INSTANCE_IS_AVAILABLE(Instance) ((Instance == LPUART0) || (Instance == LPUART1) || (Instance == LPUART2))   /* Check if the instance is available */
+#define INSTANCE_IS_VALID(Instance) ((Instance == LPUART0) || (Instance == LPUART1) || (Instance == LPUART2))   /* Check if the instance exists */
+
+#define INSTANCE_IS_AVAILABLE(Instance) DET_CHECK(INSTANCE_IS_VALID(Instance))  /* Checked in development builds only */
+
+#define LPUART_INSTANCE_NUM (3U)    /* Number of LPUART instances */
+
+#define LPUART_OSR_MIN  (4U)        /* Lowest oversampling ratio */
+#define LPUART_OSR_MAX  (32U)       /* Highest oversampling ratio */
+#define LPUART_OSR_BOTHEDGE (8U)    /* Oversampling ratios below this one sample on both edges */
+#define LPUART_SBR_MAX  (0x1FFFU)   /* Highest baudrate modulo divisor */
+
+#define LPUART_AUTOBAUD_SYNC_EDGES  (5U)    /* Falling edges of 0x55: start bit, bit 1, bit 3, bit 5 and bit 7 */
+#define LPUART_AUTOBAUD_SYNC_BITS   (8U)    /* Bit times between the first and the last falling edge of 0x55 */
+#define LPUART_AUTOBAUD_SNAP_PERCENT (4U)   /* Distance to the window of a standard baudrate, in percent, under which it is used instead */
+
+#define LPUART_STAT_ERROR_FLAGS (LPUART_STAT_OR_MASK | LPUART_STAT_NF_MASK | LPUART_STAT_FE_MASK | LPUART_STAT_PF_MASK)   /* Receive error flags */
+
+#define LPUART_RX_FIFO_WATER    (3U)    /* Rx FIFO data above which RDRF is set in the match mode, its depth minus 1 */
+
+#define LPUART_BAUD_RESET_VALUE (0x0F000004U)   /* BAUD after reset: oversampling ratio 16, divisor 4 */
+
+#define LPUART_STAT_CONFIG_MASK (LPUART_STAT_MSBF_MASK | LPUART_STAT_RXINV_MASK | LPUART_STAT_RWUID_MASK | \
+                                 LPUART_STAT_BRK13_MASK | LPUART_STAT_LBKDE_MASK)   /* Settings of STAT */
+
+#define LPUART_FIFO_CONFIG_MASK (LPUART_FIFO_TXFE_MASK | LPUART_FIFO_RXFE_MASK | LPUART_FIFO_TXOFE_MASK | \
+                                 LPUART_FIFO_RXUFE_MASK | LPUART_FIFO_RXIDEN_MASK)  /* Settings of FIFO */
+
+#define LPUART_WATER_CONFIG_MASK (LPUART_WATER_TXWATER_MASK | LPUART_WATER_RXWATER_MASK)   /* Settings of WATER */
+
+#define LPUART_TX_BLOCK_MASK    (LPUART_TX_BLOCK_QUEUE - 1U)    /* Mask to wrap an index in the block queue */
+
+#if ((LPUART_TX_BLOCK_QUEUE & LPUART_TX_BLOCK_MASK) != 0U)
+#error "LPUART_TX_BLOCK_QUEUE must be a power of 2"
+#endif
+
+/****************************************************************************************************************
+ *                                              TYPE DEFINITIONS                                                *
+ ****************************************************************************************************************/
+typedef enum
+{
+    LPUART_TX_IDLE,             /* Nothing to send */
+    LPUART_TX_URGENT,           /* Urgent ring */
+    LPUART_TX_VECTOR,           /* Segments of LPUART_TransmitV */
+    LPUART_TX_BLOCK,            /* Pool blocks of LPUART_SendBlock */
+    LPUART_TX_BULK,             /* Tx ring */
+} LPUART_TxSource_Type;         /* Data written by the Tx interrupt */
+
+typedef struct
+{
+    Std_Pool_Types *pPool;      /* Pool the block goes back to */
+    uint8_t *pData;             /* First byte of the block */
+    uint32_t len;               /* Number of bytes to send */
+} LPUART_TxBlock_Type;          /* Pool block owned by the Tx interrupt until it is sent */
+
+typedef struct
+{
+    Std_Queue_Types rxQueue;    /* Ring filled by the Rx interrupt */
+    Std_Queue_Types txQueue;    /* Ring drained by the Tx interrupt */
+    volatile uint32_t rxCount;  /* Data pushed to the Rx ring since it was attached, wraps around */
+    uint8_t isRxMatch;          /* 1 when the data gathers in the Rx FIFO until a terminator */
+    uint8_t isTerminator2;      /* 1 when terminator2 is used */
+    uint16_t terminator1;       /* Character ending a message */
+    uint16_t terminator2;       /* Second character ending a message */
+    LPUART_CallbackPtr onMessage;   /* Called at the end of a message */
+    uint8_t isBuffered;         /* 1 when the rings are attached */
+    uint32_t txBurstStart;      /* Cycle counter when data was queued to the empty Tx ring */
+    const LPUART_IoVec_Type *pTxVec;    /* Segment being sent by LPUART_TransmitV */
+    volatile uint32_t txVecCount;       /* Segments left including the current one, 0 when idle */
+    uint32_t txVecOffset;               /* Next byte of the current segment */
+    Std_Queue_Types urgentQueue;        /* Ring served before the bulk data */
+    LPUART_TxPreempt_Type txPreempt;    /* Points where the urgent ring preempts the bulk data */
+    LPUART_TxSource_Type txSource;      /* Data being sent */
+    uint32_t txLeft;                    /* Frames left before the source can change */
+    uint8_t urgentBurst;                /* Urgent frames or packets in a row before a waiting bulk one */
+    uint8_t urgentRun;                  /* Urgent frames or packets sent in a row while bulk data waits */
+    uint8_t isUrgentTimed;              /* 1 while the latency of the urgent ring is measured */
+    uint32_t urgentStart;               /* Cycle counter when data was queued to the empty urgent ring */
+    LPUART_Profile_Type switchProfile;  /* Settings of LPUART_Reconfigure */
+    volatile uint8_t isSwitchPending;   /* 1 until switchProfile is applied */
+    uint8_t isRxResync;                 /* 1 to hold the receiver until an idle line after the switch */
+    uint8_t isSwitchTcie;               /* Transmission complete interrupt before the switch was requested */
+    uint32_t switchStart;               /* Cycle counter when the switch was requested */
+    LPUART_TxBlock_Type txBlock[LPUART_TX_BLOCK_QUEUE];     /* Blocks handed over by LPUART_SendBlock */
+    volatile uint8_t txBlockCount;      /* Blocks queued including the one being sent */
+    uint8_t txBlockOut;                 /* Block being sent */
+    uint32_t txBlockOffset;             /* Next byte of the block being sent */
+} LPUART_Buffer_Type;           /* Interrupt driven transfer state of an instance */
+
+typedef struct
+{
+    uint32_t baud;                  /* BAUD register at full speed */
+    uint32_t match;                 /* MATCH register at full speed */
+    uint32_t ctrl;                  /* Transmitter and receiver enables at full speed */
+    PeripheralClockSource source;   /* Functional clock at full speed */
+    uint32_t wakeStamp;             /* Cycle counter at the wake-up interrupt */
+    uint8_t isSleeping;             /* 1 while the instance runs from SIRC */
+    uint8_t isWoken;                /* 1 once the wake-up interrupt was taken */
+} LPUART_LowPower_Type;             /* Low power reception state of an instance */
 
 /****************************************************************************************************************
  *                                              GLOBAL VARIABLES                                                *
  ****************************************************************************************************************/
 LPUART_CallbackPtr LPUART_Callback[3] = {0};    /* Array of callback functions */
 
+static LPUART_Buffer_Type LPUART_Buffer[LPUART_INSTANCE_NUM];   /* Interrupt driven transfer state */
+
+static LPUART_Statistics_Type LPUART_Statistics[LPUART_INSTANCE_NUM];   /* Runtime statistics */
+
+static LPUART_LowPower_Type LPUART_LowPower[LPUART_INSTANCE_NUM];   /* Low power reception state */
+
+static uint32_t LPUART_Timeout[LPUART_INSTANCE_NUM] =
+{
+    LPUART_TIMEOUT_US, LPUART_TIMEOUT_US, LPUART_TIMEOUT_US
+};  /* Time allowed to each flag wait of the blocking transfers, in microseconds */
+
+static uint32_t LPUART_WaitBudget[LPUART_INSTANCE_NUM] =
+{
+    LPUART_WAIT_BUDGET_CYCLES, LPUART_WAIT_BUDGET_CYCLES, LPUART_WAIT_BUDGET_CYCLES
+};  /* Cycles allowed to each flag wait of the blocking transfers */
+
+static LPUART_Type * const LPUART_Instance[LPUART_INSTANCE_NUM] =
+{
+    LPUART0, LPUART1, LPUART2
+};  /* Base address of each instance */
+
+static const IRQn_Type LPUART_IRQn[LPUART_INSTANCE_NUM] =
+{
+    LPUART0_RxTx_IRQn, LPUART1_RxTx_IRQn, LPUART2_RxTx_IRQn
+};  /* Interrupt number of each instance */
+
+static const uint32_t LPUART_PccIndex[LPUART_INSTANCE_NUM] =
+{
+    PCC_LPUART0_INDEX, PCC_LPUART1_INDEX, PCC_LPUART2_INDEX
+};  /* Clock control register of each instance */
+
+static const uint32_t LPUART_StandardBaudRate[] =
+{
+    1200U, 2400U, 4800U, 9600U, 14400U, 19200U, 38400U, 57600U, 115200U, 230400U, 460800U,
+    921600U, 1000000U, 1500000U, 2000000U, 3000000U
+};  /* Baudrates the automatic detection snaps to */
+
 /****************************************************************************************************************
  *                                         STATIC FUNCTIONS DECLARATIONS                                        *
  ****************************************************************************************************************/
+#if (1 == DET_ENABLE)
 /**
  * @name LPUART_CheckHandleValidation
  *
@@ -38,10 +177,219 @@ LPUART_CallbackPtr LPUART_Callback[3] = {0};    /* Array of callback functions *
  * @return Std_LPUART_Status: status of the operation
  */
 static Std_LPUART_Status LPUART_CheckHandleValidation(LPUART_Handle_Type *pLPUARTHandle);
+#endif
+
+/**
+ * @name LPUART_GetIndex
+ *
+ * @brief This function is used to get the index of an instance
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance, must be available
+ *
+ * @return uint8_t: index of the instance
+ */
+static uint8_t LPUART_GetIndex(LPUART_Type *pLPUARTx);
+
+/**
+ * @name LPUART_LockInstance
+ *
+ * @brief This function is used to mask the interrupt of one instance while its rings are updated,
+ *        the other instances keep running
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return uint8_t: 1 if the interrupt was enabled in the NVIC before the lock
+ */
+static uint8_t LPUART_LockInstance(uint8_t index);
+
+/**
+ * @name LPUART_UnlockInstance
+ *
+ * @brief This function is used to unmask the interrupt of one instance, if it was enabled before the lock
+ *
+ * @param index[in]: index of the instance
+ * @param isIrqEnabled[in]: value returned by LPUART_LockInstance
+ *
+ * @return void
+ */
+static void LPUART_UnlockInstance(uint8_t index, uint8_t isIrqEnabled);
+
+/**
+ * @name LPUART_IsTxIdle
+ *
+ * @brief This function is used to check that an instance has nothing queued or being sent by the Tx
+ *        interrupt
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return uint8_t: 1 if the Tx ring, the urgent ring, the segments and the blocks are all done
+ */
+static uint8_t LPUART_IsTxIdle(uint8_t index);
+
+/**
+ * @name LPUART_IRQHandler
+ *
+ * @brief This function is used to serve the Rx and Tx rings and the registered callback of an instance
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return void
+ */
+static void LPUART_IRQHandler(uint8_t index);
+
+/**
+ * @name LPUART_SetBitTime
+ *
+ * @brief This function is used to pick the oversampling ratio and divisor closest to a bit time
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param clocksPerBitX16[in]: bit time in 1/16 cycles of the LPUART clock
+ *
+ * @return uint32_t: baudrate configured, 0 if the bit time is out of range
+ */
+static uint32_t LPUART_SetBitTime(LPUART_Type *pLPUARTx, uint32_t clocksPerBitX16);
+
+/**
+ * @name LPUART_WaitRxEdge
+ *
+ * @brief This function is used to timestamp the next active edge on the Rx pin
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param start[in]: value of LPUART_CYCLE_COUNTER when the wait started
+ * @param timeoutCycles[in]: maximum time to wait from start
+ * @param pStamp[out]: value of LPUART_CYCLE_COUNTER at the edge
+ *
+ * @return uint8_t: 1 if an edge was seen, 0 on timeout
+ */
+static uint8_t LPUART_WaitRxEdge(LPUART_Type *pLPUARTx, uint32_t start, uint32_t timeoutCycles, uint32_t *pStamp);
+
+/**
+ * @name LPUART_SkipEmptySegments
+ *
+ * @brief This function is used to move the scatter-gather transmission to its next segment holding data
+ *
+ * @param pBuffer[in/out]: transfer state of the instance
+ *
+ * @return void
+ */
+static void LPUART_SkipEmptySegments(LPUART_Buffer_Type *pBuffer);
+
+/**
+ * @name LPUART_TxQueuePush
+ *
+ * @brief This function is used to queue data to a Tx ring, with its length first in packet mode
+ *
+ * @param pBuffer[in]: transfer state of the instance
+ * @param pQueue[in/out]: Tx ring
+ * @param pTxBuffer[in]: pointer to the data buffer
+ * @param len[in]: length of the data buffer
+ *
+ * @return uint32_t: number of data queued
+ */
+static uint32_t LPUART_TxQueuePush(const LPUART_Buffer_Type *pBuffer, Std_Queue_Types *pQueue,
+                                   const uint8_t *pTxBuffer, uint32_t len);
+
+/**
+ * @name LPUART_TxSelect
+ *
+ * @brief This function is used to choose the data the Tx interrupt sends until the next boundary
+ *
+ * @param pBuffer[in/out]: transfer state of the instance
+ * @param pStatistics[in/out]: statistics of the instance
+ *
+ * @return void
+ */
+static void LPUART_TxSelect(LPUART_Buffer_Type *pBuffer, LPUART_Statistics_Type *pStatistics);
+
+/**
+ * @name LPUART_WaitFlag
+ *
+ * @brief This function is used to wait for a status flag until the timeout of the instance
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ * @param flag[in]: mask of the flag in the STAT register
+ *
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if the flag is not set in time
+ */
+static Std_LPUART_Status LPUART_WaitFlag(LPUART_Type *pLPUARTx, uint32_t flag);
+
+/**
+ * @name LPUART_RestoreClock
+ *
+ * @brief This function is used to give back to an instance the clock source and the settings it had
+ *        before low power reception
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return void
+ */
+static void LPUART_RestoreClock(uint8_t index);
+
+/**
+ * @name LPUART_BaudRateSearch
+ *
+ * @brief This function is used to pick the oversampling ratio and divisor closest to a baudrate
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance or to a register image
+ * @param baudRate[in]: baudrate to set, from 1 to MAX_BAUDRATE
+ *
+ * @return void
+ */
+static void LPUART_BaudRateSearch(LPUART_Type *pLPUARTx, uint32_t baudRate);
+
+/**
+ * @name LPUART_WriteConfig
+ *
+ * @brief This function is used to write the frame format, baudrate and interrupt settings of a configuration,
+ *        the transmitter and the receiver are not touched
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance or to a register image
+ * @param pConfig[in]: pointer to the configuration, already checked
+ *
+ * @return void
+ */
+static void LPUART_WriteConfig(LPUART_Type *pLPUARTx, const LPUART_Config_Type *pConfig);
+
+/**
+ * @name LPUART_ProfileWrite
+ *
+ * @brief This function is used to write a profile to an instance whose transmitter is idle
+ *
+ * @param index[in]: index of the instance
+ * @param pProfile[in]: register values to write
+ * @param isRxResync[in]: 1 to hold the receiver until an idle line
+ *
+ * @return void
+ */
+static void LPUART_ProfileWrite(uint8_t index, const LPUART_Profile_Type *pProfile, uint8_t isRxResync);
+
+/**
+ * @name LPUART_SwitchDone
+ *
+ * @brief This function is used to close a switch of LPUART_Reconfigure once its profile is written
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return void
+ */
+static void LPUART_SwitchDone(uint8_t index);
+
+/**
+ * @name LPUART_WaitSwitch
+ *
+ * @brief This function is used to wait for a switch of LPUART_Reconfigure, the timeout restarts each time
+ *        a frame is sent
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if the data stopped draining, the switch is then cancelled
+ */
+static Std_LPUART_Status LPUART_WaitSwitch(uint8_t index);
 
 /****************************************************************************************************************
  *                                         STATIC FUNCTIONS DEFINITIONS                                         *
  ****************************************************************************************************************/
+#if (1 == DET_ENABLE)
 /**
  * @brief This function is used to check the validation of the handle
  *
@@ -53,7 +401,7 @@ static Std_LPUART_Status LPUART_CheckHandleValidation(LPUART_Handle_Type *pLPUAR
 {
     Std_LPUART_Status status = LPUART_E_NOT_OK;
 
-    if( INSTANCE_IS_AVAILABLE(pLPUARTHandle->pLPUARTx) &&
+    if( INSTANCE_IS_VALID(pLPUARTHandle->pLPUARTx) &&
         (LPUART_FRAME_7BITS <= pLPUARTHandle->LPUART_Config.frameLenth) &&
         (LPUART_FRAME_10BITS >= pLPUARTHandle->LPUART_Config.frameLenth) &&
         (LPUART_PARITY_DISABLE >= pLPUARTHandle->LPUART_Config.parityMode) &&
@@ -87,83 +435,1039 @@ static Std_LPUART_Status LPUART_CheckHandleValidation(LPUART_Handle_Type *pLPUAR
 
     return status;
 }
+#endif
 
-/****************************************************************************************************************
- *                                              API DEFINITIONS                                                 *
- ****************************************************************************************************************/
 /**
- * @brief This function is used to initialize the LPUART
+ * @brief This function is used to get the index of an instance
  *
- * @param pLPUARTHandle[in/out]: pointer to the LPUART handle
+ * @param pLPUARTx[in]: pointer to the LPUART instance, must be available
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return uint8_t: index of the instance
  */
-Std_LPUART_Status LPUART_Init(LPUART_Handle_Type *pLPUARTHandle)
+static uint8_t LPUART_GetIndex(LPUART_Type *pLPUARTx)
 {
+    uint8_t index = 0;
 
-    Std_LPUART_Status status = LPUART_E_NOT_OK;
+    if(LPUART1 == pLPUARTx)
+    {
+        index = 1;
+    }
+    else if(LPUART2 == pLPUARTx)
+    {
+        index = 2;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return index;
+}
+
+/**
+ * @brief This function is used to mask the interrupt of one instance while its rings are updated,
+ *        the other instances keep running
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return uint8_t: 1 if the interrupt was enabled in the NVIC before the lock
+ */
+static uint8_t LPUART_LockInstance(uint8_t index)
+{
+    uint32_t irqn = (uint32_t)LPUART_IRQn[index];
+    uint8_t isIrqEnabled = (0 != (S32_NVIC->ISER[irqn >> 5U] & (1UL << (irqn & 0x1FU)))) ? 1U : 0U;
+
+    S32_NVIC->ICER[irqn >> 5U] = (1UL << (irqn & 0x1FU));
+#if defined(__arm__)
+    __asm volatile ("dsb\n\tisb" ::: "memory");
+#endif
+
+    return isIrqEnabled;
+}
 
-    if(LPUART_E_OK == LPUART_CheckHandleValidation(pLPUARTHandle))
+/**
+ * @brief This function is used to unmask the interrupt of one instance, if it was enabled before the lock
+ *
+ * A polled instance, or one whose NVIC line was disabled by the application, stays disabled.
+ *
+ * @param index[in]: index of the instance
+ * @param isIrqEnabled[in]: value returned by LPUART_LockInstance
+ *
+ * @return void
+ */
+static void LPUART_UnlockInstance(uint8_t index, uint8_t isIrqEnabled)
+{
+    uint32_t irqn = (uint32_t)LPUART_IRQn[index];
+
+    if(0 != isIrqEnabled)
     {
-        HAL_LPUART_ClearTE(pLPUARTHandle->pLPUARTx);
-        HAL_LPUART_ClearRE(pLPUARTHandle->pLPUARTx);
+        S32_NVIC->ISER[irqn >> 5U] = (1UL << (irqn & 0x1FU));
+    }
+}
 
-        HAL_LPUART_FrameLengthConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.frameLenth);
+/**
+ * @brief This function is used to check that an instance has nothing queued or being sent by the Tx
+ *        interrupt
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return uint8_t: 1 if the Tx ring, the urgent ring, the segments and the blocks are all done
+ */
+static uint8_t LPUART_IsTxIdle(uint8_t index)
+{
+    const LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
 
-        HAL_LPUART_ParityConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.parityMode);
+    return ((LPUART_TX_IDLE == pBuffer->txSource) && (0 == pBuffer->txQueue.size) &&
+            (0 == pBuffer->urgentQueue.size) && (0 == pBuffer->txVecCount) && (0 == pBuffer->txBlockCount)) ? 1U : 0U;
+}
 
-        HAL_LPUART_TxDataInversionConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.txPolarity);
+/**
+ * @brief This function is used to serve the Rx and Tx rings and the registered callback of an instance
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return void
+ */
+static void LPUART_IRQHandler(uint8_t index)
+{
+    LPUART_Type *pLPUARTx = LPUART_Instance[index];
+    LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
 
-        HAL_LPUART_RxDataInversionConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.rxPolarity);
+    if(0 != pBuffer->isBuffered)
+    {
+        LPUART_Statistics_Type *pStatistics = &LPUART_Statistics[index];
+        uint32_t stat = HAL_LPUART_GetStatus(pLPUARTx);
 
-        HAL_LPUART_SetNumOfStopBit(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.nOfStopBits);
+        /* Noise, framing and parity flags come with the frame they belong to, the receiver stops on
+           overrun until the flag is cleared */
+        if(0 != (stat & LPUART_STAT_ERROR_FLAGS))
+        {
+            pStatistics->overRunErrors += (stat >> LPUART_STAT_OR_SHIFT) & 1U;
+            pStatistics->noiseErrors += (stat >> LPUART_STAT_NF_SHIFT) & 1U;
+            pStatistics->frameErrors += (stat >> LPUART_STAT_FE_SHIFT) & 1U;
+            pStatistics->parityErrors += (stat >> LPUART_STAT_PF_SHIFT) & 1U;
+            HAL_LPUART_ClearStatusFlags(pLPUARTx, stat & LPUART_STAT_ERROR_FLAGS);
+        }
 
-        HAL_LPUART_MSBFConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.msbFirst);
+        /* In the match mode RDRF comes with a full FIFO or after the timeout, MA1F and MA2F when a
+           terminator is the next data to read */
+        if((0 != (stat & LPUART_STAT_RDRF_MASK)) ||
+           ((0 != pBuffer->isRxMatch) && (0 != (stat & (LPUART_STAT_MA1F_MASK | LPUART_STAT_MA2F_MASK)))))
+        {
+            uint32_t nOfData = (0 != pBuffer->isRxMatch) ? HAL_LPUART_GetRxCount(pLPUARTx) : 1U;
+            uint8_t isMessageEnd = 0;
 
-        LPUART_BaudRateConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.baudRate);
+            pStatistics->rxInterrupts++;
 
-        HAL_LPUART_TxInterruptConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.txInterrupt);
+            for(uint32_t i = 0; i < nOfData; i++)
+            {
+                uint8_t data = (uint8_t)HAL_LPUART_ReadData(pLPUARTx);
+
+                pStatistics->rxFrames++;
+
+                if(pBuffer->rxQueue.size < pBuffer->rxQueue.capacity)
+                {
+                    queuePush(&pBuffer->rxQueue, data);
+                    pBuffer->rxCount++;
+
+                    if(pBuffer->rxQueue.size > pStatistics->rxPeakFill)
+                    {
+                        pStatistics->rxPeakFill = pBuffer->rxQueue.size;
+                    }
+                }
+                else
+                {
+                    pStatistics->rxDropped++;
+                }
+
+                if((0 != pBuffer->isRxMatch) &&
+                   ((data == pBuffer->terminator1) || ((0 != pBuffer->isTerminator2) && (data == pBuffer->terminator2))))
+                {
+                    pStatistics->rxMessages++;
+                    isMessageEnd = 1;
+                }
+            }
 
-        HAL_LPUART_TxCompleteInterruptConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.txCompleteInterrupt);
+            if(0 != pBuffer->isRxMatch)
+            {
+                HAL_LPUART_ClearStatusFlags(pLPUARTx, stat & (LPUART_STAT_MA1F_MASK | LPUART_STAT_MA2F_MASK));
+
+                /* Less data than a full FIFO without terminator is the timeout */
+                if((0 == isMessageEnd) && (0 != nOfData) && (LPUART_RX_FIFO_WATER >= nOfData))
+                {
+                    pStatistics->rxMessages++;
+                    isMessageEnd = 1;
+                }
+
+                if((0 != isMessageEnd) && (0 != pBuffer->onMessage))
+                {
+                    pBuffer->onMessage();
+                }
+            }
+        }
 
-        HAL_LPUART_RxInterruptConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.rxInterrupt);
+        if((0 != (pLPUARTx->CTRL & LPUART_CTRL_TIE_MASK)) && (0 != (stat & LPUART_STAT_TDRE_MASK)))
+        {
+            /* The data sent only changes at a frame or packet boundary */
+            if(0 == pBuffer->txLeft)
+            {
+                LPUART_TxSelect(pBuffer, pStatistics);
+            }
 
-        HAL_LPUART_OverRunInterruptConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.overRunInterrupt);
+            if(LPUART_TX_URGENT == pBuffer->txSource)
+            {
+                HAL_LPUART_WriteData(pLPUARTx, queuePop(&pBuffer->urgentQueue));
+            }
+            else if(LPUART_TX_VECTOR == pBuffer->txSource)
+            {
+                HAL_LPUART_WriteData(pLPUARTx, pBuffer->pTxVec->pData[pBuffer->txVecOffset]);
+                pBuffer->txVecOffset++;
+
+                /* The next segment is found now so the next interrupt writes at once */
+                if(pBuffer->txVecOffset == pBuffer->pTxVec->len)
+                {
+                    pBuffer->pTxVec++;
+                    pBuffer->txVecCount--;
+                    pBuffer->txVecOffset = 0;
+                    LPUART_SkipEmptySegments(pBuffer);
+
+                    if(0 == pBuffer->txVecCount)
+                    {
+                        pBuffer->txLeft = 1;
+                    }
+                }
+            }
+            else if(LPUART_TX_BLOCK == pBuffer->txSource)
+            {
+                LPUART_TxBlock_Type *pBlock = &pBuffer->txBlock[pBuffer->txBlockOut];
+
+                HAL_LPUART_WriteData(pLPUARTx, pBlock->pData[pBuffer->txBlockOffset]);
+                pBuffer->txBlockOffset++;
+
+                /* The block goes back to its pool as soon as its last byte is in the transmitter */
+                if(pBuffer->txBlockOffset == pBlock->len)
+                {
+                    (void)poolFree(pBlock->pPool, pBlock->pData);
+                    pBuffer->txBlockOut = (uint8_t)((pBuffer->txBlockOut + 1U) & LPUART_TX_BLOCK_MASK);
+                    pBuffer->txBlockCount--;
+                    pBuffer->txBlockOffset = 0;
+                    pStatistics->txBlocks++;
+                }
+            }
+            else if(LPUART_TX_BULK == pBuffer->txSource)
+            {
+                HAL_LPUART_WriteData(pLPUARTx, queuePop(&pBuffer->txQueue));
+            }
+            else
+            {
+                uint32_t queueTime = LPUART_CYCLE_COUNTER() - pBuffer->txBurstStart;
 
-        HAL_LPUART_NoiseErrorInterruptConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.noiseErrorInterrupt);
+                if(queueTime > pStatistics->txQueueTimeMax)
+                {
+                    pStatistics->txQueueTimeMax = queueTime;
+                }
 
-        HAL_LPUART_FrameErrorInterruptConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.frameErrorInterrupt);
+                HAL_LPUART_TxInterruptConfig(pLPUARTx, LPUART_TX_INTERRUPT_DISABLE);
+            }
 
-        HAL_LPUART_ParityErrorInterruptConfig(pLPUARTHandle->pLPUARTx, pLPUARTHandle->LPUART_Config.parityErrorInterrupt);
+            if(LPUART_TX_IDLE != pBuffer->txSource)
+            {
+                pStatistics->txFrames++;
+                pBuffer->txLeft--;
+            }
+        }
 
-        HAL_LPUART_SetTE(pLPUARTHandle->pLPUARTx);
-        HAL_LPUART_SetRE(pLPUARTHandle->pLPUARTx);
+        /* The switch waits for the last stop bit of the data queued before it */
+        if((0 != pBuffer->isSwitchPending) && (0 != LPUART_IsTxIdle(index)) &&
+           (0 != (HAL_LPUART_GetStatus(pLPUARTx) & LPUART_STAT_TC_MASK)))
+        {
+            LPUART_ProfileWrite(index, &pBuffer->switchProfile, pBuffer->isRxResync);
+            LPUART_SwitchDone(index);
+        }
+    }
 
-        status = LPUART_E_OK;
+    if((0 != LPUART_LowPower[index].isSleeping) && (0 == LPUART_LowPower[index].isWoken))
+    {
+        /* Only the first edge wakes, the next ones are the character being received. The address match
+           stops with the wake-up, otherwise the data following the address would be discarded until
+           LPUART_ExitLowPower, which waits for the end of the message */
+        LPUART_LowPower[index].wakeStamp = LPUART_CYCLE_COUNTER();
+        LPUART_LowPower[index].isWoken = 1;
+        HAL_LPUART_RxEdgeInterruptConfig(pLPUARTx, 0);
+        HAL_LPUART_MatchAddressConfig(pLPUARTx, (uint16_t)(pLPUARTx->MATCH & LPUART_MATCH_MA1_MASK), 0);
+        HAL_LPUART_ClearStatusFlags(pLPUARTx, LPUART_STAT_RXEDGIF_MASK | LPUART_STAT_MA1F_MASK);
     }
 
-    return status;
+    if(0 != LPUART_Callback[index])
+    {
+        LPUART_Callback[index]();
+    }
+    else
+    {
+        /* Do nothing */
+    }
 }
 
 /**
- * @brief This function is used to start and stop Transmitter of LPUART
+ * @brief This function is used to pick the oversampling ratio and divisor closest to a bit time
+ *
+ * The bit time is (OSR + 1) * SBR clocks, every ratio is tried with the rounded divisor and the first
+ * exact or closest product wins, highest ratios first for the best noise immunity. The bit time keeps
+ * 4 fractional bits so a measured bit time is not rounded twice.
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param enable[in]: state to set
+ * @param clocksPerBitX16[in]: bit time in 1/16 cycles of the LPUART clock
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return uint32_t: baudrate configured, 0 if the bit time is out of range
  */
-Std_LPUART_Status LPUART_SetTxState(LPUART_Type *pLPUARTx, uint8_t enable)
+static uint32_t LPUART_SetBitTime(LPUART_Type *pLPUARTx, uint32_t clocksPerBitX16)
 {
-    Std_LPUART_Status status = LPUART_E_NOT_OK;
+    uint32_t baudRate = 0;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    if(((LPUART_OSR_MIN * 16U) <= clocksPerBitX16) && ((LPUART_OSR_MAX * LPUART_SBR_MAX * 16U) >= clocksPerBitX16))
     {
-        HAL_LPUART_TxInterruptConfig(pLPUARTx, enable);
-        status = LPUART_E_OK;
+        uint32_t minError = 0xFFFFFFFFU;
+        uint32_t osrVal = LPUART_OSR_MAX;
+        uint32_t sbrVal = 1;
+
+        for(uint32_t osr = LPUART_OSR_MAX; (osr >= LPUART_OSR_MIN) && (0 != minError); osr--)
+        {
+            uint32_t sbr = (clocksPerBitX16 + (osr * 8U)) / (osr * 16U);
+            uint32_t bitTimeX16;
+            uint32_t error;
+
+            if(0 == sbr)
+            {
+                sbr = 1;
+            }
+            else if(LPUART_SBR_MAX < sbr)
+            {
+                sbr = LPUART_SBR_MAX;
+            }
+            else
+            {
+                /* Do nothing */
+            }
+
+            bitTimeX16 = osr * sbr * 16U;
+            error = (bitTimeX16 > clocksPerBitX16) ? (bitTimeX16 - clocksPerBitX16) : (clocksPerBitX16 - bitTimeX16);
+
+            if(error < minError)
+            {
+                minError = error;
+                osrVal = osr;
+                sbrVal = sbr;
+            }
+        }
+
+        HAL_LPUART_BothEdgeConfig(pLPUARTx, (LPUART_OSR_BOTHEDGE > osrVal) ? 1U : 0U);
+        HAL_LPUART_SetBaudrate(pLPUARTx, (uint8_t)(osrVal - 1U), (uint16_t)sbrVal);
+        baudRate = clock / (osrVal * sbrVal);
     }
 
-    return status;
+    return baudRate;
+}
+
+/**
+ * @brief This function is used to timestamp the next active edge on the Rx pin
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param start[in]: value of LPUART_CYCLE_COUNTER when the wait started
+ * @param timeoutCycles[in]: maximum time to wait from start
+ * @param pStamp[out]: value of LPUART_CYCLE_COUNTER at the edge
+ *
+ * @return uint8_t: 1 if an edge was seen, 0 on timeout
+ */
+static uint8_t LPUART_WaitRxEdge(LPUART_Type *pLPUARTx, uint32_t start, uint32_t timeoutCycles, uint32_t *pStamp)
+{
+    uint8_t isEdge = 0;
+    uint8_t isTimeout = 0;
+
+    while((0 == isEdge) && (0 == isTimeout))
+    {
+        if(0 != (pLPUARTx->STAT & LPUART_STAT_RXEDGIF_MASK))
+        {
+            /* Stamp first, the flag is cleared afterwards so the loop latency is the same for every edge */
+            *pStamp = LPUART_CYCLE_COUNTER();
+            HAL_LPUART_ClearStatusFlags(pLPUARTx, LPUART_STAT_RXEDGIF_MASK);
+            isEdge = 1;
+        }
+        else if((LPUART_CYCLE_COUNTER() - start) >= timeoutCycles)
+        {
+            isTimeout = 1;
+        }
+        else
+        {
+            /* Keep polling */
+        }
+    }
+
+    return isEdge;
+}
+
+/**
+ * @brief This function is used to move the scatter-gather transmission to its next segment holding data
+ *
+ * @param pBuffer[in/out]: transfer state of the instance
+ *
+ * @return void
+ */
+static void LPUART_SkipEmptySegments(LPUART_Buffer_Type *pBuffer)
+{
+    while((0 != pBuffer->txVecCount) && (0 == pBuffer->pTxVec->len))
+    {
+        pBuffer->pTxVec++;
+        pBuffer->txVecCount--;
+    }
+}
+
+/**
+ * @brief This function is used to queue data to a Tx ring, with its length first in packet mode
+ *
+ * In packet mode the data is queued completely or not at all, the length byte tells the Tx interrupt
+ * where the packet ends. A ring of up to 255 bytes holds packets of up to 254 bytes.
+ *
+ * @param pBuffer[in]: transfer state of the instance
+ * @param pQueue[in/out]: Tx ring
+ * @param pTxBuffer[in]: pointer to the data buffer
+ * @param len[in]: length of the data buffer
+ *
+ * @return uint32_t: number of data queued
+ */
+static uint32_t LPUART_TxQueuePush(const LPUART_Buffer_Type *pBuffer, Std_Queue_Types *pQueue,
+                                   const uint8_t *pTxBuffer, uint32_t len)
+{
+    uint32_t nOfFree = (uint32_t)pQueue->capacity - pQueue->size;
+    uint32_t nOfData = 0;
+
+    if(LPUART_PREEMPT_PACKET == pBuffer->txPreempt)
+    {
+        if((0 != len) && (len < nOfFree))
+        {
+            queuePush(pQueue, (uint8_t)len);
+        }
+        else
+        {
+            nOfFree = 0;
+        }
+    }
+
+    while((nOfData < len) && (nOfData < nOfFree))
+    {
+        queuePush(pQueue, pTxBuffer[nOfData]);
+        nOfData++;
+    }
+
+    return nOfData;
+}
+
+/**
+ * @brief This function is used to choose the data the Tx interrupt sends until the next boundary
+ *
+ * The urgent ring goes first, unless it already sent urgentBurst frames or packets in a row while bulk
+ * data was waiting: one bulk frame or packet is then sent, so the bulk data is never starved. The bulk
+ * data is the segments of LPUART_TransmitV, taken as one packet, then the blocks of LPUART_SendBlock,
+ * then the Tx ring.
+ *
+ * @param pBuffer[in/out]: transfer state of the instance
+ * @param pStatistics[in/out]: statistics of the instance
+ *
+ * @return void
+ */
+static void LPUART_TxSelect(LPUART_Buffer_Type *pBuffer, LPUART_Statistics_Type *pStatistics)
+{
+    uint8_t isPacket = (LPUART_PREEMPT_PACKET == pBuffer->txPreempt) ? 1U : 0U;
+    uint8_t isBulk = ((0 != pBuffer->txVecCount) || (0 != pBuffer->txBlockCount) || (0 != pBuffer->txQueue.size)) ? 1U : 0U;
+
+    if((0 != pBuffer->urgentQueue.size) &&
+       ((0 == isBulk) || (0 == pBuffer->urgentBurst) || (pBuffer->urgentRun < pBuffer->urgentBurst)))
+    {
+        pBuffer->txSource = LPUART_TX_URGENT;
+        pBuffer->txLeft = (0 != isPacket) ? queuePop(&pBuffer->urgentQueue) : 1U;
+
+        if(0 != isBulk)
+        {
+            pBuffer->urgentRun++;
+        }
+
+        if(0 != pBuffer->isUrgentTimed)
+        {
+            uint32_t latency = LPUART_CYCLE_COUNTER() - pBuffer->urgentStart;
+
+            if(latency > pStatistics->urgentLatencyMax)
+            {
+                pStatistics->urgentLatencyMax = latency;
+            }
+
+            pBuffer->isUrgentTimed = 0;
+        }
+    }
+    else if(0 != isBulk)
+    {
+        pBuffer->urgentRun = 0;
+
+        if(0 != pBuffer->txVecCount)
+        {
+            /* The end of the last segment closes the packet */
+            pBuffer->txSource = LPUART_TX_VECTOR;
+            pBuffer->txLeft = (0 != isPacket) ? 0xFFFFFFFFU : 1U;
+        }
+        else if(0 != pBuffer->txBlockCount)
+        {
+            /* Each block is a packet */
+            pBuffer->txSource = LPUART_TX_BLOCK;
+            pBuffer->txLeft = (0 != isPacket) ? pBuffer->txBlock[pBuffer->txBlockOut].len : 1U;
+        }
+        else
+        {
+            pBuffer->txSource = LPUART_TX_BULK;
+            pBuffer->txLeft = (0 != isPacket) ? queuePop(&pBuffer->txQueue) : 1U;
+        }
+    }
+    else
+    {
+        pBuffer->txSource = LPUART_TX_IDLE;
+        pBuffer->txLeft = 0;
+    }
+}
+
+/**
+ * @brief This function is used to wait for a status flag until the timeout of the instance
+ *
+ * The deadline is taken on the LPIT timebase and the cycle budget on LPUART_CYCLE_COUNTER, the budget
+ * still bounds the wait while the timebase is stopped. The time taken is recorded in the statistics.
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ * @param flag[in]: mask of the flag in the STAT register
+ *
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if the flag is not set in time
+ */
+static Std_LPUART_Status LPUART_WaitFlag(LPUART_Type *pLPUARTx, uint32_t flag)
+{
+    uint8_t index = LPUART_GetIndex(pLPUARTx);
+    uint64_t deadline = LPIT_Deadline(LPUART_Timeout[index]);
+    uint32_t start = LPUART_CYCLE_COUNTER();
+    uint32_t elapsed = 0;
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    while(LPUART_E_NOT_OK == status)
+    {
+        if(0 != (HAL_LPUART_GetStatus(pLPUARTx) & flag))
+        {
+            status = LPUART_E_OK;
+        }
+        else if((0 != LPIT_IsExpired(deadline)) || (elapsed > LPUART_WaitBudget[index]))
+        {
+            status = LPUART_E_TIMEOUT;
+        }
+        else
+        {
+            elapsed = LPUART_CYCLE_COUNTER() - start;
+        }
+    }
+
+    elapsed = LPUART_CYCLE_COUNTER() - start;
+
+    if(elapsed > LPUART_Statistics[index].waitCyclesMax)
+    {
+        LPUART_Statistics[index].waitCyclesMax = elapsed;
+    }
+
+    if(LPUART_E_TIMEOUT == status)
+    {
+        LPUART_Statistics[index].waitTimeouts++;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to give back to an instance the clock source and the settings it had
+ *        before low power reception
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return void
+ */
+static void LPUART_RestoreClock(uint8_t index)
+{
+    LPUART_Type *pLPUARTx = LPUART_Instance[index];
+    LPUART_LowPower_Type *pLowPower = &LPUART_LowPower[index];
+
+    /* BAUD and MATCH are written with the receiver off, the clock source with the clock gated */
+    HAL_LPUART_ClearRE(pLPUARTx);
+    PCC_De_Init(LPUART_PccIndex[index]);
+    PCC_Clock_Source_Select(LPUART_PccIndex[index], pLowPower->source);
+    PCC_Init(LPUART_PccIndex[index]);
+
+    pLPUARTx->BAUD = pLowPower->baud;
+    pLPUARTx->MATCH = pLowPower->match;
+    HAL_LPUART_ClearStatusFlags(pLPUARTx, LPUART_STAT_RXEDGIF_MASK | LPUART_STAT_MA1F_MASK);
+
+    if(0 != (pLowPower->ctrl & LPUART_CTRL_TE_MASK))
+    {
+        HAL_LPUART_SetTE(pLPUARTx);
+    }
+
+    if(0 != (pLowPower->ctrl & LPUART_CTRL_RE_MASK))
+    {
+        HAL_LPUART_SetRE(pLPUARTx);
+    }
+
+    pLowPower->isSleeping = 0;
+}
+
+/**
+ * @brief This function is used to pick the oversampling ratio and divisor closest to a baudrate
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance or to a register image
+ * @param baudRate[in]: baudrate to set, from 1 to MAX_BAUDRATE
+ *
+ * @return void
+ */
+static void LPUART_BaudRateSearch(LPUART_Type *pLPUARTx, uint32_t baudRate)
+{
+    float minError = 100;
+    volatile uint8_t osrVal = 0;
+    volatile uint16_t sbrVal = 0;
+
+    for(uint8_t i = 31; (i >= 3) && (minError != 0); i--)
+    {
+        uint16_t tmpSBRval = (uint32_t)clock / ((i + 1) * baudRate);
+        uint32_t tmpBaudRate = clock / ((i + 1) * tmpSBRval);
+        float error = ((float)(tmpBaudRate - baudRate) / baudRate) * 100;
+
+        if(error < minError)
+        {
+            minError = error;
+            osrVal = i;
+            sbrVal = tmpSBRval;
+        }
+    }
+
+    HAL_LPUART_SetBaudrate(pLPUARTx, osrVal, sbrVal);
+}
+
+/**
+ * @brief This function is used to write the frame format, baudrate and interrupt settings of a configuration,
+ *        the transmitter and the receiver are not touched
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance or to a register image
+ * @param pConfig[in]: pointer to the configuration, already checked
+ *
+ * @return void
+ */
+static void LPUART_WriteConfig(LPUART_Type *pLPUARTx, const LPUART_Config_Type *pConfig)
+{
+    HAL_LPUART_FrameLengthConfig(pLPUARTx, pConfig->frameLenth);
+
+    HAL_LPUART_ParityConfig(pLPUARTx, pConfig->parityMode);
+
+    HAL_LPUART_TxDataInversionConfig(pLPUARTx, pConfig->txPolarity);
+
+    HAL_LPUART_RxDataInversionConfig(pLPUARTx, pConfig->rxPolarity);
+
+    HAL_LPUART_SetNumOfStopBit(pLPUARTx, pConfig->nOfStopBits);
+
+    HAL_LPUART_MSBFConfig(pLPUARTx, pConfig->msbFirst);
+
+    LPUART_BaudRateSearch(pLPUARTx, pConfig->baudRate);
+
+    HAL_LPUART_TxInterruptConfig(pLPUARTx, pConfig->txInterrupt);
+
+    HAL_LPUART_TxCompleteInterruptConfig(pLPUARTx, pConfig->txCompleteInterrupt);
+
+    HAL_LPUART_RxInterruptConfig(pLPUARTx, pConfig->rxInterrupt);
+
+    HAL_LPUART_OverRunInterruptConfig(pLPUARTx, pConfig->overRunInterrupt);
+
+    HAL_LPUART_NoiseErrorInterruptConfig(pLPUARTx, pConfig->noiseErrorInterrupt);
+
+    HAL_LPUART_FrameErrorInterruptConfig(pLPUARTx, pConfig->frameErrorInterrupt);
+
+    HAL_LPUART_ParityErrorInterruptConfig(pLPUARTx, pConfig->parityErrorInterrupt);
+}
+
+/**
+ * @brief This function is used to write a profile to an instance whose transmitter is idle
+ *
+ * The transmitter and the receiver are disabled once, the registers are written directly without reading
+ * them back and CTRL is written last, which enables them again as in the profile. The flags of STAT and
+ * FIFO are not cleared, the FIFOs are flushed only when they are enabled or disabled.
+ *
+ * @param index[in]: index of the instance
+ * @param pProfile[in]: register values to write
+ * @param isRxResync[in]: 1 to hold the receiver until an idle line
+ *
+ * @return void
+ */
+static void LPUART_ProfileWrite(uint8_t index, const LPUART_Profile_Type *pProfile, uint8_t isRxResync)
+{
+    LPUART_Type *pLPUARTx = LPUART_Instance[index];
+    uint32_t fifo = pProfile->fifo;
+    uint32_t ctrl = pProfile->ctrl;
+
+    if(0 != ((pLPUARTx->FIFO ^ fifo) & (LPUART_FIFO_TXFE_MASK | LPUART_FIFO_RXFE_MASK)))
+    {
+        fifo |= LPUART_FIFO_TXFLUSH_MASK | LPUART_FIFO_RXFLUSH_MASK;
+    }
+
+    /* With the idle line wake-up the hardware clears RWU after one idle character */
+    if((0 != isRxResync) && (0 != (ctrl & LPUART_CTRL_RE_MASK)) && (0 == (ctrl & LPUART_CTRL_WAKE_MASK)))
+    {
+        ctrl |= LPUART_CTRL_RWU_MASK;
+    }
+
+    pLPUARTx->CTRL = ctrl & ~(LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
+
+    pLPUARTx->BAUD = pProfile->baud;
+    pLPUARTx->STAT = pProfile->stat;
+    pLPUARTx->MODIR = pProfile->modir;
+    pLPUARTx->MATCH = pProfile->match;
+    pLPUARTx->WATER = pProfile->water;
+    pLPUARTx->FIFO = fifo;
+
+    pLPUARTx->CTRL = ctrl;
+
+    /* The match mode of the Rx interrupt drains the FIFO, it cannot run without it */
+    if(0 == (pProfile->fifo & LPUART_FIFO_RXFE_MASK))
+    {
+        LPUART_Buffer[index].isRxMatch = 0;
+    }
+}
+
+/**
+ * @brief This function is used to close a switch of LPUART_Reconfigure once its profile is written
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return void
+ */
+static void LPUART_SwitchDone(uint8_t index)
+{
+    LPUART_Statistics_Type *pStatistics = &LPUART_Statistics[index];
+    uint32_t switchTime = LPUART_CYCLE_COUNTER() - LPUART_Buffer[index].switchStart;
+
+    if(switchTime > pStatistics->reconfigureCyclesMax)
+    {
+        pStatistics->reconfigureCyclesMax = switchTime;
+    }
+
+    pStatistics->reconfigures++;
+    LPUART_Buffer[index].isSwitchPending = 0;
+}
+
+/**
+ * @brief This function is used to wait for a switch of LPUART_Reconfigure, the timeout restarts each time
+ *        a frame is sent
+ *
+ * Without rings there is no interrupt to make the switch, it is made here.
+ *
+ * @param index[in]: index of the instance
+ *
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if the data stopped draining, the switch is then cancelled
+ */
+static Std_LPUART_Status LPUART_WaitSwitch(uint8_t index)
+{
+    LPUART_Type *pLPUARTx = LPUART_Instance[index];
+    LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
+    uint64_t deadline = LPIT_Deadline(LPUART_Timeout[index]);
+    uint32_t start = LPUART_CYCLE_COUNTER();
+    uint32_t nOfFrames = LPUART_Statistics[index].txFrames;
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    while(LPUART_E_NOT_OK == status)
+    {
+        if(0 == pBuffer->isBuffered)
+        {
+            uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+            if(0 != (HAL_LPUART_GetStatus(pLPUARTx) & LPUART_STAT_TC_MASK))
+            {
+                LPUART_ProfileWrite(index, &pBuffer->switchProfile, pBuffer->isRxResync);
+                LPUART_SwitchDone(index);
+            }
+
+            LPUART_UnlockInstance(index, isIrqEnabled);
+        }
+
+        if(0 == pBuffer->isSwitchPending)
+        {
+            status = LPUART_E_OK;
+        }
+        else if(nOfFrames != LPUART_Statistics[index].txFrames)
+        {
+            nOfFrames = LPUART_Statistics[index].txFrames;
+            deadline = LPIT_Deadline(LPUART_Timeout[index]);
+            start = LPUART_CYCLE_COUNTER();
+        }
+        else if((0 != LPIT_IsExpired(deadline)) || ((LPUART_CYCLE_COUNTER() - start) > LPUART_WaitBudget[index]))
+        {
+            uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+            /* The interrupt may have switched in between */
+            if(0 != pBuffer->isSwitchPending)
+            {
+                pBuffer->isSwitchPending = 0;
+                HAL_LPUART_TxCompleteInterruptConfig(pLPUARTx, pBuffer->isSwitchTcie);
+                LPUART_Statistics[index].waitTimeouts++;
+                status = LPUART_E_TIMEOUT;
+            }
+
+            LPUART_UnlockInstance(index, isIrqEnabled);
+        }
+        else
+        {
+            /* Keep waiting */
+        }
+    }
+
+    return status;
+}
+
+/****************************************************************************************************************
+ *                                              API DEFINITIONS                                                 *
+ ****************************************************************************************************************/
+/**
+ * @brief This function is used to initialize the LPUART
+ *
+ * @param pLPUARTHandle[in/out]: pointer to the LPUART handle
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_Init(LPUART_Handle_Type *pLPUARTHandle)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    TRACE_ENTER(TRACE_ID_LPUART_INIT);
+
+    if(DET_CHECK(LPUART_E_OK == LPUART_CheckHandleValidation(pLPUARTHandle)))
+    {
+        HAL_LPUART_ClearTE(pLPUARTHandle->pLPUARTx);
+        HAL_LPUART_ClearRE(pLPUARTHandle->pLPUARTx);
+
+        LPUART_WriteConfig(pLPUARTHandle->pLPUARTx, &pLPUARTHandle->LPUART_Config);
+
+        HAL_LPUART_SetTE(pLPUARTHandle->pLPUARTx);
+        HAL_LPUART_SetRE(pLPUARTHandle->pLPUARTx);
+
+        status = LPUART_E_OK;
+    }
+
+    TRACE_EXIT(TRACE_ID_LPUART_INIT);
+
+    return status;
+}
+
+/**
+ * @brief This function is used to compute once the register values LPUART_Init would leave for a
+ *        configuration, starting from the reset state of the instance
+ *
+ * The settings are written by the same code as LPUART_Init into a register image in RAM, so the baudrate
+ * search runs here and not when the profile is applied.
+ *
+ * @param pLPUARTHandle[in]: pointer to the LPUART handle
+ * @param pProfile[out]: register values of the configuration
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the configuration is not valid
+ */
+Std_LPUART_Status LPUART_ProfileCompile(LPUART_Handle_Type *pLPUARTHandle, LPUART_Profile_Type *pProfile)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(DET_CHECK(LPUART_E_OK == LPUART_CheckHandleValidation(pLPUARTHandle)) && (0 != pProfile))
+    {
+        LPUART_Type image = {0};
+
+        image.BAUD = LPUART_BAUD_RESET_VALUE;
+
+        LPUART_WriteConfig(&image, &pLPUARTHandle->LPUART_Config);
+
+        HAL_LPUART_SetTE(&image);
+        HAL_LPUART_SetRE(&image);
+
+        pProfile->baud = image.BAUD;
+        pProfile->stat = image.STAT & LPUART_STAT_CONFIG_MASK;
+        pProfile->ctrl = image.CTRL;
+        pProfile->match = image.MATCH;
+        pProfile->modir = image.MODIR;
+        pProfile->fifo = image.FIFO & LPUART_FIFO_CONFIG_MASK;
+        pProfile->water = image.WATER & LPUART_WATER_CONFIG_MASK;
+
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to take the register values of an instance as a profile, including the
+ *        settings LPUART_Init does not cover as the idle line, match and FIFO ones
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ * @param pProfile[out]: register values of the instance
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_ProfileCapture(LPUART_Type *pLPUARTx, LPUART_Profile_Type *pProfile)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pProfile))
+    {
+        pProfile->baud = pLPUARTx->BAUD;
+        pProfile->stat = pLPUARTx->STAT & LPUART_STAT_CONFIG_MASK;
+        pProfile->ctrl = pLPUARTx->CTRL;
+        pProfile->match = pLPUARTx->MATCH;
+        pProfile->modir = pLPUARTx->MODIR;
+        pProfile->fifo = pLPUARTx->FIFO & LPUART_FIFO_CONFIG_MASK;
+        pProfile->water = pLPUARTx->WATER & LPUART_WATER_CONFIG_MASK;
+
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to switch an instance to a profile, it must be called between two characters
+ *
+ * The transmitter and the receiver are disabled once and enabled again by the last write, no register is
+ * read back, so the switch costs a few bus writes. The rings and the callback of the instance are kept.
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pProfile[in]: register values given by LPUART_ProfileCompile or LPUART_ProfileCapture
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK while a character is sent or received, or during low power
+ *                            reception
+ */
+Std_LPUART_Status LPUART_ProfileApply(LPUART_Type *pLPUARTx, const LPUART_Profile_Type *pProfile)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    TRACE_ENTER(TRACE_ID_LPUART_PROFILE_APPLY);
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pProfile))
+    {
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        uint32_t stat;
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        stat = pLPUARTx->STAT;
+
+        if((0 == LPUART_LowPower[index].isSleeping) && (0 != (stat & LPUART_STAT_TC_MASK)) &&
+           (0 == (stat & LPUART_STAT_RAF_MASK)))
+        {
+            LPUART_ProfileWrite(index, pProfile, 0);
+            status = LPUART_E_OK;
+        }
+
+        LPUART_UnlockInstance(index, isIrqEnabled);
+    }
+
+    TRACE_EXIT(TRACE_ID_LPUART_PROFILE_APPLY);
+
+    return status;
+}
+
+/**
+ * @brief This function is used to change the baudrate and frame format while the instance is running,
+ *        the data queued before goes out with the previous settings and the received data is kept
+ *
+ * The switch is made once the Tx rings are empty and the last stop bit is sent. Until then LPUART_Send,
+ * LPUART_SendUrgent, LPUART_TransmitV and LPUART_SendBlock queue nothing, so no data can be sent with the
+ * wrong settings.
+ * The Rx ring and FIFO are kept, only a character being received at the switch is lost. Without rings
+ * only LPUART_SWITCH_DRAIN is possible.
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pProfile[in]: new settings, copied
+ * @param mode[in]: wait for the switch or leave it to the interrupt
+ * @param isRxResync[in]: 1 to hold the receiver after the switch until the line has been idle for one
+ *                        character, so the characters of the peer are not read from their middle
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if a switch is already pending, LPUART_E_TIMEOUT if the data
+ *                            stopped draining for the timeout of the instance, the switch is then cancelled
+ */
+Std_LPUART_Status LPUART_Reconfigure(LPUART_Type *pLPUARTx, const LPUART_Profile_Type *pProfile,
+                                     LPUART_Switch_Type mode, uint8_t isRxResync)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pProfile) && (LPUART_SWITCH_DEFERRED >= mode) &&
+       ((0 == isRxResync) || (1 == isRxResync)))
+    {
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        if((0 == pBuffer->isSwitchPending) && (0 == LPUART_LowPower[index].isSleeping) &&
+           ((0 != pBuffer->isBuffered) || (LPUART_SWITCH_DRAIN == mode)))
+        {
+            pBuffer->switchProfile = *pProfile;
+            pBuffer->isRxResync = isRxResync;
+            pBuffer->isSwitchTcie = (0 != (pLPUARTx->CTRL & LPUART_CTRL_TCIE_MASK)) ? 1U : 0U;
+            pBuffer->switchStart = LPUART_CYCLE_COUNTER();
+            pBuffer->isSwitchPending = 1;
+
+            /* The interrupt comes back on the last stop bit, or at once if the transmitter is idle */
+            if(0 != pBuffer->isBuffered)
+            {
+                HAL_LPUART_TxCompleteInterruptConfig(pLPUARTx, LPUART_TX_COMPLETE_INTERRUPT_ENABLE);
+            }
+
+            status = LPUART_E_OK;
+        }
+
+        LPUART_UnlockInstance(index, isIrqEnabled);
+
+        if((LPUART_E_OK == status) && (LPUART_SWITCH_DRAIN == mode))
+        {
+            status = LPUART_WaitSwitch(index);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to check whether a switch of LPUART_Reconfigure is still waiting
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint8_t: 1 until the new settings are applied, 0 otherwise
+ */
+uint8_t LPUART_IsReconfigurePending(LPUART_Type *pLPUARTx)
+{
+    uint8_t isPending = 0;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != LPUART_Buffer[LPUART_GetIndex(pLPUARTx)].isSwitchPending))
+    {
+        isPending = 1;
+    }
+
+    return isPending;
+}
+
+/**
+ * @brief This function is used to start and stop Transmitter of LPUART
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_SetTxState(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    {
+        HAL_LPUART_TxInterruptConfig(pLPUARTx, enable);
+        status = LPUART_E_OK;
+    }
+
+    return status;
 }
 
 /**
@@ -174,7 +1478,541 @@ Std_LPUART_Status LPUART_SetTxState(LPUART_Type *pLPUARTx, uint8_t enable)
  *
  * @return Std_LPUART_Status: status of the operation
  */
-Std_LPUART_Status LPUART_SetRxState(LPUART_Type *pLPUARTx, uint8_t enable)
+Std_LPUART_Status LPUART_SetRxState(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    {
+        HAL_LPUART_RxInterruptConfig(pLPUARTx, enable);
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to calculate and config the baudrate
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param baudRate[in]: baudrate to set, must be less than or equal to MAX_BAUDRATE
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_BaudRateConfig(LPUART_Type *pLPUARTx, uint32_t baudRate)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    TRACE_ENTER(TRACE_ID_LPUART_BAUDRATE);
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != baudRate) && (MAX_BAUDRATE >= baudRate))
+    {
+        LPUART_BaudRateSearch(pLPUARTx, baudRate);
+        status = LPUART_E_OK;
+    }
+
+    TRACE_EXIT(TRACE_ID_LPUART_BAUDRATE);
+
+    return status;
+}
+
+/**
+ * @brief This function is used to detect the baudrate from the first character received and configure it,
+ *        it must be called while the line is idle and returns once the character has been measured
+ *
+ * The edges are timestamped with LPUART_CYCLE_COUNTER by polling the Rx edge flag with the receiver
+ * disabled, so the measured character is not received. The sync mode averages 8 bit times and checks
+ * the edges are evenly spaced, it is the one to use at high baudrates.
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param mode[in]: character to measure
+ * @param timeoutCycles[in]: maximum time to wait for the character, in cycles of LPUART_CYCLE_COUNTER
+ * @param pBaudRate[out]: baudrate configured
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK on timeout or if the character cannot be measured
+ */
+Std_LPUART_Status LPUART_AutoBaud(LPUART_Type *pLPUARTx, LPUART_AutoBaudMode_Type mode,
+                                  uint32_t timeoutCycles, uint32_t *pBaudRate)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (LPUART_AUTOBAUD_START_BIT >= mode) && (0 != pBaudRate))
+    {
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        uint8_t isRxEnabled = (0 != (pLPUARTx->CTRL & LPUART_CTRL_RE_MASK)) ? 1U : 0U;
+        uint32_t stamps[LPUART_AUTOBAUD_SYNC_EDGES];
+        uint32_t nOfBits = 0;
+        uint32_t start;
+
+        /* The receiver must be off while the baudrate changes, the edge flag keeps working */
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+        HAL_LPUART_ClearRE(pLPUARTx);
+        HAL_LPUART_ClearStatusFlags(pLPUARTx, LPUART_STAT_RXEDGIF_MASK);
+        start = LPUART_CYCLE_COUNTER();
+
+        if(LPUART_AUTOBAUD_SYNC == mode)
+        {
+            uint8_t nOfEdges = 0;
+
+            while((LPUART_AUTOBAUD_SYNC_EDGES > nOfEdges) &&
+                  (0 != LPUART_WaitRxEdge(pLPUARTx, start, timeoutCycles, &stamps[nOfEdges])))
+            {
+                nOfEdges++;
+            }
+
+            if(LPUART_AUTOBAUD_SYNC_EDGES == nOfEdges)
+            {
+                uint32_t period = (stamps[LPUART_AUTOBAUD_SYNC_EDGES - 1U] - stamps[0]) / (LPUART_AUTOBAUD_SYNC_EDGES - 1U);
+
+                nOfBits = LPUART_AUTOBAUD_SYNC_BITS;
+
+                /* Each pair of bits must be within 25% of the average plus the polling latency, otherwise it
+                   was not 0x55 */
+                for(uint8_t i = 1; i < LPUART_AUTOBAUD_SYNC_EDGES; i++)
+                {
+                    uint32_t pair = stamps[i] - stamps[i - 1U];
+
+                    uint32_t tolerance = (period / 4U) + LPUART_AUTOBAUD_POLL_CYCLES;
+
+                    if(((pair + tolerance) < period) || (pair > (period + tolerance)))
+                    {
+                        nOfBits = 0;
+                    }
+                }
+            }
+        }
+        else
+        {
+            if(0 != LPUART_WaitRxEdge(pLPUARTx, start, timeoutCycles, &stamps[0]))
+            {
+                /* Invert the input so the end of the start bit becomes the active edge */
+                HAL_LPUART_RxDataInversionConfig(pLPUARTx, LPUART_RX_DATA_INVERSION_ENABLE);
+
+                if(0 != LPUART_WaitRxEdge(pLPUARTx, start, timeoutCycles, &stamps[1]))
+                {
+                    nOfBits = 1;
+                }
+
+                HAL_LPUART_RxDataInversionConfig(pLPUARTx, LPUART_RX_DATA_INVERSION_DISABLE);
+            }
+        }
+
+        if(0 != nOfBits)
+        {
+            uint32_t cycles = stamps[(LPUART_AUTOBAUD_SYNC == mode) ? (LPUART_AUTOBAUD_SYNC_EDGES - 1U) : 1U] - stamps[0];
+            uint64_t divisor = (uint64_t)LPUART_CYCLE_COUNTER_FREQ * nOfBits;
+
+            /* A window shorter than 4 polling periods cannot be measured */
+            if((4U * LPUART_AUTOBAUD_POLL_CYCLES) <= cycles)
+            {
+                uint32_t clocksPerBitX16 = (uint32_t)((((uint64_t)cycles * clock * 16U) + (divisor / 2U)) / divisor);
+                uint32_t tolerance = (uint32_t)(((uint64_t)cycles * LPUART_AUTOBAUD_SNAP_PERCENT) / 100U);
+                uint32_t closest = UINT32_MAX;
+
+                /* Each stamp is up to one polling period late, so a short window is only known to a few cycles.
+                   The standard baudrate whose window is the closest, within that error or the percentage, is
+                   used instead of the measure */
+                tolerance = (LPUART_AUTOBAUD_POLL_CYCLES > tolerance) ? LPUART_AUTOBAUD_POLL_CYCLES : tolerance;
+
+                for(uint8_t i = 0; i < (sizeof(LPUART_StandardBaudRate) / sizeof(LPUART_StandardBaudRate[0])); i++)
+                {
+                    uint32_t standard = LPUART_StandardBaudRate[i];
+                    uint32_t expected = (uint32_t)((divisor + (standard / 2U)) / standard);
+                    uint32_t distance = (cycles > expected) ? (cycles - expected) : (expected - cycles);
+
+                    if((distance <= tolerance) && (distance < closest))
+                    {
+                        closest = distance;
+                        clocksPerBitX16 = (uint32_t)((((uint64_t)clock * 16U) + (standard / 2U)) / standard);
+                    }
+                }
+
+                *pBaudRate = LPUART_SetBitTime(pLPUARTx, clocksPerBitX16);
+
+                if(0 != *pBaudRate)
+                {
+                    status = LPUART_E_OK;
+                }
+            }
+        }
+
+        HAL_LPUART_ClearStatusFlags(pLPUARTx, LPUART_STAT_RXEDGIF_MASK);
+
+        if(0 != isRxEnabled)
+        {
+            HAL_LPUART_SetRE(pLPUARTx);
+        }
+
+        LPUART_UnlockInstance(index, isIrqEnabled);
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to configure the LIN break handling, 13 bit break generation, break
+ *        detection and its interrupt, and enable the interrupt of the instance
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_LinModeConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    {
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        HAL_LPUART_BreakConfig(pLPUARTx, enable);
+        HAL_LPUART_ClearStatusFlags(pLPUARTx, LPUART_STAT_LBKDIF_MASK);
+        HAL_LPUART_BreakDetectInterruptConfig(pLPUARTx, enable);
+        LPUART_UnlockInstance(index, isIrqEnabled);
+
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to configure the idle line interrupt, ending a frame after a silence
+ *
+ * The IDLE flag is set once per frame, after the silence following the last character. It is not
+ * cleared by the driver, the callback registered with LPUART_CallbackRegister must clear it.
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param idleChars[in]: silence setting the IDLE flag, counted from the stop bit of the last character
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_IdleLineConfig(LPUART_Type *pLPUARTx, LPUART_IdleChars_Type idleChars, uint8_t enable)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (LPUART_IDLE_128_CHARS >= idleChars) && ((0 == enable) || (1 == enable)))
+    {
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        uint32_t isRxEnabled;
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        /* The idle time is only written with the receiver off */
+        isRxEnabled = pLPUARTx->CTRL & LPUART_CTRL_RE_MASK;
+        HAL_LPUART_ClearRE(pLPUARTx);
+        HAL_LPUART_IdleLineConfig(pLPUARTx, idleChars);
+        HAL_LPUART_ClearStatusFlags(pLPUARTx, LPUART_STAT_IDLE_MASK);
+        HAL_LPUART_IdleInterruptConfig(pLPUARTx, enable);
+
+        if(0 != isRxEnabled)
+        {
+            HAL_LPUART_SetRE(pLPUARTx);
+        }
+
+        LPUART_UnlockInstance(index, isIrqEnabled);
+
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to get the baudrate given by the oversampling ratio and the divisor
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: baudrate in bit/s, 0 if the instance is not valid
+ */
+uint32_t LPUART_GetBaudRate(LPUART_Type *pLPUARTx)
+{
+    uint32_t baudRate = 0;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
+    {
+        uint32_t osr = ((pLPUARTx->BAUD & LPUART_BAUD_OSR_MASK) >> LPUART_BAUD_OSR_SHIFT) + 1U;
+        uint32_t sbr = (pLPUARTx->BAUD & LPUART_BAUD_SBR_MASK) >> LPUART_BAUD_SBR_SHIFT;
+
+        if(0 != sbr)
+        {
+            baudRate = clock / (osr * sbr);
+        }
+    }
+
+    return baudRate;
+}
+
+/**
+ * @brief This function is used to queue a break character in the transmit stream
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_SendBreak(LPUART_Type *pLPUARTx)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
+    {
+        HAL_LPUART_SendBreak(pLPUARTx);
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to set the time allowed to each flag wait of the blocking transfers
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param timeoutUs[in]: timeout in microseconds, measured on the LPIT timebase
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_SetTimeout(LPUART_Type *pLPUARTx, uint32_t timeoutUs)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
+    {
+        LPUART_Timeout[LPUART_GetIndex(pLPUARTx)] = timeoutUs;
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to set the cycles allowed to each flag wait of the blocking transfers, the
+ *        wait ends at the timeout or at the budget, whichever comes first
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param budgetCycles[in]: budget in cycles of LPUART_CYCLE_COUNTER
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_SetWaitBudget(LPUART_Type *pLPUARTx, uint32_t budgetCycles)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
+    {
+        LPUART_WaitBudget[LPUART_GetIndex(pLPUARTx)] = budgetCycles;
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to send a frame of 7 or 8 bits
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: data to send
+ *
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if a flag wait timed out
+ */
+Std_LPUART_Status LPUART_TxFrame7_8(LPUART_Type *pLPUARTx, uint8_t data)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
+    {
+        status = LPUART_WaitFlag(pLPUARTx, LPUART_STAT_TDRE_MASK);
+
+        if(LPUART_E_OK == status)
+        {
+            HAL_LPUART_TxFrame7_8(pLPUARTx, data);
+            status = LPUART_WaitFlag(pLPUARTx, LPUART_STAT_TC_MASK);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to send multiple frames of 7 or 8 bits
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pTxBuffer[in]: pointer to the data buffer
+ * @param len[in]: length of the data buffer
+ *
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if a flag wait timed out
+ */
+Std_LPUART_Status LPUART_TxMultiFrame7_8(LPUART_Type *pLPUARTx, uint8_t *pTxBuffer, uint32_t len)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != len) && (0 != pTxBuffer))
+    {
+        status = LPUART_E_OK;
+
+        for(uint32_t i = 0; (i < len) && (LPUART_E_OK == status); i++)
+        {
+            status = LPUART_TxFrame7_8(pLPUARTx, pTxBuffer[i]);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to send a frame of 9 or 10 bits
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: data to send
+ *
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if a flag wait timed out
+ */
+Std_LPUART_Status LPUART_TxFrame9_10(LPUART_Type *pLPUARTx, uint16_t data) /* Chuyen qua HAL */
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
+    {
+        status = LPUART_WaitFlag(pLPUARTx, LPUART_STAT_TDRE_MASK);
+
+        if(LPUART_E_OK == status)
+        {
+            HAL_LPUART_TxFrame9_10(pLPUARTx, data);
+            status = LPUART_WaitFlag(pLPUARTx, LPUART_STAT_TC_MASK);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to send multiple frames of 9 or 10 bits
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pTxBuffer[in]: pointer to the data buffer
+ * @param len[in]: length of the data buffer
+ *
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if a flag wait timed out
+ */
+Std_LPUART_Status LPUART_TxMultiFrame9_10(LPUART_Type *pLPUARTx, uint16_t *pTxBuffer, uint32_t len)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != len) && (0 != pTxBuffer))
+    {
+        status = LPUART_E_OK;
+
+        for(uint32_t i = 0; (i < len) && (LPUART_E_OK == status); i++)
+        {
+            status = LPUART_TxFrame9_10(pLPUARTx, pTxBuffer[i]);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to receive a frame
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param RxBuffer[in]: pointer to the buffer to store the received data
+ *
+ * @return Std_LPUART_Status: LPUART_E_TIMEOUT if a flag wait timed out
+ */
+Std_LPUART_Status LPUART_RxFrame(LPUART_Type *pLPUARTx, uint8_t* RxBuffer)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != RxBuffer))
+    {
+        status = LPUART_WaitFlag(pLPUARTx, LPUART_STAT_RDRF_MASK);
+
+        if(LPUART_E_OK == status)
+        {
+            *RxBuffer = (uint8_t)HAL_LPUART_RxFrame(pLPUARTx);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to receive multiple frames
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pRxBuffer[in]: pointer to the buffer to store the received data
+ * @param len[in]: length of the buffer
+ *
+ * @return uint32_t: number of data received before the end of the buffer or a timeout
+ */
+uint32_t LPUART_RxMultiFrame(LPUART_Type *pLPUARTx, uint16_t *pRxBuffer, uint32_t len)
+{
+    uint32_t nOfDataRx = 0;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pRxBuffer))
+    {
+        while((nOfDataRx < len) && (LPUART_E_OK == LPUART_WaitFlag(pLPUARTx, LPUART_STAT_RDRF_MASK)))
+        {
+            pRxBuffer[nOfDataRx] = HAL_LPUART_RxFrame(pLPUARTx);
+            nOfDataRx++;
+        }
+    }
+
+    return nOfDataRx;
+}
+
+/**
+ * @brief This function is used to configure the LPUART Tx interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_TxInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    {
+        HAL_LPUART_TxInterruptConfig(pLPUARTx, enable);
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to configure the LPUART Tx complete interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_TxCompleteInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    {
+        HAL_LPUART_TxCompleteInterruptConfig(pLPUARTx, enable);
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to configure the LPUART Rx interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_RxInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
 {
     Std_LPUART_Status status = LPUART_E_NOT_OK;
 
@@ -188,280 +2026,730 @@ Std_LPUART_Status LPUART_SetRxState(LPUART_Type *pLPUARTx, uint8_t enable)
 }
 
 /**
- * @brief This function is used to calculate and config the baudrate
+ * @brief This function is used to configure the LPUART OverRun interrupt
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param baudRate[in]: baudrate to set, must be less than or equal to MAX_BAUDRATE
+ * @param enable[in]: state to set
  *
  * @return Std_LPUART_Status: status of the operation
  */
-Std_LPUART_Status LPUART_BaudRateConfig(LPUART_Type *pLPUARTx, uint32_t baudRate)
+Std_LPUART_Status LPUART_OverRunInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
 {
     Std_LPUART_Status status = LPUART_E_NOT_OK;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != baudRate) && (MAX_BAUDRATE >= baudRate))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    {
+        HAL_LPUART_OverRunInterruptConfig(pLPUARTx, enable);
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to configure the LPUART Noise error interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_NoiseErrorInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    {
+        HAL_LPUART_NoiseErrorInterruptConfig(pLPUARTx, enable);
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to configure the LPUART Frame error interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_FrameErrorInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    {
+        HAL_LPUART_FrameErrorInterruptConfig(pLPUARTx, enable);
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to configure the LPUART Parity error interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_ParityErrorInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
     {
-        float minError = 100;
-        volatile uint8_t osrVal = 0;
-        volatile uint16_t sbrVal = 0;
+        HAL_LPUART_ParityErrorInterruptConfig(pLPUARTx, enable);
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to register the callback function for the LPUART interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param IRQHandler[in]: pointer to the callback function
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_CallbackRegister(LPUART_Type *pLPUARTx, LPUART_CallbackPtr IRQHandler)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != IRQHandler))
+    {
+        if(LPUART0 == pLPUARTx)
+        {
+            LPUART_Callback[0] = IRQHandler;
+        }
+        else if(LPUART1 == pLPUARTx)
+        {
+            LPUART_Callback[1] = IRQHandler;
+        }
+        else if(LPUART2 == pLPUARTx)
+        {
+            LPUART_Callback[2] = IRQHandler;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        status = LPUART_E_OK;
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to attach Rx and Tx rings to the LPUART and enable its interrupt driven transfer
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pRxArr[in]: pointer to the array of the Rx ring
+ * @param rxCapacity[in]: capacity of the Rx ring
+ * @param pTxArr[in]: pointer to the array of the Tx ring
+ * @param txCapacity[in]: capacity of the Tx ring
+ *
+ * @return Std_LPUART_Status: status of the operation
+ */
+Std_LPUART_Status LPUART_BufferInit(LPUART_Type *pLPUARTx, uint8_t *pRxArr, uint8_t rxCapacity, uint8_t *pTxArr, uint8_t txCapacity)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pRxArr) && (0 != rxCapacity) && (0 != pTxArr) && (0 != txCapacity))
+    {
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
+
+        (void)LPUART_LockInstance(index);
+
+        queueInit(&pBuffer->rxQueue, pRxArr, rxCapacity);
+        queueInit(&pBuffer->txQueue, pTxArr, txCapacity);
+        pBuffer->rxCount = 0;
+        pBuffer->txVecCount = 0;
+
+        /* Blocks not sent yet go back to their pools */
+        while(0 != pBuffer->txBlockCount)
+        {
+            (void)poolFree(pBuffer->txBlock[pBuffer->txBlockOut].pPool, pBuffer->txBlock[pBuffer->txBlockOut].pData);
+            pBuffer->txBlockOut = (uint8_t)((pBuffer->txBlockOut + 1U) & LPUART_TX_BLOCK_MASK);
+            pBuffer->txBlockCount--;
+        }
+
+        pBuffer->txBlockOffset = 0;
+        pBuffer->urgentQueue = (Std_Queue_Types){0};
+        pBuffer->txPreempt = LPUART_PREEMPT_FRAME;
+        pBuffer->txSource = LPUART_TX_IDLE;
+        pBuffer->txLeft = 0;
+        pBuffer->isUrgentTimed = 0;
+        pBuffer->isBuffered = 1;
+
+        HAL_LPUART_TxInterruptConfig(pLPUARTx, LPUART_TX_INTERRUPT_DISABLE);
+        HAL_LPUART_RxInterruptConfig(pLPUARTx, LPUART_RX_INTERRUPT_ENABLE);
+
+        /* The rings are served by the interrupt, its NVIC line is enabled whatever it was before */
+        LPUART_UnlockInstance(index, 1U);
+        status = LPUART_E_OK;
+    }
 
-        for(uint8_t i = 31; (i >= 3) && (minError != 0); i--)
+    return status;
+}
+
+/**
+ * @brief This function is used to queue data to the Tx ring without waiting, the Tx interrupt sends it out
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pTxBuffer[in]: pointer to the data buffer
+ * @param len[in]: length of the data buffer
+ *
+ * @return uint32_t: number of data queued, less than len when the Tx ring is full, 0 while a switch of
+ *                   LPUART_Reconfigure is pending
+ */
+uint32_t LPUART_Send(LPUART_Type *pLPUARTx, const uint8_t *pTxBuffer, uint32_t len)
+{
+    uint32_t nOfDataTx = 0;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pTxBuffer))
+    {
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
+
+        /* Nothing is queued behind a pending switch of the settings */
+        if((0 != pBuffer->isBuffered) && (0 == pBuffer->isSwitchPending))
+        {
+            uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+            if(0 != LPUART_IsTxIdle(index))
+            {
+                pBuffer->txBurstStart = LPUART_CYCLE_COUNTER();
+            }
+
+            nOfDataTx = LPUART_TxQueuePush(pBuffer, &pBuffer->txQueue, pTxBuffer, len);
+
+            if(0 != nOfDataTx)
+            {
+                HAL_LPUART_TxInterruptConfig(pLPUARTx, LPUART_TX_INTERRUPT_ENABLE);
+            }
+
+            LPUART_Statistics[index].txBytes += nOfDataTx;
+
+            LPUART_UnlockInstance(index, isIrqEnabled);
+        }
+    }
+
+    return nOfDataTx;
+}
+
+/**
+ * @brief This function is used to attach the urgent Tx ring, the Tx interrupt serves it before the bulk
+ *        data of LPUART_Send and LPUART_TransmitV
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance, its rings must be attached and the Tx idle
+ * @param pUrgentArr[in]: pointer to the array of the urgent ring
+ * @param urgentCapacity[in]: capacity of the urgent ring
+ * @param preempt[in]: points where the urgent data preempts the bulk data
+ * @param urgentBurst[in]: urgent frames or packets sent in a row before one of the waiting bulk data, 0
+ *                         to never serve the bulk data while urgent data is queued
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the rings are not attached or data is being sent
+ */
+Std_LPUART_Status LPUART_TxPriorityInit(LPUART_Type *pLPUARTx, uint8_t *pUrgentArr, uint8_t urgentCapacity,
+                                        LPUART_TxPreempt_Type preempt, uint8_t urgentBurst)
+{
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pUrgentArr) && (0 != urgentCapacity) &&
+       (LPUART_PREEMPT_PACKET >= preempt))
+    {
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        /* The length bytes of the packet mode cannot be added to data already queued */
+        if((0 != pBuffer->isBuffered) && (0 != LPUART_IsTxIdle(index)))
+        {
+            queueInit(&pBuffer->urgentQueue, pUrgentArr, urgentCapacity);
+            pBuffer->txPreempt = preempt;
+            pBuffer->urgentBurst = urgentBurst;
+            pBuffer->urgentRun = 0;
+            pBuffer->isUrgentTimed = 0;
+            status = LPUART_E_OK;
+        }
+
+        LPUART_UnlockInstance(index, isIrqEnabled);
+    }
+
+    return status;
+}
+
+/**
+ * @brief This function is used to queue data to the urgent Tx ring without waiting
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param pTxBuffer[in]: pointer to the data buffer
+ * @param len[in]: length of the data buffer
+ *
+ * @return uint32_t: number of data queued, less than len when the urgent ring is full, 0 or len with
+ *                   LPUART_PREEMPT_PACKET
+ */
+uint32_t LPUART_SendUrgent(LPUART_Type *pLPUARTx, const uint8_t *pTxBuffer, uint32_t len)
+{
+    uint32_t nOfDataTx = 0;
+
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pTxBuffer))
+    {
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
+
+        if((0 != pBuffer->isBuffered) && (0 != pBuffer->urgentQueue.capacity) && (0 == pBuffer->isSwitchPending))
         {
-            uint16_t tmpSBRval = (uint32_t)clock / ((i + 1) * baudRate);
-            uint32_t tmpBaudRate = clock / ((i + 1) * tmpSBRval);
-            float error = ((float)(tmpBaudRate - baudRate) / baudRate) * 100;
+            uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+            if(0 != LPUART_IsTxIdle(index))
+            {
+                pBuffer->txBurstStart = LPUART_CYCLE_COUNTER();
+            }
+
+            /* The latency is measured from an empty ring, the head of line blocking by the bulk data */
+            if((0 == pBuffer->urgentQueue.size) && (0 != len))
+            {
+                pBuffer->urgentStart = LPUART_CYCLE_COUNTER();
+                pBuffer->isUrgentTimed = 1;
+            }
+
+            nOfDataTx = LPUART_TxQueuePush(pBuffer, &pBuffer->urgentQueue, pTxBuffer, len);
 
-            if(error < minError)
+            if(0 != nOfDataTx)
             {
-                minError = error;
-                osrVal = i;
-                sbrVal = tmpSBRval;
+                HAL_LPUART_TxInterruptConfig(pLPUARTx, LPUART_TX_INTERRUPT_ENABLE);
+            }
+            else
+            {
+                pBuffer->isUrgentTimed = (0 != pBuffer->urgentQueue.size) ? pBuffer->isUrgentTimed : 0U;
             }
-        }
 
-        HAL_LPUART_SetBaudrate(pLPUARTx, osrVal, sbrVal);
-        status = LPUART_E_OK;
+            LPUART_Statistics[index].txBytes += nOfDataTx;
+
+            LPUART_UnlockInstance(index, isIrqEnabled);
+        }
     }
 
-    return status;
+    return nOfDataTx;
 }
 
 /**
- * @brief This function is used to send a frame of 7 or 8 bits
+ * @brief This function is used to get the free space of the Tx ring
  *
- * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param data[in]: data to send
+ * @param pLPUARTx[in]: pointer to the LPUART instance
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return uint32_t: number of data that can be queued, 0 when the Tx ring is not attached or a switch of
+ *                   LPUART_Reconfigure is pending
  */
-Std_LPUART_Status LPUART_TxFrame7_8(LPUART_Type *pLPUARTx, uint8_t data)
+uint32_t LPUART_GetTxFree(LPUART_Type *pLPUARTx)
 {
-    Std_LPUART_Status status = LPUART_E_NOT_OK;
+    uint32_t nOfFree = 0;
 
     if(INSTANCE_IS_AVAILABLE(pLPUARTx))
     {
-        HAL_LPUART_TxFrame7_8(pLPUARTx, data);
-        status = LPUART_E_OK;
+        Std_Queue_Types *pTxQueue = &LPUART_Buffer[LPUART_GetIndex(pLPUARTx)].txQueue;
+
+        /* Only the Tx interrupt changes the size concurrently and it can only grow the free space */
+        nOfFree = (0 == LPUART_Buffer[LPUART_GetIndex(pLPUARTx)].isSwitchPending) ?
+                  ((uint32_t)pTxQueue->capacity - pTxQueue->size) : 0U;
+
+        /* A packet also takes its length byte */
+        if((LPUART_PREEMPT_PACKET == LPUART_Buffer[LPUART_GetIndex(pLPUARTx)].txPreempt) && (0 != nOfFree))
+        {
+            nOfFree--;
+        }
     }
 
-    return status;
+    return nOfFree;
 }
 
 /**
- * @brief This function is used to send multiple frames of 7 or 8 bits
+ * @brief This function is used to send several segments back to back from the Tx interrupt without copying
+ *        them, the segments and their table must stay unchanged until LPUART_IsTransmitVBusy returns 0
  *
- * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param pTxBuffer[in]: pointer to the data buffer
- * @param len[in]: length of the data buffer
+ * The Tx interrupt writes the segments in order and moves to the next one as soon as it writes the last
+ * byte of the current one, so there is no idle time between them. Data queued with LPUART_Send while the
+ * segments are being sent goes out after them.
  *
- * @return Std_LPUART_Status: status of the operation
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance, its rings must be attached
+ * @param pIoVec[in]: table of segments
+ * @param count[in]: number of segments
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the Tx ring is not empty, blocks of LPUART_SendBlock or a
+ *                            previous transmission are not finished, or a switch of LPUART_Reconfigure is
+ *                            pending
  */
-Std_LPUART_Status LPUART_TxMultiFrame7_8(LPUART_Type *pLPUARTx, uint8_t *pTxBuffer, uint32_t len)
+Std_LPUART_Status LPUART_TransmitV(LPUART_Type *pLPUARTx, const LPUART_IoVec_Type *pIoVec, uint32_t count)
 {
     Std_LPUART_Status status = LPUART_E_NOT_OK;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != len) && (0 != pTxBuffer))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pIoVec))
     {
-        for(uint32_t i = 0; i < len; i++)
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        /* Bytes already in the Tx ring or blocks must go out first, the segments cannot be put behind them */
+        if((0 != pBuffer->isBuffered) && (0 == pBuffer->txVecCount) && (0 == pBuffer->txBlockCount) &&
+           (0 == pBuffer->txQueue.size) && (0 == pBuffer->isSwitchPending))
         {
-            HAL_LPUART_TxFrame7_8(pLPUARTx, pTxBuffer[i]);
+            uint32_t nOfBytes = 0;
+
+            for(uint32_t i = 0; i < count; i++)
+            {
+                nOfBytes += pIoVec[i].len;
+            }
+
+            pBuffer->pTxVec = pIoVec;
+            pBuffer->txVecCount = count;
+            pBuffer->txVecOffset = 0;
+            LPUART_SkipEmptySegments(pBuffer);
+
+            if(0 != pBuffer->txVecCount)
+            {
+                if((LPUART_TX_IDLE == pBuffer->txSource) && (0 == pBuffer->urgentQueue.size))
+                {
+                    pBuffer->txBurstStart = LPUART_CYCLE_COUNTER();
+                }
+
+                HAL_LPUART_TxInterruptConfig(pLPUARTx, LPUART_TX_INTERRUPT_ENABLE);
+            }
+
+            LPUART_Statistics[index].txBytes += nOfBytes;
+            status = LPUART_E_OK;
         }
-        status = LPUART_E_OK;
+
+        LPUART_UnlockInstance(index, isIrqEnabled);
     }
 
     return status;
 }
 
 /**
- * @brief This function is used to send a frame of 9 or 10 bits
+ * @brief This function is used to check whether the segments of LPUART_TransmitV are still being sent
  *
- * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param data[in]: data to send
+ * @param pLPUARTx[in]: pointer to the LPUART instance
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return uint8_t: 1 until the last byte is written to the transmitter, 0 otherwise
  */
-Std_LPUART_Status LPUART_TxFrame9_10(LPUART_Type *pLPUARTx, uint16_t data) /* Chuyen qua HAL */
+uint8_t LPUART_IsTransmitVBusy(LPUART_Type *pLPUARTx)
 {
-    Std_LPUART_Status status = LPUART_E_NOT_OK;
+    uint8_t isBusy = 0;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != LPUART_Buffer[LPUART_GetIndex(pLPUARTx)].txVecCount))
     {
-        HAL_LPUART_TxFrame9_10(pLPUARTx, data);
-        status = LPUART_E_OK;
+        isBusy = 1;
     }
 
-    return status;
+    return isBusy;
 }
 
 /**
- * @brief This function is used to send multiple frames of 9 or 10 bits
+ * @brief This function is used to hand a pool block over to the Tx interrupt, which sends it without
+ *        copying and gives it back to its pool once its last byte is written to the transmitter
  *
- * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param pTxBuffer[in]: pointer to the data buffer
- * @param len[in]: length of the data buffer
+ * The blocks are sent in order after the segments of LPUART_TransmitV and before the data queued with
+ * LPUART_Send after them.
  *
- * @return Std_LPUART_Status: status of the operation
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance, its rings must be attached
+ * @param pPool[in/out]: pool of the block
+ * @param pBlock[in]: block given by poolAlloc, owned by the driver if the block is accepted
+ * @param len[in]: number of bytes to send from the start of the block
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the Tx ring is not empty, LPUART_TX_BLOCK_QUEUE blocks are
+ *                            queued or a switch of LPUART_Reconfigure is pending, the caller keeps the
+ *                            block then
  */
-Std_LPUART_Status LPUART_TxMultiFrame9_10(LPUART_Type *pLPUARTx, uint16_t *pTxBuffer, uint32_t len)
+Std_LPUART_Status LPUART_SendBlock(LPUART_Type *pLPUARTx, Std_Pool_Types *pPool, void *pBlock, uint32_t len)
 {
     Std_LPUART_Status status = LPUART_E_NOT_OK;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != len) && (0 != pTxBuffer))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pPool) && (0 != pBlock) && (0 != len) &&
+       (len <= poolGetBlockSize(pPool)))
     {
-        for(uint32_t i = 0; i < len; i++)
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        /* Bytes already in the Tx ring must go out first, the block cannot be put behind them */
+        if((0 != pBuffer->isBuffered) && (0 == pBuffer->txQueue.size) &&
+           (LPUART_TX_BLOCK_QUEUE > pBuffer->txBlockCount) && (0 == pBuffer->isSwitchPending))
         {
-            HAL_LPUART_TxFrame9_10(pLPUARTx, pTxBuffer[i]);
+            LPUART_TxBlock_Type *pEntry = &pBuffer->txBlock[(pBuffer->txBlockOut + pBuffer->txBlockCount) & LPUART_TX_BLOCK_MASK];
+
+            if((LPUART_TX_IDLE == pBuffer->txSource) && (0 == pBuffer->urgentQueue.size) &&
+               (0 == pBuffer->txVecCount) && (0 == pBuffer->txBlockCount))
+            {
+                pBuffer->txBurstStart = LPUART_CYCLE_COUNTER();
+            }
+
+            pEntry->pPool = pPool;
+            pEntry->pData = (uint8_t *)pBlock;
+            pEntry->len = len;
+            pBuffer->txBlockCount++;
+
+            HAL_LPUART_TxInterruptConfig(pLPUARTx, LPUART_TX_INTERRUPT_ENABLE);
+
+            LPUART_Statistics[index].txBytes += len;
+            status = LPUART_E_OK;
         }
-        status = LPUART_E_OK;
+
+        LPUART_UnlockInstance(index, isIrqEnabled);
     }
 
     return status;
 }
 
 /**
- * @brief This function is used to receive a frame
+ * @brief This function is used to take received data from the Rx ring without waiting
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param RxBuffer[in]: pointer to the buffer to store the received data
+ * @param pRxBuffer[out]: pointer to the buffer to store the received data
+ * @param len[in]: length of the buffer
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return uint32_t: number of data received
  */
-Std_LPUART_Status LPUART_RxFrame(LPUART_Type *pLPUARTx, uint8_t* RxBuffer)
+uint32_t LPUART_Receive(LPUART_Type *pLPUARTx, uint8_t *pRxBuffer, uint32_t len)
 {
-    Std_LPUART_Status status = LPUART_E_NOT_OK;
+    uint32_t nOfDataRx = 0;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != RxBuffer))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pRxBuffer))
     {
-        *RxBuffer = HAL_LPUART_RxFrame(pLPUARTx);
-        status = LPUART_E_OK;
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        Std_Queue_Types *pRxQueue = &LPUART_Buffer[index].rxQueue;
+
+        if(0 != LPUART_Buffer[index].isBuffered)
+        {
+            uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+            while((nOfDataRx < len) && (0 != pRxQueue->size))
+            {
+                pRxBuffer[nOfDataRx] = queuePop(pRxQueue);
+                nOfDataRx++;
+            }
+
+            LPUART_Statistics[index].rxBytes += nOfDataRx;
+
+            LPUART_UnlockInstance(index, isIrqEnabled);
+        }
     }
 
-    return status;
+    return nOfDataRx;
 }
 
 /**
- * @brief This function is used to receive multiple frames
+ * @brief This function is used to receive messages ended by a terminator: the data gathers in the Rx
+ *        FIFO and the interrupt comes when it is full, on a terminator or after a silence
  *
- * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param pRxBuffer[in]: pointer to the buffer to store the received data
- * @param len[in]: length of the buffer
+ * A character is reported by MA1F or MA2F once it is the next one to read, so a terminator behind
+ * other data in the FIFO ends the message at the next full FIFO or at the timeout. Without DMA the
+ * FIFO depth bounds the interrupt rate to one every 4 characters plus one per message.
  *
- * @return uint32_t: number of data received
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance, its rings must be attached
+ * @param pConfig[in]: terminators and timeout, 0 to go back to one interrupt per character
+ *
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the rings are not attached or the timeout is too long
  */
-uint32_t LPUART_RxMultiFrame(LPUART_Type *pLPUARTx, uint16_t *pRxBuffer, uint32_t len)
+Std_LPUART_Status LPUART_RxMatchConfig(LPUART_Type *pLPUARTx, const LPUART_RxMatch_Config_Type *pConfig)
 {
-    uint32_t nOfDataRx = 0;
+    Std_LPUART_Status status = LPUART_E_NOT_OK;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != *pRxBuffer) && (0 != len))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == pConfig) || (LPUART_IDLE_64_CHARS >= pConfig->timeout)))
     {
-        for(uint32_t nOfDataRx = 0; nOfDataRx < len; nOfDataRx++)
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        LPUART_Buffer_Type *pBuffer = &LPUART_Buffer[index];
+
+        if(0 != pBuffer->isBuffered)
         {
-            pRxBuffer[nOfDataRx] = HAL_LPUART_RxFrame(pLPUARTx);
+            uint32_t isRxEnabled;
+            uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+            /* The FIFO is only enabled with the receiver off */
+            isRxEnabled = pLPUARTx->CTRL & LPUART_CTRL_RE_MASK;
+            HAL_LPUART_ClearRE(pLPUARTx);
+
+            if(0 != pConfig)
+            {
+                pBuffer->terminator1 = pConfig->terminator1;
+                pBuffer->terminator2 = pConfig->terminator2;
+                pBuffer->isTerminator2 = (0 != pConfig->isTerminator2) ? 1U : 0U;
+                pBuffer->onMessage = pConfig->onMessage;
+                pBuffer->isRxMatch = 1;
+
+                HAL_LPUART_MatchInterruptConfig(pLPUARTx, pConfig->terminator1, pConfig->terminator2, 1,
+                                                pBuffer->isTerminator2);
+                HAL_LPUART_RxFifoConfig(pLPUARTx, 1, LPUART_RX_FIFO_WATER, (uint8_t)pConfig->timeout + 1U);
+            }
+            else
+            {
+                pBuffer->isRxMatch = 0;
+
+                HAL_LPUART_MatchInterruptConfig(pLPUARTx, 0, 0, 0, 0);
+                HAL_LPUART_RxFifoConfig(pLPUARTx, 0, 0, 0);
+            }
+
+            HAL_LPUART_ClearStatusFlags(pLPUARTx, LPUART_STAT_MA1F_MASK | LPUART_STAT_MA2F_MASK);
+            HAL_LPUART_RxInterruptConfig(pLPUARTx, LPUART_RX_INTERRUPT_ENABLE);
+
+            if(0 != isRxEnabled)
+            {
+                HAL_LPUART_SetRE(pLPUARTx);
+            }
+
+            LPUART_UnlockInstance(index, isIrqEnabled);
+
+            status = LPUART_E_OK;
         }
     }
 
-    return nOfDataRx;
+    return status;
 }
 
 /**
- * @brief This function is used to configure the LPUART Tx interrupt
+ * @brief This function is used to look at received data in place, without taking it from the Rx ring
  *
- * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param enable[in]: state to set
+ * The Rx interrupt only fills free slots, so the span stays valid until it is released with
+ * LPUART_RxConsume.
  *
- * @return Std_LPUART_Status: status of the operation
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ * @param offset[in]: number of data to skip from the oldest one
+ * @param ppSpan[out]: start of the contiguous span of the ring holding the data at offset
+ *
+ * @return uint32_t: length of the span, 0 when there is no data at offset
  */
-Std_LPUART_Status LPUART_TxInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+uint32_t LPUART_RxPeek(LPUART_Type *pLPUARTx, uint32_t offset, const uint8_t **ppSpan)
 {
-    Std_LPUART_Status status = LPUART_E_NOT_OK;
+    uint32_t len = 0;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != ppSpan))
     {
-        HAL_LPUART_TxInterruptConfig(pLPUARTx, enable);
-        status = LPUART_E_OK;
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        Std_Queue_Types *pRxQueue = &LPUART_Buffer[index].rxQueue;
+        uint32_t size = pRxQueue->size;
+
+        if((0 != LPUART_Buffer[index].isBuffered) && (offset < size))
+        {
+            uint32_t start = ((uint32_t)pRxQueue->front + offset) % pRxQueue->capacity;
+
+            len = size - offset;
+
+            if(len > (pRxQueue->capacity - start))
+            {
+                len = pRxQueue->capacity - start;
+            }
+
+            *ppSpan = &pRxQueue->queueArr[start];
+        }
     }
 
-    return status;
+    return len;
 }
 
 /**
- * @brief This function is used to configure the LPUART Tx complete interrupt
+ * @brief This function is used to release data looked at with LPUART_RxPeek
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param enable[in]: state to set
+ * @param len[in]: number of data to release
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return uint32_t: number of data released
  */
-Std_LPUART_Status LPUART_TxCompleteInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+uint32_t LPUART_RxConsume(LPUART_Type *pLPUARTx, uint32_t len)
 {
-    Std_LPUART_Status status = LPUART_E_NOT_OK;
+    uint32_t nOfDataRx = 0;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
     {
-        HAL_LPUART_TxCompleteInterruptConfig(pLPUARTx, enable);
-        status = LPUART_E_OK;
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        Std_Queue_Types *pRxQueue = &LPUART_Buffer[index].rxQueue;
+
+        if(0 != LPUART_Buffer[index].isBuffered)
+        {
+            uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+            nOfDataRx = (len < pRxQueue->size) ? len : pRxQueue->size;
+            pRxQueue->front = (uint8_t)(((uint32_t)pRxQueue->front + nOfDataRx) % pRxQueue->capacity);
+            pRxQueue->size = (uint8_t)(pRxQueue->size - nOfDataRx);
+
+            LPUART_Statistics[index].rxBytes += nOfDataRx;
+
+            LPUART_UnlockInstance(index, isIrqEnabled);
+        }
     }
 
-    return status;
+    return nOfDataRx;
 }
 
 /**
- * @brief This function is used to configure the LPUART Rx interrupt
+ * @brief This function is used to get the free space of the Rx ring
  *
- * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param enable[in]: state to set
+ * @param pLPUARTx[in]: pointer to the LPUART instance
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return uint32_t: number of data that can still be received, 0 when the Rx ring is not attached
  */
-Std_LPUART_Status LPUART_RxInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+uint32_t LPUART_GetRxFree(LPUART_Type *pLPUARTx)
 {
-    Std_LPUART_Status status = LPUART_E_NOT_OK;
+    uint32_t nOfFree = 0;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
     {
-        HAL_LPUART_RxInterruptConfig(pLPUARTx, enable);
-        status = LPUART_E_OK;
+        Std_Queue_Types *pRxQueue = &LPUART_Buffer[LPUART_GetIndex(pLPUARTx)].rxQueue;
+
+        /* Only the Rx interrupt changes the size concurrently and it can only shrink the free space */
+        nOfFree = (uint32_t)pRxQueue->capacity - pRxQueue->size;
     }
 
-    return status;
+    return nOfFree;
 }
 
 /**
- * @brief This function is used to configure the LPUART OverRun interrupt
+ * @brief This function is used to count the data pushed to the Rx ring, the difference of two counts
+ *        is the data received in between
  *
- * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param enable[in]: state to set
+ * @param pLPUARTx[in]: pointer to the LPUART instance
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return uint32_t: data pushed to the Rx ring since LPUART_BufferInit, dropped data is not counted
  */
-Std_LPUART_Status LPUART_OverRunInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+uint32_t LPUART_GetRxCount(LPUART_Type *pLPUARTx)
 {
-    Std_LPUART_Status status = LPUART_E_NOT_OK;
+    uint32_t count = 0;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
     {
-        HAL_LPUART_OverRunInterruptConfig(pLPUARTx, enable);
-        status = LPUART_E_OK;
+        count = LPUART_Buffer[LPUART_GetIndex(pLPUARTx)].rxCount;
     }
 
-    return status;
+    return count;
 }
 
 /**
- * @brief This function is used to configure the LPUART Noise error interrupt
+ * @brief This function is used to take a consistent snapshot of the runtime statistics of the LPUART
  *
- * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param enable[in]: state to set
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ * @param pStatistics[out]: pointer to the snapshot
  *
  * @return Std_LPUART_Status: status of the operation
  */
-Std_LPUART_Status LPUART_NoiseErrorInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+Std_LPUART_Status LPUART_GetStatistics(LPUART_Type *pLPUARTx, LPUART_Statistics_Type *pStatistics)
 {
     Std_LPUART_Status status = LPUART_E_NOT_OK;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pStatistics))
     {
-        HAL_LPUART_OverRunInterruptConfig(pLPUARTx, enable);
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        *pStatistics = LPUART_Statistics[index];
+        LPUART_UnlockInstance(index, isIrqEnabled);
+
         status = LPUART_E_OK;
     }
 
@@ -469,20 +2757,24 @@ Std_LPUART_Status LPUART_NoiseErrorInterruptConfig(LPUART_Type *pLPUARTx, uint8_
 }
 
 /**
- * @brief This function is used to configure the LPUART Frame error interrupt
+ * @brief This function is used to clear the runtime statistics of the LPUART
  *
- * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param enable[in]: state to set
+ * @param pLPUARTx[in]: pointer to the LPUART instance
  *
  * @return Std_LPUART_Status: status of the operation
  */
-Std_LPUART_Status LPUART_FrameErrorInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+Std_LPUART_Status LPUART_ResetStatistics(LPUART_Type *pLPUARTx)
 {
     Std_LPUART_Status status = LPUART_E_NOT_OK;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
     {
-        HAL_LPUART_FrameErrorInterruptConfig(pLPUARTx, enable);
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        LPUART_Statistics[index] = (LPUART_Statistics_Type){0};
+        LPUART_UnlockInstance(index, isIrqEnabled);
+
         status = LPUART_E_OK;
     }
 
@@ -490,58 +2782,125 @@ Std_LPUART_Status LPUART_FrameErrorInterruptConfig(LPUART_Type *pLPUARTx, uint8_
 }
 
 /**
- * @brief This function is used to configure the LPUART Parity error interrupt
+ * @brief This function is used to move the LPUART clock to SIRC and arm its wake-up, before the
+ *        application enters a stop or very low power mode
+ *
+ * The receiver stays enabled on SIRC at the same baudrate, so the character that wakes the MCU is
+ * received as usual and reaches the Rx ring. The oversampling is recomputed for the sleep clock from
+ * the current bit time.
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param enable[in]: state to set
+ * @param pConfig[in]: low power reception settings
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the line is busy or the baudrate cannot be reached from
+ *         the sleep clock, the instance then stays at full speed
  */
-Std_LPUART_Status LPUART_ParityErrorInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+Std_LPUART_Status LPUART_EnterLowPower(LPUART_Type *pLPUARTx, const LPUART_LowPower_Config_Type *pConfig)
 {
     Std_LPUART_Status status = LPUART_E_NOT_OK;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && ((0 == enable) || (1 == enable)))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != pConfig) && (0 != pConfig->sleepClock))
     {
-        HAL_LPUART_ParityErrorInterruptConfig(pLPUARTx, enable);
-        status = LPUART_E_OK;
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        LPUART_LowPower_Type *pLowPower = &LPUART_LowPower[index];
+        uint32_t stat;
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        stat = HAL_LPUART_GetStatus(pLPUARTx);
+
+        /* The clock can only change with nothing on the line */
+        if((0 == pLowPower->isSleeping) && (0 != LPUART_IsTxIdle(index)) &&
+           (0 == LPUART_Buffer[index].isSwitchPending) && (0 != (stat & LPUART_STAT_TC_MASK)) &&
+           (0 == (stat & (LPUART_STAT_RAF_MASK | LPUART_STAT_RDRF_MASK))))
+        {
+            uint32_t pccIndex = LPUART_PccIndex[index];
+            uint32_t osr = ((pLPUARTx->BAUD & LPUART_BAUD_OSR_MASK) >> LPUART_BAUD_OSR_SHIFT) + 1U;
+            uint32_t sbr = (pLPUARTx->BAUD & LPUART_BAUD_SBR_MASK) >> LPUART_BAUD_SBR_SHIFT;
+            uint32_t clocksPerBitX16 = (uint32_t)(((uint64_t)pConfig->sleepClock * osr * sbr * 16U) / clock);
+
+            pLowPower->baud = pLPUARTx->BAUD;
+            pLowPower->match = pLPUARTx->MATCH;
+            pLowPower->ctrl = pLPUARTx->CTRL & (LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
+            pLowPower->source = (PeripheralClockSource)((PCC->PCCn[pccIndex] & PCC_PCCn_PCS_MASK) >> PCC_PCCn_PCS_SHIFT);
+            pLowPower->isWoken = 0;
+            pLowPower->isSleeping = 1;
+
+            HAL_LPUART_ClearTE(pLPUARTx);
+            HAL_LPUART_ClearRE(pLPUARTx);
+            PCC_De_Init(pccIndex);
+            PCC_Clock_Source_Select(pccIndex, CLOCK_OPTION_2);
+            PCC_Init(pccIndex);
+
+            if(0 != LPUART_SetBitTime(pLPUARTx, clocksPerBitX16))
+            {
+                if(LPUART_WAKE_ADDRESS_MATCH == pConfig->wakeSource)
+                {
+                    HAL_LPUART_ClearStatusFlags(pLPUARTx, LPUART_STAT_MA1F_MASK);
+                    HAL_LPUART_MatchAddressConfig(pLPUARTx, pConfig->address, 1);
+                }
+                else
+                {
+                    HAL_LPUART_ClearStatusFlags(pLPUARTx, LPUART_STAT_RXEDGIF_MASK);
+                    HAL_LPUART_RxEdgeInterruptConfig(pLPUARTx, 1);
+                }
+
+                HAL_LPUART_SetRE(pLPUARTx);
+                status = LPUART_E_OK;
+            }
+            else
+            {
+                LPUART_RestoreClock(index);
+            }
+        }
+
+        LPUART_UnlockInstance(index, isIrqEnabled);
     }
 
     return status;
 }
 
 /**
- * @brief This function is used to register the callback function for the LPUART interrupt
+ * @brief This function is used to move the LPUART clock back to its full speed source after a wake-up
+ *
+ * The switch waits for the receiver to be idle and the data register to be read, so the character
+ * that woke the MCU is never cut by the clock change.
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param IRQHandler[in]: pointer to the callback function
  *
- * @return Std_LPUART_Status: status of the operation
+ * @return Std_LPUART_Status: LPUART_E_NOT_OK if the instance is not in low power or a character is being
+ *         received, call it again once the character is in the Rx ring
  */
-Std_LPUART_Status LPUART_CallbackRegister(LPUART_Type *pLPUARTx, LPUART_CallbackPtr IRQHandler)
+Std_LPUART_Status LPUART_ExitLowPower(LPUART_Type *pLPUARTx)
 {
     Std_LPUART_Status status = LPUART_E_NOT_OK;
 
-    if(INSTANCE_IS_AVAILABLE(pLPUARTx) && (0 != IRQHandler))
+    if(INSTANCE_IS_AVAILABLE(pLPUARTx))
     {
-        if(LPUART0 == pLPUARTx)
-        {
-            LPUART_Callback[0] = IRQHandler;
-        }
-        else if(LPUART1 == pLPUARTx)
-        {
-            LPUART_Callback[1] = IRQHandler;
-        }
-        else if(LPUART2 == pLPUARTx)
-        {
-            LPUART_Callback[2] = IRQHandler;
-        }
-        else
+        uint8_t index = LPUART_GetIndex(pLPUARTx);
+        LPUART_LowPower_Type *pLowPower = &LPUART_LowPower[index];
+        uint8_t isIrqEnabled = LPUART_LockInstance(index);
+
+        if((0 != pLowPower->isSleeping) &&
+           (0 == (HAL_LPUART_GetStatus(pLPUARTx) & (LPUART_STAT_RAF_MASK | LPUART_STAT_RDRF_MASK))))
         {
-            /* Do nothing */
+            LPUART_RestoreClock(index);
+
+            if(0 != pLowPower->isWoken)
+            {
+                uint32_t cycles = LPUART_CYCLE_COUNTER() - pLowPower->wakeStamp;
+
+                LPUART_Statistics[index].wakeUps++;
+
+                if(cycles > LPUART_Statistics[index].wakeCyclesMax)
+                {
+                    LPUART_Statistics[index].wakeCyclesMax = cycles;
+                }
+            }
+
+            status = LPUART_E_OK;
         }
 
-        status = LPUART_E_OK;
+        LPUART_UnlockInstance(index, isIrqEnabled);
     }
 
     return status;
@@ -561,6 +2920,7 @@ Std_LPUART_Status LPUART_DeInit(LPUART_Type *pLPUARTx)
     if(INSTANCE_IS_AVAILABLE(pLPUARTx))
     {
         HAL_LPUART_DeInit(pLPUARTx);
+        LPUART_Buffer[LPUART_GetIndex(pLPUARTx)].isRxMatch = 0;
         status = LPUART_E_OK;
     }
 
@@ -575,42 +2935,27 @@ Std_LPUART_Status LPUART_DeInit(LPUART_Type *pLPUARTx)
  */
 void LPUART0_RxTx_IRQHandler(void)
 {
-    if(0 != LPUART_Callback[0])
-    {
-        LPUART_Callback[0]();
-    }
-    else
-    {
-        /* Do nothing */
-    }
+    TRACE_ENTER(TRACE_ID_LPUART0_IRQ);
+    LPUART_IRQHandler(0);
+    TRACE_EXIT(TRACE_ID_LPUART0_IRQ);
 }
 
 /**
- * @brief IRQ Handler for LPUART0
+ * @brief IRQ Handler for LPUART1
  */
 void LPUART1_RxTx_IRQHandler(void)
 {
-    if(0 != LPUART_Callback[1])
-    {
-        LPUART_Callback[1]();
-    }
-    else
-    {
-        /* Do nothing */
-    }
+    TRACE_ENTER(TRACE_ID_LPUART1_IRQ);
+    LPUART_IRQHandler(1);
+    TRACE_EXIT(TRACE_ID_LPUART1_IRQ);
 }
 
 /**
- * @brief IRQ Handler for LPUART0
+ * @brief IRQ Handler for LPUART2
  */
 void LPUART2_RxTx_IRQHandler(void)
 {
-    if(0 != LPUART_Callback[2])
-    {
-        LPUART_Callback[2]();
-    }
-    else
-    {
-        /* Do nothing */
-    }
+    TRACE_ENTER(TRACE_ID_LPUART2_IRQ);
+    LPUART_IRQHandler(2);
+    TRACE_EXIT(TRACE_ID_LPUART2_IRQ);
 }
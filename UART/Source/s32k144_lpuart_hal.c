@@ -104,8 +104,8 @@ void HAL_LPUART_TxDataInversionConfig(LPUART_Type *pLPUARTx, uint8_t enable)
  */
 void HAL_LPUART_RxDataInversionConfig(LPUART_Type *pLPUARTx, uint8_t enable)
 {
-    pLPUARTx->CTRL &= ~LPUART_STAT_RXINV_MASK;
-    pLPUARTx->CTRL |= LPUART_STAT_RXINV(enable);
+    LPUART_STAT_WRITE(pLPUARTx, (pLPUARTx->STAT & ~(LPUART_STAT_W1C_FLAGS | LPUART_STAT_RXINV_MASK)) |
+                                LPUART_STAT_RXINV(enable));
 }
 
 
@@ -200,53 +200,201 @@ void HAL_LPUART_SetBaudrate(LPUART_Type *pLPUARTx, uint8_t OSRVal, uint16_t SBRV
 }
 
 /**
- * @brief This function is used to send a frame of 7 or 8 bits
+ * @brief This function is used to configure the sampling on both edges of the baud clock, it is required
+ *        for oversampling ratios from 4 to 7
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param data[in]: data to send
+ * @param enable[in]: state to set
  *
  * @return void
  */
-void HAL_LPUART_TxFrame7_8(LPUART_Type *pLPUARTx, uint8_t data)
+void HAL_LPUART_BothEdgeConfig(LPUART_Type *pLPUARTx, uint8_t enable)
 {
-    while(!(pLPUARTx->STAT & LPUART_STAT_TDRE_MASK))
-    {
-        /* Do nothing */
-    }
+    pLPUARTx->BAUD = (pLPUARTx->BAUD & ~LPUART_BAUD_BOTHEDGE_MASK) | LPUART_BAUD_BOTHEDGE(enable);
+}
 
-    pLPUARTx->DATA |= data;
+/**
+ * @brief This function is used to queue a break character in the transmit stream
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return void
+ */
+void HAL_LPUART_SendBreak(LPUART_Type *pLPUARTx)
+{
+    /* Writing 1 then 0 to SBK queues one break character */
+    LPUART_BREAK_QUEUE(pLPUARTx);
+}
 
-    while(!(pLPUARTx->STAT & LPUART_STAT_TC_MASK))
-    {
-        /* Do nothing */
-    }
+/**
+ * @brief This function is used to configure the 13 bit break generation and the break detection
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPUART_BreakConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    LPUART_STAT_WRITE(pLPUARTx, (pLPUARTx->STAT & ~(LPUART_STAT_W1C_FLAGS | LPUART_STAT_BRK13_MASK |
+                                                    LPUART_STAT_LBKDE_MASK)) |
+                                LPUART_STAT_BRK13(enable) | LPUART_STAT_LBKDE(enable));
 }
 
 /**
- * @brief This function is used to send a frame of 9 or 10 bits
+ * @brief This function is used to configure the LPUART break detect interrupt
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
- * @param data[in]: data to send
+ * @param enable[in]: state to set
  *
  * @return void
  */
-void HAL_LPUART_TxFrame9_10(LPUART_Type *pLPUARTx, uint16_t data)
+void HAL_LPUART_BreakDetectInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
 {
-    while(!(pLPUARTx->STAT & LPUART_STAT_TDRE_MASK))
-    {
-        /* Do nothing */
-    }
+    pLPUARTx->BAUD &= ~LPUART_BAUD_LBKDIE_MASK;
+    pLPUARTx->BAUD |= LPUART_BAUD_LBKDIE(enable);
+}
+
+/**
+ * @brief This function is used to configure the LPUART Rx input active edge interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPUART_RxEdgeInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    pLPUARTx->BAUD &= ~LPUART_BAUD_RXEDGIE_MASK;
+    pLPUARTx->BAUD |= LPUART_BAUD_RXEDGIE(enable);
+}
 
-    pLPUARTx->DATA |= data;
+/**
+ * @brief This function is used to configure the idle time setting the IDLE flag, counted from the stop
+ *        bit of the last character, the receiver must be disabled
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param idleChars[in]: idle time in characters
+ *
+ * @return void
+ */
+void HAL_LPUART_IdleLineConfig(LPUART_Type *pLPUARTx, LPUART_IdleChars_Type idleChars)
+{
+    pLPUARTx->CTRL = (pLPUARTx->CTRL & ~LPUART_CTRL_IDLECFG_MASK) | LPUART_CTRL_IDLECFG(idleChars) | LPUART_CTRL_ILT_MASK;
+}
 
-    while(!(pLPUARTx->STAT & LPUART_STAT_TC_MASK))
-    {
-        /* Do nothing */
-    }
+/**
+ * @brief This function is used to configure the LPUART idle line interrupt
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPUART_IdleInterruptConfig(LPUART_Type *pLPUARTx, uint8_t enable)
+{
+    pLPUARTx->CTRL &= ~LPUART_CTRL_ILIE_MASK;
+    pLPUARTx->CTRL |= LPUART_CTRL_ILIE(enable);
 }
 
 /**
- * @brief This function is used to receive a frame
+ * @brief This function is used to configure the match interrupts, the characters matching MA1 or MA2
+ *        are received like the others and set MA1F or MA2F when they are the next data to read
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param match1[in]: character to match with MA1
+ * @param match2[in]: character to match with MA2
+ * @param enable1[in]: state to set for the MA1 interrupt
+ * @param enable2[in]: state to set for the MA2 interrupt
+ *
+ * @return void
+ */
+void HAL_LPUART_MatchInterruptConfig(LPUART_Type *pLPUARTx, uint16_t match1, uint16_t match2, uint8_t enable1,
+                                     uint8_t enable2)
+{
+    pLPUARTx->MATCH = LPUART_MATCH_MA1(match1) | LPUART_MATCH_MA2(match2);
+
+    /* Without address match enabled the data not matching are kept */
+    pLPUARTx->BAUD &= ~(LPUART_BAUD_MAEN1_MASK | LPUART_BAUD_MAEN2_MASK | LPUART_BAUD_MATCFG_MASK);
+    pLPUARTx->CTRL = (pLPUARTx->CTRL & ~(LPUART_CTRL_MA1IE_MASK | LPUART_CTRL_MA2IE_MASK)) |
+                     LPUART_CTRL_MA1IE(enable1) | LPUART_CTRL_MA2IE(enable2);
+}
+
+/**
+ * @brief This function is used to configure the Rx FIFO, the receiver must be disabled
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param enable[in]: state to set, the FIFO is flushed
+ * @param rxWater[in]: RDRF is set when the FIFO holds more data than this value, from 0 to 3
+ * @param rxIdle[in]: 0 to disable, n to also set RDRF after 2^(n-1) idle characters with data in the FIFO
+ *
+ * @return void
+ */
+void HAL_LPUART_RxFifoConfig(LPUART_Type *pLPUARTx, uint8_t enable, uint8_t rxWater, uint8_t rxIdle)
+{
+    /* The underflow and overflow flags are write 1 to clear */
+    pLPUARTx->FIFO = (pLPUARTx->FIFO & ~(LPUART_FIFO_RXFE_MASK | LPUART_FIFO_RXIDEN_MASK | LPUART_FIFO_RXUF_MASK |
+                                         LPUART_FIFO_TXOF_MASK)) |
+                     LPUART_FIFO_RXFE(enable) | LPUART_FIFO_RXIDEN(rxIdle) | LPUART_FIFO_RXFLUSH_MASK;
+    pLPUARTx->WATER = (pLPUARTx->WATER & ~LPUART_WATER_RXWATER_MASK) | LPUART_WATER_RXWATER(rxWater);
+}
+
+/**
+ * @brief This function is used to get the number of data in the Rx FIFO
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: number of data
+ */
+uint32_t HAL_LPUART_GetRxCount(LPUART_Type *pLPUARTx)
+{
+    return (pLPUARTx->WATER & LPUART_WATER_RXCOUNT_MASK) >> LPUART_WATER_RXCOUNT_SHIFT;
+}
+
+/**
+ * @brief This function is used to configure the match address 1, received data not matching it are
+ *        discarded while the match is enabled
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param address[in]: address to match
+ * @param enable[in]: state to set
+ *
+ * @return void
+ */
+void HAL_LPUART_MatchAddressConfig(LPUART_Type *pLPUARTx, uint16_t address, uint8_t enable)
+{
+    pLPUARTx->MATCH = (pLPUARTx->MATCH & ~LPUART_MATCH_MA1_MASK) | LPUART_MATCH_MA1(address);
+    pLPUARTx->BAUD = (pLPUARTx->BAUD & ~LPUART_BAUD_MAEN1_MASK) | LPUART_BAUD_MAEN1(enable);
+}
+
+/**
+ * @brief This function is used to write a frame of 7 or 8 bits, the transmit data register must be empty
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: data to send
+ *
+ * @return void
+ */
+void HAL_LPUART_TxFrame7_8(LPUART_Type *pLPUARTx, uint8_t data)
+{
+    LPUART_DATA_WRITE(pLPUARTx, data);
+}
+
+/**
+ * @brief This function is used to write a frame of 9 or 10 bits, the transmit data register must be empty
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: data to send
+ *
+ * @return void
+ */
+void HAL_LPUART_TxFrame9_10(LPUART_Type *pLPUARTx, uint16_t data)
+{
+    LPUART_DATA_WRITE(pLPUARTx, data);
+}
+
+/**
+ * @brief This function is used to read a received frame, the receive data register must be full
  *
  * @param pLPUARTx[in/out]: pointer to the LPUART instance
  *
@@ -254,12 +402,57 @@ void HAL_LPUART_TxFrame9_10(LPUART_Type *pLPUARTx, uint16_t data)
  */
 uint16_t HAL_LPUART_RxFrame(LPUART_Type *pLPUARTx)
 {
-    while(!(pLPUARTx->STAT & LPUART_STAT_RDRF_MASK))
-    {
-        /* Do nothing */
-    }
+    return (uint16_t)LPUART_DATA_READ(pLPUARTx);
+}
 
-    return pLPUARTx->DATA;
+/**
+ * @brief This function is used to read the status register of the LPUART
+ *
+ * @param pLPUARTx[in]: pointer to the LPUART instance
+ *
+ * @return uint32_t: value of the status register
+ */
+uint32_t HAL_LPUART_GetStatus(LPUART_Type *pLPUARTx)
+{
+    return pLPUARTx->STAT;
+}
+
+/**
+ * @brief This function is used to clear write 1 to clear flags of the LPUART without touching the other STAT fields
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param flags[in]: mask of the flags to clear
+ *
+ * @return void
+ */
+void HAL_LPUART_ClearStatusFlags(LPUART_Type *pLPUARTx, uint32_t flags)
+{
+    LPUART_STAT_WRITE(pLPUARTx, (pLPUARTx->STAT & ~LPUART_STAT_W1C_FLAGS) | (flags & LPUART_STAT_W1C_FLAGS));
+}
+
+/**
+ * @brief This function is used to write the data register of the LPUART without waiting
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ * @param data[in]: data to write
+ *
+ * @return void
+ */
+void HAL_LPUART_WriteData(LPUART_Type *pLPUARTx, uint16_t data)
+{
+    LPUART_DATA_WRITE(pLPUARTx, data);
+}
+
+/**
+ * @brief This function is used to read the data register of the LPUART without waiting
+ *
+ * @param pLPUARTx[in/out]: pointer to the LPUART instance
+ *
+ * @return uint16_t: received data
+ */
+uint16_t HAL_LPUART_ReadData(LPUART_Type *pLPUARTx)
+{
+    return (uint16_t)LPUART_DATA_READ(pLPUARTx);
 }
 
 /**